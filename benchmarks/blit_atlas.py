@@ -0,0 +1,79 @@
+"""Compare blitting sprites from separate surfaces and from one atlas.
+
+Creates SPRITE_COUNT small per-pixel alpha sprites, packs copies of them
+with image.pack_atlas, then times blitting every sprite onto a 1280x720
+target from both sets, with blit and with blits.
+
+    python benchmarks/blit_atlas.py [--count 1000] [--frames 50]
+"""
+
+import argparse
+import os
+import random
+import time
+
+os.environ.setdefault("SDL_VIDEODRIVER", "dummy")
+
+import pygame
+
+
+def make_sprites(count):
+    rng = random.Random(1234)
+    sprites = []
+    for _ in range(count):
+        size = (rng.randint(8, 48), rng.randint(8, 48))
+        surf = pygame.Surface(size, pygame.SRCALPHA)
+        surf.fill([rng.randrange(256) for _ in range(4)])
+        pygame.draw.circle(
+            surf, (255, 255, 255, 200), (size[0] // 2, size[1] // 2), 4
+        )
+        sprites.append(surf)
+    return sprites
+
+
+def time_frames(target, sprites, positions, frames, batched):
+    pairs = list(zip(sprites, positions))
+    start = time.perf_counter()
+    for _ in range(frames):
+        if batched:
+            target.blits(pairs, doreturn=False)
+        else:
+            for sprite, pos in pairs:
+                target.blit(sprite, pos)
+    return (time.perf_counter() - start) / frames
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--count", type=int, default=1000)
+    parser.add_argument("--frames", type=int, default=50)
+    args = parser.parse_args()
+
+    pygame.init()
+    target = pygame.Surface((1280, 720), pygame.SRCALPHA)
+    rng = random.Random(5678)
+    sprites = make_sprites(args.count)
+    positions = [(rng.randrange(1240), rng.randrange(680)) for _ in sprites]
+
+    start = time.perf_counter()
+    atlas, atlased, _ = pygame.image.pack_atlas(sprites, padding=1)
+    packing = time.perf_counter() - start
+
+    print(
+        f"{args.count} sprites, atlas {atlas.get_width()}x{atlas.get_height()} "
+        f"packed in {packing * 1000:.1f} ms"
+    )
+    for batched in (False, True):
+        name = "blits()" if batched else "blit()"
+        scattered = time_frames(target, sprites, positions, args.frames, batched)
+        packed = time_frames(target, atlased, positions, args.frames, batched)
+        print(
+            f"{name:8} scattered {scattered * 1000:7.2f} ms/frame, "
+            f"atlas {packed * 1000:7.2f} ms/frame ({scattered / packed:.2f}x)"
+        )
+
+    pygame.quit()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,70 @@
+"""Time the camera pixelformat converters on synthetic 1080p frames.
+
+Frames are random bytes in each pixelformat a webcam can deliver, converted
+the way Camera.get_image does, so no camera device is needed. The 24 bit
+surface is the default one get_image returns on Linux.
+
+    python benchmarks/camera_convert.py [--size 1920x1080] [--repeat 20]
+"""
+
+import argparse
+import os
+import time
+
+os.environ.setdefault("SDL_VIDEODRIVER", "dummy")
+
+import pygame
+from pygame import _camera
+
+# pixelformat: frame bytes per pixel
+PIXELFORMATS = {
+    "YUYV": 2,
+    "UYVY": 2,
+    "BA81": 1,
+    "YU12": 1.5,
+    "RGB3": 3,
+    "XR24": 4,
+}
+
+
+def best_of(repeat, func):
+    best = float("inf")
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func()
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--size", default="1920x1080")
+    parser.add_argument("--repeat", type=int, default=20)
+    args = parser.parse_args()
+    size = tuple(int(n) for n in args.size.split("x"))
+
+    pygame.init()
+    surfaces = {
+        "24 bit": pygame.Surface(size, depth=24),
+        "32 bit": pygame.Surface(size, depth=32),
+    }
+
+    print(f"{size[0]}x{size[1]} frames, best of {args.repeat}")
+    print(f"{'format':8} {'color':6}", *(f"{name:>10}" for name in surfaces))
+    for fourcc, bpp in PIXELFORMATS.items():
+        frame = os.urandom(int(size[0] * size[1] * bpp))
+        for color in ("RGB", "YUV"):
+            times = []
+            for surf in surfaces.values():
+                seconds = best_of(
+                    args.repeat,
+                    lambda: _camera._convert_frame(frame, fourcc, surf, color),
+                )
+                times.append(f"{seconds * 1000:7.2f} ms")
+            print(f"{fourcc:8} {color:6}", *times)
+
+    pygame.quit()
+
+
+if __name__ == "__main__":
+    main()
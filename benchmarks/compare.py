@@ -0,0 +1,86 @@
+"""Compare two suite.py result files and flag the cases that got slower.
+
+Each case's best time in NEW is divided by its best time in BASE; a case is
+a regression when it is more than THRESHOLD slower (10% by default), and an
+improvement when it is that much faster. Exits with status 1 when anything
+regressed, so it can gate CI.
+
+    python benchmarks/compare.py BASE.json NEW.json [--threshold 0.1] [--all]
+"""
+
+import argparse
+import json
+import sys
+
+# metadata that makes timings incomparable when it differs
+MACHINE_KEYS = ("machine", "processor", "cpu_count", "platform", "instruction_sets")
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        return json.load(f)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("base")
+    parser.add_argument("new")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.1,
+        help="relative slowdown counted as a regression (default 0.1)",
+    )
+    parser.add_argument(
+        "--all", action="store_true", help="also list the unchanged cases"
+    )
+    args = parser.parse_args()
+
+    base, new = load(args.base), load(args.new)
+    for key in MACHINE_KEYS:
+        if base["machine"].get(key) != new["machine"].get(key):
+            print(
+                f"warning: {key} differs ({base['machine'].get(key)!r} vs "
+                f"{new['machine'].get(key)!r}), timings may not be comparable",
+                file=sys.stderr,
+            )
+
+    base_results, new_results = base["results"], new["results"]
+    names = [name for name in new_results if name in base_results]
+    width = max(map(len, names), default=0)
+    regressions = improvements = 0
+    for name in names:
+        before = base_results[name]["best"]
+        after = new_results[name]["best"]
+        ratio = after / before if before else float("inf")
+        if ratio > 1 + args.threshold:
+            regressions += 1
+            verdict = "SLOWER"
+        elif ratio < 1 / (1 + args.threshold):
+            improvements += 1
+            verdict = "faster"
+        elif args.all:
+            verdict = ""
+        else:
+            continue
+        print(
+            f"{name:{width}} {before * 1e6:12.2f} us -> {after * 1e6:12.2f} us "
+            f"{ratio:6.2f}x {verdict}"
+        )
+
+    for label, only in (
+        ("only in base", base_results.keys() - new_results.keys()),
+        ("only in new", new_results.keys() - base_results.keys()),
+    ):
+        if only:
+            print(f"{label}: {', '.join(sorted(only))}")
+
+    print(
+        f"{len(names)} cases compared, {regressions} slower and "
+        f"{improvements} faster by more than {args.threshold:.0%}"
+    )
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
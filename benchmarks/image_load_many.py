@@ -0,0 +1,81 @@
+"""Compare loading a set of PNG assets serially and with image.load_many.
+
+Writes ASSET_COUNT generated PNGs to a temporary directory, then loads them
+with a plain image.load loop, with load_many on one thread and with
+load_many on every core.
+
+    python benchmarks/image_load_many.py [--count 500] [--size 128] [--repeat 3]
+"""
+
+import argparse
+import os
+import random
+import tempfile
+import time
+
+os.environ.setdefault("SDL_VIDEODRIVER", "dummy")
+
+import pygame
+
+
+def make_assets(directory, count, size):
+    rng = random.Random(1234)
+    paths = []
+    surf = pygame.Surface((size, size), pygame.SRCALPHA)
+    for i in range(count):
+        surf.fill((0, 0, 0, 0))
+        for _ in range(16):
+            color = [rng.randrange(256) for _ in range(4)]
+            rect = [rng.randrange(size) for _ in range(4)]
+            pygame.draw.rect(surf, color, rect)
+        path = os.path.join(directory, f"asset{i:04d}.png")
+        pygame.image.save(surf, path)
+        paths.append(path)
+    return paths
+
+
+def best_of(repeat, func):
+    best = float("inf")
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func()
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--count", type=int, default=500)
+    parser.add_argument("--size", type=int, default=128)
+    parser.add_argument("--repeat", type=int, default=3)
+    args = parser.parse_args()
+
+    pygame.init()
+    if not pygame.image.get_extended():
+        raise SystemExit("pygame was built without extended image support")
+
+    with tempfile.TemporaryDirectory() as directory:
+        paths = make_assets(directory, args.count, args.size)
+        cores = os.cpu_count() or 1
+
+        runs = [
+            ("load() loop", lambda: [pygame.image.load(p) for p in paths]),
+            ("load_many, 1 thread", lambda: pygame.image.load_many(paths, 1)),
+            (
+                f"load_many, {cores} threads",
+                lambda: pygame.image.load_many(paths, cores),
+            ),
+        ]
+
+        print(f"{args.count} PNG assets of {args.size}x{args.size}")
+        baseline = None
+        for name, func in runs:
+            seconds = best_of(args.repeat, func)
+            baseline = baseline or seconds
+            print(f"{name:24} {seconds * 1000:9.1f} ms {baseline / seconds:6.2f}x")
+
+    pygame.quit()
+
+
+if __name__ == "__main__":
+    main()
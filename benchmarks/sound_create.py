@@ -0,0 +1,53 @@
+"""Time making short Sounds from buffers, copied and with copy=False.
+
+A synth UI makes dozens of short Sounds a second from generated samples;
+this makes and drops them in a loop, the way such a UI would.
+
+    python benchmarks/sound_create.py [--ms 50] [--count 2000] [--repeat 5]
+"""
+
+import argparse
+import os
+import time
+
+os.environ.setdefault("SDL_AUDIODRIVER", "dummy")
+
+import pygame
+
+
+def best_of(repeat, func):
+    best = float("inf")
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func()
+        best = min(best, time.perf_counter() - start)
+    return best
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--ms", type=int, default=50)
+    parser.add_argument("--count", type=int, default=2000)
+    parser.add_argument("--repeat", type=int, default=5)
+    args = parser.parse_args()
+
+    pygame.mixer.init(44100, -16, 2)
+    frequency, size, channels = pygame.mixer.get_init()
+    frame = abs(size) // 8 * channels
+    data = bytearray(frequency * args.ms // 1000 * frame)
+
+    def make(copy):
+        for _ in range(args.count):
+            pygame.mixer.Sound(buffer=data, copy=copy)
+
+    print(f"{args.count} sounds of {args.ms} ms, best of {args.repeat}")
+    for copy in (True, False):
+        seconds = best_of(args.repeat, lambda: make(copy))
+        per_sound = seconds / args.count * 1e6
+        print(f"copy={copy!s:5} {seconds * 1000:8.2f} ms {per_sound:8.2f} us/sound")
+
+    pygame.mixer.quit()
+
+
+if __name__ == "__main__":
+    main()
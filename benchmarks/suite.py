@@ -0,0 +1,563 @@
+"""Time the core 2D paths and write the results as JSON.
+
+Covers blits per blend mode and surface format, fills, draw primitives,
+transforms, mask ops, rect collisions, vector math and font rendering. Every
+case builds its inputs from a fixed seed, so two runs time the same work and
+compare.py can flag the cases that got slower between them.
+
+    python benchmarks/suite.py [-k blit] [--repeat 7] [--output results.json]
+    python benchmarks/suite.py --list
+"""
+
+import argparse
+import fnmatch
+import json
+import os
+import platform
+import random
+import statistics
+import subprocess
+import sys
+import time
+
+os.environ.setdefault("SDL_VIDEODRIVER", "dummy")
+os.environ.setdefault("SDL_AUDIODRIVER", "dummy")
+
+import pygame
+
+SEED = 1234
+SIZE = (640, 480)
+
+# name: setup function returning the callable to time
+CASES = {}
+
+
+def case(name):
+    def register(setup):
+        CASES[name] = setup
+        return setup
+
+    return register
+
+
+def make_surface(size, kind, rng):
+    """A surface of the given kind filled with seeded noise."""
+    if kind == "alpha":
+        surf = pygame.Surface(size, pygame.SRCALPHA)
+    elif kind == "24":
+        surf = pygame.Surface(size, depth=24)
+    elif kind == "16":
+        surf = pygame.Surface(size, depth=16)
+    else:
+        surf = pygame.Surface(size, depth=32)
+    width, height = size
+    for _ in range(64):
+        color = [rng.randrange(256) for _ in range(4)]
+        rect = (rng.randrange(width), rng.randrange(height), width // 4, height // 4)
+        surf.fill(color, rect)
+    return surf
+
+
+def make_mask(size, rng, density=0.5):
+    mask = pygame.Mask(size)
+    width, height = size
+    for _ in range(int(width * height * density)):
+        mask.set_at((rng.randrange(width), rng.randrange(height)))
+    return mask
+
+
+# blits: onto an opaque 32 bit target, one per source format and blend mode
+
+BLIT_SOURCES = {
+    "opaque32": lambda rng: make_surface(SIZE, "32", rng),
+    "opaque24": lambda rng: make_surface(SIZE, "24", rng),
+    "opaque16": lambda rng: make_surface(SIZE, "16", rng),
+    "alpha": lambda rng: make_surface(SIZE, "alpha", rng),
+    "surfalpha": lambda rng: _with(make_surface(SIZE, "32", rng), alpha=128),
+    "colorkey": lambda rng: _with(make_surface(SIZE, "32", rng), colorkey=(0, 0, 0)),
+}
+
+BLEND_MODES = {
+    "none": 0,
+    "add": pygame.BLEND_ADD,
+    "sub": pygame.BLEND_SUB,
+    "mult": pygame.BLEND_MULT,
+    "min": pygame.BLEND_MIN,
+    "max": pygame.BLEND_MAX,
+    "rgba_add": pygame.BLEND_RGBA_ADD,
+    "rgba_mult": pygame.BLEND_RGBA_MULT,
+    "rgba_max": pygame.BLEND_RGBA_MAX,
+    "premultiplied": pygame.BLEND_PREMULTIPLIED,
+}
+
+
+def _with(surf, alpha=None, colorkey=None):
+    if alpha is not None:
+        surf.set_alpha(alpha)
+    if colorkey is not None:
+        surf.set_colorkey(colorkey)
+    return surf
+
+
+def _blit_case(source, mode):
+    def setup(rng):
+        target = make_surface(SIZE, "32", rng)
+        src = BLIT_SOURCES[source](rng)
+        if mode == "premultiplied":
+            src = src.premul_alpha()
+        flags = BLEND_MODES[mode]
+        return lambda: target.blit(src, (0, 0), special_flags=flags)
+
+    return setup
+
+
+for _source in BLIT_SOURCES:
+    for _mode in BLEND_MODES:
+        # premultiplied blending only makes sense with per pixel alpha
+        if _mode == "premultiplied" and _source != "alpha":
+            continue
+        case(f"blit/{_source}/{_mode}")(_blit_case(_source, _mode))
+
+
+@case("blit/many_sprites")
+def _(rng):
+    target = make_surface(SIZE, "32", rng)
+    sprite = make_surface((32, 32), "alpha", rng)
+    pairs = [(sprite, (rng.randrange(608), rng.randrange(448))) for _ in range(500)]
+    return lambda: target.blits(pairs, doreturn=False)
+
+
+# fills
+
+for _kind in ("32", "alpha", "24"):
+    for _mode in ("none", "add", "rgba_mult"):
+
+        def _fill_case(rng, kind=_kind, flags=BLEND_MODES[_mode]):
+            target = make_surface(SIZE, kind, rng)
+            return lambda: target.fill((40, 80, 120, 160), special_flags=flags)
+
+        case(f"fill/{_kind}/{_mode}")(_fill_case)
+
+
+@case("fill/small_rects")
+def _(rng):
+    target = make_surface(SIZE, "32", rng)
+    rects = [(rng.randrange(620), rng.randrange(460), 20, 20) for _ in range(500)]
+
+    def run():
+        for rect in rects:
+            target.fill((200, 100, 50), rect)
+
+    return run
+
+
+# draw primitives, each call draws 100 shapes
+
+
+def _points(rng, count):
+    return [(rng.randrange(SIZE[0]), rng.randrange(SIZE[1])) for _ in range(count)]
+
+
+def _draw_case(draw):
+    def setup(rng):
+        target = make_surface(SIZE, "32", rng)
+        args = [
+            (_points(rng, 2), rng.randrange(1, 60), [rng.randrange(256)] * 3)
+            for _ in range(100)
+        ]
+
+        def run():
+            for points, size, color in args:
+                draw(target, color, points, size)
+
+        return run
+
+    return setup
+
+
+DRAWS = {
+    "line": lambda s, c, p, n: pygame.draw.line(s, c, p[0], p[1]),
+    "line_wide": lambda s, c, p, n: pygame.draw.line(s, c, p[0], p[1], 8),
+    "aaline": lambda s, c, p, n: pygame.draw.aaline(s, c, p[0], p[1]),
+    "rect": lambda s, c, p, n: pygame.draw.rect(s, c, (p[0], (n, n))),
+    "rect_rounded": lambda s, c, p, n: pygame.draw.rect(
+        s, c, (p[0], (n, n)), border_radius=n // 4
+    ),
+    "circle": lambda s, c, p, n: pygame.draw.circle(s, c, p[0], n),
+    "circle_outline": lambda s, c, p, n: pygame.draw.circle(s, c, p[0], n, 3),
+    "aacircle": lambda s, c, p, n: pygame.draw.aacircle(s, c, p[0], n),
+    "ellipse": lambda s, c, p, n: pygame.draw.ellipse(s, c, (p[0], (n * 2, n))),
+    "polygon": lambda s, c, p, n: pygame.draw.polygon(
+        s, c, [p[0], p[1], (p[0][0], p[1][1])]
+    ),
+}
+
+for _name, _draw in DRAWS.items():
+    case(f"draw/{_name}")(_draw_case(_draw))
+
+
+# transforms of a 640x480 surface
+
+
+def _transform_case(kind, func):
+    def setup(rng):
+        surf = make_surface(SIZE, kind, rng)
+        return lambda: func(surf)
+
+    return setup
+
+
+TRANSFORMS = {
+    "scale_up": lambda s: pygame.transform.scale(s, (1280, 960)),
+    "scale_down": lambda s: pygame.transform.scale(s, (320, 240)),
+    "smoothscale_up": lambda s: pygame.transform.smoothscale(s, (1280, 960)),
+    "smoothscale_down": lambda s: pygame.transform.smoothscale(s, (320, 240)),
+    "scale_by": lambda s: pygame.transform.scale_by(s, 1.5),
+    "rotate_30": lambda s: pygame.transform.rotate(s, 30),
+    "rotate_90": lambda s: pygame.transform.rotate(s, 90),
+    "rotozoom": lambda s: pygame.transform.rotozoom(s, 30, 0.75),
+    "flip": lambda s: pygame.transform.flip(s, True, True),
+    "grayscale": pygame.transform.grayscale,
+    "invert": pygame.transform.invert,
+    "box_blur": lambda s: pygame.transform.box_blur(s, 4),
+    "gaussian_blur": lambda s: pygame.transform.gaussian_blur(s, 4),
+    "laplacian": pygame.transform.laplacian,
+}
+
+for _kind in ("32", "alpha"):
+    for _name, _func in TRANSFORMS.items():
+        case(f"transform/{_kind}/{_name}")(_transform_case(_kind, _func))
+
+
+# masks
+
+
+@case("mask/from_surface")
+def _(rng):
+    surf = make_surface(SIZE, "alpha", rng)
+    return lambda: pygame.mask.from_surface(surf)
+
+
+@case("mask/from_threshold")
+def _(rng):
+    surf = make_surface(SIZE, "32", rng)
+    return lambda: pygame.mask.from_threshold(surf, (128, 128, 128), (64, 64, 64))
+
+
+@case("mask/overlap")
+def _(rng):
+    big = make_mask(SIZE, rng, 0.05)
+    small = make_mask((64, 64), rng)
+    offsets = _points(rng, 100)
+
+    def run():
+        for offset in offsets:
+            big.overlap(small, offset)
+
+    return run
+
+
+@case("mask/overlap_area")
+def _(rng):
+    big = make_mask(SIZE, rng)
+    small = make_mask((64, 64), rng)
+    offsets = _points(rng, 100)
+
+    def run():
+        for offset in offsets:
+            big.overlap_area(small, offset)
+
+    return run
+
+
+@case("mask/connected_components")
+def _(rng):
+    mask = make_mask((256, 256), rng, 0.3)
+    return mask.connected_components
+
+
+@case("mask/outline")
+def _(rng):
+    mask = make_mask((256, 256), rng, 0.3)
+    return mask.outline
+
+
+@case("mask/to_surface")
+def _(rng):
+    mask = make_mask(SIZE, rng)
+    return mask.to_surface
+
+
+# rect collisions, against 1000 rects
+
+
+def _rects(rng, count):
+    return [
+        pygame.Rect(rng.randrange(1000), rng.randrange(1000), 20, 20)
+        for _ in range(count)
+    ]
+
+
+@case("rect/colliderect")
+def _(rng):
+    rects = _rects(rng, 1000)
+    probe = pygame.Rect(500, 500, 40, 40)
+
+    def run():
+        for rect in rects:
+            probe.colliderect(rect)
+
+    return run
+
+
+@case("rect/collidelistall")
+def _(rng):
+    rects = _rects(rng, 1000)
+    probes = _rects(rng, 100)
+
+    def run():
+        for probe in probes:
+            probe.collidelistall(rects)
+
+    return run
+
+
+@case("rect/collidedictall")
+def _(rng):
+    rects = {i: rect for i, rect in enumerate(_rects(rng, 1000))}
+    probes = _rects(rng, 100)
+
+    def run():
+        for probe in probes:
+            probe.collidedictall(rects, 1)
+
+    return run
+
+
+@case("rect/unionall")
+def _(rng):
+    rects = _rects(rng, 1000)
+    probe = pygame.Rect(0, 0, 1, 1)
+    return lambda: probe.unionall(rects)
+
+
+@case("rect/frect_collidelistall")
+def _(rng):
+    rects = [pygame.FRect(rect) for rect in _rects(rng, 1000)]
+    probes = [pygame.FRect(rect) for rect in _rects(rng, 100)]
+
+    def run():
+        for probe in probes:
+            probe.collidelistall(rects)
+
+    return run
+
+
+# vector math, 1000 vectors per call
+
+
+def _vectors(rng, count):
+    return [
+        pygame.Vector2(rng.uniform(-100, 100), rng.uniform(-100, 100))
+        for _ in range(count)
+    ]
+
+
+@case("math/vector2_arith")
+def _(rng):
+    vectors = _vectors(rng, 1000)
+    offset = pygame.Vector2(1.5, -2.5)
+
+    def run():
+        for vector in vectors:
+            (vector + offset) * 0.5 - offset
+
+    return run
+
+
+@case("math/vector2_normalize")
+def _(rng):
+    vectors = _vectors(rng, 1000)
+
+    def run():
+        for vector in vectors:
+            vector.normalize()
+
+    return run
+
+
+@case("math/vector2_rotate")
+def _(rng):
+    vectors = _vectors(rng, 1000)
+
+    def run():
+        for vector in vectors:
+            vector.rotate(33.0)
+
+    return run
+
+
+@case("math/vector2_distance")
+def _(rng):
+    vectors = _vectors(rng, 1000)
+    origin = pygame.Vector2(10, 20)
+
+    def run():
+        for vector in vectors:
+            vector.distance_to(origin)
+
+    return run
+
+
+@case("math/vector3_cross")
+def _(rng):
+    vectors = [pygame.Vector3(v.x, v.y, v.x - v.y) for v in _vectors(rng, 1000)]
+    axis = pygame.Vector3(0, 0, 1)
+
+    def run():
+        for vector in vectors:
+            vector.cross(axis)
+
+    return run
+
+
+# font rendering with the default font
+
+TEXT = "The quick brown fox jumps over the lazy dog 0123456789"
+
+
+def _font_case(size, antialias, background=None, wraplength=0):
+    def setup(rng):
+        if not pygame.font.get_init():
+            pygame.font.init()
+        font = pygame.font.Font(None, size)
+        color = (255, 255, 255)
+        return lambda: font.render(TEXT, antialias, color, background, wraplength)
+
+    return setup
+
+
+case("font/render_aa")(_font_case(24, True))
+case("font/render_solid")(_font_case(24, False))
+case("font/render_shaded")(_font_case(24, True, (0, 0, 0)))
+case("font/render_large")(_font_case(96, True))
+case("font/render_wrapped")(_font_case(24, True, wraplength=200))
+
+
+def _autorange(func, min_time):
+    """How many calls of func take at least min_time seconds."""
+    number = 1
+    while True:
+        start = time.perf_counter()
+        for _ in range(number):
+            func()
+        if time.perf_counter() - start >= min_time:
+            return number
+        number *= 2
+
+
+def run_case(func, repeat, min_time):
+    number = _autorange(func, min_time)
+    times = []
+    for _ in range(repeat):
+        start = time.perf_counter()
+        for _ in range(number):
+            func()
+        times.append((time.perf_counter() - start) / number)
+    return {
+        "best": min(times),
+        "median": statistics.median(times),
+        "stdev": statistics.stdev(times) if len(times) > 1 else 0.0,
+        "number": number,
+        "repeat": repeat,
+    }
+
+
+def machine_info():
+    info = {
+        "python": platform.python_version(),
+        "implementation": platform.python_implementation(),
+        "platform": platform.platform(),
+        "machine": platform.machine(),
+        "processor": platform.processor(),
+        "cpu_count": os.cpu_count(),
+        "pygame": pygame.version.ver,
+        "sdl": ".".join(map(str, pygame.get_sdl_version())),
+        "instruction_sets": sorted(
+            name
+            for name, present in pygame.system.get_cpu_instruction_sets().items()
+            if present
+        ),
+        "time": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+    }
+    try:
+        info["commit"] = subprocess.run(
+            ["git", "rev-parse", "HEAD"],
+            capture_output=True,
+            text=True,
+            check=True,
+            cwd=os.path.dirname(os.path.abspath(__file__)),
+        ).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        pass
+    return info
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "-k",
+        dest="patterns",
+        action="append",
+        default=[],
+        help="only run cases matching this glob or substring (repeatable)",
+    )
+    parser.add_argument("--repeat", type=int, default=7)
+    parser.add_argument(
+        "--min-time",
+        type=float,
+        default=0.05,
+        help="seconds each repeat runs for at least",
+    )
+    parser.add_argument("--output", "-o", help="JSON file to write the results to")
+    parser.add_argument("--list", action="store_true", help="list the cases and exit")
+    args = parser.parse_args()
+
+    names = [
+        name
+        for name in CASES
+        if not args.patterns
+        or any(p in name or fnmatch.fnmatchcase(name, p) for p in args.patterns)
+    ]
+    if args.list:
+        print("\n".join(names))
+        return
+
+    pygame.init()
+    # some paths convert to the display format, so give them one
+    pygame.display.set_mode((1, 1))
+
+    results = {}
+    width = max(map(len, names), default=0)
+    for name in names:
+        # a fresh seed per case keeps inputs the same when run with -k
+        func = CASES[name](random.Random(f"{SEED}:{name}"))
+        result = run_case(func, args.repeat, args.min_time)
+        results[name] = result
+        print(
+            f"{name:{width}} {result['best'] * 1e6:12.2f} us "
+            f"(median {result['median'] * 1e6:.2f} us)",
+            flush=True,
+        )
+
+    machine = machine_info()
+    pygame.quit()
+
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            json.dump({"machine": machine, "results": results}, f, indent=2)
+        print(f"wrote {len(results)} results to {args.output}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -5,7 +5,10 @@ from pygame.rect import Rect
 from pygame.surface import Surface
 from pygame.typing import ColorLike, IntPoint, Point, RectLike, SequenceLike
 from pygame.window import Window
-from typing_extensions import deprecated  # added in 3.13
+from typing_extensions import (
+    Buffer,  # collections.abc 3.12
+    deprecated,  # added in 3.13
+)
 
 class _DrawableClass(Protocol):
     # Object that has the draw method that accepts area and dest arguments
@@ -25,20 +28,29 @@ class Renderer:
     ) -> None: ...
     def blit(
         self,
-        source: Union["Texture", "Image", _DrawableClass],
+        source: Union["Texture", "Image", Surface, _DrawableClass],
         dest: Optional[RectLike] = None,
         area: Optional[RectLike] = None,
         special_flags: int = 0,
     ) -> Rect: ...
     def clear(self) -> None: ...
+    def draw_geometry(
+        self,
+        vertices: Buffer,
+        indices: Optional[Buffer] = None,
+        texture: Union["Texture", Surface, None] = None,
+    ) -> None: ...
     def draw_line(self, p1: Point, p2: Point) -> None: ...
+    def draw_lines(self, points: Buffer) -> None: ...
     def draw_point(self, point: Point) -> None: ...
     def draw_quad(self, p1: Point, p2: Point, p3: Point, p4: Point) -> None: ...
     def draw_rect(self, rect: RectLike) -> None: ...
     def draw_triangle(self, p1: Point, p2: Point, p3: Point) -> None: ...
     def fill_quad(self, p1: Point, p2: Point, p3: Point, p4: Point) -> None: ...
     def fill_rect(self, rect: RectLike) -> None: ...
+    def fill_rects(self, rects: Buffer) -> None: ...
     def fill_triangle(self, p1: Point, p2: Point, p3: Point) -> None: ...
+    def get_upload_stats(self) -> tuple[int, int]: ...
     def get_viewport(self) -> Rect: ...
     def present(self) -> None: ...
     def set_viewport(self, area: Optional[RectLike]) -> None: ...
@@ -1,3 +1,4 @@
+import sys
 from abc import ABC, abstractmethod
 from typing import Literal, Optional, Union
 
@@ -27,6 +28,20 @@ class AbstractCamera(ABC):
     def get_image(self, dest_surf: Optional[Surface] = None) -> Surface: ...
     @abstractmethod
     def get_raw(self) -> bytes: ...
+    def get_raw_view(self) -> RawView: ...
+
+class RawView:
+    @property
+    def sequence(self) -> int: ...
+    @property
+    def released(self) -> bool: ...
+    def release(self) -> None: ...
+    def to_surface(self, surface: Optional[Surface] = None) -> Surface: ...
+    def __enter__(self) -> RawView: ...
+    def __exit__(self, *args, **kwargs) -> None: ...
+    if sys.version_info >= (3, 12):
+        def __buffer__(self, flags: int, /) -> memoryview[int]: ...
+        def __release_buffer__(self, view: memoryview[int], /) -> None: ...
     # set_controls and get_controls are not a part of the AbstractCamera ABC,
     # because implementations of the same can vary across different Camera
     # types
@@ -51,3 +66,17 @@ class Camera(AbstractCamera):
     def query_image(self) -> bool: ...
     def get_image(self, surface: Optional[Surface] = None) -> Surface: ...
     def get_raw(self) -> bytes: ...
+    def get_raw_view(self) -> RawView: ...
+
+class RawView:
+    @property
+    def sequence(self) -> int: ...
+    @property
+    def released(self) -> bool: ...
+    def release(self) -> None: ...
+    def to_surface(self, surface: Optional[Surface] = None) -> Surface: ...
+    def __enter__(self) -> RawView: ...
+    def __exit__(self, *args, **kwargs) -> None: ...
+    if sys.version_info >= (3, 12):
+        def __buffer__(self, flags: int, /) -> memoryview[int]: ...
+        def __release_buffer__(self, view: memoryview[int], /) -> None: ...
@@ -59,6 +59,7 @@ from pygame.constants import FULLSCREEN
 from pygame.surface import Surface
 from pygame.typing import (
     ColorLike,
+    FileLike,
     IntPoint,
     Point,
     RectLike,
@@ -334,12 +335,39 @@ def update(*args):  # type: ignore
     to update.
 
     If passing an iterable of rectangles it is safe to include None
-    values in the list, which will be skipped.
+    values in the list, which will be skipped. Rectangles are merged where their
+    union is no bigger than the two of them, as when they overlap or touch.
+
+    With ``pygame.SCALED`` displays, only the given rectangles of the display
+    surface are uploaded to the window's texture; the rest of the window shows
+    what was last updated there. The window is presented even when no
+    rectangle is on screen.
 
     This call cannot be used on ``pygame.OPENGL`` displays and will generate an
     exception.
 
     .. versionchanged:: 2.5.1 Added support for passing an iterable, previously only sequence was allowed
+
+    .. versionchanged:: 2.5.6 ``pygame.SCALED`` displays upload only the
+        updated rectangles, instead of the whole display surface.
+    """
+
+def get_present_stats(reset: bool = False) -> dict[str, float]:
+    """Get timings of presented frames.
+
+    SDL only lets the thread that made the display present it, so
+    ``flip()`` and ``update()`` return once the frame is presented, which
+    with vsync includes the wait for it. Returns a dict about the frames
+    presented through a renderer, made with ``pygame.SCALED`` or
+    ``vsync=1``, since the stats were last reset:
+
+    * ``"frames"``: how many frames were presented
+    * ``"latency"``, ``"max_latency"``: the average and longest time in
+      milliseconds that uploading and presenting a frame took
+
+    Pass ``reset=True`` to start counting again after reading them.
+
+    .. versionadded:: 2.5.6
     """
 
 def get_driver() -> str:
@@ -863,3 +891,125 @@ def message_box(
 
     .. versionadded:: 2.4.0
     """
+
+class Recorder:
+    """Record the display to a video file.
+
+    :param file: A path, or a file object opened for binary writing, such as
+                 the ``stdin`` of an encoder started with :mod:`subprocess`.
+                 File objects are closed along with the Recorder.
+    :param int fps: The frame rate written to the ``Y4M`` header.
+    :param str format: ``"y4m"`` for a YUV4MPEG2 stream, which most video
+                       tools read directly, or ``"i420"`` for bare frames
+                       with no headers.
+    :param int buffers: How many frames can wait to be written.
+    :param bool block: What to do when ``buffers`` frames are already
+                       waiting: wait for the oldest to be written, or drop the
+                       new frame.
+
+    Each frame is converted to full range YUV 4:2:0 as it is captured,
+    straight from the Surface into one of the Recorder's buffers, and a
+    background thread writes the buffers out. Capturing a frame therefore
+    costs far less than ``tobytes()`` followed by a write from Python, and a
+    slow disk or encoder does not hold up the game unless every buffer is
+    full. Odd frame sizes are supported; the chroma planes are rounded up.
+
+    The size of the first frame becomes the size of the recording. Later
+    frames of a different size are dropped when captured automatically, and
+    rejected by :meth:`capture`.
+
+    Recording works with the ``dummy`` video driver, so frames can be
+    captured on machines without a screen. It does not work with ``OPENGL``
+    displays, whose contents are not in the display Surface.
+
+    .. code-block:: python
+
+        import subprocess
+        import pygame
+
+        screen = pygame.display.set_mode((1280, 720))
+        ffmpeg = subprocess.Popen(
+            ["ffmpeg", "-y", "-i", "-", "gameplay.mp4"], stdin=subprocess.PIPE
+        )
+        with pygame.display.Recorder(ffmpeg.stdin, fps=60) as recorder:
+            recorder.start()
+            ...  # the game loop, which calls pygame.display.flip()
+        ffmpeg.wait()
+
+    .. versionadded:: 2.5.6
+    """
+
+    def __init__(
+        self,
+        file: FileLike,
+        fps: int = 60,
+        format: Literal["y4m", "i420"] = "y4m",
+        buffers: int = 4,
+        block: bool = True,
+    ) -> None: ...
+    def __enter__(self) -> Recorder: ...
+    def __exit__(self, *args, **kwargs) -> None: ...
+    def start(self) -> None:
+        """Record the display after every flip() and update().
+
+        From now on, each call to :func:`pygame.display.flip()` or
+        :func:`pygame.display.update()` captures the display Surface once it
+        has been presented. Only one Recorder can do this at a time; starting
+        a second one raises :exc:`pygame.error`. Quitting the display stops
+        it.
+        """
+
+    def stop(self) -> None:
+        """Stop recording the display after every flip() and update().
+
+        Frames already captured are still written. :meth:`capture` can still
+        be used.
+        """
+
+    def capture(self, surface: Optional[Surface] = None) -> None:
+        """Add a frame to the recording.
+
+        Convert ``surface``, or the display Surface when it is ``None``, and
+        queue it to be written. Raises :exc:`ValueError` if its size is not
+        the size of the recording, and :exc:`pygame.error` if writing an
+        earlier frame failed.
+        """
+
+    def close(self) -> None:
+        """Finish writing the recording and close the file.
+
+        Waits for every captured frame to be written, then closes the file.
+        Raises :exc:`pygame.error` if any frame could not be written. Called
+        when leaving a ``with`` block, and when the Recorder is garbage
+        collected.
+        """
+
+    @property
+    def frames(self) -> int:
+        """The number of frames recorded.
+
+        Frames are counted when they are captured, which may be a little
+        before they are written.
+        """
+
+    @property
+    def dropped(self) -> int:
+        """The number of frames dropped.
+
+        Counts frames left out because every buffer was full with
+        ``block=False``, or because they were not the size of the recording.
+        """
+
+    @property
+    def size(self) -> Optional[tuple[int, int]]:
+        """The size of the recorded frames.
+
+        ``None`` until the first frame is captured.
+        """
+
+    @property
+    def recording(self) -> bool:
+        """Whether the display is being recorded.
+
+        ``True`` between :meth:`start` and :meth:`stop`.
+        """
@@ -1,4 +1,5 @@
-from typing import Any, ClassVar, Optional, Union, final
+import sys
+from typing import Any, ClassVar, Literal, Optional, Union, final
 
 from pygame.typing import SequenceLike
 from typing_extensions import deprecated  # added in 3.13
@@ -33,6 +34,14 @@ class Event(_GenericEvent):
 class EventType(_GenericEvent):
     pass
 
+@final
+class EventBuffer:
+    @property
+    def format(self) -> str: ...
+    def __len__(self) -> int: ...
+    if sys.version_info >= (3, 12):
+        def __buffer__(self, flags: int, /) -> memoryview: ...
+
 _EventTypes = Union[int, SequenceLike[int]]
 
 def pump() -> None: ...
@@ -41,6 +50,12 @@ def get(
     pump: bool = True,
     exclude: Optional[_EventTypes] = None,
 ) -> list[Event]: ...
+def get_buffer(
+    eventtype: Optional[_EventTypes] = None,
+    pump: bool = True,
+    coalesce: bool = False,
+    buffer: Optional[EventBuffer] = None,
+) -> EventBuffer: ...
 def poll() -> Event: ...
 def wait(timeout: int = 0) -> Event: ...
 def peek(eventtype: Optional[_EventTypes] = None, pump: bool = True) -> bool: ...
@@ -53,3 +68,9 @@ def set_grab(grab: bool, /) -> None: ...
 def get_grab() -> bool: ...
 def post(event: Event, /) -> bool: ...
 def custom_type() -> int: ...
+def set_coalesce(
+    eventtype: _EventTypes,
+    policy: Optional[Literal["latest", "accumulate", "limit"]] = None,
+    limit: int = 0,
+) -> None: ...
+def get_coalesce_stats(reset: bool = False) -> tuple[int, int]: ...
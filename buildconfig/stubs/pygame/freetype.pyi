@@ -1,4 +1,4 @@
-from collections.abc import Callable, Iterable
+from collections.abc import Callable, Iterable, Sequence
 from typing import Any, Optional, Union
 
 from pygame.color import Color
@@ -164,6 +164,16 @@ class Font:
         rotation: int = 0,
         size: float = 0,
     ) -> tuple[Surface, Rect]: ...
+    def render_many(
+        self,
+        texts: Sequence[Union[str, bytes]],
+        fgcolor: Optional[ColorLike] = None,
+        bgcolor: Optional[ColorLike] = None,
+        style: int = STYLE_DEFAULT,
+        rotation: int = 0,
+        size: float = 0,
+        threads: int = 0,
+    ) -> list[tuple[Surface, Rect]]: ...
     def render_to(
         self,
         surf: Surface,
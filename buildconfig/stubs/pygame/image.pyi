@@ -62,11 +62,14 @@ following formats.
 .. versionaddedold:: 1.8 Saving PNG and JPEG files.
 """
 
+from collections.abc import Mapping, Sequence
+from concurrent.futures import Future
 from typing import Literal, Optional, Union
 
 from pygame.bufferproxy import BufferProxy
+from pygame.rect import Rect
 from pygame.surface import Surface
-from pygame.typing import FileLike, IntPoint, Point
+from pygame.typing import FileLike, IntPoint, Point, _PathLike
 from typing_extensions import (
     Buffer,  # collections.abc 3.12
     deprecated,  # added in 3.13
@@ -78,7 +81,12 @@ _to_bytes_format = Literal[
 ]
 _from_bytes_format = Literal["P", "RGB", "RGBX", "RGBA", "ARGB", "BGRA", "ABGR"]
 
-def load(file: FileLike, namehint: str = "") -> Surface:
+def load(
+    file: FileLike,
+    namehint: str = "",
+    format: Optional[Surface] = None,
+    premultiply: bool = False,
+) -> Surface:
     """Load new image from a file (or file-like object).
 
     Load an image from a file source. You can pass either a filename, a Python
@@ -110,7 +118,84 @@ def load(file: FileLike, namehint: str = "") -> Surface:
 
         eg. asurf = pygame.image.load(os.path.join('data', 'bla.png'))
 
+    If ``format`` is given, it must be a Surface, and the image is converted to
+    that Surface's pixel format right after it is decoded, still without
+    holding the GIL. Passing the display surface gives the same result as
+    calling :meth:`pygame.Surface.convert()` on the loaded image, while a
+    32-bit ``SRCALPHA`` surface stands in for
+    :meth:`pygame.Surface.convert_alpha()`, but the decoded copy is freed
+    straight away instead of being kept until the converted one is made.
+
+    If ``premultiply`` is ``True``, the colors of the image are multiplied by
+    its alpha as with :meth:`pygame.Surface.premul_alpha()`, after any
+    conversion. Images without alpha are returned unchanged.
+
+    ::
+
+        screen = pygame.display.set_mode((640, 480))
+        background = pygame.image.load('background.jpg', format=screen)
+
     .. versionchanged:: 2.2.0 Now supports keyword arguments.
+    .. versionchanged:: 2.5.6 Added the ``format`` and ``premultiply``
+        arguments.
+    """
+
+def load_many(
+    files: Sequence[FileLike],
+    threads: int = 0,
+    format: Optional[Surface] = None,
+    premultiply: bool = False,
+) -> list[Surface]:
+    """Load many images in parallel on worker threads.
+
+    Load every image in the ``files`` sequence and return a list of Surfaces in
+    the same order. Each item can be anything :func:`pygame.image.load()`
+    accepts as its ``file`` argument; the file type is taken from the file name
+    extension or, for file-like objects, detected from the data.
+
+    The images are decoded by a pool of native worker threads that run without
+    the GIL, so a level's worth of assets loads several times faster than
+    calling :func:`pygame.image.load()` in a loop. ``threads`` sets the size of
+    the pool; the default of ``0`` uses one thread per CPU core. Every file is
+    read through its own stream, though file-like objects still need the GIL to
+    read and so gain less than paths.
+
+    ``format`` and ``premultiply`` work as they do for
+    :func:`pygame.image.load()`, with each image converted by the worker that
+    decoded it. Passing the display surface this way saves converting every
+    image on the main thread afterwards.
+
+    If any image cannot be loaded, ``pygame.error`` is raised and none of the
+    Surfaces are returned.
+
+    .. versionadded:: 2.5.6
+    """
+
+def load_async(
+    file: FileLike,
+    namehint: str = "",
+    format: Optional[Surface] = None,
+    premultiply: bool = False,
+) -> Future[Surface]:
+    """Load an image in the background.
+
+    Start loading an image as :func:`pygame.image.load()` would and return
+    immediately with a :class:`concurrent.futures.Future`. Its ``result()`` is
+    the loaded Surface, or raises the error that loading it raised.
+
+    Images are loaded by a pool of threads shared by all calls, with one
+    thread per CPU core, and decoding does not hold the GIL, so the game can
+    keep running while they load. Use :func:`pygame.image.load_many()` to load
+    a known list of images at once.
+
+    ::
+
+        future = pygame.image.load_async(os.path.join('data', 'level2.png'))
+        ...
+        if future.done():
+            background = future.result()
+
+    .. versionadded:: 2.5.6
     """
 
 def load_sized_svg(file: FileLike, size: Point) -> Surface:
@@ -177,6 +262,33 @@ def save(surface: Surface, file: FileLike, namehint: str = "") -> None:
     .. versionchanged:: 2.2.0 Now supports keyword arguments.
     """
 
+def save_async(
+    surface: Surface, file: _PathLike, block: bool = True
+) -> Future[None]:
+    """Save an image to a file in the background.
+
+    Save the Surface the same way :func:`save()` does, choosing the format
+    from the filename extension, without holding up the caller while the
+    image is encoded and written. A copy of the pixels is taken before this
+    returns, so the Surface can be drawn to again straight away; the copy is
+    then encoded on a worker thread and written out as it is encoded. This
+    makes it practical to capture frames of a running game to disk.
+
+    Returns a :class:`concurrent.futures.Future` that resolves to ``None``
+    once the file is written, or raises :exc:`pygame.error` if writing it
+    failed. Saves are written in the order they were made.
+
+    At most 8 saves can be waiting to be written. When that many are
+    waiting, ``block=True`` waits for one of them to finish, while
+    ``block=False`` drops this save and raises :exc:`pygame.error` instead,
+    so a game loop never stalls on a slow disk.
+
+    Only file paths are accepted, not file-like objects. Saves still waiting
+    when the interpreter exits are written out before it does.
+
+    .. versionadded:: 2.5.6
+    """
+
 def get_sdl_image_version(linked: bool = True) -> Optional[tuple[int, int, int]]:
     """Get version number of the SDL_Image library being used.
 
@@ -271,6 +383,31 @@ def tobytes(
     .. versionchanged:: 2.5.1 Added support for ABGR image format
     """
 
+def tobytes_into(
+    surface: Surface,
+    buffer: Buffer,
+    format: _to_bytes_format,
+    flipped: bool = False,
+    pitch: int = -1,
+) -> int:
+    """Transfer image into a writable buffer.
+
+    Works like :func:`pygame.image.tobytes()`, but writes the pixel data into
+    ``buffer`` instead of returning a new bytes object. The buffer can be a
+    bytearray, a writable memoryview, a NumPy array, or any other object that
+    supports the writable buffer protocol. Reusing one buffer avoids an
+    allocation per frame when the image data is streamed, for example to a
+    video encoder.
+
+    The buffer must hold at least ``pitch * surface.get_height()`` bytes, or a
+    ``ValueError`` is raised; any bytes after that are left alone. Returns the
+    number of bytes written.
+
+    Large surfaces are converted on several threads, without holding the GIL.
+
+    .. versionadded:: 2.5.6
+    """
+
 @deprecated("since 2.3.0. Use `pygame.image.frombytes` instead")
 def fromstring(
     bytes: bytes,
@@ -364,6 +501,93 @@ def frombuffer(
     .. versionadded:: 2.1.4 Added a 'pitch' argument and support for keyword arguments.
     """
 
+def load_mapped(file: FileLike) -> dict[str, Surface]:
+    """Load the surfaces of a mapped surface file without copying them.
+
+    Load a file written by :func:`pygame.image.save_mapped()` and return a
+    dictionary of its Surfaces by name, in the order they were saved. ``file``
+    can be a filename, a pathlib.Path or a file object with a ``fileno()``.
+
+    The file is memory mapped, and uncompressed Surfaces use the mapped pages
+    as their pixels, so nothing is decoded or copied up front: pixels are read
+    from disk by the operating system when they are first used. The mapping is
+    copy-on-write, so drawing on one of these Surfaces changes only the memory
+    of the program, never the file. The mapping is released when the last of
+    its Surfaces is garbage collected.
+
+    Surfaces that were saved compressed are expanded into ordinary Surfaces
+    while loading.
+
+    .. versionadded:: 2.5.6
+    """
+
+def save_mapped(
+    surfaces: Mapping[str, Surface], file: FileLike, compress: bool = False
+) -> None:
+    """Save named surfaces to a mapped surface file.
+
+    Write every Surface of the ``surfaces`` mapping, under its name, to a
+    single file that :func:`pygame.image.load_mapped()` can map back into
+    memory. ``file`` can be a filename, a pathlib.Path or a Python file-like
+    object.
+
+    The file holds the raw pixels of each Surface in its own pixel format,
+    together with its palette, colorkey, surface alpha and whether it uses
+    alpha blending, so loaded Surfaces are ready to blit without conversion.
+    Convert them to the display format before saving for the fastest blits.
+    The pixel data of each Surface starts on a page boundary.
+
+    With ``compress=True`` rows are stored run-length encoded, which suits
+    sprites with large uniform or transparent areas. Such Surfaces cannot be
+    mapped and are expanded when loaded.
+
+    The file stores pixels in the byte order of the machine that wrote it and
+    cannot be loaded on one with a different byte order.
+
+    ::
+
+        pygame.image.save_mapped({'player': player, 'tiles': tiles}, 'level1.pgs')
+        sprites = pygame.image.load_mapped('level1.pgs')
+
+    .. versionadded:: 2.5.6
+    """
+
+def pack_atlas(
+    surfaces: Sequence[Surface], max_size: Point = (4096, 4096), padding: int = 0
+) -> tuple[Surface, list[Surface], list[Rect]]:
+    """Pack many small surfaces into one atlas surface.
+
+    Copy every Surface of the ``surfaces`` sequence into a single new atlas
+    Surface, no larger than ``max_size``, and return a tuple of the atlas, a
+    list of subsurfaces of the atlas and a list of the Rects they occupy in
+    it. Both lists are in the order of ``surfaces``, and every subsurface holds
+    the same pixels as the Surface it replaces.
+
+    Blitting many sprites that live in one atlas reads from a single compact
+    block of memory, which is friendlier to the CPU caches than hundreds of
+    separately allocated Surfaces. The atlas is also convenient to upload as a
+    single texture.
+
+    The surfaces are placed with a skyline bottom-left packer, tallest first,
+    and the atlas is cropped to the area they use. ``padding`` pixels are left
+    empty between neighbours. If they do not all fit within ``max_size``, a
+    ``ValueError`` is raised.
+
+    The atlas has the pixel format, colorkey and blend mode of the first
+    Surface; any others in a different pixel format are converted to it.
+    Convert all the surfaces (for instance with
+    :meth:`pygame.Surface.convert_alpha()`) beforehand for a predictable
+    result. Empty space in the atlas is filled with the colorkey if there is
+    one, and is otherwise zero, which is transparent for surfaces with per
+    pixel alpha.
+
+    ::
+
+        atlas, sprites, rects = pygame.image.pack_atlas(sprites, padding=1)
+
+    .. versionadded:: 2.5.6
+    """
+
 def load_basic(file: FileLike, /) -> Surface:
     """Load new BMP image from a file (or file-like object).
 
@@ -1,5 +1,6 @@
 import sys
-from typing import Any, Optional, Union, overload
+from collections.abc import Iterable
+from typing import Any, Literal, Optional, Union, overload
 
 from pygame.event import Event
 from pygame.typing import FileLike
@@ -43,13 +44,17 @@ def find_channel(force: bool = False) -> Channel: ...
 def set_soundfont(paths: Optional[str] = None, /) -> None: ...
 def get_soundfont() -> Optional[str]: ...
 def get_busy() -> bool: ...
+def set_effects(effects: Iterable[Effect] = ()) -> None: ...
+def get_effects() -> tuple[Effect, ...]: ...
 def get_sdl_mixer_version(linked: bool = True) -> tuple[int, int, int]: ...
 
 class Sound:
     @overload
     def __init__(self, file: FileLike) -> None: ...
     @overload
-    def __init__(self, buffer: Buffer) -> None: ...
+    def __init__(self, buffer: Buffer, *, copy: bool = True) -> None: ...
+    @overload
+    def __init__(self, *, array: Buffer, copy: bool = True) -> None: ...
     def play(
         self,
         loops: int = 0,
@@ -72,6 +77,7 @@ class Sound:
     def get_num_channels(self) -> int: ...
     def get_length(self) -> float: ...
     def get_raw(self) -> bytes: ...
+    def apply_effects(self, effects: Iterable[Effect], /) -> Sound: ...
 
 class Channel:
     def __init__(self, id: int) -> None: ...
@@ -100,6 +106,38 @@ class Channel:
     def get_queue(self) -> Sound: ...
     def set_endevent(self, type: Union[int, Event] = 0, /) -> None: ...
     def get_endevent(self) -> int: ...
+    def set_effects(self, effects: Iterable[Effect] = ()) -> None: ...
+    def get_effects(self) -> tuple[Effect, ...]: ...
+
+class Effect:
+    def __init__(
+        self,
+        kind: Literal[
+            "lowpass",
+            "highpass",
+            "bandpass",
+            "delay",
+            "reverb",
+            "gain",
+            "pan",
+            "pitch",
+        ],
+        /,
+        **params: float,
+    ) -> None: ...
+    @property
+    def kind(self) -> str: ...
+    @property
+    def params(self) -> dict[str, float]: ...
+    def set(self, **params: float) -> None: ...
+
+class StreamChannel(Channel):
+    def __init__(self, id: int, frames: int = 4096) -> None: ...
+    def play(self) -> None: ...  # type: ignore[override]
+    def push(self, buffer: Buffer, /) -> int: ...
+    def get_queued(self) -> int: ...
+    def get_free(self) -> int: ...
+    def get_underruns(self) -> int: ...
 
 @deprecated("Use `Sound` instead (SoundType is an old alias)")
 class SoundType(Sound): ...
@@ -4,7 +4,7 @@ from typing_extensions import deprecated  # added in 3.13
 
 def array(sound: Sound) -> numpy.ndarray: ...
 def samples(sound: Sound) -> numpy.ndarray: ...
-def make_sound(array: numpy.ndarray) -> Sound: ...
+def make_sound(array: numpy.ndarray, copy: bool = True) -> Sound: ...
 @deprecated("Only numpy is supported")
 def use_arraytype(arraytype: str) -> None: ...
 @deprecated("Only numpy is supported")
@@ -1024,6 +1024,41 @@ class Surface:
         .. versionadded:: 2.5.1
         """
 
+    def get_generation(self) -> int:
+        """Get a counter that changes whenever the pixels are written.
+
+        Returns a number that goes up every time something may have written to
+        the surface: fills, blits, ``set_at()``, the draw and transform functions
+        writing to it, ``unlock()``, and a :class:`PixelArray` or a buffer view
+        of it being released. Reading pixels, with ``get_at()`` for example,
+        leaves it alone. For a subsurface it also changes when its parent is
+        written to.
+
+        Comparing it to a value saved earlier is a cheap way to tell if a cached
+        result based on the pixels, like a texture or a mask, needs to be made
+        again. It can change without the pixels actually changing, so use
+        :meth:`get_hash` when that matters.
+
+        .. versionadded:: 2.5.6
+        """
+
+    def get_hash(self) -> int:
+        """Get a hash of the pixel data.
+
+        Returns a 64 bit hash of the surface's size, pixel format and the bytes of
+        its pixels. Padding at the end of rows is left out, so a subsurface hashes
+        the same as a copy of it. Surfaces with equal pixels give the same hash,
+        on all platforms with the same byte order, and a surface whose pixels
+        changed almost certainly gives a different one. Palettes, colorkeys and
+        the surface alpha are not part of the hash.
+
+        It reads every pixel, using SIMD where the CPU has it, so it is meant for
+        telling apart surfaces in a cache rather than calling every frame. It is
+        not a cryptographic hash.
+
+        .. versionadded:: 2.5.6
+        """
+
     @property
     def width(self) -> int:
         """Surface width in pixels (read-only).
@@ -3,7 +3,7 @@
 .. versionadded:: 2.2.0
 """
 
-from typing import Optional, TypedDict
+from typing import Literal, Optional, TypedDict
 
 from pygame._data_classes import PowerState
 
@@ -27,6 +27,11 @@ class _Locale(TypedDict):
     language: str
     country: Optional[str]
 
+class _PerfCounter(TypedDict):
+    calls: int
+    pixels: int
+    ns: int
+
 def get_cpu_instruction_sets() -> _InstructionSets:
     """Get the information of CPU instruction sets.
 
@@ -204,3 +209,88 @@ def get_power_state() -> Optional[PowerState]:
 
     .. versionadded:: 2.4.0
     """
+
+def enable_perf_counters(enable: bool = True) -> None:
+    """Turn counting of internal hot path calls on or off.
+
+    While counting is on, pygame counts every call of its internal blit, fill,
+    transform, draw and conversion kernels, see :func:`get_perf_counters`.
+    Counting is off by default; while it is off it costs next to nothing.
+
+    Raises ``NotImplementedError`` when turning counting on if pygame was built
+    with the ``perf_counters`` build option off.
+
+    .. versionadded:: 2.5.6
+    """
+
+def get_perf_counters() -> dict[str, _PerfCounter]:
+    """Get how often and how long internal hot paths ran.
+
+    Returns a dict with an entry for every kernel that ran since counting was
+    turned on with :func:`enable_perf_counters` (or since the last
+    :func:`reset_perf_counters`). Keys name the operation and, where pygame
+    has several implementations, the one that ran, like ``"blit.alpha.avx2"``,
+    ``"blit.alpha.sse2"`` or ``"blit.alpha.scalar"``, ``"fill.add.sse2"``,
+    ``"transform.smoothscale.mmx"``, ``"draw.circle"`` or ``"convert"``. A
+    blit that ``SDL`` does itself is counted as ``"blit.sdl"``. Each value is
+    a dict with:
+
+    .. code-block:: text
+
+        calls:
+            How many times the kernel ran.
+
+        pixels:
+            How many pixels it processed. For draw functions this is the area
+            of the returned bounding rect.
+
+        ns:
+            The total time it took, in nanoseconds.
+
+    This shows, for instance, that a surface with a different pixel format
+    than the display sent every blit down the scalar path::
+
+        pygame.system.enable_perf_counters()
+        screen.blit(sprite, (0, 0))
+        print(pygame.system.get_perf_counters())
+
+    .. versionadded:: 2.5.6
+    """
+
+def reset_perf_counters() -> None:
+    """Set all internal hot path counters back to zero.
+
+    Does not change whether counting is on.
+
+    .. versionadded:: 2.5.6
+    """
+
+def set_blit_diagnostics(
+    mode: Optional[Literal["warn", "convert"]] = None, threshold: int = 10
+) -> None:
+    """Report or fix blits that miss the fast same format paths.
+
+    Blits are fastest when the source has the destination's pixel format, or
+    both are 32 bit with the same color layout, which is what
+    :meth:`Surface.convert` and :meth:`Surface.convert_alpha` give you. A
+    source that wasn't converted silently takes a path that can be several
+    times slower. With ``mode`` set, pygame counts such blits per source
+    surface, and once a source reaches ``threshold`` of them:
+
+    * ``'warn'`` issues a ``RuntimeWarning`` once for that surface, naming
+      both pixel formats and why they don't match.
+    * ``'convert'`` keeps a copy of the source converted for the destination
+      and blits from that instead. The copy is made again when the source is
+      written to (filled, drawn on, blitted onto or unlocked), or when its
+      alpha, blend mode, colorkey or the destination format change. It costs
+      the memory of a second surface. Subsurfaces, 8 bit surfaces and
+      surfaces over memory pygame doesn't own, from
+      :func:`pygame.image.frombuffer` for example, are never converted, and
+      warn instead. While the source is locked, by a surfarray array for
+      example, blits take the slow path again.
+
+    ``None``, the default, turns this off again, and slow blits are then not
+    even counted.
+
+    .. versionadded:: 2.5.6
+    """
@@ -5,6 +5,7 @@ constant frame rate.
 Times in pygame-ce are represented in milliseconds (1/1000 of a second).
 """
 
+from collections.abc import Sequence
 from typing import Union, final
 
 from pygame.event import Event
@@ -120,6 +121,51 @@ class Clock:
         .. versionaddedold:: 1.8
         """
 
+    def tick_precise(self, framerate: float = 0, spin: float = 1.0) -> int:
+        """Update the clock, pacing frames with high resolution timing.
+
+        Works like ``Clock.tick()``, but waits using the high resolution
+        performance counter and sub-millisecond sleeps where the platform
+        supports them. Most of the wait is spent sleeping, and only the last
+        ``spin`` milliseconds are spent in a busy loop to hit the end of the
+        frame exactly. A larger ``spin`` gives more accurate frame times at the
+        cost of more CPU use, ``0`` never busy loops.
+
+        Frames are scheduled on a fixed cadence, so a frame that ends a bit late
+        is made up for by a slightly shorter next frame instead of making the
+        game drift slower than ``framerate``. If a frame is late by more than a
+        whole frame, the cadence starts over.
+
+        The GIL is released while waiting.
+
+        .. versionadded:: 2.5.6
+        """
+
+    def get_frame_percentiles(
+        self, percentiles: Sequence[float] = (50, 95, 99)
+    ) -> tuple[float, ...]:
+        """Percentiles of the recent frame times.
+
+        Returns the given percentiles (between 0 and 100) of the times, in
+        milliseconds, of the last 512 frames measured by any of the tick
+        methods. This is measured with the high resolution performance counter,
+        so it is more precise than ``Clock.get_time()``. All values are ``0.0``
+        before the first tick.
+
+        .. versionadded:: 2.5.6
+        """
+
+    def get_frame_histogram(self, bin_width: float = 1.0, bins: int = 32) -> list[int]:
+        """Histogram of the recent frame times.
+
+        Returns the number of the last 512 frames whose time falls into each of
+        ``bins`` bins of ``bin_width`` milliseconds. The first bin counts frames
+        shorter than ``bin_width``, and the last bin also counts all the frames
+        that are longer than the histogram.
+
+        .. versionadded:: 2.5.6
+        """
+
     def get_time(self) -> int:
         """Time used in the previous tick.
 
@@ -19,6 +19,7 @@ from buildconfig.get_version import version
 
 MOD_NAME = "pygame-ce"
 DIST_DIR = "dist"
+BENCH_OUTPUT = "bench_results.json"
 
 VENV_NAME = "dev_venv"
 
@@ -327,6 +328,33 @@ class Dev:
             pprint("Running tests (with all modules)")
             cmd_run([self.py, "-m", "pygame.tests"])
 
+    def cmd_bench(self):
+        patterns = self.args.get("pattern", [])
+        output = self.args.get("output")
+        baseline = self.args.get("compare")
+        threshold = self.args.get("threshold")
+
+        if baseline and not output:
+            output = BENCH_OUTPUT
+
+        pprint(f"Running benchmarks (with {patterns=} and {output=})")
+        suite_args = [f"-k{i}" for i in patterns]
+        if output:
+            suite_args.extend(["--output", output])
+        cmd_run([self.py, "benchmarks/suite.py", *suite_args])
+
+        if baseline:
+            pprint(f"Comparing against '{baseline}' (with {threshold=})")
+            cmd_run(
+                [
+                    self.py,
+                    "benchmarks/compare.py",
+                    baseline,
+                    output,
+                    f"--threshold={threshold}",
+                ]
+            )
+
     def cmd_all(self):
         self.cmd_format()
         self.cmd_docs()
@@ -435,6 +463,31 @@ class Dev:
             ),
         )
 
+        # Bench command
+        bench_parser = subparsers.add_parser(
+            "bench", help="Run the benchmark suite (needs a built pygame-ce)"
+        )
+        bench_parser.add_argument(
+            "pattern",
+            nargs="*",
+            help="Only run cases matching these globs or substrings, like 'blit/*'",
+        )
+        bench_parser.add_argument("--output", help="JSON file to write the results to")
+        bench_parser.add_argument(
+            "--compare",
+            metavar="BASELINE",
+            help=(
+                "Compare the results with an earlier --output file, failing when a "
+                f"case regressed (results go to '{BENCH_OUTPUT}' without --output)"
+            ),
+        )
+        bench_parser.add_argument(
+            "--threshold",
+            type=float,
+            default=0.1,
+            help="Relative slowdown counted as a regression by --compare",
+        )
+
         # Lint command
         subparsers.add_parser("lint", help="Lint code")
 
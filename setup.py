@@ -76,7 +76,9 @@ import distutils
 
 import distutils.ccompiler
 
-avx2_filenames = ['simd_blitters_avx2', 'simd_transform_avx2', 'simd_surface_fill_avx2']
+avx2_filenames = ['simd_blitters_avx2', 'simd_transform_avx2', 'simd_surface_fill_avx2',
+                  'simd_image_avx2', 'simd_display_avx2', 'simd_camera_avx2',
+                  'simd_mixer_avx2', 'simd_surface_hash_avx2']
 
 compiler_options = {
     'unix': ('-mavx2',),
@@ -37,6 +37,13 @@
 #include "camera.h"
 #include "pgcompat.h"
 
+#include "simd_camera.h"
+
+static int camera_has_avx2 = 0;
+static int camera_has_sse2 = 0;
+
+extern PyTypeObject pgCamera_Type;
+
 /*
 #if defined(__unix__) || !defined(__APPLE__)
 #else
@@ -66,6 +73,10 @@ PyObject *
 camera_get_image(pgCameraObject *self, PyObject *arg);
 PyObject *
 camera_get_raw(pgCameraObject *self, PyObject *args);
+PyObject *
+camera_get_raw_view(pgCameraObject *self, PyObject *args);
+PyObject *
+camera_convert_frame(PyObject *self, PyObject *args, PyObject *kwargs);
 
 /*
  * Functions available to pygame-ce users.  The idea is to make these as simple
@@ -135,6 +146,9 @@ surf_colorspace(PyObject *self, PyObject *arg)
         return RAISE(pgExc_SDLError, SDL_GetError());
     }
 
+    if (surfobj2) {
+        pgSurface_Touch(surfobj2);
+    }
     SDL_LockSurface(newsurf);
     pgSurface_Lock(surfobj);
 
@@ -154,6 +168,138 @@ surf_colorspace(PyObject *self, PyObject *arg)
     }
 }
 
+/* _convert_frame() - runs the converters used by Camera.get_image on a
+ * frame from Python, so they can be tested and timed without a device */
+PyObject *
+camera_convert_frame(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    Py_buffer view;
+    pgSurfaceObject *surfobj;
+    SDL_Surface *surf;
+    PG_PixelFormat *fmt;
+    char *fourcc, *color = "RGB";
+    unsigned long pixelformat;
+    Py_ssize_t size;
+    int w, h, yuv;
+    static char *kwids[] = {"frame", "pixelformat", "surface", "color", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "y*sO!|s", kwids, &view,
+                                     &fourcc, &pgSurface_Type, &surfobj,
+                                     &color)) {
+        return NULL;
+    }
+
+    surf = pgSurface_AsSurface(surfobj);
+    if (!surf) {
+        PyBuffer_Release(&view);
+        return RAISE(pgExc_SDLError, "display Surface quit");
+    }
+    w = surf->w;
+    h = surf->h;
+    size = (Py_ssize_t)w * h;
+
+    if (!strcmp(color, "RGB")) {
+        yuv = 0;
+    }
+    else if (!strcmp(color, "YUV")) {
+        yuv = 1;
+    }
+    else {
+        PyBuffer_Release(&view);
+        return RAISE(PyExc_ValueError, "color must be 'RGB' or 'YUV'");
+    }
+
+    if (strlen(fourcc) != 4) {
+        PyBuffer_Release(&view);
+        return RAISE(PyExc_ValueError, "pixelformat must be a fourcc");
+    }
+    pixelformat = v4l2_fourcc(fourcc[0], fourcc[1], fourcc[2], fourcc[3]);
+    if (pixelformat == v4l2_fourcc('Y', 'U', 'Y', 'V') ||
+        pixelformat == v4l2_fourcc('U', 'Y', 'V', 'Y')) {
+        size *= 2;
+    }
+    else if (pixelformat == v4l2_fourcc('Y', 'U', '1', '2')) {
+        size += size / 2;
+    }
+    else if (pixelformat == V4L2_PIX_FMT_RGB24) {
+        size *= 3;
+    }
+    else if (pixelformat == V4L2_PIX_FMT_XBGR32) {
+        size *= 4;
+    }
+    else if (pixelformat != v4l2_fourcc('B', 'A', '8', '1')) {
+        PyBuffer_Release(&view);
+        return RAISE(PyExc_ValueError, "unsupported pixelformat");
+    }
+
+    if (view.len != size) {
+        PyBuffer_Release(&view);
+        return RAISE(PyExc_ValueError, "frame is not the size of surface");
+    }
+    /* like the camera backends, the converters write rows back to back */
+    if (surf->pitch != w * PG_SURF_BytesPerPixel(surf)) {
+        PyBuffer_Release(&view);
+        return RAISE(PyExc_ValueError, "surface rows must not be padded");
+    }
+    fmt = PG_GetSurfaceFormat(surf);
+    if (!fmt) {
+        PyBuffer_Release(&view);
+        return RAISE(pgExc_SDLError, SDL_GetError());
+    }
+
+    pgSurface_Touch(surfobj);
+    if (!pgSurface_Lock(surfobj)) {
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    if (pixelformat == v4l2_fourcc('Y', 'U', 'Y', 'V')) {
+        if (yuv) {
+            yuyv_to_yuv(view.buf, surf->pixels, w * h, fmt);
+        }
+        else {
+            yuyv_to_rgb(view.buf, surf->pixels, w * h, fmt);
+        }
+    }
+    else if (pixelformat == v4l2_fourcc('U', 'Y', 'V', 'Y')) {
+        if (yuv) {
+            uyvy_to_yuv(view.buf, surf->pixels, w * h, fmt);
+        }
+        else {
+            uyvy_to_rgb(view.buf, surf->pixels, w * h, fmt);
+        }
+    }
+    else if (pixelformat == v4l2_fourcc('Y', 'U', '1', '2')) {
+        if (yuv) {
+            yuv420_to_yuv(view.buf, surf->pixels, w, h, fmt);
+        }
+        else {
+            yuv420_to_rgb(view.buf, surf->pixels, w, h, fmt);
+        }
+    }
+    else if (pixelformat == v4l2_fourcc('B', 'A', '8', '1')) {
+        sbggr8_to_rgb(view.buf, surf->pixels, w, h, fmt);
+        if (yuv) {
+            rgb_to_yuv(surf->pixels, surf->pixels, w * h, 0, fmt);
+        }
+    }
+    else if (yuv) {
+        rgb_to_yuv(view.buf, surf->pixels, w * h, pixelformat, fmt);
+    }
+    else if (pixelformat == V4L2_PIX_FMT_RGB24) {
+        rgb24_to_rgb(view.buf, surf->pixels, w * h, fmt);
+    }
+    else {
+        bgr32_to_rgb(view.buf, surf->pixels, w * h, fmt);
+    }
+    Py_END_ALLOW_THREADS;
+
+    pgSurface_Unlock(surfobj);
+    PyBuffer_Release(&view);
+    Py_RETURN_NONE;
+}
+
 /* list_cameras() - lists cameras available on the computer */
 PyObject *
 list_cameras(PyObject *self, PyObject *_null)
@@ -249,6 +395,11 @@ PyObject *
 camera_stop(pgCameraObject *self, PyObject *_null)
 {
 #if defined(__unix__)
+    if (self->raw_views) {
+        return RAISE(PyExc_BufferError,
+                     "raw views of this camera must be released before it is "
+                     "stopped");
+    }
     if (v4l2_stop_capturing(self) == 0) {
         return NULL;
     }
@@ -493,10 +644,434 @@ camera_get_raw(pgCameraObject *self, PyObject *_null)
     Py_RETURN_NONE;
 }
 
+#if defined(__unix__)
+/* A frame dequeued by get_raw_view(). It keeps the camera alive and exports
+ * the mmapped buffer read only; the buffer goes back to the driver on
+ * release(), which refuses while a memoryview of it is still open. */
+typedef struct {
+    PyObject_HEAD pgCameraObject *camera; /* NULL once released */
+    struct v4l2_buffer buf;
+    Py_ssize_t exports;
+} pgCameraRawViewObject;
+
+static const void *
+camera_raw_view_data(pgCameraRawViewObject *self, Py_ssize_t *len)
+{
+    struct buffer *mem = &self->camera->buffers[self->buf.index];
+
+    *len = (Py_ssize_t)mem->length;
+    if (self->buf.bytesused && self->buf.bytesused < mem->length) {
+        *len = (Py_ssize_t)self->buf.bytesused;
+    }
+    return mem->start;
+}
+
+/* Queues the buffer again and lets go of the camera; 0 if the driver
+ * refused, with errno set */
+static int
+camera_raw_view_requeue(pgCameraRawViewObject *self)
+{
+    pgCameraObject *camera = self->camera;
+    int ret = v4l2_xioctl(camera->fd, VIDIOC_QBUF, &self->buf);
+
+    camera->raw_views--;
+    self->camera = NULL;
+    Py_DECREF(camera);
+    return ret != -1;
+}
+
+static int
+camera_raw_view_getbuffer(pgCameraRawViewObject *self, Py_buffer *view,
+                          int flags)
+{
+    const void *data;
+    Py_ssize_t len;
+
+    if (!self->camera) {
+        view->obj = NULL;
+        PyErr_SetString(PyExc_BufferError, "raw view has been released");
+        return -1;
+    }
+    data = camera_raw_view_data(self, &len);
+    if (PyBuffer_FillInfo(view, (PyObject *)self, (void *)data, len, 1,
+                          flags)) {
+        return -1;
+    }
+    self->exports++;
+    return 0;
+}
+
+static void
+camera_raw_view_releasebuffer(pgCameraRawViewObject *self, Py_buffer *view)
+{
+    self->exports--;
+}
+
+static PyBufferProcs camera_raw_view_as_buffer = {
+    (getbufferproc)camera_raw_view_getbuffer,
+    (releasebufferproc)camera_raw_view_releasebuffer};
+
+static PyObject *
+camera_raw_view_release(pgCameraRawViewObject *self, PyObject *_null)
+{
+    if (!self->camera) {
+        Py_RETURN_NONE;
+    }
+    if (self->exports) {
+        return RAISE(PyExc_BufferError,
+                     "raw view is still exported, release its memoryview "
+                     "first");
+    }
+    if (!camera_raw_view_requeue(self)) {
+        PyErr_Format(PyExc_SystemError, "ioctl(VIDIOC_QBUF) failure : %d, %s",
+                     errno, strerror(errno));
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+camera_raw_view_enter(pgCameraRawViewObject *self, PyObject *_null)
+{
+    Py_INCREF(self);
+    return (PyObject *)self;
+}
+
+static PyObject *
+camera_raw_view_exit(pgCameraRawViewObject *self, PyObject *_args)
+{
+    return camera_raw_view_release(self, NULL);
+}
+
+/* to_surface() - converts the frame the way get_image() does */
+static PyObject *
+camera_raw_view_to_surface(pgCameraRawViewObject *self, PyObject *args,
+                           PyObject *kwargs)
+{
+    pgCameraObject *camera = self->camera;
+    pgSurfaceObject *surfobj = NULL;
+    SDL_Surface *surf;
+    const void *data;
+    Py_ssize_t len;
+    int ret;
+    static char *kwids[] = {"surface", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O!", kwids,
+                                     &pgSurface_Type, &surfobj)) {
+        return NULL;
+    }
+    if (!camera) {
+        return RAISE(PyExc_BufferError, "raw view has been released");
+    }
+
+    if (!surfobj) {
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        surf = PG_CreateSurface(camera->width, camera->height,
+                                SDL_PIXELFORMAT_RGB24);
+#else
+        surf = PG_CreateSurface(camera->width, camera->height,
+                                SDL_PIXELFORMAT_BGR24);
+#endif
+        if (!surf) {
+            return RAISE(pgExc_SDLError, SDL_GetError());
+        }
+    }
+    else {
+        surf = pgSurface_AsSurface(surfobj);
+        if (!surf) {
+            return RAISE(pgExc_SDLError, "display Surface quit");
+        }
+        if (surf->w != camera->width || surf->h != camera->height) {
+            return RAISE(PyExc_ValueError,
+                         "Destination surface not the correct width or "
+                         "height.");
+        }
+        /* the converters write rows back to back */
+        if (surf->pitch != surf->w * PG_SURF_BytesPerPixel(surf)) {
+            return RAISE(PyExc_ValueError, "surface rows must not be padded");
+        }
+    }
+
+    data = camera_raw_view_data(self, &len);
+    /* counts as an export, so release() can't requeue the buffer while it is
+     * being read without the GIL */
+    self->exports++;
+    Py_BEGIN_ALLOW_THREADS;
+    ret = v4l2_process_image(camera, data, (int)len, surf);
+    Py_END_ALLOW_THREADS;
+    self->exports--;
+
+    if (!ret) {
+        if (!surfobj) {
+            SDL_FreeSurface(surf);
+        }
+        return RAISE(PyExc_SystemError, "image processing error");
+    }
+    if (surfobj) {
+        Py_INCREF(surfobj);
+        return (PyObject *)surfobj;
+    }
+    return (PyObject *)pgSurface_New(surf);
+}
+
+static void
+camera_raw_view_dealloc(pgCameraRawViewObject *self)
+{
+    if (self->camera) {
+        /* nothing to report a failure to, the driver keeps the buffer */
+        camera_raw_view_requeue(self);
+    }
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyMethodDef camera_raw_view_methods[] = {
+    {"release", (PyCFunction)camera_raw_view_release, METH_NOARGS,
+     DOC_CAMERA_RAWVIEW_RELEASE},
+    {"to_surface", (PyCFunction)camera_raw_view_to_surface,
+     METH_VARARGS | METH_KEYWORDS, DOC_CAMERA_RAWVIEW_TOSURFACE},
+    {"__enter__", (PyCFunction)camera_raw_view_enter, METH_NOARGS, NULL},
+    {"__exit__", (PyCFunction)camera_raw_view_exit, METH_VARARGS, NULL},
+    {NULL, NULL, 0, NULL}};
+
+static PyObject *
+camera_raw_view_get_sequence(pgCameraRawViewObject *self, void *closure)
+{
+    return PyLong_FromUnsignedLong(self->buf.sequence);
+}
+
+static PyObject *
+camera_raw_view_get_released(pgCameraRawViewObject *self, void *closure)
+{
+    return PyBool_FromLong(!self->camera);
+}
+
+static PyGetSetDef camera_raw_view_getsets[] = {
+    {"sequence", (getter)camera_raw_view_get_sequence, NULL,
+     DOC_CAMERA_RAWVIEW_SEQUENCE, NULL},
+    {"released", (getter)camera_raw_view_get_released, NULL,
+     DOC_CAMERA_RAWVIEW_RELEASED, NULL},
+    {NULL, NULL, NULL, NULL, NULL}};
+
+static PyTypeObject pgCameraRawView_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.camera.RawView",
+    .tp_basicsize = sizeof(pgCameraRawViewObject),
+    .tp_dealloc = (destructor)camera_raw_view_dealloc,
+    .tp_as_buffer = &camera_raw_view_as_buffer,
+    .tp_doc = DOC_CAMERA_RAWVIEW,
+    .tp_methods = camera_raw_view_methods,
+    .tp_getset = camera_raw_view_getsets,
+};
+#endif /* defined(__unix__) */
+
+/* get_raw_view() - dequeues a frame and exports it without a copy */
+PyObject *
+camera_get_raw_view(pgCameraObject *self, PyObject *_null)
+{
+#if defined(__unix__)
+    pgCameraRawViewObject *view;
+    struct v4l2_buffer buf;
+    int ret;
+
+    /* one buffer stays with the driver, or capturing would stall */
+    if (self->raw_views + 1 >= self->n_buffers) {
+        PyErr_Format(PyExc_BufferError,
+                     "cannot hold more than %u raw views of this camera",
+                     self->n_buffers ? self->n_buffers - 1 : 0);
+        return NULL;
+    }
+
+    view = PyObject_New(pgCameraRawViewObject, &pgCameraRawView_Type);
+    if (!view) {
+        return NULL;
+    }
+    view->camera = NULL;
+    view->exports = 0;
+
+    CLEAR(buf);
+    buf.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+    buf.memory = V4L2_MEMORY_MMAP;
+
+    Py_BEGIN_ALLOW_THREADS;
+    ret = v4l2_xioctl(self->fd, VIDIOC_DQBUF, &buf);
+    Py_END_ALLOW_THREADS;
+    if (ret == -1) {
+        PyErr_Format(PyExc_SystemError, "ioctl(VIDIOC_DQBUF) failure : %d, %s",
+                     errno, strerror(errno));
+        Py_DECREF(view);
+        return NULL;
+    }
+    assert(buf.index < self->n_buffers);
+
+    Py_INCREF(self);
+    view->camera = self;
+    view->buf = buf;
+    self->raw_views++;
+    return (PyObject *)view;
+#else
+    return RAISE(PyExc_NotImplementedError,
+                 "get_raw_view() is only available with the v4l2 backend");
+#endif
+}
+
+#if defined(__unix__)
+/* _start_mock() - starts a camera on the in-memory v4l2 driver, so the
+ * streaming paths can be tested without a device */
+static PyObject *
+camera_start_mock(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    pgCameraObject *camera;
+    char *fourcc = "YUYV";
+    unsigned int n_buffers = 2;
+    static char *kwids[] = {"camera", "pixelformat", "buffers", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O!|sI", kwids,
+                                     &pgCamera_Type, &camera, &fourcc,
+                                     &n_buffers)) {
+        return NULL;
+    }
+    if (camera->fd != -1) {
+        return RAISE(PyExc_ValueError, "camera is already started");
+    }
+    if (strlen(fourcc) != 4) {
+        return RAISE(PyExc_ValueError, "pixelformat must be a fourcc");
+    }
+
+    if (!v4l2_mock_device(
+            camera, v4l2_fourcc(fourcc[0], fourcc[1], fourcc[2], fourcc[3]),
+            n_buffers)) {
+        if (camera->fd == PG_V4L2_MOCK_FD) {
+            v4l2_uninit_device(camera);
+            v4l2_close_device(camera);
+        }
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+#endif /* defined(__unix__) */
+
 /*
  * Pixelformat conversion functions
  */
 
+/* Upper bound on the number of threads a frame is converted with, and the
+ * least number of output bytes worth giving one thread */
+#define PG_CAMERA_ROWS_MAX_THREADS 16
+#define PG_CAMERA_ROWS_MIN_BYTES (256 * 1024)
+
+typedef void (*CameraRowsFunc)(void *ctx, int first, int last);
+
+typedef struct {
+    CameraRowsFunc func;
+    void *ctx;
+    int first;
+    int last;
+} CameraRowsBand;
+
+static int SDLCALL
+_camera_rows_worker(void *data)
+{
+    CameraRowsBand *band = (CameraRowsBand *)data;
+
+    band->func(band->ctx, band->first, band->last);
+    return 0;
+}
+
+/* Call func over the rows [0, rows) of a frame of size output bytes. Large
+ * frames are split in bands of rows, one per thread. The converters run
+ * without the GIL, so this never touches Python. */
+static void
+camera_run_rows(CameraRowsFunc func, void *ctx, int rows, Sint64 size)
+{
+    CameraRowsBand bands[PG_CAMERA_ROWS_MAX_THREADS];
+    SDL_Thread *threads[PG_CAMERA_ROWS_MAX_THREADS];
+    int nthreads = 1;
+    int n;
+
+#if !defined(__EMSCRIPTEN__) && !defined(__wasi__)
+    nthreads = SDL_GetCPUCount();
+    if (nthreads > PG_CAMERA_ROWS_MAX_THREADS) {
+        nthreads = PG_CAMERA_ROWS_MAX_THREADS;
+    }
+    if (nthreads > size / PG_CAMERA_ROWS_MIN_BYTES) {
+        nthreads = (int)(size / PG_CAMERA_ROWS_MIN_BYTES);
+    }
+    if (nthreads > rows) {
+        nthreads = rows;
+    }
+    if (nthreads < 1) {
+        nthreads = 1;
+    }
+#endif
+
+    for (n = 0; n < nthreads; ++n) {
+        bands[n].func = func;
+        bands[n].ctx = ctx;
+        bands[n].first = (int)((Sint64)rows * n / nthreads);
+        bands[n].last = (int)((Sint64)rows * (n + 1) / nthreads);
+    }
+    for (n = 1; n < nthreads; ++n) {
+        threads[n] = SDL_CreateThread(_camera_rows_worker, "pg_camera_rows",
+                                      &bands[n]);
+    }
+    func(ctx, bands[0].first, bands[0].last);
+    for (n = 1; n < nthreads; ++n) {
+        if (threads[n]) {
+            SDL_WaitThread(threads[n], NULL);
+        }
+        else {
+            /* the thread could not be started, do its band here */
+            func(ctx, bands[n].first, bands[n].last);
+        }
+    }
+}
+
+/* Fill pack for the SIMD kernels when the destination is 24 bit, or 32 bit
+ * with whole byte channels; other formats keep the scalar converters. The
+ * kernels build 32 bit pixels in little endian order. */
+static int
+camera_packing(PG_PixelFormat *format, PG_CameraPacking *pack)
+{
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    switch (PG_FORMAT_BytesPerPixel(format)) {
+        case 3:
+            pack->bpp = 3;
+            return 1;
+        case 4:
+            if (PG_FORMAT_R_LOSS(format) || PG_FORMAT_G_LOSS(format) ||
+                PG_FORMAT_B_LOSS(format) || format->Rshift % 8 ||
+                format->Gshift % 8 || format->Bshift % 8) {
+                return 0;
+            }
+            pack->bpp = 4;
+            pack->shift[0] = format->Rshift;
+            pack->shift[1] = format->Gshift;
+            pack->shift[2] = format->Bshift;
+            return 1;
+    }
+#endif
+    return 0;
+}
+
+/* The scalar version of the kernels' store, for the pixels they leave */
+static PG_INLINE void
+camera_put_pixel(Uint8 *dst, int c0, int c1, int c2,
+                 const PG_CameraPacking *pack)
+{
+    Uint32 pixel;
+
+    if (pack->bpp == 3) {
+        dst[0] = (Uint8)c2;
+        dst[1] = (Uint8)c1;
+        dst[2] = (Uint8)c0;
+    }
+    else {
+        pixel = ((Uint32)c0 << pack->shift[0]) |
+                ((Uint32)c1 << pack->shift[1]) |
+                ((Uint32)c2 << pack->shift[2]);
+        memcpy(dst, &pixel, 4);
+    }
+}
+
 /* converts from rgb Surface to yuv or hsv */
 /* TODO: Allow for conversion from yuv and hsv to all */
 void
@@ -801,6 +1376,47 @@ rgb_to_hsv(const void *src, void *dst, int length, unsigned long source,
     }
 }
 
+typedef struct {
+    const Uint8 *src;
+    Uint8 *dst;
+    int src_bpp;
+    int rshift, gshift, bshift;
+    PG_CameraPacking pack;
+} CameraRGBToYUV;
+
+/* rgb_to_yuv over the pixels [first, last) */
+static void
+camera_rgb_to_yuv_rows(void *ctx, int first, int last)
+{
+    CameraRGBToYUV *c = (CameraRGBToYUV *)ctx;
+    const Uint8 *s = c->src + (Sint64)first * c->src_bpp;
+    Uint8 *d = c->dst + (Sint64)first * c->pack.bpp;
+    int length = last - first;
+    int x = 0, r, g, b;
+    Uint32 pixel;
+
+    if (camera_has_avx2) {
+        x = camera_rgb_to_yuv_avx2(s, d, length, c->src_bpp, c->rshift,
+                                   c->gshift, c->bshift, &c->pack);
+    }
+    if (!x && camera_has_sse2) {
+        x = camera_rgb_to_yuv_sse2(s, d, length, c->src_bpp, c->rshift,
+                                   c->gshift, c->bshift, &c->pack);
+    }
+    for (; x < length; ++x) {
+        pixel = 0;
+        memcpy(&pixel, s + x * c->src_bpp, c->src_bpp);
+        r = (pixel >> c->rshift) & 0xff;
+        g = (pixel >> c->gshift) & 0xff;
+        b = (pixel >> c->bshift) & 0xff;
+        camera_put_pixel(d + x * c->pack.bpp,
+                         (77 * r + 150 * g + 29 * b + 128) >> 8,
+                         ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128,
+                         ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128,
+                         &c->pack);
+    }
+}
+
 /* convert packed rgb to yuv. Note that unlike many implementations of YUV,
    this has a full range of 0-255 for Y, not 16-235. Formulas from wikipedia */
 void
@@ -813,6 +1429,34 @@ rgb_to_yuv(const void *src, void *dst, int length, unsigned long source,
     Uint8 r, g, b, y, u, v;
     Uint8 p1, p2;
     int rshift, gshift, bshift, rloss, gloss, bloss;
+    CameraRGBToYUV ctx;
+
+    if (source != V4L2_PIX_FMT_RGB444 && camera_packing(format, &ctx.pack)) {
+        ctx.src = (const Uint8 *)src;
+        ctx.dst = (Uint8 *)dst;
+        if (source == V4L2_PIX_FMT_RGB24) {
+            ctx.src_bpp = 3;
+            ctx.rshift = 0;
+            ctx.gshift = 8;
+            ctx.bshift = 16;
+        }
+        else if (source == V4L2_PIX_FMT_XBGR32 || ctx.pack.bpp == 3) {
+            /* stage 2 reads three byte pixels as b, g, r too */
+            ctx.src_bpp = source == V4L2_PIX_FMT_XBGR32 ? 4 : 3;
+            ctx.rshift = 16;
+            ctx.gshift = 8;
+            ctx.bshift = 0;
+        }
+        else {
+            ctx.src_bpp = 4;
+            ctx.rshift = format->Rshift;
+            ctx.gshift = format->Gshift;
+            ctx.bshift = format->Bshift;
+        }
+        camera_run_rows(camera_rgb_to_yuv_rows, &ctx, length,
+                        (Sint64)length * ctx.pack.bpp);
+        return;
+    }
 
     s8 = (Uint8 *)src;
     s16 = (Uint16 *)src;
@@ -1002,6 +1646,73 @@ rgb444_to_rgb(const void *src, void *dst, int length, PG_PixelFormat *format)
     }
 }
 
+typedef struct {
+    const Uint8 *src;
+    Uint8 *dst;
+    int uyvy;
+    PG_CameraPacking pack;
+} CameraYUYVToRGB;
+
+/* yuyv_to_rgb or uyvy_to_rgb over the pixel pairs [first, last) */
+static void
+camera_yuyv_to_rgb_rows(void *ctx, int first, int last)
+{
+    CameraYUYVToRGB *c = (CameraYUYVToRGB *)ctx;
+    const Uint8 *s = c->src + (Sint64)first * 4;
+    Uint8 *d = c->dst + (Sint64)first * 2 * c->pack.bpp;
+    int length = (last - first) * 2;
+    int x = 0, y1, y2, u, v, u1, rg, v1;
+
+    if (camera_has_avx2) {
+        x = camera_yuyv_to_rgb_avx2(s, d, length, c->uyvy, &c->pack);
+    }
+    if (!x && camera_has_sse2) {
+        x = camera_yuyv_to_rgb_sse2(s, d, length, c->uyvy, &c->pack);
+    }
+    for (; x < length; x += 2) {
+        if (c->uyvy) {
+            u = s[x * 2];
+            y1 = s[x * 2 + 1];
+            v = s[x * 2 + 2];
+            y2 = s[x * 2 + 3];
+        }
+        else {
+            y1 = s[x * 2];
+            u = s[x * 2 + 1];
+            y2 = s[x * 2 + 2];
+            v = s[x * 2 + 3];
+        }
+        u1 = (((u - 128) << 7) + (u - 128)) >> 6;
+        rg = (((u - 128) << 1) + (u - 128) + ((v - 128) << 2) +
+              ((v - 128) << 1)) >>
+             3;
+        v1 = (((v - 128) << 1) + (v - 128)) >> 1;
+
+        camera_put_pixel(d + x * c->pack.bpp, SAT2(y1 + v1), SAT2(y1 - rg),
+                         SAT2(y1 + u1), &c->pack);
+        camera_put_pixel(d + (x + 1) * c->pack.bpp, SAT2(y2 + v1),
+                         SAT2(y2 - rg), SAT2(y2 + u1), &c->pack);
+    }
+}
+
+/* Convert YUYV or UYVY to RGB with the kernels, if pack could be filled */
+static int
+camera_yuyv_to_rgb(const void *src, void *dst, int length, int uyvy,
+                   PG_PixelFormat *format)
+{
+    CameraYUYVToRGB ctx;
+
+    if (!camera_packing(format, &ctx.pack)) {
+        return 0;
+    }
+    ctx.src = (const Uint8 *)src;
+    ctx.dst = (Uint8 *)dst;
+    ctx.uyvy = uyvy;
+    camera_run_rows(camera_yuyv_to_rgb_rows, &ctx, length >> 1,
+                    (Sint64)length * ctx.pack.bpp);
+    return 1;
+}
+
 /* convert from 4:2:2 YUYV interlaced to RGB */
 /* colorspace conversion routine from libv4l. Licensed LGPL 2.1
    (C) 2008 Hans de Goede <j.w.r.degoede@hhs.nl> */
@@ -1015,6 +1726,10 @@ yuyv_to_rgb(const void *src, void *dst, int length, PG_PixelFormat *format)
     int r1, g1, b1, r2, b2, g2;
     int rshift, gshift, bshift, rloss, gloss, bloss, y1, y2, u, v, u1, rg, v1;
 
+    if (camera_yuyv_to_rgb(src, dst, length, 0, format)) {
+        return;
+    }
+
     rshift = format->Rshift;
     gshift = format->Gshift;
     bshift = format->Bshift;
@@ -1168,6 +1883,10 @@ uyvy_to_rgb(const void *src, void *dst, int length, PG_PixelFormat *format)
     int r1, g1, b1, r2, b2, g2;
     int rshift, gshift, bshift, rloss, gloss, bloss, y1, y2, u, v, u1, rg, v1;
 
+    if (camera_yuyv_to_rgb(src, dst, length, 1, format)) {
+        return;
+    }
+
     rshift = format->Rshift;
     gshift = format->Gshift;
     bshift = format->Bshift;
@@ -1335,7 +2054,145 @@ uyvy_to_yuv(const void *src, void *dst, int length, PG_PixelFormat *format)
  * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
  * SUCH DAMAGE.
  */
-/* TODO: Certainly not the most efficient way of doing this conversion. */
+/* The color of the Bayer sample at rawpt. i counts the samples left in the
+ * frame after this one, which is how the edges and rows are told apart. */
+static void
+bggr_pixel(const Uint8 *rawpt, int i, int width, int height, Uint8 *r,
+           Uint8 *g, Uint8 *b)
+{
+    if ((i / width) % 2 == 0) {
+        /* even row (BGBGBGBG)*/
+        if ((i % 2) == 0) {
+            /* B */
+            if ((i > width) && ((i % width) > 0)) {
+                *b = *rawpt; /* B */
+                *g = (*(rawpt - 1) + *(rawpt + 1) + *(rawpt + width) +
+                      *(rawpt - width)) /
+                    4; /* G */
+                *r = (*(rawpt - width - 1) + *(rawpt - width + 1) +
+                      *(rawpt + width - 1) + *(rawpt + width + 1)) /
+                    4; /* R */
+            }
+            else {
+                /* first line or left column */
+                *b = *rawpt;                                /* B */
+                *g = (*(rawpt + 1) + *(rawpt + width)) / 2; /* G */
+                *r = *(rawpt + width + 1);                  /* R */
+            }
+        }
+        else {
+            /* (B)G */
+            if ((i > width) && ((i % width) < (width - 1))) {
+                *b = (*(rawpt - 1) + *(rawpt + 1)) / 2;         /* B */
+                *g = *rawpt;                                    /* G */
+                *r = (*(rawpt + width) + *(rawpt - width)) / 2; /* R */
+            }
+            else {
+                /* first line or right column */
+                *b = *(rawpt - 1);     /* B */
+                *g = *rawpt;           /* G */
+                *r = *(rawpt + width); /* R */
+            }
+        }
+    }
+    else {
+        /* odd row (GRGRGRGR) */
+        if ((i % 2) == 0) {
+            /* G(R) */
+            if ((i < (width * (height - 1))) && ((i % width) > 0)) {
+                *b = (*(rawpt + width) + *(rawpt - width)) / 2; /* B */
+                *g = *rawpt;                                    /* G */
+                *r = (*(rawpt - 1) + *(rawpt + 1)) / 2;         /* R */
+            }
+            else {
+                /* bottom line or left column */
+                *b = *(rawpt - width); /* B */
+                *g = *rawpt;           /* G */
+                *r = *(rawpt + 1);     /* R */
+            }
+        }
+        else {
+            /* R */
+            if (i < (width * (height - 1)) && ((i % width) < (width - 1))) {
+                *b = (*(rawpt - width - 1) + *(rawpt - width + 1) +
+                      *(rawpt + width - 1) + *(rawpt + width + 1)) /
+                    4; /* B */
+                *g = (*(rawpt - 1) + *(rawpt + 1) + *(rawpt - width) +
+                      *(rawpt + width)) /
+                    4;       /* G */
+                *r = *rawpt; /* R */
+            }
+            else {
+                /* bottom line or right column */
+                *b = *(rawpt - width - 1);                  /* B */
+                *g = (*(rawpt - 1) + *(rawpt - width)) / 2; /* G */
+                *r = *rawpt;                                /* R */
+            }
+        }
+    }
+}
+
+typedef struct {
+    const Uint8 *src;
+    Uint8 *dst;
+    int width;
+    int height;
+    PG_CameraPacking pack;
+} CameraBGGRToRGB;
+
+/* bggr_pixel for the pixels [first, last) of a row */
+static void
+camera_bggr_pixels(CameraBGGRToRGB *c, int row, int first, int last)
+{
+    const Uint8 *s = c->src + (Sint64)row * c->width;
+    Uint8 *d = c->dst + (Sint64)row * c->width * c->pack.bpp;
+    int i = (c->height - 1 - row) * c->width + c->width - 1;
+    int x;
+    Uint8 r, g, b;
+
+    for (x = first; x < last; ++x) {
+        bggr_pixel(s + x, i - x, c->width, c->height, &r, &g, &b);
+        camera_put_pixel(d + x * c->pack.bpp, r, g, b, &c->pack);
+    }
+}
+
+/* sbggr8_to_rgb over the rows [first, last). Away from the edges every
+ * pixel is interpolated from all of its neighbours, which the kernels do. */
+static void
+camera_bggr_to_rgb_rows(void *ctx, int first, int last)
+{
+    CameraBGGRToRGB *c = (CameraBGGRToRGB *)ctx;
+    int width = c->width;
+    int row, i, blue_row, green_first, x;
+    const Uint8 *s;
+    Uint8 *d;
+
+    for (row = first; row < last; ++row) {
+        if (row == 0 || row == c->height - 1 || width < 3) {
+            camera_bggr_pixels(c, row, 0, width);
+            continue;
+        }
+        s = c->src + (Sint64)row * width;
+        d = c->dst + (Sint64)row * width * c->pack.bpp;
+        /* what bggr_pixel takes the sample at x = 1 for */
+        i = (c->height - 1 - row) * width + width - 2;
+        blue_row = (i / width) % 2 == 0;
+        green_first = blue_row ? i % 2 != 0 : i % 2 == 0;
+
+        x = 0;
+        if (camera_has_avx2) {
+            x = camera_bggr_to_rgb_avx2(s, d, width - 2, width, blue_row,
+                                        green_first, &c->pack);
+        }
+        if (!x && camera_has_sse2) {
+            x = camera_bggr_to_rgb_sse2(s, d, width - 2, width, blue_row,
+                                        green_first, &c->pack);
+        }
+        camera_bggr_pixels(c, row, 0, 1);
+        camera_bggr_pixels(c, row, 1 + x, width);
+    }
+}
+
 void
 sbggr8_to_rgb(const void *src, void *dst, int width, int height,
               PG_PixelFormat *format)
@@ -1346,6 +2203,18 @@ sbggr8_to_rgb(const void *src, void *dst, int width, int height,
     Uint8 r, g, b;
     int rshift, gshift, bshift, rloss, gloss, bloss;
     int i = width * height;
+    CameraBGGRToRGB ctx;
+
+    if (camera_packing(format, &ctx.pack)) {
+        ctx.src = (const Uint8 *)src;
+        ctx.dst = (Uint8 *)dst;
+        ctx.width = width;
+        ctx.height = height;
+        camera_run_rows(camera_bggr_to_rgb_rows, &ctx, height,
+                        (Sint64)width * height * ctx.pack.bpp);
+        return;
+    }
+
     rawpt = (Uint8 *)src;
     rshift = format->Rshift;
     gshift = format->Gshift;
@@ -1359,77 +2228,7 @@ sbggr8_to_rgb(const void *src, void *dst, int width, int height,
     d32 = (Uint32 *)dst;
 
     while (i--) {
-        if ((i / width) % 2 == 0) {
-            /* even row (BGBGBGBG)*/
-            if ((i % 2) == 0) {
-                /* B */
-                if ((i > width) && ((i % width) > 0)) {
-                    b = *rawpt; /* B */
-                    g = (*(rawpt - 1) + *(rawpt + 1) + *(rawpt + width) +
-                         *(rawpt - width)) /
-                        4; /* G */
-                    r = (*(rawpt - width - 1) + *(rawpt - width + 1) +
-                         *(rawpt + width - 1) + *(rawpt + width + 1)) /
-                        4; /* R */
-                }
-                else {
-                    /* first line or left column */
-                    b = *rawpt;                                /* B */
-                    g = (*(rawpt + 1) + *(rawpt + width)) / 2; /* G */
-                    r = *(rawpt + width + 1);                  /* R */
-                }
-            }
-            else {
-                /* (B)G */
-                if ((i > width) && ((i % width) < (width - 1))) {
-                    b = (*(rawpt - 1) + *(rawpt + 1)) / 2;         /* B */
-                    g = *rawpt;                                    /* G */
-                    r = (*(rawpt + width) + *(rawpt - width)) / 2; /* R */
-                }
-                else {
-                    /* first line or right column */
-                    b = *(rawpt - 1);     /* B */
-                    g = *rawpt;           /* G */
-                    r = *(rawpt + width); /* R */
-                }
-            }
-        }
-        else {
-            /* odd row (GRGRGRGR) */
-            if ((i % 2) == 0) {
-                /* G(R) */
-                if ((i < (width * (height - 1))) && ((i % width) > 0)) {
-                    b = (*(rawpt + width) + *(rawpt - width)) / 2; /* B */
-                    g = *rawpt;                                    /* G */
-                    r = (*(rawpt - 1) + *(rawpt + 1)) / 2;         /* R */
-                }
-                else {
-                    /* bottom line or left column */
-                    b = *(rawpt - width); /* B */
-                    g = *rawpt;           /* G */
-                    r = *(rawpt + 1);     /* R */
-                }
-            }
-            else {
-                /* R */
-                if (i < (width * (height - 1)) &&
-                    ((i % width) < (width - 1))) {
-                    b = (*(rawpt - width - 1) + *(rawpt - width + 1) +
-                         *(rawpt + width - 1) + *(rawpt + width + 1)) /
-                        4; /* B */
-                    g = (*(rawpt - 1) + *(rawpt + 1) + *(rawpt - width) +
-                         *(rawpt + width)) /
-                        4;      /* G */
-                    r = *rawpt; /* R */
-                }
-                else {
-                    /* bottom line or right column */
-                    b = *(rawpt - width - 1);                  /* B */
-                    g = (*(rawpt - 1) + *(rawpt - width)) / 2; /* G */
-                    r = *rawpt;                                /* R */
-                }
-            }
-        }
+        bggr_pixel(rawpt, i, width, height, &r, &g, &b);
         rawpt++;
         switch (PG_FORMAT_BytesPerPixel(format)) {
             case 1:
@@ -1655,6 +2454,44 @@ yuv420_to_rgb(const void *src, void *dst, int width, int height,
     }
 }
 
+typedef struct {
+    const Uint8 *src;
+    Uint8 *dst;
+    int width;
+    int height;
+    PG_CameraPacking pack;
+} CameraYUV420ToYUV;
+
+/* yuv420_to_yuv over the rows [first, last), of an even width */
+static void
+camera_yuv420_to_yuv_rows(void *ctx, int first, int last)
+{
+    CameraYUV420ToYUV *c = (CameraYUV420ToYUV *)ctx;
+    Sint64 size = (Sint64)c->width * c->height;
+    const Uint8 *y, *u, *v;
+    Uint8 *d;
+    int row, x;
+
+    for (row = first; row < last; ++row) {
+        y = c->src + (Sint64)row * c->width;
+        u = c->src + size + (Sint64)(row / 2) * (c->width / 2);
+        v = u + size / 4;
+        d = c->dst + (Sint64)row * c->width * c->pack.bpp;
+
+        x = 0;
+        if (camera_has_avx2) {
+            x = camera_yuv420_to_yuv_avx2(y, u, v, d, c->width, &c->pack);
+        }
+        if (!x && camera_has_sse2) {
+            x = camera_yuv420_to_yuv_sse2(y, u, v, d, c->width, &c->pack);
+        }
+        for (; x < c->width; ++x) {
+            camera_put_pixel(d + x * c->pack.bpp, y[x], u[x / 2], v[x / 2],
+                             &c->pack);
+        }
+    }
+}
+
 /* turn yuv420 into packed yuv. */
 void
 yuv420_to_yuv(const void *src, void *dst, int width, int height,
@@ -1665,6 +2502,17 @@ yuv420_to_yuv(const void *src, void *dst, int width, int height,
     Uint16 *d16_1, *d16_2;
     Uint32 *d32_1, *d32_2;
     int rshift, gshift, bshift, rloss, gloss, bloss, j, i;
+    CameraYUV420ToYUV ctx;
+
+    if (width % 2 == 0 && camera_packing(format, &ctx.pack)) {
+        ctx.src = (const Uint8 *)src;
+        ctx.dst = (Uint8 *)dst;
+        ctx.width = width;
+        ctx.height = height;
+        camera_run_rows(camera_yuv420_to_yuv_rows, &ctx, height / 2 * 2,
+                        (Sint64)width * height * ctx.pack.bpp);
+        return;
+    }
 
     rshift = format->Rshift;
     gshift = format->Gshift;
@@ -1801,6 +2649,8 @@ PyMethodDef cameraobj_builtins[] = {
      DOC_CAMERA_CAMERA_GETIMAGE},
     {"get_raw", (PyCFunction)camera_get_raw, METH_NOARGS,
      DOC_CAMERA_CAMERA_GETRAW},
+    {"get_raw_view", (PyCFunction)camera_get_raw_view, METH_NOARGS,
+     DOC_CAMERA_CAMERA_GETRAWVIEW},
     {NULL, NULL, 0, NULL}};
 
 void
@@ -1868,6 +2718,7 @@ camera_init(pgCameraObject *self, PyObject *arg, PyObject *kwargs)
     self->vflip = 0;
     self->brightness = 0;
     self->fd = -1;
+    self->raw_views = 0;
 
     return 0;
 #elif defined(PYGAME_WINDOWS_CAMERA)
@@ -1948,6 +2799,12 @@ PyTypeObject pgCamera_Type = {
 PyMethodDef camera_builtins[] = {
     {"colorspace", surf_colorspace, METH_VARARGS, DOC_CAMERA_COLORSPACE},
     {"list_cameras", list_cameras, METH_NOARGS, DOC_CAMERA_LISTCAMERAS},
+    {"_convert_frame", (PyCFunction)camera_convert_frame,
+     METH_VARARGS | METH_KEYWORDS, NULL},
+#if defined(__unix__)
+    {"_start_mock", (PyCFunction)camera_start_mock,
+     METH_VARARGS | METH_KEYWORDS, NULL},
+#endif
     {NULL, NULL, 0, NULL}};
 
 MODINIT_DEFINE(_camera)
@@ -1976,11 +2833,19 @@ MODINIT_DEFINE(_camera)
         return NULL;
     }
 
+    camera_has_avx2 = SDL_HasAVX2();
+    camera_has_sse2 = SDL_HasSSE2() || SDL_HasNEON();
+
     /* type preparation */
     pgCamera_Type.tp_new = PyType_GenericNew;
     if (PyType_Ready(&pgCamera_Type) < 0) {
         return NULL;
     }
+#if defined(__unix__)
+    if (PyType_Ready(&pgCameraRawView_Type) < 0) {
+        return NULL;
+    }
+#endif
 
     /* create the module */
     module = PyModule_Create(&_module);
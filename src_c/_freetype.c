@@ -85,6 +85,8 @@ _ftfont_getmetrics(pgFontObject *, PyObject *, PyObject *);
 static PyObject *
 _ftfont_render(pgFontObject *, PyObject *, PyObject *);
 static PyObject *
+_ftfont_render_many(pgFontObject *, PyObject *, PyObject *);
+static PyObject *
 _ftfont_render_to(pgFontObject *, PyObject *, PyObject *);
 static PyObject *
 _ftfont_render_raw(pgFontObject *, PyObject *, PyObject *);
@@ -543,6 +545,8 @@ static PyMethodDef _ftfont_methods[] = {
      DOC_FREETYPE_FONT_GETSIZES},
     {"render", (PyCFunction)_ftfont_render, METH_VARARGS | METH_KEYWORDS,
      DOC_FREETYPE_FONT_RENDER},
+    {"render_many", (PyCFunction)_ftfont_render_many,
+     METH_VARARGS | METH_KEYWORDS, DOC_FREETYPE_FONT_RENDERMANY},
     {"render_to", (PyCFunction)_ftfont_render_to, METH_VARARGS | METH_KEYWORDS,
      DOC_FREETYPE_FONT_RENDERTO},
     {"render_raw", (PyCFunction)_ftfont_render_raw,
@@ -1960,6 +1964,359 @@ error:
     return 0;
 }
 
+/* Upper bound on the number of render_many worker threads. Each one has
+ * its own FreeType library, face and glyph cache. */
+#define PGFT_RENDER_MANY_MAX_THREADS 64
+
+typedef struct {
+    FreeTypeInstance *freetype; /* private to the worker */
+    pgFontObject font;          /* clone of the rendered font */
+    const FontRenderMode *mode;
+    FontColor fg_color;
+    FontColor bg_color;
+    int use_bg_color;
+
+    /* shared by all workers */
+    PGFT_String **texts;
+    SDL_Surface **surfaces;
+    SDL_Rect *rects;
+    int count;
+    SDL_atomic_t *next_index;
+    SDL_atomic_t *failed;
+
+    int error;
+} RenderManyTask;
+
+/* Render texts, taken in turn from the shared index, until none are left or
+ * another worker failed. Runs without the GIL. */
+static int SDLCALL
+_render_many_worker(void *data)
+{
+    RenderManyTask *task = (RenderManyTask *)data;
+    int i;
+
+    while (!SDL_AtomicGet(task->failed)) {
+        i = SDL_AtomicAdd(task->next_index, 1);
+        if (i >= task->count) {
+            break;
+        }
+        task->surfaces[i] = _PGFT_Render_NewSurface(
+            task->freetype, &task->font, task->mode, task->texts[i],
+            &task->fg_color, task->use_bg_color ? &task->bg_color : 0,
+            &task->rects[i]);
+        if (!task->surfaces[i]) {
+            task->error = 1;
+            SDL_AtomicSet(task->failed, 1);
+            break;
+        }
+    }
+    return 0;
+}
+
+/* Render all texts with nthreads clones of self, the calling thread
+ * being one of the workers. Returns -1 with a Python exception set on
+ * failure. */
+static int
+_render_many_threaded(pgFontObject *self, const FontRenderMode *mode,
+                      FontColor *fg_color, FontColor *bg_color,
+                      PGFT_String **texts, SDL_Surface **surfaces,
+                      SDL_Rect *rects, int count, int nthreads)
+{
+    RenderManyTask *tasks;
+    SDL_Thread **threads;
+    SDL_atomic_t next_index;
+    SDL_atomic_t failed;
+    int result = -1;
+    int n;
+
+    tasks = PyMem_Calloc(nthreads, sizeof(RenderManyTask));
+    threads = PyMem_Calloc(nthreads, sizeof(SDL_Thread *));
+    if (!tasks || !threads) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+    SDL_AtomicSet(&next_index, 0);
+    SDL_AtomicSet(&failed, 0);
+
+    /* The worker instances are set up while the GIL is still held */
+    for (n = 0; n < nthreads; ++n) {
+        RenderManyTask *task = &tasks[n];
+
+        if (_PGFT_Init(&task->freetype, self->freetype->cache_size)) {
+            goto cleanup;
+        }
+        if (_PGFT_Font_InitClone(task->freetype, &task->font, self)) {
+            goto cleanup;
+        }
+        task->freetype->nogil = 1;
+        task->mode = mode;
+        task->fg_color = *fg_color;
+        if (bg_color) {
+            task->bg_color = *bg_color;
+            task->use_bg_color = 1;
+        }
+        task->texts = texts;
+        task->surfaces = surfaces;
+        task->rects = rects;
+        task->count = count;
+        task->next_index = &next_index;
+        task->failed = &failed;
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    /* If a thread cannot be started, its share of the work is simply taken
+     * by the other workers */
+    for (n = 1; n < nthreads; ++n) {
+        threads[n] = SDL_CreateThread(_render_many_worker,
+                                      "pg_ft_render_many", &tasks[n]);
+    }
+    _render_many_worker(&tasks[0]);
+    for (n = 1; n < nthreads; ++n) {
+        if (threads[n]) {
+            SDL_WaitThread(threads[n], NULL);
+        }
+    }
+    Py_END_ALLOW_THREADS;
+
+    result = 0;
+    for (n = 0; n < nthreads; ++n) {
+        FreeTypeInstance *ft = tasks[n].freetype;
+
+        if (tasks[n].error) {
+            ft->nogil = 0;
+            _PGFT_RaiseError(
+                ft, ft->_error_type ? ft->_error_type : pgExc_SDLError,
+                _PGFT_GetError(ft));
+            result = -1;
+            break;
+        }
+    }
+
+cleanup:
+    if (tasks) {
+        for (n = 0; n < nthreads; ++n) {
+            if (tasks[n].freetype) {
+                _PGFT_Font_FreeClone(tasks[n].freetype, &tasks[n].font);
+                _PGFT_Quit(tasks[n].freetype);
+            }
+        }
+    }
+    PyMem_Free(tasks);
+    PyMem_Free(threads);
+    return result;
+}
+
+static PyObject *
+_ftfont_render_many(pgFontObject *self, PyObject *args, PyObject *kwds)
+{
+    if (!FreetypeFont_GenerationCheck(self)) {
+        RAISE_FREETYPE_QUIT_ERROR(NULL);
+    }
+
+    /* keyword list */
+    static char *kwlist[] = {"texts",    "fgcolor", "bgcolor", "style",
+                             "rotation", "size",    "threads", 0};
+
+    /* input arguments */
+    PyObject *textsobj = 0;
+    PyObject *seq = 0;
+    Scale_t face_size = FACE_SIZE_NONE;
+    PyObject *fg_color_obj = 0;
+    PyObject *bg_color_obj = 0;
+    Angle_t rotation = self->rotation;
+    int style = FT_STYLE_DEFAULT;
+    int nthreads = 0;
+
+    /* output arguments */
+    PyObject *rlist = 0;
+
+    PGFT_String **texts = 0;
+    SDL_Surface **surfaces = 0;
+    SDL_Rect *rects = 0;
+    Py_ssize_t count = 0;
+    Py_ssize_t i;
+
+    FontColor fg_color;
+    FontColor bg_color;
+    FontColor *bg_color_ptr;
+    FontRenderMode render;
+
+    ASSERT_SELF_IS_ALIVE(self);
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|OOiO&O&i", kwlist,
+                                     /* required */
+                                     &textsobj,
+                                     /* optional */
+                                     &fg_color_obj, &bg_color_obj, &style,
+                                     obj_to_rotation, (void *)&rotation,
+                                     obj_to_scale, (void *)&face_size,
+                                     &nthreads)) {
+        return 0;
+    }
+
+    if (nthreads < 0) {
+        return RAISE(PyExc_ValueError, "threads must not be negative");
+    }
+
+    if (fg_color_obj == Py_None) {
+        fg_color_obj = 0;
+    }
+    if (bg_color_obj == Py_None) {
+        bg_color_obj = 0;
+    }
+
+    if (fg_color_obj) {
+        if (!pg_RGBAFromObjEx(fg_color_obj, (Uint8 *)&fg_color,
+                              PG_COLOR_HANDLE_ALL)) {
+            /* Exception already set for us */
+            return 0;
+        }
+    }
+    else {
+        fg_color.r = self->fgcolor[0];
+        fg_color.g = self->fgcolor[1];
+        fg_color.b = self->fgcolor[2];
+        fg_color.a = self->fgcolor[3];
+    }
+
+    if (bg_color_obj) {
+        if (!pg_RGBAFromObjEx(bg_color_obj, (Uint8 *)&bg_color,
+                              PG_COLOR_HANDLE_ALL)) {
+            /* Exception already set for us */
+            return 0;
+        }
+    }
+    else if (self->is_bg_col_set) {
+        bg_color.r = self->bgcolor[0];
+        bg_color.g = self->bgcolor[1];
+        bg_color.b = self->bgcolor[2];
+        bg_color.a = self->bgcolor[3];
+    }
+    bg_color_ptr = (bg_color_obj || self->is_bg_col_set) ? &bg_color : 0;
+
+    if (_PGFT_BuildRenderMode(self->freetype, self, &render, face_size, style,
+                              rotation)) {
+        return 0;
+    }
+
+    seq = PySequence_Fast(textsobj, "texts must be a sequence of strings");
+    if (!seq) {
+        return 0;
+    }
+    count = PySequence_Fast_GET_SIZE(seq);
+    if (count > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "too many texts");
+        goto error;
+    }
+
+    texts = PyMem_Calloc(count ? count : 1, sizeof(PGFT_String *));
+    surfaces = PyMem_Calloc(count ? count : 1, sizeof(SDL_Surface *));
+    rects = PyMem_Calloc(count ? count : 1, sizeof(SDL_Rect));
+    if (!texts || !surfaces || !rects) {
+        PyErr_NoMemory();
+        goto error;
+    }
+
+    /* Encode all texts up front, while the GIL is held */
+    for (i = 0; i < count; ++i) {
+        texts[i] = _PGFT_EncodePyString(PySequence_Fast_GET_ITEM(seq, i),
+                                        self->render_flags & FT_RFLAG_UCS4);
+        if (!texts[i]) {
+            goto error;
+        }
+    }
+
+    if (!nthreads) {
+        nthreads = SDL_GetCPUCount();
+    }
+    if (nthreads > PGFT_RENDER_MANY_MAX_THREADS) {
+        nthreads = PGFT_RENDER_MANY_MAX_THREADS;
+    }
+    if (nthreads > count) {
+        nthreads = (int)count;
+    }
+
+#if defined(__EMSCRIPTEN__) || defined(__wasi__)
+    /* no threads on WASM */
+    nthreads = 1;
+#endif
+
+    if (nthreads > 1 && self->id.open_args.flags == FT_OPEN_PATHNAME) {
+        if (_render_many_threaded(self, &render, &fg_color, bg_color_ptr,
+                                  texts, surfaces, rects, (int)count,
+                                  nthreads)) {
+            goto error;
+        }
+    }
+    else {
+        /* A font read from a file object shares one stream, which cannot be
+         * read concurrently, so it is rendered here one text at a time */
+        for (i = 0; i < count; ++i) {
+            surfaces[i] =
+                _PGFT_Render_NewSurface(self->freetype, self, &render,
+                                        texts[i], &fg_color, bg_color_ptr,
+                                        &rects[i]);
+            if (!surfaces[i]) {
+                goto error;
+            }
+        }
+    }
+
+    rlist = PyList_New(count);
+    if (!rlist) {
+        goto error;
+    }
+    for (i = 0; i < count; ++i) {
+        PyObject *surface_obj;
+        PyObject *rect_obj;
+        PyObject *rtuple;
+
+        surface_obj = (PyObject *)pgSurface_New(surfaces[i]);
+        if (!surface_obj) {
+            goto error;
+        }
+        surfaces[i] = 0; /* now owned by surface_obj */
+
+        rect_obj = pgRect_New(&rects[i]);
+        if (!rect_obj) {
+            Py_DECREF(surface_obj);
+            goto error;
+        }
+        rtuple = PyTuple_Pack(2, surface_obj, rect_obj);
+        Py_DECREF(surface_obj);
+        Py_DECREF(rect_obj);
+        if (!rtuple) {
+            goto error;
+        }
+        PyList_SET_ITEM(rlist, i, rtuple);
+    }
+
+    for (i = 0; i < count; ++i) {
+        free_string(texts[i]);
+    }
+    PyMem_Free(texts);
+    PyMem_Free(surfaces);
+    PyMem_Free(rects);
+    Py_DECREF(seq);
+    return rlist;
+
+error:
+    for (i = 0; i < count; ++i) {
+        if (texts) {
+            free_string(texts[i]);
+        }
+        if (surfaces && surfaces[i]) {
+            SDL_FreeSurface(surfaces[i]);
+        }
+    }
+    PyMem_Free(texts);
+    PyMem_Free(surfaces);
+    PyMem_Free(rects);
+    Py_XDECREF(rlist);
+    Py_DECREF(seq);
+    return 0;
+}
+
 static PyObject *
 _ftfont_render_to(pgFontObject *self, PyObject *args, PyObject *kwds)
 {
@@ -2065,6 +2422,7 @@ _ftfont_render_to(pgFontObject *self, PyObject *args, PyObject *kwds)
         PyErr_SetString(pgExc_SDLError, "display Surface quit");
         goto error;
     }
+    pgSurface_Touch((pgSurfaceObject *)surface_obj);
     if (_PGFT_Render_ExistingSurface(
             self->freetype, self, &render, text, surface, xpos, ypos,
             &fg_color, (bg_color_obj || self->is_bg_col_set) ? &bg_color : 0,
@@ -644,7 +644,16 @@ typedef enum {
  */
 struct pgEventObject {
     PyObject_HEAD int type;
+    /* NULL until first needed for events taken from the queue, use
+     * pgEvent_GetDict to access it */
     PyObject *dict;
+    /* unicode of KEYDOWN/KEYUP events, captured when the event is taken */
+    char unicode[4];
+    /* joystick device index and pygame.Window, also captured when the event
+     * is taken, see _pg_event_joy and _pg_event_window */
+    int joy;
+    PyObject *window;
+    SDL_Event event;
 };
 
 /*
@@ -686,6 +695,39 @@ typedef enum {
  */
 #include "include/_pygame.h"
 
+/* Marks a surface, and the surfaces it is a subsurface of, as written to by
+ * bumping their generation (Surface.get_generation). Reads lock surfaces
+ * too, so pgSurface_Lock doesn't do this: every write path calls it, as do
+ * Surface.unlock() and releasing a buffer export, which may have been
+ * written through. */
+static inline void
+pgSurface_Touch(pgSurfaceObject *surfobj)
+{
+    while (surfobj) {
+        surfobj->generation++;
+        surfobj = surfobj->subsurface
+                      ? (pgSurfaceObject *)surfobj->subsurface->owner
+                      : NULL;
+    }
+}
+
+/* Surface.get_generation. Writes to a parent show through a subsurface,
+ * and writes to the subsurface bump the parents, so the sum up the chain
+ * changes whenever any pixel the surface shows may have changed. */
+static inline Uint64
+pgSurface_GetGeneration(pgSurfaceObject *surfobj)
+{
+    Uint64 generation = 0;
+
+    while (surfobj) {
+        generation += surfobj->generation;
+        surfobj = surfobj->subsurface
+                      ? (pgSurfaceObject *)surfobj->subsurface->owner
+                      : NULL;
+    }
+    return generation;
+}
+
 /* Slot counts.
  * Remember to keep these constants up to date.
  */
@@ -693,13 +735,13 @@ typedef enum {
 #define PYGAMEAPI_RECT_NUMSLOTS 10
 #define PYGAMEAPI_JOYSTICK_NUMSLOTS 3
 #define PYGAMEAPI_DISPLAY_NUMSLOTS 2
-#define PYGAMEAPI_SURFACE_NUMSLOTS 4
+#define PYGAMEAPI_SURFACE_NUMSLOTS 5
 #define PYGAMEAPI_SURFLOCK_NUMSLOTS 6
 #define PYGAMEAPI_RWOBJECT_NUMSLOTS 5
 #define PYGAMEAPI_PIXELARRAY_NUMSLOTS 2
 #define PYGAMEAPI_COLOR_NUMSLOTS 5
-#define PYGAMEAPI_BASE_NUMSLOTS 30
-#define PYGAMEAPI_EVENT_NUMSLOTS 10
+#define PYGAMEAPI_BASE_NUMSLOTS 31
+#define PYGAMEAPI_EVENT_NUMSLOTS 11
 #define PYGAMEAPI_WINDOW_NUMSLOTS 1
 #define PYGAMEAPI_RENDER_NUMSLOTS 3
 #define PYGAMEAPI_GEOMETRY_NUMSLOTS 2
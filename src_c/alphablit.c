@@ -26,6 +26,7 @@
 #include "_surface.h"
 #include "simd_shared.h"
 #include "simd_blitters.h"
+#include "pgperf.h"
 
 static void
 alphablit_alpha(SDL_BlitInfo *info);
@@ -62,6 +63,10 @@ static int
 SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                SDL_Rect *dstrect, int blend_flags);
 
+/* counts the blit kernel that just ran, see pgperf.h */
+#define COUNT_BLIT(id) \
+    PG_PERF_COUNT(perf, id, (Uint64)info.width * info.height)
+
 static int
 SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                SDL_Rect *dstrect, int blend_flags)
@@ -160,6 +165,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                 blend_flags = PYGAME_BLEND_MULT;
             }
 
+            PG_PERF_START(perf);
             switch (blend_flags) {
                 case 0: {
                     if (info.src_blend != SDL_BLENDMODE_NONE &&
@@ -178,6 +184,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                                 if (info.src_blanket_alpha != 255) {
                                     alphablit_alpha_avx2_argb_surf_alpha(
                                         &info);
+                                    COUNT_BLIT(BLIT_ALPHA_AVX2);
                                 }
                                 else if (SDL_ISPIXELFORMAT_ALPHA(
                                              PG_SURF_FORMATENUM(dst)) &&
@@ -185,10 +192,12 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                                              SDL_BLENDMODE_NONE) {
                                     alphablit_alpha_avx2_argb_no_surf_alpha(
                                         &info);
+                                    COUNT_BLIT(BLIT_ALPHA_AVX2);
                                 }
                                 else {
                                     alphablit_alpha_avx2_argb_no_surf_alpha_opaque_dst(
                                         &info);
+                                    COUNT_BLIT(BLIT_ALPHA_AVX2);
                                 }
                                 break;
                             }
@@ -197,6 +206,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                                 if (info.src_blanket_alpha != 255) {
                                     alphablit_alpha_sse2_argb_surf_alpha(
                                         &info);
+                                    COUNT_BLIT(BLIT_ALPHA_SSE2);
                                 }
                                 else if (SDL_ISPIXELFORMAT_ALPHA(
                                              PG_SURF_FORMATENUM(dst)) &&
@@ -204,10 +214,12 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                                              SDL_BLENDMODE_NONE) {
                                     alphablit_alpha_sse2_argb_no_surf_alpha(
                                         &info);
+                                    COUNT_BLIT(BLIT_ALPHA_SSE2);
                                 }
                                 else {
                                     alphablit_alpha_sse2_argb_no_surf_alpha_opaque_dst(
                                         &info);
+                                    COUNT_BLIT(BLIT_ALPHA_SSE2);
                                 }
                                 break;
                             }
@@ -216,12 +228,15 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                         alphablit_alpha(&info);
+                        COUNT_BLIT(BLIT_ALPHA_SCALAR);
                     }
                     else if (info.src_has_colorkey) {
                         alphablit_colorkey(&info);
+                        COUNT_BLIT(BLIT_COLORKEY);
                     }
                     else {
                         alphablit_solid(&info);
+                        COUNT_BLIT(BLIT_SOLID);
                     }
                     break;
                 }
@@ -237,6 +252,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgb_add_avx2(&info);
+                        COUNT_BLIT(BLIT_ADD_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -249,12 +265,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgb_add_sse2(&info);
+                        COUNT_BLIT(BLIT_ADD_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_add(&info);
+                    COUNT_BLIT(BLIT_ADD_SCALAR);
                     break;
                 }
                 case PYGAME_BLEND_SUB: {
@@ -269,6 +287,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgb_sub_avx2(&info);
+                        COUNT_BLIT(BLIT_SUB_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -281,12 +300,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgb_sub_sse2(&info);
+                        COUNT_BLIT(BLIT_SUB_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_sub(&info);
+                    COUNT_BLIT(BLIT_SUB_SCALAR);
                     break;
                 }
                 case PYGAME_BLEND_MULT: {
@@ -301,6 +322,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgb_mul_avx2(&info);
+                        COUNT_BLIT(BLIT_MULT_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -313,12 +335,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgb_mul_sse2(&info);
+                        COUNT_BLIT(BLIT_MULT_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_mul(&info);
+                    COUNT_BLIT(BLIT_MULT_SCALAR);
                     break;
                 }
                 case PYGAME_BLEND_MIN: {
@@ -333,6 +357,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgb_min_avx2(&info);
+                        COUNT_BLIT(BLIT_MIN_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -345,12 +370,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgb_min_sse2(&info);
+                        COUNT_BLIT(BLIT_MIN_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_min(&info);
+                    COUNT_BLIT(BLIT_MIN_SCALAR);
                     break;
                 }
                 case PYGAME_BLEND_MAX: {
@@ -365,6 +392,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgb_max_avx2(&info);
+                        COUNT_BLIT(BLIT_MAX_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -377,12 +405,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                           info.src->Amask != info.dst->Amask) &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgb_max_sse2(&info);
+                        COUNT_BLIT(BLIT_MAX_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_max(&info);
+                    COUNT_BLIT(BLIT_MAX_SCALAR);
                     break;
                 }
 
@@ -397,6 +427,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgba_add_avx2(&info);
+                        COUNT_BLIT(BLIT_RGBA_ADD_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -408,12 +439,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgba_add_sse2(&info);
+                        COUNT_BLIT(BLIT_RGBA_ADD_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_rgba_add(&info);
+                    COUNT_BLIT(BLIT_RGBA_ADD_SCALAR);
                     break;
                 }
                 case PYGAME_BLEND_RGBA_SUB: {
@@ -427,6 +460,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgba_sub_avx2(&info);
+                        COUNT_BLIT(BLIT_RGBA_SUB_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -438,12 +472,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgba_sub_sse2(&info);
+                        COUNT_BLIT(BLIT_RGBA_SUB_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_rgba_sub(&info);
+                    COUNT_BLIT(BLIT_RGBA_SUB_SCALAR);
                     break;
                 }
                 case PYGAME_BLEND_RGBA_MULT: {
@@ -457,6 +493,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgba_mul_avx2(&info);
+                        COUNT_BLIT(BLIT_RGBA_MULT_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -468,12 +505,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgba_mul_sse2(&info);
+                        COUNT_BLIT(BLIT_RGBA_MULT_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_rgba_mul(&info);
+                    COUNT_BLIT(BLIT_RGBA_MULT_SCALAR);
                     break;
                 }
                 case PYGAME_BLEND_RGBA_MIN: {
@@ -487,6 +526,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgba_min_avx2(&info);
+                        COUNT_BLIT(BLIT_RGBA_MIN_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -498,12 +538,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgba_min_sse2(&info);
+                        COUNT_BLIT(BLIT_RGBA_MIN_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_rgba_min(&info);
+                    COUNT_BLIT(BLIT_RGBA_MIN_SCALAR);
                     break;
                 }
                 case PYGAME_BLEND_RGBA_MAX: {
@@ -517,6 +559,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_rgba_max_avx2(&info);
+                        COUNT_BLIT(BLIT_RGBA_MAX_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -528,12 +571,14 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_rgba_max_sse2(&info);
+                        COUNT_BLIT(BLIT_RGBA_MAX_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
                     blit_blend_rgba_max(&info);
+                    COUNT_BLIT(BLIT_RGBA_MAX_SCALAR);
                     break;
                 }
                 case PYGAME_BLEND_PREMULTIPLIED: {
@@ -547,6 +592,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_has_avx2() && (src != dst)) {
                         blit_blend_premultiplied_avx2(&info);
+                        COUNT_BLIT(BLIT_PREMULTIPLIED_AVX2);
                         break;
                     }
 #if PG_ENABLE_SSE_NEON
@@ -559,6 +605,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
                         info.src_blend != SDL_BLENDMODE_NONE &&
                         pg_HasSSE_NEON() && (src != dst)) {
                         blit_blend_premultiplied_sse2(&info);
+                        COUNT_BLIT(BLIT_PREMULTIPLIED_SSE2);
                         break;
                     }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -566,6 +613,7 @@ SoftBlitPyGame(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
 #endif /* __EMSCRIPTEN__ */
 
                     blit_blend_premultiplied(&info);
+                    COUNT_BLIT(BLIT_PREMULTIPLIED_SCALAR);
                     break;
                 }
                 default: {
@@ -1693,9 +1741,11 @@ pygame_AlphaBlit(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
     return pygame_Blit(src, srcrect, dst, dstrect, blend_flags);
 }
 
-// Returns -1 if has no alpha channel, -2 on SDL error
-int
-premul_surf_color_by_alpha(SDL_Surface *src, SDL_Surface *dst)
+// Returns -1 if has no alpha channel, -2 on SDL error. Sets kernel to the
+// path that was taken, for the caller to count.
+static int
+premul_surf_color_by_alpha_path(SDL_Surface *src, SDL_Surface *dst,
+                                pgPerfKernel *kernel)
 {
     SDL_BlendMode src_blend;
     SDL_GetSurfaceBlendMode(src, &src_blend);
@@ -1716,17 +1766,20 @@ premul_surf_color_by_alpha(SDL_Surface *src, SDL_Surface *dst)
 #if SDL_BYTEORDER == SDL_LIL_ENDIAN
     if ((PG_SURF_BytesPerPixel(src) == 4) && pg_has_avx2()) {
         premul_surf_color_by_alpha_avx2(src, dst);
+        *kernel = PG_PERF_PREMUL_ALPHA_AVX2;
         return 0;
     }
 #if defined(__SSE2__)
     if ((PG_SURF_BytesPerPixel(src) == 4) && SDL_HasSSE2()) {
         premul_surf_color_by_alpha_sse2(src, dst);
+        *kernel = PG_PERF_PREMUL_ALPHA_SSE2;
         return 0;
     }
 #endif /* __SSE2__*/
 #if PG_ENABLE_ARM_NEON
     if ((PG_SURF_BytesPerPixel(src) == 4) && SDL_HasNEON()) {
         premul_surf_color_by_alpha_sse2(src, dst);
+        *kernel = PG_PERF_PREMUL_ALPHA_SSE2;
         return 0;
     }
 #endif /* PG_ENABLE_ARM_NEON */
@@ -1734,9 +1787,35 @@ premul_surf_color_by_alpha(SDL_Surface *src, SDL_Surface *dst)
 #endif /* __EMSCRIPTEN__ */
     premul_surf_color_by_alpha_non_simd(src, src_format, src_palette, dst,
                                         dst_format, dst_palette);
+    *kernel = PG_PERF_PREMUL_ALPHA_SCALAR;
     return 0;
 }
 
+// Returns -1 if has no alpha channel, -2 on SDL error. Not counted, as the
+// C API lets this run without the GIL (image decode workers do).
+int
+premul_surf_color_by_alpha(SDL_Surface *src, SDL_Surface *dst)
+{
+    pgPerfKernel kernel;
+
+    return premul_surf_color_by_alpha_path(src, dst, &kernel);
+}
+
+// premul_surf_color_by_alpha counted in get_perf_counters, call with the GIL
+// held.
+int
+premul_surf_color_by_alpha_counted(SDL_Surface *src, SDL_Surface *dst)
+{
+    pgPerfKernel kernel;
+    PG_PERF_START(perf);
+    int result = premul_surf_color_by_alpha_path(src, dst, &kernel);
+
+    if (!result) {
+        PG_PERF_COUNT_KERNEL(perf, kernel, (Uint64)src->w * src->h);
+    }
+    return result;
+}
+
 void
 premul_surf_color_by_alpha_non_simd(SDL_Surface *src,
                                     PG_PixelFormat *src_format,
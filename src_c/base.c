@@ -28,6 +28,7 @@
 #include "doc/pygame_doc.h"
 #include "pgarrinter.h"
 #include "pgcompat.h"
+#include "pgperf.h"
 
 /* This file controls all the initialization of
  * the module and the various SDL subsystems
@@ -82,6 +83,9 @@ static bool pg_sdl_was_init = 0;
 SDL_Window *pg_default_window = NULL;
 pgSurfaceObject *pg_default_screen = NULL;
 static int pg_env_blend_alpha_SDL2 = 0;
+/* Hot path counters, shared with the other modules through the C api. */
+static pgPerfState pg_perf = {0};
+pgPerfState *pg_perf_state = &pg_perf;
 
 static void
 pg_install_parachute(void);
@@ -2439,8 +2443,9 @@ MODINIT_DEFINE(base)
     c_api[27] = pg_GetDefaultConvertFormat;
     c_api[28] = pg_SetDefaultConvertFormat;
     c_api[29] = pgObject_getRectHelper;
+    c_api[PG_PERF_STATE_SLOT] = &pg_perf;
 
-#define FILLED_SLOTS 30
+#define FILLED_SLOTS 31
 
 #if PYGAMEAPI_BASE_NUMSLOTS != FILLED_SLOTS
 #error export slot count mismatch
@@ -120,6 +120,7 @@ typedef struct pgCameraObject {
     int vflip;
     int brightness;
     int fd;
+    unsigned int raw_views; /* buffers dequeued by get_raw_view() */
 } pgCameraObject;
 #elif defined(PYGAME_WINDOWS_CAMERA)
 typedef struct pgCameraObject {
@@ -231,6 +232,14 @@ int
 v4l2_close_device(pgCameraObject *self);
 int
 v4l2_open_device(pgCameraObject *self);
+int
+v4l2_mock_device(pgCameraObject *self, unsigned long pixelformat,
+                 unsigned int n_buffers);
+
+/* File descriptor of a camera started with v4l2_mock_device(); v4l2_xioctl
+   answers it from memory instead of calling into a driver */
+#define PG_V4L2_MOCK_FD -2
+#define PG_V4L2_MOCK_MAX_BUFFERS 32
 
 #elif defined(PYGAME_WINDOWS_CAMERA)
 /* internal functions specific to WINDOWS */
@@ -183,11 +183,101 @@ v4l2_read_raw(pgCameraObject *self)
  * and the HighGUI library in OpenCV.
  */
 
+/* State of the in-memory driver behind PG_V4L2_MOCK_FD. Queued buffers are
+   kept in the order they were queued, as the oldest one is dequeued first */
+static struct {
+    struct buffer *buffers;
+    unsigned int n_buffers;
+    unsigned int queue[PG_V4L2_MOCK_MAX_BUFFERS];
+    unsigned int head;
+    unsigned int queued;
+    unsigned int sequence;
+    int streaming;
+} v4l2_mock;
+
+static int
+v4l2_mock_is_queued(unsigned int index)
+{
+    unsigned int i;
+
+    for (i = 0; i < v4l2_mock.queued; ++i) {
+        if (v4l2_mock.queue[(v4l2_mock.head + i) % PG_V4L2_MOCK_MAX_BUFFERS] ==
+            index) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Answers the streaming ioctls for a camera started by v4l2_mock_device().
+   A queued buffer is captured into as soon as streaming is on: dequeuing it
+   fills it with the low byte of its frame sequence number. */
+static int
+v4l2_mock_ioctl(int request, void *arg)
+{
+    struct v4l2_buffer *buf = (struct v4l2_buffer *)arg;
+    struct buffer *mem;
+
+    switch ((unsigned int)request) {
+        case VIDIOC_QUERYBUF:
+            if (buf->index >= v4l2_mock.n_buffers) {
+                break;
+            }
+            buf->length = (__u32)v4l2_mock.buffers[buf->index].length;
+            buf->flags = 0;
+            if (v4l2_mock_is_queued(buf->index)) {
+                buf->flags = V4L2_BUF_FLAG_QUEUED;
+                if (v4l2_mock.streaming) {
+                    buf->flags |= V4L2_BUF_FLAG_DONE;
+                }
+            }
+            return 0;
+        case VIDIOC_QBUF:
+            if (buf->index >= v4l2_mock.n_buffers ||
+                v4l2_mock_is_queued(buf->index)) {
+                break;
+            }
+            v4l2_mock.queue[(v4l2_mock.head + v4l2_mock.queued++) %
+                            PG_V4L2_MOCK_MAX_BUFFERS] = buf->index;
+            return 0;
+        case VIDIOC_DQBUF:
+            if (!v4l2_mock.streaming || !v4l2_mock.queued) {
+                errno = EAGAIN;
+                return -1;
+            }
+            buf->index = v4l2_mock.queue[v4l2_mock.head];
+            v4l2_mock.head = (v4l2_mock.head + 1) % PG_V4L2_MOCK_MAX_BUFFERS;
+            v4l2_mock.queued--;
+
+            mem = &v4l2_mock.buffers[buf->index];
+            memset(mem->start, v4l2_mock.sequence & 0xff, mem->length);
+            buf->length = buf->bytesused = (__u32)mem->length;
+            buf->sequence = v4l2_mock.sequence++;
+            buf->flags = 0;
+            return 0;
+        case VIDIOC_STREAMON:
+            v4l2_mock.streaming = 1;
+            return 0;
+        case VIDIOC_STREAMOFF:
+            /* like a driver, this takes back every queued buffer */
+            v4l2_mock.streaming = 0;
+            v4l2_mock.head = v4l2_mock.queued = 0;
+            return 0;
+    }
+
+    errno = EINVAL;
+    return -1;
+}
+
 int
 v4l2_xioctl(int fd, int request, void *arg)
 {
     int r;
 
+    if (fd == PG_V4L2_MOCK_FD) {
+        return v4l2_mock_ioctl(request, arg);
+    }
+
     do {
         r = ioctl(fd, request, arg);
     } while (-1 == r && EINTR == errno);
@@ -473,6 +563,15 @@ v4l2_uninit_device(pgCameraObject *self)
 {
     unsigned int i;
 
+    if (self->fd == PG_V4L2_MOCK_FD) {
+        for (i = 0; i < self->n_buffers; ++i) {
+            free(self->buffers[i].start);
+        }
+        free(self->buffers);
+        memset(&v4l2_mock, 0, sizeof(v4l2_mock));
+        return 1;
+    }
+
     for (i = 0; i < self->n_buffers; ++i) {
         if (-1 == munmap(self->buffers[i].start, self->buffers[i].length)) {
             PyErr_Format(PyExc_MemoryError, "munmap failure: %d, %s", errno,
@@ -686,6 +785,10 @@ v4l2_close_device(pgCameraObject *self)
     if (self->fd == -1) {
         return 1;
     }
+    if (self->fd == PG_V4L2_MOCK_FD) {
+        self->fd = -1;
+        return 1;
+    }
 
     if (-1 == close(self->fd)) {
         PyErr_Format(PyExc_SystemError, "Cannot close '%s': %d, %s",
@@ -723,4 +826,78 @@ v4l2_open_device(pgCameraObject *self)
 
     return 1;
 }
+
+/* Starts self on the in-memory driver instead of a device, capturing
+   n_buffers frames of pixelformat at its width and height. Used to test the
+   streaming code without a camera; only one camera can use it at a time. */
+int
+v4l2_mock_device(pgCameraObject *self, unsigned long pixelformat,
+                 unsigned int n_buffers)
+{
+    size_t length, size = (size_t)self->width * self->height;
+    unsigned int i;
+
+    if (v4l2_mock.buffers) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "another camera is using the mock device");
+        return 0;
+    }
+    if (n_buffers < 2 || n_buffers > PG_V4L2_MOCK_MAX_BUFFERS) {
+        PyErr_Format(PyExc_ValueError, "buffers must be from 2 to %d",
+                     PG_V4L2_MOCK_MAX_BUFFERS);
+        return 0;
+    }
+
+    switch (pixelformat) {
+        case V4L2_PIX_FMT_RGB24:
+            length = size * 3;
+            break;
+        case V4L2_PIX_FMT_RGB444:
+        case V4L2_PIX_FMT_YUYV:
+        case V4L2_PIX_FMT_UYVY:
+            length = size * 2;
+            break;
+        case V4L2_PIX_FMT_SBGGR8:
+            length = size;
+            break;
+        case V4L2_PIX_FMT_YUV420:
+            length = size + 2 * (size_t)((self->width + 1) / 2) *
+                                ((self->height + 1) / 2);
+            break;
+        default:
+            PyErr_SetString(PyExc_ValueError, "unsupported pixelformat");
+            return 0;
+    }
+
+    self->buffers = calloc(n_buffers, sizeof(*self->buffers));
+    if (!self->buffers) {
+        PyErr_NoMemory();
+        return 0;
+    }
+    for (i = 0; i < n_buffers; ++i) {
+        self->buffers[i].length = length;
+        self->buffers[i].start = malloc(length);
+        if (!self->buffers[i].start) {
+            while (i--) {
+                free(self->buffers[i].start);
+            }
+            free(self->buffers);
+            self->buffers = NULL;
+            PyErr_NoMemory();
+            return 0;
+        }
+    }
+
+    self->camera_type = CAM_V4L2;
+    self->pixelformat = pixelformat;
+    self->size = self->width * self->height;
+    self->n_buffers = n_buffers;
+    self->fd = PG_V4L2_MOCK_FD;
+
+    memset(&v4l2_mock, 0, sizeof(v4l2_mock));
+    v4l2_mock.buffers = self->buffers;
+    v4l2_mock.n_buffers = n_buffers;
+
+    return v4l2_start_capturing(self);
+}
 #endif
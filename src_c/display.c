@@ -31,15 +31,24 @@
 
 #include "doc/display_doc.h"
 
+#include "simd_display.h"
+
 #include <SDL_syswm.h>
 
 static PyTypeObject pgVidInfo_Type;
+static PyTypeObject pgRecorder_Type;
+
+/* Recorder capturing the display after every flip() or update(), if any */
+static PyObject *pg_active_recorder = NULL;
 
 static PyObject *
 pgVidInfo_New(const pg_VideoInfo *info);
 
 static SDL_Renderer *pg_renderer = NULL;
 static SDL_Texture *pg_texture = NULL;
+/* pg_texture does not hold the display surface yet, because it is new or
+   the renderer lost it, so the next present must upload all of it */
+static int pg_texture_stale = 1;
 
 typedef struct _display_state_s {
     char *title;
@@ -182,6 +191,7 @@ pg_display_quit(PyObject *self, PyObject *_null)
 {
     _DisplayState *state = DISPLAY_STATE;
     _display_state_cleanup(state);
+    Py_CLEAR(pg_active_recorder);
     if (pg_GetDefaultWindowSurface()) {
         pgSurface_AsSurface(pg_GetDefaultWindowSurface()) = NULL;
         pg_SetDefaultWindowSurface(NULL);
@@ -714,6 +724,11 @@ pg_ResizeEventWatch(void *userdata, SDL_Event *event)
     _DisplayState *state;
     SDL_Window *window;
 
+    if (event->type == SDL_RENDER_TARGETS_RESET ||
+        event->type == SDL_RENDER_DEVICE_RESET) {
+        pg_texture_stale = 1;
+        return 0;
+    }
     if (event->type != SDL_WINDOWEVENT) {
         return 0;
     }
@@ -742,6 +757,7 @@ pg_ResizeEventWatch(void *userdata, SDL_Event *event)
             pg_texture =
                 SDL_CreateTexture(pg_renderer, SDL_PIXELFORMAT_ARGB8888,
                                   SDL_TEXTUREACCESS_STREAMING, w, h);
+            pg_texture_stale = 1;
         }
         return 0;
     }
@@ -1334,6 +1350,7 @@ pg_set_mode(PyObject *self, PyObject *arg, PyObject *kwds)
                     pg_texture = SDL_CreateTexture(
                         pg_renderer, SDL_PIXELFORMAT_ARGB8888,
                         SDL_TEXTUREACCESS_STREAMING, w, h);
+                    pg_texture_stale = 1;
                 }
                 surf = PG_CreateSurface(w, h, SDL_PIXELFORMAT_XRGB8888);
                 newownedsurf = surf;
@@ -1687,6 +1704,734 @@ pg_list_modes(PyObject *self, PyObject *args, PyObject *kwds)
     return list;
 }
 
+/* Recorder: writes frames of a surface, usually the display, to a file as
+ * YUV 4:2:0 video. Frames are converted on the capturing thread straight
+ * into a ring of buffers, which a writer thread drains to the file. */
+
+/* "FRAME\n", the header of each Y4M frame, which every buffer starts with
+ * so that a frame is written in one go */
+#define PG_RECORDER_FRAME_TAG 6
+
+typedef struct {
+    PyObject_HEAD SDL_RWops *rw;
+    int y4m; /* write a YUV4MPEG2 stream, otherwise bare I420 frames */
+    int fps;
+    int block;
+    int w, h; /* frame size, fixed by the first frame; 0 until then */
+    size_t frame_size; /* bytes of Y, U and V in a frame */
+    int nbuffers;
+    Uint8 **buffers;
+    Uint8 *scratch; /* two rows of pixels and one of Y, for odd formats */
+    int head;      /* next buffer for the writer */
+    int count;     /* buffers waiting for the writer */
+    int capturing; /* a frame is being converted without the GIL */
+    int header_written;
+    int quit;
+    int failed; /* the writer could not write, see error */
+    char error[256];
+    SDL_mutex *mutex;
+    SDL_cond *cond;
+    SDL_Thread *thread;
+    Py_ssize_t frames;
+    Py_ssize_t dropped;
+} pgRecorderObject;
+
+static int display_has_avx2 = 0;
+static int display_has_sse2 = 0;
+
+#define RECORDER_Y(r, g, b) ((77 * (r) + 150 * (g) + 29 * (b) + 128) >> 8)
+#define RECORDER_U(r, g, b) \
+    (((-38 * (r) - 74 * (g) + 112 * (b) + 128) >> 8) + 128)
+#define RECORDER_V(r, g, b) \
+    (((112 * (r) - 94 * (g) - 18 * (b) + 128) >> 8) + 128)
+
+/* Convert a pair of rows of 32 bit pixels to 4:2:0, with the same full
+ * range formulas as _camera.c's rgb_to_yuv. A lone last column is paired
+ * with itself. */
+static void
+recorder_yuv420_rows(const Uint8 *row0, const Uint8 *row1, Uint8 *y0,
+                     Uint8 *y1, Uint8 *u, Uint8 *v, int width, int rshift,
+                     int gshift, int bshift)
+{
+    const Uint32 *p0 = (const Uint32 *)row0;
+    const Uint32 *p1 = (const Uint32 *)row1;
+    int x = 0;
+
+    if (display_has_avx2) {
+        x = display_rgb_to_yuv420_avx2(row0, row1, y0, y1, u, v, width,
+                                       rshift, gshift, bshift);
+    }
+    if (!x && display_has_sse2) {
+        x = display_rgb_to_yuv420_sse2(row0, row1, y0, y1, u, v, width,
+                                       rshift, gshift, bshift);
+    }
+    for (; x < width; x += 2) {
+        int x1 = x + 1 < width ? x + 1 : x;
+        Uint32 px[4] = {p0[x], p0[x1], p1[x], p1[x1]};
+        int r = 0, g = 0, b = 0;
+        int i, cr, cg, cb;
+
+        for (i = 0; i < 4; ++i) {
+            cr = (px[i] >> rshift) & 0xff;
+            cg = (px[i] >> gshift) & 0xff;
+            cb = (px[i] >> bshift) & 0xff;
+            if (i == 0) {
+                y0[x] = RECORDER_Y(cr, cg, cb);
+            }
+            else if (i == 1 && x1 != x) {
+                y0[x1] = RECORDER_Y(cr, cg, cb);
+            }
+            else if (i == 2) {
+                y1[x] = RECORDER_Y(cr, cg, cb);
+            }
+            else if (x1 != x) {
+                y1[x1] = RECORDER_Y(cr, cg, cb);
+            }
+            r += cr;
+            g += cg;
+            b += cb;
+        }
+        r = (r + 2) >> 2;
+        g = (g + 2) >> 2;
+        b = (b + 2) >> 2;
+        u[x / 2] = RECORDER_U(r, g, b);
+        v[x / 2] = RECORDER_V(r, g, b);
+    }
+}
+
+/* Copy a row of any format to 32 bit pixels with R, G and B at bits 16, 8
+ * and 0 */
+static void
+recorder_unpack_row(const Uint8 *src, Uint32 *dst, int width,
+                    PG_PixelFormat *format, SDL_Palette *palette)
+{
+    int bpp = PG_FORMAT_BytesPerPixel(format);
+    Uint32 pixel;
+    Uint8 r, g, b;
+    int x;
+
+    for (x = 0; x < width; ++x, src += bpp) {
+        switch (bpp) {
+            case 1:
+                pixel = *src;
+                break;
+            case 2:
+                pixel = *(const Uint16 *)src;
+                break;
+            case 3:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+                pixel = src[0] | (src[1] << 8) | (src[2] << 16);
+#else
+                pixel = src[2] | (src[1] << 8) | (src[0] << 16);
+#endif
+                break;
+            default:
+                pixel = *(const Uint32 *)src;
+                break;
+        }
+        PG_GetRGB(pixel, format, palette, &r, &g, &b);
+        dst[x] = ((Uint32)r << 16) | ((Uint32)g << 8) | b;
+    }
+}
+
+/* Convert surf, which must be locked, to a Y plane followed by U and V
+ * planes of half the size, rounded up. Runs without the GIL. */
+static void
+recorder_convert(pgRecorderObject *self, SDL_Surface *surf,
+                 PG_PixelFormat *format, SDL_Palette *palette, Uint8 *frame)
+{
+    int w = surf->w, h = surf->h;
+    int cw = (w + 1) / 2;
+    Uint8 *yplane = frame;
+    Uint8 *uplane = yplane + (size_t)w * h;
+    Uint8 *vplane = uplane + (size_t)cw * ((h + 1) / 2);
+    Uint32 *rows = (Uint32 *)self->scratch;
+    Uint8 *ysink = self->scratch + (size_t)w * 8;
+    int rshift = 16, gshift = 8, bshift = 0;
+    int direct = 0;
+    int y;
+
+    if (PG_FORMAT_BytesPerPixel(format) == 4 && !PG_FORMAT_R_LOSS(format) &&
+        !PG_FORMAT_G_LOSS(format) && !PG_FORMAT_B_LOSS(format) &&
+        !(format->Rshift % 8) && !(format->Gshift % 8) &&
+        !(format->Bshift % 8)) {
+        direct = 1;
+        rshift = format->Rshift;
+        gshift = format->Gshift;
+        bshift = format->Bshift;
+    }
+
+    for (y = 0; y < h; y += 2) {
+        const Uint8 *row0 = (Uint8 *)surf->pixels + (size_t)y * surf->pitch;
+        const Uint8 *row1 = y + 1 < h ? row0 + surf->pitch : row0;
+        Uint8 *y0 = yplane + (size_t)y * w;
+        Uint8 *y1 = y + 1 < h ? y0 + w : ysink;
+
+        if (!direct) {
+            recorder_unpack_row(row0, rows, w, format, palette);
+            recorder_unpack_row(row1, rows + w, w, format, palette);
+            row0 = (Uint8 *)rows;
+            row1 = (Uint8 *)(rows + w);
+        }
+        recorder_yuv420_rows(row0, row1, y0, y1, uplane + (size_t)y / 2 * cw,
+                             vplane + (size_t)y / 2 * cw, w, rshift, gshift,
+                             bshift);
+    }
+}
+
+/* Write one converted frame, after the stream header if it is the first.
+ * Returns 0 with the SDL error set on failure. */
+static int
+recorder_write_frame(pgRecorderObject *self, const Uint8 *buffer)
+{
+    char header[128];
+    size_t size;
+
+    SDL_ClearError();
+    if (self->y4m && !self->header_written) {
+        size = (size_t)PyOS_snprintf(
+            header, sizeof(header),
+            "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg XCOLORRANGE=FULL\n",
+            self->w, self->h, self->fps);
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+        if (SDL_WriteIO(self->rw, header, size) != size) {
+#else
+        if (SDL_RWwrite(self->rw, header, size, 1) != 1) {
+#endif
+            goto error;
+        }
+        self->header_written = 1;
+    }
+    if (!self->y4m) {
+        buffer += PG_RECORDER_FRAME_TAG;
+    }
+    size = self->frame_size + (self->y4m ? PG_RECORDER_FRAME_TAG : 0);
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    if (SDL_WriteIO(self->rw, buffer, size) != size) {
+#else
+    if (SDL_RWwrite(self->rw, buffer, size, 1) != 1) {
+#endif
+        goto error;
+    }
+    return 1;
+
+error:
+    /* Python file objects print their exception rather than set one */
+    if (!*SDL_GetError()) {
+        SDL_SetError("could not write the recorded frame");
+    }
+    return 0;
+}
+
+/* Write out frames as they are captured, until told to quit and none are
+ * left. After a failed write the rest are thrown away. */
+static int SDLCALL
+_recorder_writer(void *data)
+{
+    pgRecorderObject *self = (pgRecorderObject *)data;
+    int ok;
+
+    SDL_LockMutex(self->mutex);
+    for (;;) {
+        while (!self->count && !self->quit) {
+            SDL_CondWait(self->cond, self->mutex);
+        }
+        if (!self->count) {
+            break;
+        }
+        SDL_UnlockMutex(self->mutex);
+
+        ok = self->failed ||
+             recorder_write_frame(self, self->buffers[self->head]);
+
+        SDL_LockMutex(self->mutex);
+        if (!ok) {
+            SDL_strlcpy(self->error, SDL_GetError(), sizeof(self->error));
+            self->failed = 1;
+        }
+        self->head = (self->head + 1) % self->nbuffers;
+        --self->count;
+        SDL_CondBroadcast(self->cond);
+    }
+    SDL_UnlockMutex(self->mutex);
+    return 0;
+}
+
+/* Size the ring for the first frame and start the writer */
+static int
+recorder_setup(pgRecorderObject *self, int w, int h)
+{
+    int i;
+
+    self->frame_size = (size_t)w * h + 2 * (size_t)((w + 1) / 2) *
+                                           (size_t)((h + 1) / 2);
+    self->buffers = PyMem_Calloc(self->nbuffers, sizeof(Uint8 *));
+    self->scratch = PyMem_Malloc((size_t)w * 9 + 1);
+    if (!self->buffers || !self->scratch) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < self->nbuffers; ++i) {
+        self->buffers[i] =
+            PyMem_Malloc(PG_RECORDER_FRAME_TAG + self->frame_size);
+        if (!self->buffers[i]) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        memcpy(self->buffers[i], "FRAME\n", PG_RECORDER_FRAME_TAG);
+    }
+    self->w = w;
+    self->h = h;
+
+#if !defined(__EMSCRIPTEN__) && !defined(__wasi__)
+    self->thread =
+        SDL_CreateThread(_recorder_writer, "pg_display_recorder", self);
+    if (!self->thread) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+/* Add a frame of surfobj to the recording. When the ring is full, waits
+ * for the writer or drops the frame, as the recorder was asked to. A frame
+ * of the wrong size is an error if strict, otherwise it is dropped. */
+static int
+recorder_capture(pgRecorderObject *self, pgSurfaceObject *surfobj,
+                 int strict)
+{
+    SDL_Surface *surf = pgSurface_AsSurface(surfobj);
+    PG_PixelFormat *format;
+    SDL_Palette *palette;
+    int slot;
+
+    if (!self->rw) {
+        PyErr_SetString(PyExc_ValueError, "the Recorder is closed");
+        return -1;
+    }
+    if (!surf) {
+        PyErr_SetString(pgExc_SDLError, "display Surface quit");
+        return -1;
+    }
+    if (!PG_GetSurfaceDetails(surf, &format, &palette)) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        return -1;
+    }
+    if (self->failed) {
+        PyErr_SetString(pgExc_SDLError, self->error);
+        return -1;
+    }
+    if (!self->w) {
+        if (surf->w < 1 || surf->h < 1) {
+            PyErr_SetString(PyExc_ValueError, "cannot record an empty frame");
+            return -1;
+        }
+        if (recorder_setup(self, surf->w, surf->h) < 0) {
+            return -1;
+        }
+    }
+    else if (surf->w != self->w || surf->h != self->h) {
+        if (strict) {
+            PyErr_Format(PyExc_ValueError,
+                         "frame size (%d, %d) does not match the recording "
+                         "size (%d, %d)",
+                         surf->w, surf->h, self->w, self->h);
+            return -1;
+        }
+        ++self->dropped;
+        return 0;
+    }
+
+    /* The mutex is only taken with the GIL released, so that no thread
+     * blocks on it while holding the GIL that its owner is waiting for */
+    slot = -1;
+    Py_BEGIN_ALLOW_THREADS;
+    SDL_LockMutex(self->mutex);
+    while (self->block && !self->capturing &&
+           self->count == self->nbuffers) {
+        SDL_CondWait(self->cond, self->mutex);
+    }
+    /* unless another thread is adding a frame right now */
+    if (!self->capturing && self->count < self->nbuffers) {
+        slot = (self->head + self->count) % self->nbuffers;
+        self->capturing = 1;
+    }
+    SDL_UnlockMutex(self->mutex);
+    Py_END_ALLOW_THREADS;
+    if (slot < 0) {
+        ++self->dropped;
+        return 0;
+    }
+
+    if (!pgSurface_Lock(surfobj)) {
+        /* give the slot back */
+        Py_BEGIN_ALLOW_THREADS;
+        SDL_LockMutex(self->mutex);
+        self->capturing = 0;
+        SDL_CondBroadcast(self->cond);
+        SDL_UnlockMutex(self->mutex);
+        Py_END_ALLOW_THREADS;
+        return -1;
+    }
+    Py_BEGIN_ALLOW_THREADS;
+    recorder_convert(self, surf, format, palette,
+                     self->buffers[slot] + PG_RECORDER_FRAME_TAG);
+#if !defined(__EMSCRIPTEN__) && !defined(__wasi__)
+    SDL_LockMutex(self->mutex);
+    self->capturing = 0;
+    ++self->count;
+    SDL_CondBroadcast(self->cond);
+    SDL_UnlockMutex(self->mutex);
+#endif
+    Py_END_ALLOW_THREADS;
+    pgSurface_Unlock(surfobj);
+    ++self->frames;
+
+#if defined(__EMSCRIPTEN__) || defined(__wasi__)
+    /* no threads on WASM, so the frame is written straight away */
+    self->capturing = 0;
+    if (!recorder_write_frame(self, self->buffers[slot])) {
+        SDL_strlcpy(self->error, SDL_GetError(), sizeof(self->error));
+        self->failed = 1;
+        PyErr_SetString(pgExc_SDLError, self->error);
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+/* Called after the display is presented, to record it if asked to. A
+ * recorder that fails is stopped, so the error is only raised once. */
+static int
+pg_recorder_after_present(_DisplayState *state)
+{
+    pgSurfaceObject *screen = pg_GetDefaultWindowSurface();
+
+    if (!pg_active_recorder || !screen || state->using_gl) {
+        return 0;
+    }
+    if (recorder_capture((pgRecorderObject *)pg_active_recorder, screen, 0) <
+        0) {
+        Py_CLEAR(pg_active_recorder);
+        return -1;
+    }
+    return 0;
+}
+
+/* Write out what is left and close the file. Returns -1 with an exception
+ * set if the file could not be written. */
+static int
+recorder_close(pgRecorderObject *self)
+{
+    int i, closed;
+
+    if (pg_active_recorder == (PyObject *)self) {
+        Py_CLEAR(pg_active_recorder);
+    }
+    if (!self->rw) {
+        return 0;
+    }
+    if (self->thread) {
+        Py_BEGIN_ALLOW_THREADS;
+        SDL_LockMutex(self->mutex);
+        /* the buffers are freed below, so let a capture finish first */
+        while (self->capturing) {
+            SDL_CondWait(self->cond, self->mutex);
+        }
+        self->quit = 1;
+        SDL_CondBroadcast(self->cond);
+        SDL_UnlockMutex(self->mutex);
+        SDL_WaitThread(self->thread, NULL);
+        Py_END_ALLOW_THREADS;
+        self->thread = NULL;
+    }
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    closed = SDL_RWclose(self->rw);
+#else
+    closed = SDL_RWclose(self->rw) == 0;
+#endif
+    self->rw = NULL;
+    if (!closed && !self->failed) {
+        SDL_strlcpy(self->error, SDL_GetError(), sizeof(self->error));
+        self->failed = 1;
+    }
+
+    if (self->buffers) {
+        for (i = 0; i < self->nbuffers; ++i) {
+            PyMem_Free(self->buffers[i]);
+        }
+        PyMem_Free(self->buffers);
+        self->buffers = NULL;
+    }
+    PyMem_Free(self->scratch);
+    self->scratch = NULL;
+
+    if (self->failed) {
+        PyErr_SetString(pgExc_SDLError, self->error);
+        return -1;
+    }
+    return 0;
+}
+
+static int
+recorder_init(pgRecorderObject *self, PyObject *args, PyObject *kwargs)
+{
+    PyObject *file, *oencoded;
+    char *format = "y4m";
+    int fps = 60, buffers = 4, block = 1;
+    static char *kwids[] = {"file", "fps", "format", "buffers", "block", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|isip", kwids, &file,
+                                     &fps, &format, &buffers, &block)) {
+        return -1;
+    }
+    if (self->rw) {
+        PyErr_SetString(PyExc_RuntimeError, "Recorder is already set up");
+        return -1;
+    }
+    if (fps < 1) {
+        PyErr_SetString(PyExc_ValueError, "fps must be positive");
+        return -1;
+    }
+    if (buffers < 1) {
+        PyErr_SetString(PyExc_ValueError, "buffers must be positive");
+        return -1;
+    }
+    if (!strcmp(format, "y4m")) {
+        self->y4m = 1;
+    }
+    else if (!strcmp(format, "i420")) {
+        self->y4m = 0;
+    }
+    else {
+        PyErr_Format(PyExc_ValueError,
+                     "format must be 'y4m' or 'i420', not '%s'", format);
+        return -1;
+    }
+
+    /* __init__ may be called again after failing, keep what it made */
+    if (!self->mutex) {
+        self->mutex = SDL_CreateMutex();
+    }
+    if (!self->cond) {
+        self->cond = SDL_CreateCond();
+    }
+    if (!self->mutex || !self->cond) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        return -1;
+    }
+    self->fps = fps;
+    self->nbuffers = buffers;
+    self->block = block;
+
+    oencoded = pg_EncodeString(file, "UTF-8", NULL, pgExc_SDLError);
+    if (!oencoded) {
+        return -1;
+    }
+    if (oencoded != Py_None) {
+        self->rw = SDL_RWFromFile(PyBytes_AS_STRING(oencoded), "wb");
+        if (!self->rw) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        }
+    }
+    else {
+        self->rw = pgRWops_FromObject(file, NULL);
+    }
+    Py_DECREF(oencoded);
+    return self->rw ? 0 : -1;
+}
+
+static void
+recorder_dealloc(pgRecorderObject *self)
+{
+    if (recorder_close(self) < 0) {
+        PyErr_WriteUnraisable((PyObject *)self);
+    }
+    if (self->cond) {
+        SDL_DestroyCond(self->cond);
+    }
+    if (self->mutex) {
+        SDL_DestroyMutex(self->mutex);
+    }
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *
+recorder_start(pgRecorderObject *self, PyObject *_null)
+{
+    if (!self->rw) {
+        return RAISE(PyExc_ValueError, "the Recorder is closed");
+    }
+    if (pg_active_recorder && pg_active_recorder != (PyObject *)self) {
+        return RAISE(pgExc_SDLError,
+                     "another Recorder is already recording the display");
+    }
+    Py_INCREF(self);
+    Py_XSETREF(pg_active_recorder, (PyObject *)self);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+recorder_stop(pgRecorderObject *self, PyObject *_null)
+{
+    if (pg_active_recorder == (PyObject *)self) {
+        Py_CLEAR(pg_active_recorder);
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+recorder_capture_method(pgRecorderObject *self, PyObject *args,
+                        PyObject *kwargs)
+{
+    PyObject *surfobj = Py_None;
+    static char *kwids[] = {"surface", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", kwids, &surfobj)) {
+        return NULL;
+    }
+    if (surfobj == Py_None) {
+        surfobj = (PyObject *)pg_GetDefaultWindowSurface();
+        if (!surfobj) {
+            return RAISE(pgExc_SDLError, "Display mode not set");
+        }
+    }
+    else if (!pgSurface_Check(surfobj)) {
+        return RAISE(PyExc_TypeError, "surface must be a Surface or None");
+    }
+    if (recorder_capture(self, (pgSurfaceObject *)surfobj, 1) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+recorder_close_method(pgRecorderObject *self, PyObject *_null)
+{
+    if (recorder_close(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+recorder_enter(PyObject *self, PyObject *_null)
+{
+    Py_INCREF(self);
+    return self;
+}
+
+static PyObject *
+recorder_exit(pgRecorderObject *self, PyObject *args)
+{
+    if (recorder_close(self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+recorder_get_frames(pgRecorderObject *self, void *closure)
+{
+    return PyLong_FromSsize_t(self->frames);
+}
+
+static PyObject *
+recorder_get_dropped(pgRecorderObject *self, void *closure)
+{
+    return PyLong_FromSsize_t(self->dropped);
+}
+
+static PyObject *
+recorder_get_size(pgRecorderObject *self, void *closure)
+{
+    if (!self->w) {
+        Py_RETURN_NONE;
+    }
+    return Py_BuildValue("(ii)", self->w, self->h);
+}
+
+static PyObject *
+recorder_get_recording(pgRecorderObject *self, void *closure)
+{
+    return PyBool_FromLong(pg_active_recorder == (PyObject *)self);
+}
+
+static PyMethodDef recorder_methods[] = {
+    {"start", (PyCFunction)recorder_start, METH_NOARGS,
+     DOC_DISPLAY_RECORDER_START},
+    {"stop", (PyCFunction)recorder_stop, METH_NOARGS,
+     DOC_DISPLAY_RECORDER_STOP},
+    {"capture", (PyCFunction)recorder_capture_method,
+     METH_VARARGS | METH_KEYWORDS, DOC_DISPLAY_RECORDER_CAPTURE},
+    {"close", (PyCFunction)recorder_close_method, METH_NOARGS,
+     DOC_DISPLAY_RECORDER_CLOSE},
+    {"__enter__", (PyCFunction)recorder_enter, METH_NOARGS, NULL},
+    {"__exit__", (PyCFunction)recorder_exit, METH_VARARGS, NULL},
+    {NULL, NULL, 0, NULL}};
+
+static PyGetSetDef recorder_getsets[] = {
+    {"frames", (getter)recorder_get_frames, NULL, DOC_DISPLAY_RECORDER_FRAMES,
+     NULL},
+    {"dropped", (getter)recorder_get_dropped, NULL,
+     DOC_DISPLAY_RECORDER_DROPPED, NULL},
+    {"size", (getter)recorder_get_size, NULL, DOC_DISPLAY_RECORDER_SIZE, NULL},
+    {"recording", (getter)recorder_get_recording, NULL,
+     DOC_DISPLAY_RECORDER_RECORDING, NULL},
+    {NULL, NULL, NULL, NULL, NULL}};
+
+static PyTypeObject pgRecorder_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.display.Recorder",
+    .tp_basicsize = sizeof(pgRecorderObject),
+    .tp_dealloc = (destructor)recorder_dealloc,
+    .tp_doc = DOC_DISPLAY_RECORDER,
+    .tp_methods = recorder_methods,
+    .tp_getset = recorder_getsets,
+    .tp_init = (initproc)recorder_init,
+    .tp_new = PyType_GenericNew,
+};
+
+/* Statistics of the presents through pg_renderer, in performance counter
+   ticks, see get_present_stats() */
+static struct {
+    Uint64 presented;
+    Uint64 latency_total, latency_max;
+} pg_present_stats = {0};
+
+/* Presents the display surface through pg_renderer, uploading only the
+   count rects of it to pg_texture, or all of it if rects is NULL. The
+   texture keeps what was uploaded before, so what did not change does not
+   need to go across again. Called without the GIL, on the main thread. */
+static void
+pg_present_rects(const SDL_Rect *rects, int count)
+{
+    SDL_Surface *screen = pgSurface_AsSurface(pg_GetDefaultWindowSurface());
+    Uint64 start = SDL_GetPerformanceCounter(), latency;
+    Uint8 *pixels;
+    int i;
+
+    if (!rects || pg_texture_stale) {
+        SDL_UpdateTexture(pg_texture, NULL, screen->pixels, screen->pitch);
+        pg_texture_stale = 0;
+    }
+    else {
+        for (i = 0; i < count; ++i) {
+            pixels = (Uint8 *)screen->pixels + rects[i].y * screen->pitch +
+                     rects[i].x * PG_SURF_BytesPerPixel(screen);
+            SDL_UpdateTexture(pg_texture, &rects[i], pixels, screen->pitch);
+        }
+    }
+    SDL_RenderClear(pg_renderer);
+    SDL_RenderCopy(pg_renderer, pg_texture, NULL, NULL);
+    SDL_RenderPresent(pg_renderer);
+
+    latency = SDL_GetPerformanceCounter() - start;
+    ++pg_present_stats.presented;
+    pg_present_stats.latency_total += latency;
+    pg_present_stats.latency_max = MAX(pg_present_stats.latency_max, latency);
+}
+
 static int
 pg_flip_internal(_DisplayState *state)
 {
@@ -1711,12 +2456,7 @@ pg_flip_internal(_DisplayState *state)
     }
     else {
         if (pg_renderer != NULL) {
-            SDL_Surface *screen =
-                pgSurface_AsSurface(pg_GetDefaultWindowSurface());
-            SDL_UpdateTexture(pg_texture, NULL, screen->pixels, screen->pitch);
-            SDL_RenderClear(pg_renderer);
-            SDL_RenderCopy(pg_renderer, pg_texture, NULL, NULL);
-            SDL_RenderPresent(pg_renderer);
+            pg_present_rects(NULL, 0);
         }
         else {
             /* Force a re-initialization of the surface in case it
@@ -1745,7 +2485,9 @@ pg_flip_internal(_DisplayState *state)
 static PyObject *
 pg_flip(PyObject *self, PyObject *_null)
 {
-    if (pg_flip_internal(DISPLAY_MOD_STATE(self)) < 0) {
+    _DisplayState *state = DISPLAY_MOD_STATE(self);
+
+    if (pg_flip_internal(state) < 0 || pg_recorder_after_present(state) < 0) {
         return NULL;
     }
     Py_RETURN_NONE;
@@ -1779,6 +2521,45 @@ pg_screencroprect(SDL_Rect *r, int w, int h, SDL_Rect *cur)
     return cur;
 }
 
+/* Past this many rects, update() sends their bounding box instead of
+   merging them one pair at a time */
+#define PG_UPDATE_MERGE_MAX 256
+
+/* Merges each pair of rects whose union has no more pixels than the two
+   have apart, as when they overlap a lot or touch side by side, so less is
+   uploaded twice and in fewer pieces. Returns the new count. */
+static int
+pg_merge_rects(SDL_Rect *rects, int count)
+{
+    SDL_Rect u;
+    Sint64 area;
+    int i, j, merged = 1;
+
+    if (count > PG_UPDATE_MERGE_MAX) {
+        for (i = 1; i < count; ++i) {
+            SDL_UnionRect(&rects[0], &rects[i], &rects[0]);
+        }
+        return 1;
+    }
+    while (merged) {
+        merged = 0;
+        for (i = 0; i < count; ++i) {
+            for (j = i + 1; j < count; ++j) {
+                SDL_UnionRect(&rects[i], &rects[j], &u);
+                area = (Sint64)rects[i].w * rects[i].h +
+                       (Sint64)rects[j].w * rects[j].h;
+                if ((Sint64)u.w * u.h > area) {
+                    continue;
+                }
+                rects[i] = u;
+                rects[j--] = rects[--count];
+                merged = 1;
+            }
+        }
+    }
+    return count;
+}
+
 static PyObject *
 pg_update(PyObject *self, PyObject *arg)
 {
@@ -1794,9 +2575,15 @@ pg_update(PyObject *self, PyObject *arg)
     }
 
     if (pg_renderer != NULL) {
-        return pg_flip(self, NULL);
+        /* the texture is the size of the display surface, not the window */
+        SDL_Surface *screen =
+            pgSurface_AsSurface(pg_GetDefaultWindowSurface());
+        wide = screen->w;
+        high = screen->h;
+    }
+    else {
+        SDL_GetWindowSize(win, &wide, &high);
     }
-    SDL_GetWindowSize(win, &wide, &high);
 
     if (state->using_gl) {
         return RAISE(pgExc_SDLError, "Cannot update an OPENGL display");
@@ -1810,14 +2597,29 @@ pg_update(PyObject *self, PyObject *arg)
     if (PyTuple_GET_ITEM(arg, 0) == Py_None) {
         /* This is to comply with old behaviour of the function, might be worth
          * deprecating this in the future */
+        if (pg_renderer != NULL) {
+            /* still present, a vsynced renderer paces the game loop */
+            Py_BEGIN_ALLOW_THREADS;
+            pg_present_rects(&temp, 0);
+            Py_END_ALLOW_THREADS;
+        }
+        if (pg_recorder_after_present(state) < 0) {
+            return NULL;
+        }
         Py_RETURN_NONE;
     }
 
     gr = pgRect_FromObject(arg, &temp);
     if (gr) {
         SDL_Rect sdlr;
+        int onscreen = pg_screencroprect(gr, wide, high, &sdlr) != NULL;
 
-        if (pg_screencroprect(gr, wide, high, &sdlr)) {
+        if (pg_renderer != NULL) {
+            Py_BEGIN_ALLOW_THREADS;
+            pg_present_rects(&sdlr, onscreen);
+            Py_END_ALLOW_THREADS;
+        }
+        else if (onscreen) {
             SDL_UpdateWindowSurfaceRects(win, &sdlr, 1);
         }
     }
@@ -1903,18 +2705,49 @@ pg_update(PyObject *self, PyObject *arg)
             ++count;
         }
 
-        if (count) {
-            Py_BEGIN_ALLOW_THREADS;
+        Py_BEGIN_ALLOW_THREADS;
+        count = pg_merge_rects(rects, count);
+        if (pg_renderer != NULL) {
+            pg_present_rects(rects, count);
+        }
+        else if (count) {
             SDL_UpdateWindowSurfaceRects(win, rects, count);
-            Py_END_ALLOW_THREADS;
         }
+        Py_END_ALLOW_THREADS;
 
         Py_DECREF(iterable);
         PyMem_Free((void *)rects);
     }
+    if (pg_recorder_after_present(state) < 0) {
+        return NULL;
+    }
     Py_RETURN_NONE;
 }
 
+static PyObject *
+pg_get_present_stats(PyObject *self, PyObject *arg, PyObject *kwargs)
+{
+    int reset = 0;
+    double ms = 1000.0 / (double)SDL_GetPerformanceFrequency();
+    Uint64 presented = pg_present_stats.presented;
+    static char *keywords[] = {"reset", NULL};
+    PyObject *stats;
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwargs, "|p", keywords, &reset)) {
+        return NULL;
+    }
+
+    stats = Py_BuildValue(
+        "{s:K,s:d,s:d}", "frames", (unsigned long long)presented, "latency",
+        presented ? pg_present_stats.latency_total * ms / presented : 0.0,
+        "max_latency", pg_present_stats.latency_max * ms);
+    if (stats && reset) {
+        pg_present_stats.presented = 0;
+        pg_present_stats.latency_total = pg_present_stats.latency_max = 0;
+    }
+    return stats;
+}
+
 static PyObject *
 pg_set_palette(PyObject *self, PyObject *args)
 {
@@ -3105,6 +3938,8 @@ static PyMethodDef _pg_display_methods[] = {
 
     {"flip", (PyCFunction)pg_flip, METH_NOARGS, DOC_DISPLAY_FLIP},
     {"update", (PyCFunction)pg_update, METH_VARARGS, DOC_DISPLAY_UPDATE},
+    {"get_present_stats", (PyCFunction)pg_get_present_stats,
+     METH_VARARGS | METH_KEYWORDS, DOC_DISPLAY_GETPRESENTSTATS},
 
     {"set_palette", pg_set_palette, METH_VARARGS, DOC_DISPLAY_SETPALETTE},
     {"set_gamma", pg_set_gamma, METH_VARARGS, DOC_DISPLAY_SETGAMMA},
@@ -3193,11 +4028,18 @@ MODINIT_DEFINE(display)
     if (PyErr_Occurred()) {
         return NULL;
     }
+    import_pygame_rwobject();
+    if (PyErr_Occurred()) {
+        return NULL;
+    }
 
     /* type preparation */
     if (PyType_Ready(&pgVidInfo_Type) < 0) {
         return NULL;
     }
+    if (PyType_Ready(&pgRecorder_Type) < 0) {
+        return NULL;
+    }
 
     /* create the module */
     module = PyModule_Create(&_module);
@@ -3211,5 +4053,14 @@ MODINIT_DEFINE(display)
     state->using_gl = 0;
     state->auto_resize = SDL_TRUE;
 
+    if (PyModule_AddObjectRef(module, "Recorder",
+                              (PyObject *)&pgRecorder_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
+
+    display_has_avx2 = SDL_HasAVX2();
+    display_has_sse2 = SDL_HasSSE2() || SDL_HasNEON();
+
     return module;
 }
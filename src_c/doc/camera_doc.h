@@ -13,3 +13,9 @@
 #define DOC_CAMERA_CAMERA_QUERYIMAGE "query_image() -> bool\nchecks if a frame is ready"
 #define DOC_CAMERA_CAMERA_GETIMAGE "get_image(Surface = None, /) -> Surface\ncaptures an image as a Surface"
 #define DOC_CAMERA_CAMERA_GETRAW "get_raw() -> bytes\nreturns an unmodified image as bytes"
+#define DOC_CAMERA_CAMERA_GETRAWVIEW "get_raw_view() -> RawView\nreturns the next frame without copying it"
+#define DOC_CAMERA_RAWVIEW "RawView\na frame dequeued by Camera.get_raw_view"
+#define DOC_CAMERA_RAWVIEW_RELEASE "release() -> None\ngive the buffer back to the camera"
+#define DOC_CAMERA_RAWVIEW_TOSURFACE "to_surface(surface=None) -> Surface\nconverts the frame to a Surface"
+#define DOC_CAMERA_RAWVIEW_SEQUENCE "sequence -> int\nthe frame number"
+#define DOC_CAMERA_RAWVIEW_RELEASED "released -> bool\nwhether the buffer went back to the camera"
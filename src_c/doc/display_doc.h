@@ -7,6 +7,7 @@
 #define DOC_DISPLAY_GETSURFACE "get_surface() -> Optional[Surface]\nGet a reference to the currently set display surface."
 #define DOC_DISPLAY_FLIP "flip() -> None\nUpdate the full display Surface to the screen."
 #define DOC_DISPLAY_UPDATE "update() -> None\nupdate(rectangle, /) -> None\nupdate(rectangles, /) -> None\nupdate(x, y, w, h, /) -> None\nupdate(xy, wh, /) -> None\nUpdate all, or a portion, of the display. For non-OpenGL displays."
+#define DOC_DISPLAY_GETPRESENTSTATS "get_present_stats(reset=False) -> dict\nGet timings of presented frames."
 #define DOC_DISPLAY_GETDRIVER "get_driver() -> str\nGet the name of the pygame display backend."
 #define DOC_DISPLAY_INFO "Info() -> _VidInfo\nCreate a video display information object."
 #define DOC_DISPLAY_GETWMINFO "get_wm_info() -> dict[str, int]\nGet information about the current windowing system."
@@ -35,3 +36,12 @@
 #define DOC_DISPLAY_GETCURRENTREFRESHRATE "get_current_refresh_rate() -> int\nReturns the screen refresh rate or 0 if unknown."
 #define DOC_DISPLAY_GETDESKTOPREFRESHRATES "get_desktop_refresh_rates() -> list[int]\nReturns the screen refresh rates for all displays (in windowed mode)."
 #define DOC_DISPLAY_MESSAGEBOX "message_box(title, message=None, message_type='info', parent_window=None, buttons=('OK', ), return_button=0, escape_button=None) -> int\nCreate a native GUI message box."
+#define DOC_DISPLAY_RECORDER "Recorder(file, fps=60, format='y4m', buffers=4, block=True) -> Recorder\nRecord the display to a video file."
+#define DOC_DISPLAY_RECORDER_START "start() -> None\nRecord the display after every flip() and update()."
+#define DOC_DISPLAY_RECORDER_STOP "stop() -> None\nStop recording the display after every flip() and update()."
+#define DOC_DISPLAY_RECORDER_CAPTURE "capture(surface=None) -> None\nAdd a frame to the recording."
+#define DOC_DISPLAY_RECORDER_CLOSE "close() -> None\nFinish writing the recording and close the file."
+#define DOC_DISPLAY_RECORDER_FRAMES "frames -> int\nThe number of frames recorded."
+#define DOC_DISPLAY_RECORDER_DROPPED "dropped -> int\nThe number of frames dropped."
+#define DOC_DISPLAY_RECORDER_SIZE "size -> Optional[tuple[int, int]]\nThe size of the recorded frames."
+#define DOC_DISPLAY_RECORDER_RECORDING "recording -> bool\nWhether the display is being recorded."
@@ -2,6 +2,7 @@
 #define DOC_EVENT "pygame module for interacting with events and queues"
 #define DOC_EVENT_PUMP "pump() -> None\ninternally process pygame event handlers"
 #define DOC_EVENT_GET "get(eventtype=None) -> Eventlist\nget(eventtype=None, pump=True) -> Eventlist\nget(eventtype=None, pump=True, exclude=None) -> Eventlist\nget events from the queue"
+#define DOC_EVENT_GETBUFFER "get_buffer(eventtype=None, pump=True, coalesce=False, buffer=None) -> EventBuffer\nget events from the queue as a compact buffer"
 #define DOC_EVENT_POLL "poll() -> Event instance\nget a single event from the queue"
 #define DOC_EVENT_WAIT "wait() -> Event instance\nwait(timeout) -> Event instance\nwait for a single event from the queue"
 #define DOC_EVENT_PEEK "peek(eventtype=None) -> bool\npeek(eventtype=None, pump=True) -> bool\ntest if event types are waiting on the queue"
@@ -14,6 +15,10 @@
 #define DOC_EVENT_GETGRAB "get_grab() -> bool\ntest if the program is sharing input devices"
 #define DOC_EVENT_POST "post(event, /) -> bool\nplace a new event on the queue"
 #define DOC_EVENT_CUSTOMTYPE "custom_type() -> int\nmake custom user event type"
+#define DOC_EVENT_SETCOALESCE "set_coalesce(eventtype, policy=None, limit=0) -> None\ncontrol how high frequency input events are coalesced"
+#define DOC_EVENT_GETCOALESCESTATS "get_coalesce_stats(reset=False) -> (merged, dropped)\nget the number of coalesced input events"
 #define DOC_EVENT_EVENT "Event(type, dict) -> Event\nEvent(type, **attributes) -> Event\npygame object for representing events"
 #define DOC_EVENT_EVENT_TYPE "type -> int\nevent type identifier."
 #define DOC_EVENT_EVENT_DICT "__dict__ -> dict\nevent attribute dictionary"
+#define DOC_EVENT_EVENTBUFFER "EventBuffer -> EventBuffer\npygame object holding events as compact records"
+#define DOC_EVENT_EVENTBUFFER_FORMAT "format -> str\nstruct format of a single record"
@@ -1,16 +1,23 @@
 /* Auto generated file: with make_docs.py .  Docs go in docs/reST/ref/ . */
 #define DOC_IMAGE "Pygame module for image transfer."
-#define DOC_IMAGE_LOAD "load(file, namehint='') -> Surface\nLoad new image from a file (or file-like object)."
+#define DOC_IMAGE_LOAD "load(file, namehint='', format=None, premultiply=False) -> Surface\nLoad new image from a file (or file-like object)."
+#define DOC_IMAGE_LOADMANY "load_many(files, threads=0, format=None, premultiply=False) -> list[Surface]\nLoad many images in parallel on worker threads."
+#define DOC_IMAGE_LOADASYNC "load_async(file, namehint='', format=None, premultiply=False) -> Future[Surface]\nLoad an image in the background."
 #define DOC_IMAGE_LOADSIZEDSVG "load_sized_svg(file, size) -> Surface\nLoad an SVG image from a file (or file-like object) with the given size."
 #define DOC_IMAGE_LOADANIMATION "load_animation(file, namehint='') -> list[tuple[Surface, float]]\nLoad an animation (GIF/WEBP) from a file (or file-like object) as a list of frames."
 #define DOC_IMAGE_SAVE "save(surface, file, namehint='') -> None\nSave an image to file (or file-like object)."
+#define DOC_IMAGE_SAVEASYNC "save_async(surface, file, block=True) -> Future[None]\nSave an image to a file in the background."
 #define DOC_IMAGE_GETSDLIMAGEVERSION "get_sdl_image_version(linked=True) -> Optional[tuple[int, int, int]]\nGet version number of the SDL_Image library being used."
 #define DOC_IMAGE_GETEXTENDED "get_extended() -> bool\nTest if extended image formats can be loaded."
 #define DOC_IMAGE_TOSTRING "tostring(surface, format, flipped=False, pitch=-1) -> bytes\nTransfer image to byte buffer."
 #define DOC_IMAGE_TOBYTES "tobytes(surface, format, flipped=False, pitch=-1) -> bytes\nTransfer image to byte buffer."
+#define DOC_IMAGE_TOBYTESINTO "tobytes_into(surface, buffer, format, flipped=False, pitch=-1) -> int\nTransfer image into a writable buffer."
 #define DOC_IMAGE_FROMSTRING "fromstring(bytes, size, format, flipped=False, pitch=-1) -> Surface\nCreate new Surface from a byte buffer."
 #define DOC_IMAGE_FROMBYTES "frombytes(bytes, size, format, flipped=False, pitch=-1) -> Surface\nCreate new Surface from a byte buffer."
 #define DOC_IMAGE_FROMBUFFER "frombuffer(buffer, size, format, pitch=-1) -> Surface\nCreate a new Surface that shares data inside a bytes buffer."
+#define DOC_IMAGE_LOADMAPPED "load_mapped(file) -> dict[str, Surface]\nLoad the surfaces of a mapped surface file without copying them."
+#define DOC_IMAGE_SAVEMAPPED "save_mapped(surfaces, file, compress=False) -> None\nSave named surfaces to a mapped surface file."
+#define DOC_IMAGE_PACKATLAS "pack_atlas(surfaces, max_size=(4096, 4096), padding=0) -> tuple[Surface, list[Surface], list[Rect]]\nPack many small surfaces into one atlas surface."
 #define DOC_IMAGE_LOADBASIC "load_basic(file, /) -> Surface\nLoad new BMP image from a file (or file-like object)."
 #define DOC_IMAGE_LOADEXTENDED "load_extended(file, namehint='') -> Surface\nLoad an image from a file (or file-like object)."
 #define DOC_IMAGE_SAVEEXTENDED "save_extended(surface, file, namehint='') -> None\nSave a png/jpg image to file (or file-like object)."
@@ -16,8 +16,10 @@
 #define DOC_MIXER_SETSOUNDFONT "set_soundfont(path, /) -> None\nset the soundfont for playing midi music"
 #define DOC_MIXER_GETSOUNDFONT "get_soundfont() -> paths\nget the soundfont for playing midi music"
 #define DOC_MIXER_GETBUSY "get_busy() -> bool\ntest if any sound is being mixed"
+#define DOC_MIXER_SETEFFECTS "set_effects(effects=()) -> None\nrun effects over the whole mix"
+#define DOC_MIXER_GETEFFECTS "get_effects() -> tuple\nget the effects run over the whole mix"
 #define DOC_MIXER_GETSDLMIXERVERSION "get_sdl_mixer_version() -> (major, minor, patch)\nget_sdl_mixer_version(linked=True) -> (major, minor, patch)\nget the mixer's SDL version"
-#define DOC_MIXER_SOUND "Sound(filename) -> Sound\nSound(file=filename) -> Sound\nSound(file=pathlib_path) -> Sound\nSound(buffer) -> Sound\nSound(buffer=buffer) -> Sound\nSound(object) -> Sound\nSound(file=object) -> Sound\nSound(array=object) -> Sound\nCreate a new Sound object from a file or buffer object"
+#define DOC_MIXER_SOUND "Sound(filename) -> Sound\nSound(file=filename) -> Sound\nSound(file=pathlib_path) -> Sound\nSound(buffer) -> Sound\nSound(buffer=buffer) -> Sound\nSound(object) -> Sound\nSound(file=object) -> Sound\nSound(array=object) -> Sound\nSound(buffer=buffer, copy=False) -> Sound\nSound(array=object, copy=False) -> Sound\nCreate a new Sound object from a file or buffer object"
 #define DOC_MIXER_SOUND_PLAY "play(loops=0, maxtime=0, fade_ms=0) -> Channel\nbegin sound playback"
 #define DOC_MIXER_SOUND_STOP "stop() -> None\nstop sound playback"
 #define DOC_MIXER_SOUND_FADEOUT "fadeout(time, /) -> None\nstop sound playback after fading out"
@@ -26,6 +28,7 @@
 #define DOC_MIXER_SOUND_GETNUMCHANNELS "get_num_channels() -> count\ncount how many times this Sound is playing"
 #define DOC_MIXER_SOUND_GETLENGTH "get_length() -> seconds\nget the length of the Sound"
 #define DOC_MIXER_SOUND_GETRAW "get_raw() -> bytes\nreturn a bytestring copy of the Sound samples."
+#define DOC_MIXER_SOUND_APPLYEFFECTS "apply_effects(effects, /) -> Sound\nreturn a new Sound with effects applied"
 #define DOC_MIXER_CHANNEL "Channel(id) -> Channel\nCreate a Channel object for controlling playback"
 #define DOC_MIXER_CHANNEL_ID "id -> int\nget the channel id for the Channel object"
 #define DOC_MIXER_CHANNEL_PLAY "play(Sound, loops=0, maxtime=0, fade_ms=0) -> None\nplay a Sound on a specific Channel"
@@ -42,3 +45,15 @@
 #define DOC_MIXER_CHANNEL_GETQUEUE "get_queue() -> Sound\nreturn any Sound that is queued"
 #define DOC_MIXER_CHANNEL_SETENDEVENT "set_endevent() -> None\nset_endevent(type, /) -> None\nhave the channel send an event when playback stops"
 #define DOC_MIXER_CHANNEL_GETENDEVENT "get_endevent() -> type\nget the event a channel sends when playback stops"
+#define DOC_MIXER_CHANNEL_SETEFFECTS "set_effects(effects=()) -> None\nrun effects on everything the channel plays"
+#define DOC_MIXER_CHANNEL_GETEFFECTS "get_effects() -> tuple\nget the effects run on the channel"
+#define DOC_MIXER_EFFECT "Effect(kind, **params) -> Effect\nan audio effect for Channel and mixer effect chains"
+#define DOC_MIXER_EFFECT_KIND "kind -> str\nthe kind of effect"
+#define DOC_MIXER_EFFECT_PARAMS "params -> dict\nthe current parameters"
+#define DOC_MIXER_EFFECT_SET "set(**params) -> None\nchange parameters"
+#define DOC_MIXER_STREAMCHANNEL "StreamChannel(id, frames=4096) -> StreamChannel\na Channel that plays audio pushed to it a block at a time"
+#define DOC_MIXER_STREAMCHANNEL_PLAY "play() -> None\nstart playing the queue"
+#define DOC_MIXER_STREAMCHANNEL_PUSH "push(buffer) -> int\nqueue samples to play"
+#define DOC_MIXER_STREAMCHANNEL_GETQUEUED "get_queued() -> int\nget the number of frames waiting to play"
+#define DOC_MIXER_STREAMCHANNEL_GETFREE "get_free() -> int\nget the number of frames that can be pushed"
+#define DOC_MIXER_STREAMCHANNEL_GETUNDERRUNS "get_underruns() -> int\nget the number of times the queue ran dry"
@@ -42,6 +42,7 @@
 #define DOC_SDL2_VIDEO_RENDERER_GETVIEWPORT "get_viewport() -> Rect\nGet the drawing area on the rendering target"
 #define DOC_SDL2_VIDEO_RENDERER_SETVIEWPORT "set_viewport(area) -> None\nSet the drawing area on the rendering target"
 #define DOC_SDL2_VIDEO_RENDERER_BLIT "blit(source, dest, area=None, special_flags=0)-> Rect\nDraw textures using a Surface-like API"
+#define DOC_SDL2_VIDEO_RENDERER_GETUPLOADSTATS "get_upload_stats() -> (int bytes, int uploads)\nGet how much surface data was uploaded in the last frame"
 #define DOC_SDL2_VIDEO_RENDERER_DRAWLINE "draw_line(p1, p2) -> None\nDraw a line"
 #define DOC_SDL2_VIDEO_RENDERER_DRAWPOINT "draw_point(point) -> None\nDraw a point"
 #define DOC_SDL2_VIDEO_RENDERER_DRAWRECT "draw_rect(rect)-> None\nDraw a rectangle outline"
@@ -50,5 +51,8 @@
 #define DOC_SDL2_VIDEO_RENDERER_FILLTRIANGLE "fill_triangle(p1, p2, p3) -> None\nDraw a filled triangle"
 #define DOC_SDL2_VIDEO_RENDERER_DRAWQUAD "draw_quad(p1, p2, p3, p4) -> None\nDraw a quad outline"
 #define DOC_SDL2_VIDEO_RENDERER_FILLQUAD "fill_quad(p1, p2, p3, p4) -> None\nDraw a filled quad"
+#define DOC_SDL2_VIDEO_RENDERER_FILLRECTS "fill_rects(rects) -> None\nDraw many filled rectangles in one call"
+#define DOC_SDL2_VIDEO_RENDERER_DRAWLINES "draw_lines(points) -> None\nDraw connected lines in one call"
+#define DOC_SDL2_VIDEO_RENDERER_DRAWGEOMETRY "draw_geometry(vertices, indices=None, texture=None) -> None\nDraw triangles from a vertex buffer in one call"
 #define DOC_SDL2_VIDEO_RENDERER_TOSURFACE "to_surface(surface=None, area=None)-> Surface\nRead pixels from current rendering target and create a Surface (slow operation, use sparingly)"
 #define DOC_SDL2_VIDEO_RENDERER_COMPOSECUSTOMBLENDMODE "compose_custom_blend_mode(color_mode, alpha_mode) -> int\nCompose a custom blend mode"
@@ -53,6 +53,8 @@
 #define DOC_SURFACE_PIXELSADDRESS "_pixels_address -> int\nPixel buffer address."
 #define DOC_SURFACE_PREMULALPHA "premul_alpha() -> Surface\nReturns a copy of the surface with the RGB channels pre-multiplied by the alpha channel."
 #define DOC_SURFACE_PREMULALPHAIP "premul_alpha_ip() -> Surface\nMultiplies the RGB channels by the surface alpha channel."
+#define DOC_SURFACE_GETGENERATION "get_generation() -> int\nGet a counter that changes whenever the pixels are written."
+#define DOC_SURFACE_GETHASH "get_hash() -> int\nGet a hash of the pixel data."
 #define DOC_SURFACE_WIDTH "width -> int\nSurface width in pixels (read-only)."
 #define DOC_SURFACE_HEIGHT "height -> int\nSurface height in pixels (read-only)."
 #define DOC_SURFACE_SIZE "size -> tuple[int, int]\nSurface size in pixels (read-only)."
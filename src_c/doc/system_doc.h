@@ -5,3 +5,7 @@
 #define DOC_SYSTEM_GETPREFPATH "get_pref_path(org, app) -> str\nGet a writeable folder for your app."
 #define DOC_SYSTEM_GETPREFLOCALES "get_pref_locales() -> list[_Locale]\nGet preferred locales set on the system."
 #define DOC_SYSTEM_GETPOWERSTATE "get_power_state() -> Optional[PowerState]\nGet the current power supply state."
+#define DOC_SYSTEM_ENABLEPERFCOUNTERS "enable_perf_counters(enable=True) -> None\nTurn counting of internal hot path calls on or off."
+#define DOC_SYSTEM_GETPERFCOUNTERS "get_perf_counters() -> dict[str, _PerfCounter]\nGet how often and how long internal hot paths ran."
+#define DOC_SYSTEM_RESETPERFCOUNTERS "reset_perf_counters() -> None\nSet all internal hot path counters back to zero."
+#define DOC_SYSTEM_SETBLITDIAGNOSTICS "set_blit_diagnostics(mode=None, threshold=10) -> None\nReport or fix blits that miss the fast same format paths."
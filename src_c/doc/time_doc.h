@@ -7,6 +7,9 @@
 #define DOC_TIME_CLOCK "Clock() -> Clock\nCreate an object to help track time."
 #define DOC_TIME_CLOCK_TICK "tick(framerate=0, /) -> int\nUpdate the clock."
 #define DOC_TIME_CLOCK_TICKBUSYLOOP "tick_busy_loop(framerate=0, /) -> int\nUpdate the clock."
+#define DOC_TIME_CLOCK_TICKPRECISE "tick_precise(framerate=0, spin=1.0) -> int\nUpdate the clock, pacing frames with high resolution timing."
+#define DOC_TIME_CLOCK_GETFRAMEPERCENTILES "get_frame_percentiles(percentiles=(50, 95, 99)) -> tuple[float, ...]\nPercentiles of the recent frame times."
+#define DOC_TIME_CLOCK_GETFRAMEHISTOGRAM "get_frame_histogram(bin_width=1.0, bins=32) -> list[int]\nHistogram of the recent frame times."
 #define DOC_TIME_CLOCK_GETTIME "get_time() -> int\nTime used in the previous tick."
 #define DOC_TIME_CLOCK_GETRAWTIME "get_rawtime() -> int\nActual time used in the previous tick."
 #define DOC_TIME_CLOCK_GETFPS "get_fps() -> float\nCompute the clock framerate."
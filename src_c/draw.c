@@ -26,6 +26,7 @@
 #include "pygame.h"
 
 #include "pgcompat.h"
+#include "pgperf.h"
 
 #include "doc/draw_doc.h"
 
@@ -107,6 +108,21 @@ draw_round_rect(SDL_Surface *surf, SDL_Rect surf_clip_rect, int x1, int y1,
                 int top_left, int top_right, int bottom_left, int bottom_right,
                 int *drawn_area);
 
+PG_PERF_DEFINE_STATE
+
+/* Pixel count of a drawn_area bounding box, 0 when nothing was drawn */
+static PG_INLINE Uint64
+drawn_area_pixels(const int *drawn_area)
+{
+    if (drawn_area[0] == INT_MAX) {
+        return 0;
+    }
+    return (Uint64)(drawn_area[2] - drawn_area[0] + 1) *
+           (drawn_area[3] - drawn_area[1] + 1);
+}
+
+#define COUNT_DRAW(id) PG_PERF_COUNT(perf, id, drawn_area_pixels(drawn_area))
+
 // validation of a draw color
 #define CHECK_LOAD_COLOR(colorobj)                       \
     if (!pg_MappedColorFromObj((colorobj), surf, &color, \
@@ -184,9 +200,11 @@ aaline(PyObject *self, PyObject *arg, PyObject *kwargs)
         return pgRect_New4((int)startx, (int)starty, 0, 0);
     }
 
+    pgSurface_Touch(surfobj);
     if (!pgSurface_Lock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
+    PG_PERF_START(perf);
 
     if (width > 1) {
         draw_aaline_width(surf, surf_clip_rect, surf_format, color, startx,
@@ -200,6 +218,7 @@ aaline(PyObject *self, PyObject *arg, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    COUNT_DRAW(DRAW_AALINE);
 
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
@@ -264,9 +283,11 @@ line(PyObject *self, PyObject *arg, PyObject *kwargs)
         return pgRect_New4(startx, starty, 0, 0);
     }
 
+    pgSurface_Touch(surfobj);
     if (!pgSurface_Lock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
+    PG_PERF_START(perf);
 
     draw_line_width(surf, surf_clip_rect, color, startx, starty, endx, endy,
                     width, drawn_area);
@@ -274,6 +295,7 @@ line(PyObject *self, PyObject *arg, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    COUNT_DRAW(DRAW_LINE);
 
     /* Compute return rect. */
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
@@ -392,10 +414,12 @@ aalines(PyObject *self, PyObject *arg, PyObject *kwargs)
         ylist[loop] = y;
     }
 
+    pgSurface_Touch(surfobj);
     if (!pgSurface_Lock(surfobj)) {
         PyMem_Free(points_buf);
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
+    PG_PERF_START(perf);
 
     /* first line - if open, add endpoint pixels.*/
     pts[0] = xlist[0];
@@ -496,6 +520,7 @@ aalines(PyObject *self, PyObject *arg, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    COUNT_DRAW(DRAW_AALINES);
 
     /* Compute return rect. */
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
@@ -602,11 +627,13 @@ lines(PyObject *self, PyObject *arg, PyObject *kwargs)
         return pgRect_New4(x, y, 0, 0);
     }
 
+    pgSurface_Touch(surfobj);
     if (!pgSurface_Lock(surfobj)) {
         PyMem_Free(xlist);
         PyMem_Free(ylist);
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
+    PG_PERF_START(perf);
 
     for (loop = 1; loop < length; ++loop) {
         draw_line_width(surf, surf_clip_rect, color, xlist[loop - 1],
@@ -626,6 +653,7 @@ lines(PyObject *self, PyObject *arg, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    COUNT_DRAW(DRAW_LINES);
 
     /* Compute return rect. */
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
@@ -695,9 +723,11 @@ arc(PyObject *self, PyObject *arg, PyObject *kwargs)
         angle_stop += 2 * M_PI;
     }
 
+    pgSurface_Touch(surfobj);
     if (!pgSurface_Lock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
+    PG_PERF_START(perf);
 
     width = MIN(width, MIN(rect->w, rect->h) / 2);
 
@@ -708,6 +738,7 @@ arc(PyObject *self, PyObject *arg, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    COUNT_DRAW(DRAW_ARC);
 
     /* Compute return rect. */
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
@@ -766,9 +797,11 @@ ellipse(PyObject *self, PyObject *arg, PyObject *kwargs)
         return pgRect_New4(rect->x, rect->y, 0, 0);
     }
 
+    pgSurface_Touch(surfobj);
     if (!pgSurface_Lock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
+    PG_PERF_START(perf);
 
     if (!width ||
         width >= MIN(rect->w / 2 + rect->w % 2, rect->h / 2 + rect->h % 2)) {
@@ -783,6 +816,7 @@ ellipse(PyObject *self, PyObject *arg, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    COUNT_DRAW(DRAW_ELLIPSE);
 
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
@@ -868,9 +902,11 @@ circle(PyObject *self, PyObject *args, PyObject *kwargs)
         return pgRect_New4(posx, posy, 0, 0);
     }
 
+    pgSurface_Touch(surfobj);
     if (!pgSurface_Lock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
+    PG_PERF_START(perf);
 
     if ((top_right == 0 && top_left == 0 && bottom_left == 0 &&
          bottom_right == 0)) {
@@ -896,6 +932,7 @@ circle(PyObject *self, PyObject *args, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    COUNT_DRAW(DRAW_CIRCLE);
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
         return pgRect_New4(drawn_area[0], drawn_area[1],
@@ -983,9 +1020,11 @@ aacircle(PyObject *self, PyObject *args, PyObject *kwargs)
         return pgRect_New4(posx, posy, 0, 0);
     }
 
+    pgSurface_Touch(surfobj);
     if (!pgSurface_Lock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
+    PG_PERF_START(perf);
 
     if ((top_right == 0 && top_left == 0 && bottom_left == 0 &&
          bottom_right == 0)) {
@@ -1030,6 +1069,7 @@ aacircle(PyObject *self, PyObject *args, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    COUNT_DRAW(DRAW_AACIRCLE);
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
         return pgRect_New4(drawn_area[0], drawn_area[1],
@@ -1131,10 +1171,12 @@ polygon(PyObject *self, PyObject *arg, PyObject *kwargs)
         ylist[loop] = y;
     }
 
+    pgSurface_Touch(surfobj);
     if (!pgSurface_Lock(surfobj)) {
         PyMem_Free(points_buf);
         return RAISE(PyExc_RuntimeError, "error locking surface");
     }
+    PG_PERF_START(perf);
 
     if (length != 3) {
         draw_fillpoly(surf, surf_clip_rect, xlist, ylist, length, color,
@@ -1148,6 +1190,7 @@ polygon(PyObject *self, PyObject *arg, PyObject *kwargs)
     if (!pgSurface_Unlock(surfobj)) {
         return RAISE(PyExc_RuntimeError, "error unlocking surface");
     }
+    COUNT_DRAW(DRAW_POLYGON);
 
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
         drawn_area[2] != INT_MIN && drawn_area[3] != INT_MIN) {
@@ -1233,6 +1276,8 @@ rect(PyObject *self, PyObject *args, PyObject *kwargs)
         if (!SDL_IntersectRect(&sdlrect, &surf_clip_rect, &clipped)) {
             return pgRect_New4(rect->x, rect->y, 0, 0);
         }
+        pgSurface_Touch(surfobj);
+        PG_PERF_START(perf);
         if (width > 0 && (width * 2) < clipped.w && (width * 2) < clipped.h) {
             draw_rect(surf, surf_clip_rect, sdlrect.x, sdlrect.y,
                       sdlrect.x + sdlrect.w - 1, sdlrect.y + sdlrect.h - 1,
@@ -1248,12 +1293,15 @@ rect(PyObject *self, PyObject *args, PyObject *kwargs)
                 return RAISE(pgExc_SDLError, SDL_GetError());
             }
         }
+        PG_PERF_COUNT(perf, DRAW_RECT, (Uint64)clipped.w * clipped.h);
         return pgRect_New(&clipped);
     }
     else {
+        pgSurface_Touch(surfobj);
         if (!pgSurface_Lock(surfobj)) {
             return RAISE(PyExc_RuntimeError, "error locking surface");
         }
+        PG_PERF_START(perf);
 
         /* Little bit to normalize the rect: this matters for the rounded
            rects, despite not mattering for the normal rects. */
@@ -1277,6 +1325,7 @@ rect(PyObject *self, PyObject *args, PyObject *kwargs)
         if (!pgSurface_Unlock(surfobj)) {
             return RAISE(PyExc_RuntimeError, "error unlocking surface");
         }
+        COUNT_DRAW(DRAW_RECT);
     }
 
     if (drawn_area[0] != INT_MAX && drawn_area[1] != INT_MAX &&
@@ -3825,6 +3874,7 @@ MODINIT_DEFINE(draw)
     if (PyErr_Occurred()) {
         return NULL;
     }
+    PG_PERF_IMPORT_STATE();
     import_pygame_color();
     if (PyErr_Occurred()) {
         return NULL;
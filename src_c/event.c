@@ -323,8 +323,11 @@ _pg_put_event_unicode(SDL_Event *event, const char *uni)
     return 0;
 }
 
-static PyObject *
-_pg_get_event_unicode(SDL_Event *event)
+/* Copies the unicode of a KEYDOWN/KEYUP event into unicode (UNICODE_LEN
+ * bytes), releasing its cache entry once it is no longer needed. The caller
+ * must hold the event filter mutex */
+static void
+_pg_take_event_unicode(SDL_Event *event, char *unicode)
 {
     for (int i = 0; i < MAX_SCAN_UNICODE; i++) {
 #if SDL_VERSION_ATLEAST(3, 0, 0)
@@ -338,14 +341,15 @@ _pg_get_event_unicode(SDL_Event *event)
                  * events to occupy. */
                 scanunicode[i].key = 0;
             }
-            return PyUnicode_FromString(scanunicode[i].unicode);
+            memcpy(unicode, scanunicode[i].unicode, UNICODE_LEN);
+            return;
         }
     }
     /* fallback to function that determines unicode from the event.
      * We don't need to store this in our cache because this is entirely
      * determined from the event fields, and therefore needs no other info. */
-    char fallback[] = {_pg_unicode_from_event(event), '\0'};
-    return PyUnicode_FromString(fallback);
+    memset(unicode, 0, UNICODE_LEN);
+    unicode[0] = _pg_unicode_from_event(event);
 }
 
 #define _PG_HANDLE_PROXIFY(name) \
@@ -518,6 +522,191 @@ _pg_remove_pending_VIDEOEXPOSE(void *userdata, SDL_Event *event)
     return 1;
 }
 
+/* Input coalescing policies for high frequency motion and axis events, see
+ * pygame.event.set_coalesce() */
+#define PG_COALESCE_NONE 0
+#define PG_COALESCE_LATEST 1
+#define PG_COALESCE_ACCUMULATE 2
+#define PG_COALESCE_LIMIT 3
+
+typedef struct {
+    Uint32 type;
+    int policy;
+    int limit;
+    /* events of this type let through since the last pump */
+    int passed;
+} pgCoalescePolicy;
+
+static pgCoalescePolicy _pg_coalesce_policies[] = {
+    {SDL_MOUSEMOTION, PG_COALESCE_NONE, 0, 0},
+    {SDL_FINGERMOTION, PG_COALESCE_NONE, 0, 0},
+    {SDL_JOYAXISMOTION, PG_COALESCE_NONE, 0, 0},
+    {SDL_JOYBALLMOTION, PG_COALESCE_NONE, 0, 0},
+    {SDL_CONTROLLERAXISMOTION, PG_COALESCE_NONE, 0, 0},
+};
+
+#define PG_NUM_COALESCE_POLICIES \
+    (int)(sizeof(_pg_coalesce_policies) / sizeof(pgCoalescePolicy))
+
+/* number of policies that are not PG_COALESCE_NONE, the event filter and
+ * the functions taking events off the queue skip all coalescing work (and
+ * locking) while this is 0 */
+static int _pg_coalesce_active = 0;
+static Uint64 _pg_coalesce_merged = 0;
+static Uint64 _pg_coalesce_dropped = 0;
+
+static pgCoalescePolicy *
+_pg_coalesce_find(Uint32 type)
+{
+    for (int i = 0; i < PG_NUM_COALESCE_POLICIES; i++) {
+        if (_pg_coalesce_policies[i].type == type) {
+            return &_pg_coalesce_policies[i];
+        }
+    }
+    return NULL;
+}
+
+/* Whether both events come from the same device, axis, ball or finger */
+static int
+_pg_coalesce_same_source(SDL_Event *a, SDL_Event *b)
+{
+    if (a->type != b->type) {
+        return 0;
+    }
+    switch (a->type) {
+        case SDL_MOUSEMOTION:
+            return a->motion.which == b->motion.which &&
+                   a->motion.windowID == b->motion.windowID;
+        case SDL_FINGERMOTION:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            return a->tfinger.touchID == b->tfinger.touchID &&
+                   a->tfinger.fingerID == b->tfinger.fingerID;
+#else
+            return a->tfinger.touchId == b->tfinger.touchId &&
+                   a->tfinger.fingerId == b->tfinger.fingerId;
+#endif
+        case SDL_JOYAXISMOTION:
+            return a->jaxis.which == b->jaxis.which &&
+                   a->jaxis.axis == b->jaxis.axis;
+        case SDL_JOYBALLMOTION:
+            return a->jball.which == b->jball.which &&
+                   a->jball.ball == b->jball.ball;
+        case SDL_CONTROLLERAXISMOTION:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            return a->gaxis.which == b->gaxis.which &&
+                   a->gaxis.axis == b->gaxis.axis;
+#else
+            return a->caxis.which == b->caxis.which &&
+                   a->caxis.axis == b->caxis.axis;
+#endif
+    }
+    return 0;
+}
+
+/* Merges event into prev, the event taken off the queue right before it, if
+ * both come from the same source and the policy of their type is
+ * PG_COALESCE_LATEST or PG_COALESCE_ACCUMULATE. prev then holds event, plus
+ * the relative motion of prev for PG_COALESCE_ACCUMULATE. Returns the
+ * policy that was applied, PG_COALESCE_NONE if nothing was merged */
+static int
+_pg_coalesce_pair(SDL_Event *prev, SDL_Event *event)
+{
+    pgCoalescePolicy *policy;
+
+    if (!_pg_coalesce_same_source(prev, event)) {
+        return PG_COALESCE_NONE;
+    }
+    policy = _pg_coalesce_find(event->type);
+    if (policy->policy == PG_COALESCE_ACCUMULATE) {
+        switch (event->type) {
+            case SDL_MOUSEMOTION:
+                event->motion.xrel += prev->motion.xrel;
+                event->motion.yrel += prev->motion.yrel;
+                break;
+            case SDL_FINGERMOTION:
+                event->tfinger.dx += prev->tfinger.dx;
+                event->tfinger.dy += prev->tfinger.dy;
+                break;
+            case SDL_JOYBALLMOTION:
+                event->jball.xrel += prev->jball.xrel;
+                event->jball.yrel += prev->jball.yrel;
+                break;
+        }
+    }
+    else if (policy->policy != PG_COALESCE_LATEST) {
+        return PG_COALESCE_NONE;
+    }
+    *prev = *event;
+    return policy->policy;
+}
+
+/* Coalesces neighbouring events of the len events just taken off the queue
+ * in place, and returns how many are left */
+static int
+_pg_coalesce_events(SDL_Event *events, int len)
+{
+    int i, n = 1;
+
+    if (len < 2) {
+        return len;
+    }
+    PG_LOCK_EVFILTER_MUTEX
+    for (i = 1; i < len; i++) {
+        switch (_pg_coalesce_pair(&events[n - 1], &events[i])) {
+            case PG_COALESCE_LATEST:
+                _pg_coalesce_dropped++;
+                break;
+            case PG_COALESCE_ACCUMULATE:
+                _pg_coalesce_merged++;
+                break;
+            default:
+                events[n++] = events[i];
+        }
+    }
+    PG_UNLOCK_EVFILTER_MUTEX
+    return n;
+}
+
+/* Coalesces the events queued right after an event that was just taken off
+ * the queue into it, for as long as they follow it directly */
+static void
+_pg_coalesce_next(SDL_Event *event)
+{
+    SDL_Event pair[2];
+
+    pair[0] = *event;
+    while (PG_PEEP_EVENT_ALL(&pair[1], 1, SDL_PEEKEVENT) == 1 &&
+           _pg_coalesce_events(pair, 2) == 1) {
+        PG_PEEP_EVENT_ALL(&pair[1], 1, SDL_GETEVENT);
+    }
+    *event = pair[0];
+}
+
+/* Applies the PG_COALESCE_LIMIT policy of the event type to an event that is
+ * about to be queued. Returns 0 if the event must be dropped. The other
+ * policies only need the neighbours of an event, so they are applied when
+ * events are taken off the queue instead, see _pg_coalesce_events */
+static int
+_pg_coalesce_limit(SDL_Event *event)
+{
+    pgCoalescePolicy *policy;
+    int keep = 1;
+
+    PG_LOCK_EVFILTER_MUTEX
+    policy = _pg_coalesce_find(event->type);
+    if (policy && policy->policy == PG_COALESCE_LIMIT) {
+        if (policy->passed >= policy->limit) {
+            _pg_coalesce_dropped++;
+            keep = 0;
+        }
+        else {
+            policy->passed++;
+        }
+    }
+    PG_UNLOCK_EVFILTER_MUTEX
+    return keep;
+}
+
 /* SDL 2 to SDL 1.2 event mapping and SDL 1.2 key repeat emulation,
  * this can alter events in-place.
  * This function can be called from multiple threads, so a mutex must be held
@@ -709,7 +898,10 @@ pg_event_filter(void *_, SDL_Event *event)
             return RAISE(pgExc_SDLError, SDL_GetError()), 0;
         */
     }
-    return PG_EventEnabled(_pg_pgevent_proxify(event->type));
+    if (!PG_EventEnabled(_pg_pgevent_proxify(event->type))) {
+        return 0;
+    }
+    return !_pg_coalesce_active || _pg_coalesce_limit(event);
 }
 
 /* The two keyrepeat functions below modify state accessed by the event filter,
@@ -764,6 +956,10 @@ pgEvent_AutoInit(PyObject *self, PyObject *_null)
     if (!_pg_event_is_init) {
         pg_key_repeat_delay = 0;
         pg_key_repeat_interval = 0;
+        for (int i = 0; i < PG_NUM_COALESCE_POLICIES; i++) {
+            _pg_coalesce_policies[i].policy = PG_COALESCE_NONE;
+        }
+        _pg_coalesce_active = 0;
 #ifndef __EMSCRIPTEN__
         if (!pg_evfilter_mutex) {
             /* Create mutex only if it has not been created already */
@@ -1038,8 +1234,114 @@ get_joy_device_index(int instance_id)
     return PyLong_FromLong(device_index);
 }
 
+/* The pygame.Window an event happened in (borrowed), None if it is not
+ * one, or NULL for events without a window attribute. Looked up when the
+ * event is taken, since the window may be gone by the time the attributes
+ * are read */
+static PyObject *
+_pg_event_window(SDL_Event *event)
+{
+    SDL_Window *window;
+    switch (event->type) {
+        case PGE_WINDOWSHOWN:
+        case PGE_WINDOWHIDDEN:
+        case PGE_WINDOWEXPOSED:
+        case PGE_WINDOWMOVED:
+        case PGE_WINDOWRESIZED:
+        case PGE_WINDOWSIZECHANGED:
+        case PGE_WINDOWMINIMIZED:
+        case PGE_WINDOWMAXIMIZED:
+        case PGE_WINDOWRESTORED:
+        case PGE_WINDOWENTER:
+        case PGE_WINDOWLEAVE:
+        case PGE_WINDOWFOCUSGAINED:
+        case PGE_WINDOWFOCUSLOST:
+        case PGE_WINDOWCLOSE:
+        case PGE_WINDOWTAKEFOCUS:
+        case PGE_WINDOWHITTEST:
+        case PGE_WINDOWICCPROFCHANGED:
+        case PGE_WINDOWDISPLAYCHANGED: {
+            window = SDL_GetWindowFromID(event->window.windowID);
+            break;
+        }
+        case SDL_TEXTEDITING: {
+            window = SDL_GetWindowFromID(event->edit.windowID);
+            break;
+        }
+        case SDL_TEXTINPUT: {
+            window = SDL_GetWindowFromID(event->text.windowID);
+            break;
+        }
+        case SDL_DROPBEGIN:
+        case SDL_DROPCOMPLETE:
+        case SDL_DROPTEXT:
+        case SDL_DROPFILE: {
+            window = SDL_GetWindowFromID(event->drop.windowID);
+            break;
+        }
+        case SDL_KEYDOWN:
+        case SDL_KEYUP: {
+            window = SDL_GetWindowFromID(event->key.windowID);
+            break;
+        }
+        case SDL_MOUSEWHEEL: {
+            window = SDL_GetWindowFromID(event->wheel.windowID);
+            break;
+        }
+        case SDL_MOUSEMOTION: {
+            window = SDL_GetWindowFromID(event->motion.windowID);
+            break;
+        }
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP: {
+            window = SDL_GetWindowFromID(event->button.windowID);
+            break;
+        }
+        case SDL_FINGERMOTION:
+        case SDL_FINGERDOWN:
+        case SDL_FINGERUP: {
+            window = SDL_GetWindowFromID(event->tfinger.windowID);
+            break;
+        }
+        default: {
+            return NULL;
+        }
+    }
+    PyObject *pgWindow;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    if (!window ||
+        !(pgWindow = SDL_GetPointerProperty(SDL_GetWindowProperties(window),
+                                            "pg_window", NULL))) {
+#else
+    if (!window || !(pgWindow = SDL_GetWindowData(window, "pg_window"))) {
+#endif
+        pgWindow = Py_None;
+    }
+    return pgWindow;
+}
+
+/* The device index of the joystick of a joystick event, looked up when the
+ * event is taken for the same reason */
+static int
+_pg_event_joy(SDL_Event *event)
+{
+    switch (event->type) {
+        case SDL_JOYAXISMOTION:
+        case SDL_JOYBALLMOTION:
+        case SDL_JOYHATMOTION:
+        case SDL_JOYBUTTONUP:
+        case SDL_JOYBUTTONDOWN:
+            return pgJoystick_GetDeviceIndexByInstanceID(event->jaxis.which);
+    }
+    return -1;
+}
+
+/* unicode is only used for KEYDOWN and KEYUP events, see
+ * _pg_take_event_unicode. joy and window are what _pg_event_joy and
+ * _pg_event_window gave when the event was taken */
 static PyObject *
-dict_from_event(SDL_Event *event)
+dict_from_event(SDL_Event *event, const char *unicode, int joy,
+                PyObject *window)
 {
     PyObject *dict = NULL, *tuple, *obj;
     int hx, hy;
@@ -1120,10 +1422,7 @@ dict_from_event(SDL_Event *event)
             break;
         case SDL_KEYDOWN:
         case SDL_KEYUP:
-            PG_LOCK_EVFILTER_MUTEX
-            /* this accesses state also accessed the event filter, so lock */
-            _pg_insobj(dict, "unicode", _pg_get_event_unicode(event));
-            PG_UNLOCK_EVFILTER_MUTEX
+            _pg_insobj(dict, "unicode", PyUnicode_FromString(unicode));
 #if SDL_VERSION_ATLEAST(3, 0, 0)
             _pg_insobj(dict, "key", PyLong_FromLong(event->key.key));
             _pg_insobj(dict, "mod", PyLong_FromLong(event->key.mod));
@@ -1169,7 +1468,7 @@ dict_from_event(SDL_Event *event)
                 PyBool_FromLong((event->button.which == SDL_TOUCH_MOUSEID)));
             break;
         case SDL_JOYAXISMOTION:
-            _pg_insobj(dict, "joy", get_joy_device_index(event->jaxis.which));
+            _pg_insobj(dict, "joy", PyLong_FromLong(joy));
             _pg_insobj(dict, "instance_id",
                        PyLong_FromLong(event->jaxis.which));
             _pg_insobj(dict, "axis", PyLong_FromLong(event->jaxis.axis));
@@ -1178,7 +1477,7 @@ dict_from_event(SDL_Event *event)
                        PyFloat_FromDouble(event->jaxis.value / 32768.0));
             break;
         case SDL_JOYBALLMOTION:
-            _pg_insobj(dict, "joy", get_joy_device_index(event->jaxis.which));
+            _pg_insobj(dict, "joy", PyLong_FromLong(joy));
             _pg_insobj(dict, "instance_id",
                        PyLong_FromLong(event->jball.which));
             _pg_insobj(dict, "ball", PyLong_FromLong(event->jball.ball));
@@ -1187,7 +1486,7 @@ dict_from_event(SDL_Event *event)
             _pg_insobj(dict, "rel", obj);
             break;
         case SDL_JOYHATMOTION:
-            _pg_insobj(dict, "joy", get_joy_device_index(event->jaxis.which));
+            _pg_insobj(dict, "joy", PyLong_FromLong(joy));
             _pg_insobj(dict, "instance_id",
                        PyLong_FromLong(event->jhat.which));
             _pg_insobj(dict, "hat", PyLong_FromLong(event->jhat.hat));
@@ -1208,7 +1507,7 @@ dict_from_event(SDL_Event *event)
             break;
         case SDL_JOYBUTTONUP:
         case SDL_JOYBUTTONDOWN:
-            _pg_insobj(dict, "joy", get_joy_device_index(event->jaxis.which));
+            _pg_insobj(dict, "joy", PyLong_FromLong(joy));
             _pg_insobj(dict, "instance_id",
                        PyLong_FromLong(event->jbutton.which));
             _pg_insobj(dict, "button", PyLong_FromLong(event->jbutton.button));
@@ -1463,106 +1762,73 @@ dict_from_event(SDL_Event *event)
 #endif /* (defined(unix) || ... */
 #endif /* !SDL_VERSION_ATLEAST(3, 0, 0) */
     } /* switch (event->type) */
-    /* Events that don't have any attributes are not handled in switch
-     * statement */
-    SDL_Window *window;
-    switch (event->type) {
-        case PGE_WINDOWSHOWN:
-        case PGE_WINDOWHIDDEN:
-        case PGE_WINDOWEXPOSED:
-        case PGE_WINDOWMOVED:
-        case PGE_WINDOWRESIZED:
-        case PGE_WINDOWSIZECHANGED:
-        case PGE_WINDOWMINIMIZED:
-        case PGE_WINDOWMAXIMIZED:
-        case PGE_WINDOWRESTORED:
-        case PGE_WINDOWENTER:
-        case PGE_WINDOWLEAVE:
-        case PGE_WINDOWFOCUSGAINED:
-        case PGE_WINDOWFOCUSLOST:
-        case PGE_WINDOWCLOSE:
-        case PGE_WINDOWTAKEFOCUS:
-        case PGE_WINDOWHITTEST:
-        case PGE_WINDOWICCPROFCHANGED:
-        case PGE_WINDOWDISPLAYCHANGED: {
-            window = SDL_GetWindowFromID(event->window.windowID);
-            break;
-        }
-        case SDL_TEXTEDITING: {
-            window = SDL_GetWindowFromID(event->edit.windowID);
-            break;
-        }
-        case SDL_TEXTINPUT: {
-            window = SDL_GetWindowFromID(event->text.windowID);
-            break;
-        }
-        case SDL_DROPBEGIN:
-        case SDL_DROPCOMPLETE:
-        case SDL_DROPTEXT:
-        case SDL_DROPFILE: {
-            window = SDL_GetWindowFromID(event->drop.windowID);
-            break;
-        }
-        case SDL_KEYDOWN:
-        case SDL_KEYUP: {
-            window = SDL_GetWindowFromID(event->key.windowID);
-            break;
-        }
-        case SDL_MOUSEWHEEL: {
-            window = SDL_GetWindowFromID(event->wheel.windowID);
-            break;
-        }
-        case SDL_MOUSEMOTION: {
-            window = SDL_GetWindowFromID(event->motion.windowID);
-            break;
-        }
-        case SDL_MOUSEBUTTONDOWN:
-        case SDL_MOUSEBUTTONUP: {
-            window = SDL_GetWindowFromID(event->button.windowID);
-            break;
-        }
-        case SDL_FINGERMOTION:
-        case SDL_FINGERDOWN:
-        case SDL_FINGERUP: {
-            window = SDL_GetWindowFromID(event->tfinger.windowID);
-            break;
-        }
-        default: {
-            return dict;
-        }
-    }
-    PyObject *pgWindow;
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-    if (!window ||
-        !(pgWindow = SDL_GetPointerProperty(SDL_GetWindowProperties(window),
-                                            "pg_window", NULL))) {
-#else
-    if (!window || !(pgWindow = SDL_GetWindowData(window, "pg_window"))) {
-#endif
-        pgWindow = Py_None;
+    if (window) {
+        Py_INCREF(window);
+        _pg_insobj(dict, "window", window);
     }
-    Py_INCREF(pgWindow);
-    _pg_insobj(dict, "window", pgWindow);
     return dict;
 }
 
 /* event object internals */
 
-static void
-pg_event_dealloc(PyObject *self)
+/* Events taken from the queue keep a copy of their SDL_Event and only build
+ * their attribute dict the first time something other than the type is
+ * needed. Returns the (borrowed) dict, or NULL with an exception set */
+static PyObject *
+pgEvent_GetDict(PyObject *self)
 {
     pgEventObject *e = (pgEventObject *)self;
-    Py_XDECREF(e->dict);
-    Py_TYPE(self)->tp_free(self);
+    if (!e->dict) {
+        e->dict =
+            dict_from_event(&e->event, e->unicode, e->joy, e->window);
+    }
+    return e->dict;
 }
 
-#ifdef PYPY_VERSION
-/* Because pypy does not work with the __dict__ tp_dictoffset. */
-PyObject *
-pg_EventGetAttr(PyObject *o, PyObject *attr_name)
+/* Events whose attributes depend on data that does not outlive the queue
+ * (posted dicts, SDL owned strings, device indices) must be converted
+ * right away */
+static int
+_pg_event_needs_eager_dict(SDL_Event *event)
+{
+    if (event->type >= PGPOST_EVENTBEGIN) {
+        return 1;
+    }
+    switch (event->type) {
+        case SDL_DROPFILE:
+        case SDL_DROPTEXT:
+        case SDL_JOYDEVICEADDED:
+        case SDL_CONTROLLERDEVICEADDED:
+        case SDL_SYSWMEVENT:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+        case SDL_TEXTINPUT:
+        case SDL_TEXTEDITING:
+#endif
+            return 1;
+    }
+    return 0;
+}
+
+static void
+pg_event_dealloc(PyObject *self)
+{
+    pgEventObject *e = (pgEventObject *)self;
+    Py_XDECREF(e->dict);
+    Py_XDECREF(e->window);
+    Py_TYPE(self)->tp_free(self);
+}
+
+#ifdef PYPY_VERSION
+/* Because pypy does not work with the __dict__ tp_dictoffset. */
+PyObject *
+pg_EventGetAttr(PyObject *o, PyObject *attr_name)
 {
     /* Try e->dict first, if not try the generic attribute. */
-    PyObject *result = PyDict_GetItem(((pgEventObject *)o)->dict, attr_name);
+    PyObject *dict = pgEvent_GetDict(o);
+    if (!dict) {
+        return NULL;
+    }
+    PyObject *result = PyDict_GetItem(dict, attr_name);
     if (!result) {
         return PyObject_GenericGetAttr(o, attr_name);
     }
@@ -1578,7 +1844,11 @@ pg_EventSetAttr(PyObject *o, PyObject *name, PyObject *value)
     */
     int dictResult;
     int setInDict = 0;
-    PyObject *result = PyDict_GetItem(((pgEventObject *)o)->dict, name);
+    PyObject *dict = pgEvent_GetDict(o);
+    if (!dict) {
+        return -1;
+    }
+    PyObject *result = PyDict_GetItem(dict, name);
 
     if (result) {
         setInDict = 1;
@@ -1592,7 +1862,7 @@ pg_EventSetAttr(PyObject *o, PyObject *name, PyObject *value)
     }
 
     if (setInDict) {
-        dictResult = PyDict_SetItem(((pgEventObject *)o)->dict, name, value);
+        dictResult = PyDict_SetItem(dict, name, value);
         if (dictResult) {
             return -1;
         }
@@ -1602,12 +1872,37 @@ pg_EventSetAttr(PyObject *o, PyObject *name, PyObject *value)
         return PyObject_GenericSetAttr(o, name, value);
     }
 }
+#else
+static PyObject *
+pg_EventGetAttr(PyObject *o, PyObject *attr_name)
+{
+    /* the type is not kept in the dict, no need to build it for that */
+    if (!((pgEventObject *)o)->dict &&
+        !(PyUnicode_Check(attr_name) &&
+          PyUnicode_CompareWithASCIIString(attr_name, "type") == 0) &&
+        !pgEvent_GetDict(o)) {
+        return NULL;
+    }
+    return PyObject_GenericGetAttr(o, attr_name);
+}
+
+static int
+pg_EventSetAttr(PyObject *o, PyObject *name, PyObject *value)
+{
+    if (!pgEvent_GetDict(o)) {
+        return -1;
+    }
+    return PyObject_GenericSetAttr(o, name, value);
+}
 #endif
 
 PyObject *
 pg_event_str(PyObject *self)
 {
     pgEventObject *e = (pgEventObject *)self;
+    if (!pgEvent_GetDict(self)) {
+        return NULL;
+    }
     return PyUnicode_FromFormat("<Event(%d-%s %S)>", e->type,
                                 _pg_name_from_eventtype(e->type), e->dict);
 }
@@ -1627,12 +1922,23 @@ static PyTypeObject pgEvent_Type;
 #define OFF(x) offsetof(pgEventObject, x)
 
 static PyMemberDef pg_event_members[] = {
-    {"__dict__", T_OBJECT, OFF(dict), READONLY, DOC_EVENT_EVENT_DICT},
     {"type", T_INT, OFF(type), READONLY, DOC_EVENT_EVENT_TYPE},
-    {"dict", T_OBJECT, OFF(dict), READONLY, DOC_EVENT_EVENT_DICT},
     {NULL} /* Sentinel */
 };
 
+static PyObject *
+pg_event_get_dict(PyObject *self, void *closure)
+{
+    PyObject *dict = pgEvent_GetDict(self);
+    Py_XINCREF(dict);
+    return dict;
+}
+
+static PyGetSetDef pg_event_getsets[] = {
+    {"__dict__", pg_event_get_dict, NULL, DOC_EVENT_EVENT_DICT, NULL},
+    {"dict", pg_event_get_dict, NULL, DOC_EVENT_EVENT_DICT, NULL},
+    {NULL, NULL, NULL, NULL, NULL}};
+
 /*
  * eventA == eventB
  * eventA != eventB
@@ -1648,6 +1954,9 @@ pg_event_richcompare(PyObject *o1, PyObject *o2, int opid)
 
     e1 = (pgEventObject *)o1;
     e2 = (pgEventObject *)o2;
+    if (!pgEvent_GetDict(o1) || !pgEvent_GetDict(o2)) {
+        return NULL;
+    }
     switch (opid) {
         case Py_EQ:
             return PyBool_FromLong(
@@ -1722,16 +2031,12 @@ static PyTypeObject pgEvent_Type = {
     .tp_dealloc = pg_event_dealloc,
     .tp_repr = pg_event_str,
     .tp_as_number = &pg_event_as_number,
-#ifdef PYPY_VERSION
     .tp_getattro = pg_EventGetAttr,
     .tp_setattro = pg_EventSetAttr,
-#else
-    .tp_getattro = PyObject_GenericGetAttr,
-    .tp_setattro = PyObject_GenericSetAttr,
-#endif
     .tp_doc = DOC_EVENT_EVENT,
     .tp_richcompare = pg_event_richcompare,
     .tp_members = pg_event_members,
+    .tp_getset = pg_event_getsets,
     .tp_dictoffset = offsetof(pgEventObject, dict),
     .tp_init = (initproc)pg_event_init,
     .tp_new = PyType_GenericNew,
@@ -1746,17 +2051,29 @@ pgEvent_New(SDL_Event *event)
         return PyErr_NoMemory();
     }
 
+    e->dict = NULL;
+    e->window = NULL;
     if (event) {
         e->type = _pg_pgevent_deproxify(event->type);
-        e->dict = dict_from_event(event);
+        e->event = *event;
+        e->joy = _pg_event_joy(event);
+        e->window = _pg_event_window(event);
+        Py_XINCREF(e->window);
+        if (event->type == SDL_KEYDOWN || event->type == SDL_KEYUP) {
+            PG_LOCK_EVFILTER_MUTEX
+            /* this accesses state also accessed the event filter, so lock */
+            _pg_take_event_unicode(event, e->unicode);
+            PG_UNLOCK_EVFILTER_MUTEX
+        }
+        if (_pg_event_needs_eager_dict(event) &&
+            !pgEvent_GetDict((PyObject *)e)) {
+            Py_DECREF(e);
+            return NULL;
+        }
     }
     else {
         e->type = SDL_NOEVENT;
-        e->dict = PyDict_New();
-    }
-    if (!e->dict) {
-        Py_TYPE(e)->tp_free(e);
-        return PyErr_NoMemory();
+        memset(&e->event, 0, sizeof(SDL_Event));
     }
     return (PyObject *)e;
 }
@@ -1843,6 +2160,15 @@ _pg_event_pump(int dopump)
         memset(pressed_mouse_buttons, 0, sizeof(pressed_mouse_buttons));
         memset(released_mouse_buttons, 0, sizeof(released_mouse_buttons));
 
+        if (_pg_coalesce_active) {
+            /* PG_COALESCE_LIMIT counts events per pump */
+            PG_LOCK_EVFILTER_MUTEX
+            for (int i = 0; i < PG_NUM_COALESCE_POLICIES; i++) {
+                _pg_coalesce_policies[i].passed = 0;
+            }
+            PG_UNLOCK_EVFILTER_MUTEX
+        }
+
         SDL_PumpEvents();
     }
 
@@ -1874,6 +2200,9 @@ _pg_event_wait(SDL_Event *event, int timeout)
             case -1:
                 return 0; /* Because this never happens, SDL does it too*/
             case 1:
+                if (_pg_coalesce_active) {
+                    _pg_coalesce_next(event);
+                }
                 return 1;
 
             default:
@@ -2062,6 +2391,43 @@ pgEvent_GetMouseButtonUpInfo(void)
     return released_mouse_buttons;
 }
 
+/* Takes every event off the queue and appends it to list, coalescing
+ * neighbouring events while a coalescing policy is set. Returns 0 with an
+ * exception set on error */
+static int
+_pg_take_all_events(PyObject *list)
+{
+    SDL_Event eventbuf[PG_GET_LIST_LEN];
+    int loop, len, kept = 0, more = 1;
+
+    while (more) {
+        len = PG_PEEP_EVENT_ALL(eventbuf + kept, PG_GET_LIST_LEN - kept,
+                                SDL_GETEVENT);
+        if (len == -1) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            return 0;
+        }
+        more = len == PG_GET_LIST_LEN - kept;
+        len += kept;
+        kept = 0;
+
+        if (_pg_coalesce_active) {
+            len = _pg_coalesce_events(eventbuf, len);
+            /* the last event may still coalesce with the next one queued */
+            kept = more;
+        }
+        for (loop = 0; loop < len - kept; loop++) {
+            if (!_pg_event_append_to_list(list, &eventbuf[loop])) {
+                return 0;
+            }
+        }
+        if (kept) {
+            eventbuf[0] = eventbuf[len - 1];
+        }
+    }
+    return 1;
+}
+
 static PyObject *
 _pg_get_all_events_except(PyObject *obj)
 {
@@ -2074,8 +2440,6 @@ _pg_get_all_events_except(PyObject *obj)
     int filtered_index = 0;
     int filtered_events_len = 16;
 
-    SDL_Event eventbuf[PG_GET_LIST_LEN];
-
     filtered_events = malloc(sizeof(SDL_Event) * filtered_events_len);
     if (!filtered_events) {
         return PyErr_NoMemory();
@@ -2148,19 +2512,9 @@ _pg_get_all_events_except(PyObject *obj)
         } while (ret);
     }
 
-    do {
-        len = PG_PEEP_EVENT_ALL(eventbuf, PG_GET_LIST_LEN, SDL_GETEVENT);
-        if (len == -1) {
-            PyErr_SetString(pgExc_SDLError, SDL_GetError());
-            goto error;
-        }
-
-        for (loop = 0; loop < len; loop++) {
-            if (!_pg_event_append_to_list(list, &eventbuf[loop])) {
-                goto error;
-            }
-        }
-    } while (len == PG_GET_LIST_LEN);
+    if (!_pg_take_all_events(list)) {
+        goto error;
+    }
 
     PG_PEEP_EVENT_ALL(filtered_events, filtered_index, SDL_ADDEVENT);
 
@@ -2179,33 +2533,17 @@ error:
 static PyObject *
 _pg_get_all_events(void)
 {
-    SDL_Event eventbuf[PG_GET_LIST_LEN];
     PyObject *list;
-    int loop, len = PG_GET_LIST_LEN;
 
     list = PyList_New(0);
     if (!list) {
         return PyErr_NoMemory();
     }
-
-    while (len == PG_GET_LIST_LEN) {
-        len = PG_PEEP_EVENT_ALL(eventbuf, PG_GET_LIST_LEN, SDL_GETEVENT);
-        if (len == -1) {
-            PyErr_SetString(pgExc_SDLError, SDL_GetError());
-            goto error;
-        }
-
-        for (loop = 0; loop < len; loop++) {
-            if (!_pg_event_append_to_list(list, &eventbuf[loop])) {
-                goto error;
-            }
-        }
+    if (!_pg_take_all_events(list)) {
+        Py_DECREF(list);
+        return NULL;
     }
     return list;
-
-error:
-    Py_DECREF(list);
-    return NULL;
 }
 
 static PyObject *
@@ -2302,6 +2640,510 @@ pg_event_get(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 }
 
+/* Compact, allocation-free representation of a queued event, used by
+ * pygame.event.get_buffer(). The record layout is exported as-is through the
+ * buffer protocol, so PG_EVENT_RECORD_FORMAT must always match it. */
+typedef struct {
+    Uint32 type;
+    Uint32 window;
+    Uint64 timestamp;
+    Sint32 which;
+    Sint32 code;
+    Sint32 state;
+    Sint32 count;
+    float x;
+    float y;
+    float dx;
+    float dy;
+} pgEventRecord;
+
+#define PG_EVENT_RECORD_FORMAT "IIQiiiiffff"
+
+typedef struct {
+    PyObject_HEAD pgEventRecord *records;
+    Py_ssize_t len;
+    Py_ssize_t capacity;
+    Py_ssize_t shape[1];
+    Py_ssize_t strides[1];
+    int exports;
+} pgEventBufferObject;
+
+/* Drops the reference a posted event holds on its dictproxy, without
+ * building the event dict. Must be called with the GIL held. */
+static void
+_pg_event_release_dictproxy(SDL_Event *event)
+{
+    int to_free;
+    pgEventDictProxy *dict_proxy = (pgEventDictProxy *)event->user.data1;
+    if (!dict_proxy) {
+        return;
+    }
+
+    SDL_AtomicLock(&dict_proxy->lock);
+    dict_proxy->num_on_queue--;
+    to_free = dict_proxy->num_on_queue <= 0 && dict_proxy->do_free_at_end;
+    SDL_AtomicUnlock(&dict_proxy->lock);
+
+    if (to_free) {
+        Py_DECREF(dict_proxy->dict);
+        free(dict_proxy);
+    }
+}
+
+static void
+_pg_event_record_fill(pgEventRecord *rec, SDL_Event *event)
+{
+    int hx = 0, hy = 0;
+    char unicode[UNICODE_LEN];
+
+    memset(rec, 0, sizeof(pgEventRecord));
+    rec->type = _pg_pgevent_deproxify(event->type);
+    rec->count = 1;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    rec->timestamp = SDL_NS_TO_MS(event->common.timestamp);
+#else
+    rec->timestamp = event->common.timestamp;
+#endif
+
+    if (event->type >= PGPOST_EVENTBEGIN) {
+        /* posted events carry their attributes in a python dict only */
+        _pg_event_release_dictproxy(event);
+        return;
+    }
+
+    switch (event->type) {
+        case SDL_KEYDOWN:
+        case SDL_KEYUP:
+            /* keep the unicode cache in sync, like pgEvent_New does */
+            PG_LOCK_EVFILTER_MUTEX
+            _pg_take_event_unicode(event, unicode);
+            PG_UNLOCK_EVFILTER_MUTEX
+            rec->window = event->key.windowID;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->which = event->key.scancode;
+            rec->code = event->key.key;
+            rec->state = event->key.mod;
+#else
+            rec->which = event->key.keysym.scancode;
+            rec->code = event->key.keysym.sym;
+            rec->state = event->key.keysym.mod;
+#endif
+            break;
+        case SDL_MOUSEMOTION:
+            rec->window = event->motion.windowID;
+            rec->which = (Sint32)event->motion.which;
+            rec->state = (Sint32)event->motion.state;
+            rec->x = (float)event->motion.x;
+            rec->y = (float)event->motion.y;
+            rec->dx = (float)event->motion.xrel;
+            rec->dy = (float)event->motion.yrel;
+            break;
+        case SDL_MOUSEBUTTONDOWN:
+        case SDL_MOUSEBUTTONUP:
+            rec->window = event->button.windowID;
+            rec->which = (Sint32)event->button.which;
+            rec->code = event->button.button;
+            rec->x = (float)event->button.x;
+            rec->y = (float)event->button.y;
+            break;
+        case SDL_MOUSEWHEEL:
+            rec->window = event->wheel.windowID;
+            rec->which = (Sint32)event->wheel.which;
+#ifndef NO_SDL_MOUSEWHEEL_FLIPPED
+            rec->state = event->wheel.direction == SDL_MOUSEWHEEL_FLIPPED;
+#endif
+#if SDL_VERSION_ATLEAST(3, 0, 0) || !SDL_VERSION_ATLEAST(2, 0, 18)
+            rec->x = (float)event->wheel.x;
+            rec->y = (float)event->wheel.y;
+#else
+            rec->x = event->wheel.preciseX;
+            rec->y = event->wheel.preciseY;
+#endif
+            break;
+        case SDL_JOYAXISMOTION:
+            rec->which = event->jaxis.which;
+            rec->code = event->jaxis.axis;
+            rec->x = event->jaxis.value / 32768.0f;
+            break;
+        case SDL_JOYBALLMOTION:
+            rec->which = event->jball.which;
+            rec->code = event->jball.ball;
+            rec->dx = event->jball.xrel;
+            rec->dy = event->jball.yrel;
+            break;
+        case SDL_JOYHATMOTION:
+            rec->which = event->jhat.which;
+            rec->code = event->jhat.hat;
+            if (event->jhat.value & SDL_HAT_UP) {
+                hy = 1;
+            }
+            else if (event->jhat.value & SDL_HAT_DOWN) {
+                hy = -1;
+            }
+            if (event->jhat.value & SDL_HAT_RIGHT) {
+                hx = 1;
+            }
+            else if (event->jhat.value & SDL_HAT_LEFT) {
+                hx = -1;
+            }
+            rec->x = (float)hx;
+            rec->y = (float)hy;
+            break;
+        case SDL_JOYBUTTONUP:
+        case SDL_JOYBUTTONDOWN:
+            rec->which = event->jbutton.which;
+            rec->code = event->jbutton.button;
+            break;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+        case SDL_CONTROLLERAXISMOTION:
+            rec->which = event->gaxis.which;
+            rec->code = event->gaxis.axis;
+            rec->x = event->gaxis.value;
+            break;
+        case SDL_CONTROLLERBUTTONDOWN:
+        case SDL_CONTROLLERBUTTONUP:
+            rec->which = event->gbutton.which;
+            rec->code = event->gbutton.button;
+            break;
+#else
+        case SDL_CONTROLLERAXISMOTION:
+            rec->which = event->caxis.which;
+            rec->code = event->caxis.axis;
+            rec->x = event->caxis.value;
+            break;
+        case SDL_CONTROLLERBUTTONDOWN:
+        case SDL_CONTROLLERBUTTONUP:
+            rec->which = event->cbutton.which;
+            rec->code = event->cbutton.button;
+            break;
+#endif
+        case SDL_FINGERMOTION:
+        case SDL_FINGERDOWN:
+        case SDL_FINGERUP:
+            rec->window = event->tfinger.windowID;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            rec->which = (Sint32)event->tfinger.fingerID;
+            rec->code = (Sint32)event->tfinger.touchID;
+#else
+            rec->which = (Sint32)event->tfinger.fingerId;
+            rec->code = (Sint32)event->tfinger.touchId;
+#endif
+            rec->x = event->tfinger.x;
+            rec->y = event->tfinger.y;
+            rec->dx = event->tfinger.dx;
+            rec->dy = event->tfinger.dy;
+            break;
+        case SDL_TEXTINPUT:
+            rec->window = event->text.windowID;
+            break;
+        case SDL_TEXTEDITING:
+            rec->window = event->edit.windowID;
+            rec->code = event->edit.start;
+            rec->state = event->edit.length;
+            break;
+        case SDL_DROPFILE:
+        case SDL_DROPTEXT:
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+            /* nothing else owns the dropped data on SDL2, see
+             * dict_from_event */
+            SDL_free(event->drop.file);
+#endif
+            /* fallthrough */
+        case SDL_DROPBEGIN:
+        case SDL_DROPCOMPLETE:
+            rec->window = event->drop.windowID;
+            break;
+        case SDL_VIDEORESIZE:
+        case PGE_WINDOWSHOWN:
+        case PGE_WINDOWHIDDEN:
+        case PGE_WINDOWEXPOSED:
+        case PGE_WINDOWMOVED:
+        case PGE_WINDOWRESIZED:
+        case PGE_WINDOWSIZECHANGED:
+        case PGE_WINDOWMINIMIZED:
+        case PGE_WINDOWMAXIMIZED:
+        case PGE_WINDOWRESTORED:
+        case PGE_WINDOWENTER:
+        case PGE_WINDOWLEAVE:
+        case PGE_WINDOWFOCUSGAINED:
+        case PGE_WINDOWFOCUSLOST:
+        case PGE_WINDOWCLOSE:
+        case PGE_WINDOWTAKEFOCUS:
+        case PGE_WINDOWHITTEST:
+        case PGE_WINDOWICCPROFCHANGED:
+        case PGE_WINDOWDISPLAYCHANGED:
+            rec->window = event->window.windowID;
+            rec->x = (float)event->window.data1;
+            rec->y = (float)event->window.data2;
+            break;
+    }
+}
+
+/* Merges rec into the last record of the buffer if both describe the same
+ * continuous stream (same motion source or same axis). Returns 1 if merged */
+static int
+_pg_event_record_coalesce(pgEventRecord *last, pgEventRecord *rec)
+{
+    if (last->type != rec->type || last->window != rec->window ||
+        last->which != rec->which) {
+        return 0;
+    }
+
+    switch (rec->type) {
+        case SDL_MOUSEMOTION:
+            last->state = rec->state;
+            last->x = rec->x;
+            last->y = rec->y;
+            last->dx += rec->dx;
+            last->dy += rec->dy;
+            break;
+        case SDL_FINGERMOTION:
+            if (last->code != rec->code) {
+                return 0;
+            }
+            last->x = rec->x;
+            last->y = rec->y;
+            last->dx += rec->dx;
+            last->dy += rec->dy;
+            break;
+        case SDL_JOYBALLMOTION:
+            if (last->code != rec->code) {
+                return 0;
+            }
+            last->dx += rec->dx;
+            last->dy += rec->dy;
+            break;
+        case SDL_JOYAXISMOTION:
+        case SDL_CONTROLLERAXISMOTION:
+            if (last->code != rec->code) {
+                return 0;
+            }
+            last->x = rec->x;
+            break;
+        default:
+            return 0;
+    }
+    last->timestamp = rec->timestamp;
+    last->count += rec->count;
+    return 1;
+}
+
+static int
+_pg_event_buffer_append(pgEventBufferObject *self, SDL_Event *event,
+                        int coalesce)
+{
+    pgEventRecord rec;
+
+    /* posted events keep their attributes in a dict, never merge those */
+    coalesce = coalesce && event->type < PGPOST_EVENTBEGIN;
+    _pg_event_record_fill(&rec, event);
+    if (coalesce && self->len &&
+        _pg_event_record_coalesce(&self->records[self->len - 1], &rec)) {
+        return 1;
+    }
+
+    if (self->len == self->capacity) {
+        Py_ssize_t new_capacity =
+            self->capacity ? self->capacity * 2 : PG_GET_LIST_LEN;
+        pgEventRecord *new_records = PyMem_Realloc(
+            self->records, sizeof(pgEventRecord) * new_capacity);
+        if (!new_records) {
+            PyErr_NoMemory();
+            return 0;
+        }
+        self->records = new_records;
+        self->capacity = new_capacity;
+    }
+    self->records[self->len++] = rec;
+    return 1;
+}
+
+static int
+_pg_event_buffer_drain(pgEventBufferObject *self, Uint32 minType,
+                       Uint32 maxType, int coalesce)
+{
+    SDL_Event eventbuf[PG_GET_LIST_LEN];
+    pgEventRecord scratch;
+    int loop, len;
+
+    do {
+        len = SDL_PeepEvents(eventbuf, PG_GET_LIST_LEN, SDL_GETEVENT, minType,
+                             maxType);
+        if (len == -1) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            return 0;
+        }
+
+        for (loop = 0; loop < len; loop++) {
+            if (!_pg_event_buffer_append(self, &eventbuf[loop], coalesce)) {
+                /* release what is left of this batch so posted dicts and
+                 * dropped files are not leaked */
+                for (loop++; loop < len; loop++) {
+                    _pg_event_record_fill(&scratch, &eventbuf[loop]);
+                }
+                return 0;
+            }
+        }
+    } while (len == PG_GET_LIST_LEN);
+    return 1;
+}
+
+static void
+pg_event_buffer_dealloc(pgEventBufferObject *self)
+{
+    PyMem_Free(self->records);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static Py_ssize_t
+pg_event_buffer_length(pgEventBufferObject *self)
+{
+    return self->len;
+}
+
+static PyObject *
+pg_event_buffer_repr(pgEventBufferObject *self)
+{
+    return PyUnicode_FromFormat("<EventBuffer(%zd events)>", self->len);
+}
+
+static int
+pg_event_buffer_getbuffer(pgEventBufferObject *self, Py_buffer *view,
+                          int flags)
+{
+    if (flags & PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError, "EventBuffer is read-only");
+        return -1;
+    }
+
+    self->shape[0] = self->len;
+    self->strides[0] = sizeof(pgEventRecord);
+
+    view->buf = self->records;
+    view->len = self->len * sizeof(pgEventRecord);
+    view->readonly = 1;
+    view->itemsize = sizeof(pgEventRecord);
+    view->ndim = 1;
+    view->internal = NULL;
+    view->format = (flags & PyBUF_FORMAT) ? PG_EVENT_RECORD_FORMAT : NULL;
+    view->shape = (flags & PyBUF_ND) ? self->shape : NULL;
+    view->strides = (flags & PyBUF_STRIDES) ? self->strides : NULL;
+    view->suboffsets = NULL;
+
+    self->exports++;
+    Py_INCREF(self);
+    view->obj = (PyObject *)self;
+    return 0;
+}
+
+static void
+pg_event_buffer_releasebuffer(pgEventBufferObject *self, Py_buffer *view)
+{
+    self->exports--;
+}
+
+static PySequenceMethods pg_event_buffer_as_sequence = {
+    .sq_length = (lenfunc)pg_event_buffer_length,
+};
+
+static PyBufferProcs pg_event_buffer_as_buffer = {
+    (getbufferproc)pg_event_buffer_getbuffer,
+    (releasebufferproc)pg_event_buffer_releasebuffer};
+
+static PyObject *
+pg_event_buffer_get_format(PyObject *self, void *closure)
+{
+    return PyUnicode_FromString(PG_EVENT_RECORD_FORMAT);
+}
+
+static PyGetSetDef pg_event_buffer_getsets[] = {
+    {"format", (getter)pg_event_buffer_get_format, NULL,
+     DOC_EVENT_EVENTBUFFER_FORMAT, NULL},
+    {NULL, NULL, NULL, NULL, NULL}};
+
+static PyTypeObject pgEventBuffer_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.event.EventBuffer",
+    .tp_basicsize = sizeof(pgEventBufferObject),
+    .tp_dealloc = (destructor)pg_event_buffer_dealloc,
+    .tp_repr = (reprfunc)pg_event_buffer_repr,
+    .tp_as_sequence = &pg_event_buffer_as_sequence,
+    .tp_as_buffer = &pg_event_buffer_as_buffer,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = DOC_EVENT_EVENTBUFFER,
+    .tp_getset = pg_event_buffer_getsets,
+};
+
+static PyObject *
+pg_event_get_buffer(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    Py_ssize_t len;
+    int loop, type;
+    PyObject *seq, *obj_evtype = NULL;
+    pgEventBufferObject *buffer = NULL;
+    int dopump = 1, coalesce = 0;
+
+    static char *kwids[] = {"eventtype", "pump", "coalesce", "buffer", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OppO!", kwids,
+                                     &obj_evtype, &dopump, &coalesce,
+                                     &pgEventBuffer_Type, &buffer)) {
+        return NULL;
+    }
+
+    VIDEO_INIT_CHECK();
+
+    if (buffer) {
+        if (buffer->exports) {
+            return RAISE(PyExc_BufferError,
+                         "cannot refill an EventBuffer while it is exported");
+        }
+        Py_INCREF(buffer);
+        buffer->len = 0;
+    }
+    else {
+        buffer = PyObject_New(pgEventBufferObject, &pgEventBuffer_Type);
+        if (!buffer) {
+            return NULL;
+        }
+        buffer->records = NULL;
+        buffer->len = buffer->capacity = 0;
+        buffer->exports = 0;
+    }
+
+    _pg_event_pump(dopump);
+
+    if (obj_evtype == NULL || obj_evtype == Py_None) {
+        if (!_pg_event_buffer_drain(buffer, SDL_FIRSTEVENT, SDL_LASTEVENT,
+                                    coalesce)) {
+            goto error;
+        }
+        return (PyObject *)buffer;
+    }
+
+    seq = _pg_eventtype_as_seq(obj_evtype, &len);
+    if (!seq) {
+        goto error;
+    }
+
+    for (loop = 0; loop < len; loop++) {
+        type = _pg_eventtype_from_seq(seq, loop);
+        if (type == -1 ||
+            !_pg_event_buffer_drain(buffer, type, type, coalesce) ||
+            !_pg_event_buffer_drain(buffer, _pg_pgevent_proxify(type),
+                                    _pg_pgevent_proxify(type), coalesce)) {
+            Py_DECREF(seq);
+            goto error;
+        }
+    }
+    Py_DECREF(seq);
+    return (PyObject *)buffer;
+
+error:
+    /* While doing a goto here, PyErr must be set */
+    Py_DECREF(buffer);
+    return NULL;
+}
+
 static PyObject *
 pg_event_peek(PyObject *self, PyObject *args, PyObject *kwargs)
 {
@@ -2380,6 +3222,9 @@ pg_event_post(PyObject *self, PyObject *obj)
     }
 
     pgEventObject *e = (pgEventObject *)obj;
+    if (!pgEvent_GetDict(obj)) {
+        return NULL;
+    }
     switch (pg_post_event(e->type, e->dict)) {
         case 0:
             Py_RETURN_FALSE;
@@ -2505,6 +3350,105 @@ pg_event_custom_type(PyObject *self, PyObject *_null)
     }
 }
 
+static PyObject *
+pg_event_set_coalesce(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    Py_ssize_t len;
+    int loop, type, policy_id, limit = 0;
+    const char *policy = NULL;
+    PyObject *seq, *obj;
+    pgCoalescePolicy *coalesce;
+
+    static char *kwids[] = {"eventtype", "policy", "limit", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|zi", kwids, &obj,
+                                     &policy, &limit)) {
+        return NULL;
+    }
+
+    if (!policy) {
+        policy_id = PG_COALESCE_NONE;
+    }
+    else if (!strcmp(policy, "latest")) {
+        policy_id = PG_COALESCE_LATEST;
+    }
+    else if (!strcmp(policy, "accumulate")) {
+        policy_id = PG_COALESCE_ACCUMULATE;
+    }
+    else if (!strcmp(policy, "limit")) {
+        policy_id = PG_COALESCE_LIMIT;
+    }
+    else {
+        return RAISE(PyExc_ValueError,
+                     "policy must be None, 'latest', 'accumulate' or 'limit'");
+    }
+    if (limit < 0) {
+        return RAISE(PyExc_ValueError, "limit must be at least 0");
+    }
+
+    seq = _pg_eventtype_as_seq(obj, &len);
+    if (!seq) {
+        return NULL;
+    }
+
+    /* check every type first, so nothing changes on error */
+    for (loop = 0; loop < len; loop++) {
+        type = _pg_eventtype_from_seq(seq, loop);
+        if (type == -1) {
+            Py_DECREF(seq);
+            return NULL;
+        }
+        if (!_pg_coalesce_find(type)) {
+            Py_DECREF(seq);
+            return PyErr_Format(PyExc_ValueError,
+                                "%s events can not be coalesced",
+                                _pg_name_from_eventtype(type));
+        }
+    }
+
+    PG_LOCK_EVFILTER_MUTEX
+    for (loop = 0; loop < len; loop++) {
+        coalesce = _pg_coalesce_find(_pg_eventtype_from_seq(seq, loop));
+        coalesce->policy = policy_id;
+        coalesce->limit = limit;
+        coalesce->passed = 0;
+    }
+    _pg_coalesce_active = 0;
+    for (loop = 0; loop < PG_NUM_COALESCE_POLICIES; loop++) {
+        if (_pg_coalesce_policies[loop].policy != PG_COALESCE_NONE) {
+            _pg_coalesce_active++;
+        }
+    }
+    PG_UNLOCK_EVFILTER_MUTEX
+
+    Py_DECREF(seq);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+pg_event_get_coalesce_stats(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    Uint64 merged, dropped;
+    int reset = 0;
+
+    static char *kwids[] = {"reset", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", kwids, &reset)) {
+        return NULL;
+    }
+
+    PG_LOCK_EVFILTER_MUTEX
+    merged = _pg_coalesce_merged;
+    dropped = _pg_coalesce_dropped;
+    if (reset) {
+        _pg_coalesce_merged = _pg_coalesce_dropped = 0;
+    }
+    PG_UNLOCK_EVFILTER_MUTEX
+
+    return Py_BuildValue("KK", (unsigned long long)merged,
+                         (unsigned long long)dropped);
+}
+
 static PyMethodDef _event_methods[] = {
     {"_internal_mod_init", (PyCFunction)pgEvent_AutoInit, METH_NOARGS,
      "auto initialize for event module"},
@@ -2524,6 +3468,8 @@ static PyMethodDef _event_methods[] = {
      DOC_EVENT_CLEAR},
     {"get", (PyCFunction)pg_event_get, METH_VARARGS | METH_KEYWORDS,
      DOC_EVENT_GET},
+    {"get_buffer", (PyCFunction)pg_event_get_buffer,
+     METH_VARARGS | METH_KEYWORDS, DOC_EVENT_GETBUFFER},
     {"peek", (PyCFunction)pg_event_peek, METH_VARARGS | METH_KEYWORDS,
      DOC_EVENT_PEEK},
     {"post", (PyCFunction)pg_event_post, METH_O, DOC_EVENT_POST},
@@ -2536,6 +3482,10 @@ static PyMethodDef _event_methods[] = {
      DOC_EVENT_GETBLOCKED},
     {"custom_type", (PyCFunction)pg_event_custom_type, METH_NOARGS,
      DOC_EVENT_CUSTOMTYPE},
+    {"set_coalesce", (PyCFunction)pg_event_set_coalesce,
+     METH_VARARGS | METH_KEYWORDS, DOC_EVENT_SETCOALESCE},
+    {"get_coalesce_stats", (PyCFunction)pg_event_get_coalesce_stats,
+     METH_VARARGS | METH_KEYWORDS, DOC_EVENT_GETCOALESCESTATS},
 
     {NULL, NULL, 0, NULL}};
 
@@ -2571,6 +3521,9 @@ MODINIT_DEFINE(event)
     if (PyType_Ready(&pgEvent_Type) < 0) {
         return NULL;
     }
+    if (PyType_Ready(&pgEventBuffer_Type) < 0) {
+        return NULL;
+    }
 
     /* create the module */
     module = PyModule_Create(&_module);
@@ -2587,9 +3540,14 @@ MODINIT_DEFINE(event)
         Py_DECREF(module);
         return NULL;
     }
+    if (PyModule_AddObjectRef(module, "EventBuffer",
+                              (PyObject *)&pgEventBuffer_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
 
     /* export the c api */
-    assert(PYGAMEAPI_EVENT_NUMSLOTS == 10);
+    assert(PYGAMEAPI_EVENT_NUMSLOTS == 11);
     c_api[0] = &pgEvent_Type;
     c_api[1] = pgEvent_New;
     c_api[2] = pg_post_event;
@@ -2600,6 +3558,7 @@ MODINIT_DEFINE(event)
     c_api[7] = pgEvent_GetKeyUpInfo;
     c_api[8] = pgEvent_GetMouseButtonDownInfo;
     c_api[9] = pgEvent_GetMouseButtonUpInfo;
+    c_api[10] = pgEvent_GetDict;
 
     apiobj = encapsulate_api(c_api, "event");
     if (PyModule_AddObject(module, PYGAMEAPI_LOCAL_ENTRY, apiobj)) {
@@ -79,7 +79,7 @@ fill_context(TextContext *, const FreeTypeInstance *, const pgFontObject *,
 static int
 size_text(Layout *, FreeTypeInstance *, TextContext *, const PGFT_String *);
 static int
-load_glyphs(Layout *, TextContext *, FontCache *);
+load_glyphs(Layout *, FreeTypeInstance *, TextContext *, FontCache *);
 static void
 position_glyphs(Layout *);
 static void
@@ -139,7 +139,7 @@ _PGFT_LoadLayout(FreeTypeInstance *ft, pgFontObject *fontobj,
         copy_mode(&ftext->mode, mode);
         font = _PGFT_GetFontSized(ft, fontobj, mode->face_size);
         if (!font) {
-            PyErr_SetString(pgExc_SDLError, _PGFT_GetError(ft));
+            _PGFT_RaiseError(ft, pgExc_SDLError, _PGFT_GetError(ft));
             return 0;
         }
     }
@@ -153,7 +153,7 @@ _PGFT_LoadLayout(FreeTypeInstance *ft, pgFontObject *fontobj,
                     return 0;
                 }
             }
-            if (load_glyphs(ftext, &context, cache)) {
+            if (load_glyphs(ftext, ft, &context, cache)) {
                 return 0;
             }
             /* fall through */
@@ -196,7 +196,7 @@ size_text(Layout *ftext, FreeTypeInstance *ft, TextContext *context,
         ftext->glyphs = (GlyphSlot *)_PGFT_malloc((size_t)string_length *
                                                   sizeof(GlyphSlot));
         if (!ftext->glyphs) {
-            PyErr_NoMemory();
+            _PGFT_RaiseError(ft, PyExc_MemoryError, "");
             return -1;
         }
         ftext->buffer_size = (int)string_length;
@@ -213,7 +213,7 @@ size_text(Layout *ftext, FreeTypeInstance *ft, TextContext *context,
                                    &slots[length].kerning);
             if (error) {
                 _PGFT_SetError(ft, "Loading glyphs", error);
-                PyErr_SetString(pgExc_SDLError, _PGFT_GetError(ft));
+                _PGFT_RaiseError(ft, pgExc_SDLError, _PGFT_GetError(ft));
                 return -1;
             }
         }
@@ -239,7 +239,8 @@ size_text(Layout *ftext, FreeTypeInstance *ft, TextContext *context,
 }
 
 static int
-load_glyphs(Layout *ftext, TextContext *context, FontCache *cache)
+load_glyphs(Layout *ftext, FreeTypeInstance *ft, TextContext *context,
+            FontCache *cache)
 {
     GlyphSlot *slot = ftext->glyphs;
     Py_ssize_t length = ftext->length;
@@ -250,8 +251,11 @@ load_glyphs(Layout *ftext, TextContext *context, FontCache *cache)
     for (i = 0; i < length; ++i) {
         glyph = _PGFT_Cache_FindGlyph(slot[i].id, mode, cache, context);
         if (!glyph) {
-            PyErr_Format(pgExc_SDLError, "Unable to load glyph for id %lu",
-                         (unsigned long)slot[i].id);
+            char msg[64];
+
+            PyOS_snprintf(msg, sizeof(msg), "Unable to load glyph for id %lu",
+                          (unsigned long)slot[i].id);
+            _PGFT_RaiseError(ft, pgExc_SDLError, msg);
             return -1;
         }
         slot[i].glyph = glyph;
@@ -440,13 +440,13 @@ _PGFT_Render_NewSurface(FreeTypeInstance *ft, pgFontObject *fontobj,
     }
     surface = PG_CreateSurface(width, height, pixelformat);
     if (!surface) {
-        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        _PGFT_RaiseError(ft, pgExc_SDLError, SDL_GetError());
         return 0;
     }
 
     if (SDL_MUSTLOCK(surface)) {
         if (!PG_LockSurface(surface)) {
-            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            _PGFT_RaiseError(ft, pgExc_SDLError, SDL_GetError());
             SDL_FreeSurface(surface);
             return 0;
         }
@@ -483,7 +483,7 @@ _PGFT_Render_NewSurface(FreeTypeInstance *ft, pgFontObject *fontobj,
 
         if (!palette) {
             SDL_FreeSurface(surface);
-            PyErr_NoMemory();
+            _PGFT_RaiseError(ft, PyExc_MemoryError, "");
             return 0;
         }
         colors[1].r = fgcolor->r; /* Foreground */
@@ -495,9 +495,12 @@ _PGFT_Render_NewSurface(FreeTypeInstance *ft, pgFontObject *fontobj,
         colors[0].b = ~colors[1].b;
         colors[0].a = SDL_ALPHA_OPAQUE;
         if (!PG_SetPaletteColors(palette, colors, 0, 2)) {
-            PyErr_Format(PyExc_SystemError,
-                         "Pygame bug in _PGFT_Render_NewSurface: %.200s",
-                         SDL_GetError());
+            char msg[256];
+
+            PyOS_snprintf(msg, sizeof(msg),
+                          "Pygame bug in _PGFT_Render_NewSurface: %.200s",
+                          SDL_GetError());
+            _PGFT_RaiseError(ft, PyExc_SystemError, msg);
             SDL_FreeSurface(surface);
             return 0;
         }
@@ -88,6 +88,29 @@ _PGFT_GetError(FreeTypeInstance *ft)
     return ft->_error_msg;
 }
 
+/* Set a Python exception of the given type. For an instance used without
+ * the GIL (see render_many), the error is only recorded instead, and it is
+ * up to the owner of the instance to raise it afterwards.
+ */
+void
+_PGFT_RaiseError(FreeTypeInstance *ft, PyObject *type, const char *error_msg)
+{
+    if (!ft->nogil) {
+        if (type == PyExc_MemoryError) {
+            PyErr_NoMemory();
+        }
+        else {
+            PyErr_SetString(type, error_msg);
+        }
+        return;
+    }
+
+    ft->_error_type = type;
+    if (error_msg != ft->_error_msg) {
+        _PGFT_SetError(ft, error_msg, 0);
+    }
+}
+
 /*********************************************************
  *
  * Misc getters
@@ -190,7 +213,7 @@ _PGFT_Font_GetHeightSized(FreeTypeInstance *ft, pgFontObject *fontobj,
     FT_Face font = _PGFT_GetFontSized(ft, fontobj, face_size);
 
     if (!font) {
-        PyErr_SetString(pgExc_SDLError, _PGFT_GetError(ft));
+        _PGFT_RaiseError(ft, pgExc_SDLError, _PGFT_GetError(ft));
         return 0;
     }
     return (long)FX6_TRUNC(FX6_CEIL(font->size->metrics.height));
@@ -381,8 +404,14 @@ _PGFT_font_request(FTC_FaceID font_id, FT_Library library,
                    FT_Pointer request_data, FT_Face *afont)
 {
     pgFontId *id = (pgFontId *)font_id;
+    FreeTypeInstance *ft = (FreeTypeInstance *)request_data;
     FT_Error error;
 
+    if (ft->nogil) {
+        /* render_many worker, the GIL is not held */
+        return FT_Open_Face(library, &id->open_args, id->font_index, afont);
+    }
+
     Py_BEGIN_ALLOW_THREADS;
     error = FT_Open_Face(library, &id->open_args, id->font_index, afont);
     Py_END_ALLOW_THREADS;
@@ -544,6 +573,43 @@ _PGFT_UnloadFont(FreeTypeInstance *ft, pgFontObject *fontobj)
     fontobj->id.open_args.flags = 0;
 }
 
+/* Initialize clone as a private copy of fontobj bound to the instance ft,
+ * with its own face, layout and glyph cache, so that it can be rendered
+ * concurrently with the original. Only fonts loaded from a file can be
+ * cloned, as a shared stream cannot be read from several threads.
+ */
+int
+_PGFT_Font_InitClone(FreeTypeInstance *ft, pgFontObject *clone,
+                     pgFontObject *fontobj)
+{
+    if (fontobj->id.open_args.flags != FT_OPEN_PATHNAME) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "only fonts loaded from a file can be cloned");
+        return -1;
+    }
+
+    *clone = *fontobj;
+    clone->freetype = ft;
+    clone->_internals = 0;
+
+    return ft_wrap_init(ft, clone);
+}
+
+/* Release a clone made by _PGFT_Font_InitClone. The file name is owned by
+ * the original font object, so it is left alone.
+ */
+void
+_PGFT_Font_FreeClone(FreeTypeInstance *ft, pgFontObject *clone)
+{
+    if (clone->id.open_args.flags == 0) {
+        return;
+    }
+
+    FTC_Manager_RemoveFaceID(ft->cache_manager, (FTC_FaceID)(&clone->id));
+    ft_wrap_quit(clone);
+    clone->id.open_args.flags = 0;
+}
+
 /*********************************************************
  *
  * Library (de)initialization
@@ -566,6 +632,8 @@ _PGFT_Init(FreeTypeInstance **_instance, int cache_size)
     inst->cache_manager = 0;
     inst->library = 0;
     inst->cache_size = cache_size;
+    inst->nogil = 0;
+    inst->_error_type = 0;
 
     error = FT_Init_FreeType(&inst->library);
     if (error) {
@@ -575,7 +643,7 @@ _PGFT_Init(FreeTypeInstance **_instance, int cache_size)
         goto error_cleanup;
     }
 
-    if (FTC_Manager_New(inst->library, 0, 0, 0, &_PGFT_font_request, 0,
+    if (FTC_Manager_New(inst->library, 0, 0, 0, &_PGFT_font_request, inst,
                         &inst->cache_manager) != 0) {
         PyErr_SetString(
             PyExc_RuntimeError,
@@ -92,6 +92,12 @@ typedef struct freetypeinstance_ {
 
     int cache_size;
     char _error_msg[1024];
+
+    /* Set on the private instances used by render_many worker threads,
+     * which run without the GIL. Errors are then only recorded in
+     * _error_type and _error_msg, to be raised later by the caller. */
+    int nogil;
+    PyObject *_error_type;
 } FreeTypeInstance;
 
 typedef struct fontcolor_ {
@@ -257,6 +263,8 @@ extern _FreeTypeState _modstate;
 const char *
 _PGFT_GetError(FreeTypeInstance *);
 void
+_PGFT_RaiseError(FreeTypeInstance *, PyObject *, const char *);
+void
 _PGFT_Quit(FreeTypeInstance *);
 int
 _PGFT_Init(FreeTypeInstance **, int);
@@ -294,6 +302,10 @@ SDL_RWops *
 _PGFT_GetRWops(pgFontObject *fontobj);
 void
 _PGFT_UnloadFont(FreeTypeInstance *, pgFontObject *);
+int
+_PGFT_Font_InitClone(FreeTypeInstance *, pgFontObject *, pgFontObject *);
+void
+_PGFT_Font_FreeClone(FreeTypeInstance *, pgFontObject *);
 
 /**************************************** Metrics management *****************/
 int
@@ -431,8 +443,10 @@ FT_Face
 _PGFT_GetFontSized(FreeTypeInstance *, pgFontObject *, Scale_t);
 void
 _PGFT_BuildScaler(pgFontObject *, FTC_Scaler, Scale_t);
-#define _PGFT_malloc PyMem_Malloc
-#define _PGFT_calloc PyMem_Calloc
-#define _PGFT_free PyMem_Free
+/* The raw allocators are used so that layouts and glyph caches can also be
+ * (re)allocated by render_many worker threads, which do not hold the GIL */
+#define _PGFT_malloc PyMem_RawMalloc
+#define _PGFT_calloc PyMem_RawCalloc
+#define _PGFT_free PyMem_RawFree
 
 #endif
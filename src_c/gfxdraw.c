@@ -168,6 +168,7 @@ _gfx_pixelcolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -196,6 +197,7 @@ _gfx_hlinecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -224,6 +226,7 @@ _gfx_vlinecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -253,6 +256,7 @@ _gfx_rectanglecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     sdlrect = pgRect_FromObject(rect, &temprect);
     if (sdlrect == NULL) {
         return RAISE(PyExc_TypeError, "invalid rect style argument");
@@ -292,6 +296,7 @@ _gfx_boxcolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     sdlrect = pgRect_FromObject(rect, &temprect);
     if (sdlrect == NULL) {
         return RAISE(PyExc_TypeError, "invalid rect style argument");
@@ -329,6 +334,7 @@ _gfx_linecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -357,6 +363,7 @@ _gfx_circlecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -385,6 +392,7 @@ _gfx_arccolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -413,6 +421,7 @@ _gfx_aacirclecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -441,6 +450,7 @@ _gfx_filledcirclecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -469,6 +479,7 @@ _gfx_ellipsecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -497,6 +508,7 @@ _gfx_aaellipsecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -525,6 +537,7 @@ _gfx_filledellipsecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -553,6 +566,7 @@ _gfx_piecolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -581,6 +595,7 @@ _gfx_trigoncolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -609,6 +624,7 @@ _gfx_aatrigoncolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -637,6 +653,7 @@ _gfx_filledtrigoncolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -666,6 +683,7 @@ _gfx_polygoncolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -742,6 +760,7 @@ _gfx_aapolygoncolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -819,6 +838,7 @@ _gfx_filledpolygoncolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -896,6 +916,7 @@ _gfx_texturedpolygon(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     s_surface = pgSurface_AsSurface(surface);
     if (!pgSurface_Check(texture)) {
         return RAISE(PyExc_TypeError, "texture must be a Surface");
@@ -980,6 +1001,7 @@ _gfx_beziercolor(PyObject *self, PyObject *args)
     if (!pgSurface_Check(surface)) {
         return RAISE(PyExc_TypeError, "surface must be a Surface");
     }
+    pgSurface_Touch((pgSurfaceObject *)surface);
     if (!pg_RGBAFromObjEx(color, rgba, PG_COLOR_HANDLE_SIMPLE)) {
         return NULL;
     }
@@ -30,11 +30,7 @@
 
 #include "doc/image_doc.h"
 
-#if PG_COMPILE_SSE4_2
-#include <emmintrin.h>
-/* SSSE 3 */
-#include <tmmintrin.h>
-#endif
+#include "simd_image.h"
 
 static int
 SaveTGA(SDL_Surface *surface, const char *file, int rle);
@@ -51,14 +47,9 @@ static PyObject *extverobj = NULL;
 static PyObject *ext_load_sized_svg = NULL;
 static PyObject *ext_load_animation = NULL;
 
-static inline void
-pad(char **data, int padding)
-{
-    if (padding) {
-        memset(*data, 0, padding);
-        *data += padding;
-    }
-}
+/* SIMD instruction sets the tobytes/frombytes kernels can use at runtime */
+static int image_has_avx2 = 0;
+static int image_has_sse2 = 0;
 
 static const char *
 find_extension(const char *fullname)
@@ -113,23 +104,415 @@ image_load_extended(PyObject *self, PyObject *arg, PyObject *kwarg)
     }
 }
 
+/* Decodes an image from rw, closing it, without touching any Python
+ * state. Provided by imageext when extended formats are available. */
+static SDL_Surface *(*ext_decode_rw)(SDL_RWops *rw, const char *type) = NULL;
+/* Encodes surf as PNG or JPEG to rw, leaving it open, without touching any
+ * Python state. Provided by imageext when extended formats are available. */
+static int (*ext_encode_rw)(SDL_Surface *surf, SDL_RWops *rw,
+                            const char *type) = NULL;
+
+/* Executor backing load_async, created on first use */
+static PyObject *load_executor = NULL;
+
+static SDL_Surface *
+image_decode_bmp_rw(SDL_RWops *rw, const char *type)
+{
+    return SDL_LoadBMP_RW(rw, 1);
+}
+
+/* Decode an image from rw, closing it, then convert it to the pixel format
+ * of target (if not NULL) and premultiply its colors by alpha (if
+ * requested and the image has alpha). Conversion replaces the decoded
+ * surface as soon as it is made, so at most two copies of the image ever
+ * exist. Runs without the GIL; returns NULL with the SDL error set on
+ * failure. */
+static SDL_Surface *
+image_decode(SDL_RWops *rw, const char *type, SDL_Surface *target,
+             int premultiply)
+{
+    SDL_Surface *surf, *converted;
+
+    if (ext_decode_rw) {
+        surf = ext_decode_rw(rw, type);
+    }
+    else {
+        surf = image_decode_bmp_rw(rw, type);
+    }
+    if (!surf) {
+        return NULL;
+    }
+
+    if (target) {
+        converted = PG_ConvertSurface(surf, target->format);
+        SDL_FreeSurface(surf);
+        if (!converted) {
+            return NULL;
+        }
+        surf = converted;
+    }
+
+    /* Opaque images are left as they are, premultiplying would not change
+     * them */
+    if (premultiply && surf->w && surf->h &&
+        pgSurface_PremulAlpha(surf, surf) == -2) {
+        SDL_FreeSurface(surf);
+        return NULL;
+    }
+    return surf;
+}
+
+/* Get the surface to convert loaded images to from a format argument */
+static int
+image_get_format_target(PyObject *formatobj, SDL_Surface **target)
+{
+    if (!formatobj || formatobj == Py_None) {
+        *target = NULL;
+        return 1;
+    }
+    if (!pgSurface_Check(formatobj)) {
+        PyErr_Format(PyExc_TypeError,
+                     "format must be a Surface or None, not %.200s",
+                     Py_TYPE(formatobj)->tp_name);
+        return 0;
+    }
+    *target = pgSurface_AsSurface(formatobj);
+    if (!*target) {
+        PyErr_SetString(pgExc_SDLError, "display Surface quit");
+        return 0;
+    }
+    return 1;
+}
+
 static PyObject *
 image_load(PyObject *self, PyObject *arg, PyObject *kwarg)
 {
-    PyObject *obj;
-    const char *name = NULL;
-    static char *kwds[] = {"file", "namehint", NULL};
+    PyObject *obj, *final;
+    PyObject *formatobj = NULL;
+    const char *name = NULL, *type;
+    char *ext = NULL;
+    int premultiply = 0;
+    SDL_Surface *target, *surf;
+    SDL_RWops *rw;
+    static char *kwds[] = {"file", "namehint", "format", "premultiply",
+                           NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O|sOp", kwds, &obj, &name,
+                                     &formatobj, &premultiply)) {
+        return NULL;
+    }
+    if (!image_get_format_target(formatobj, &target)) {
+        return NULL;
+    }
 
-    if (extloadobj == NULL) {
-        if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O|s", kwds, &obj,
-                                         &name)) {
-            return NULL;
+    rw = pgRWops_FromObject(obj, &ext);
+    if (rw == NULL) { /* stop on NULL, error already set */
+        return NULL;
+    }
+
+    /* the namehint overrides the extension, BMP loading ignores both */
+    type = name ? find_extension(name) : ext;
+
+    Py_BEGIN_ALLOW_THREADS;
+    surf = image_decode(rw, type, target, premultiply);
+    Py_END_ALLOW_THREADS;
+
+    if (ext) {
+        free(ext);
+    }
+
+    if (surf == NULL) {
+        return RAISE(pgExc_SDLError, SDL_GetError());
+    }
+
+    final = (PyObject *)pgSurface_New(surf);
+    if (final == NULL) {
+        SDL_FreeSurface(surf);
+    }
+    return final;
+}
+
+/* Upper bound on the number of load_many worker threads */
+#define PG_IMAGE_LOAD_MANY_MAX_THREADS 64
+
+typedef struct {
+    SDL_RWops *rw; /* closed by the decoder */
+    char *ext;     /* file name extension, or NULL */
+    SDL_Surface *surf;
+} LoadManyItem;
+
+typedef struct {
+    LoadManyItem *items;
+    int count;
+    SDL_Surface *target; /* surface whose format to convert to, or NULL */
+    int premultiply;
+    SDL_atomic_t *next_index;
+    SDL_atomic_t *failed;
+
+    char error[256];
+} LoadManyTask;
+
+/* Decode (and convert) items, taken in turn from the shared index, until
+ * none are left or another worker failed. Runs without the GIL. */
+static int SDLCALL
+_load_many_worker(void *data)
+{
+    LoadManyTask *task = (LoadManyTask *)data;
+    LoadManyItem *item;
+    int i;
+
+    while (!SDL_AtomicGet(task->failed)) {
+        i = SDL_AtomicAdd(task->next_index, 1);
+        if (i >= task->count) {
+            break;
         }
-        return image_load_basic(self, obj);
+        item = &task->items[i];
+        item->surf = image_decode(item->rw, item->ext, task->target,
+                                  task->premultiply);
+        item->rw = NULL;
+        if (!item->surf) {
+            SDL_strlcpy(task->error, SDL_GetError(), sizeof(task->error));
+            SDL_AtomicSet(task->failed, 1);
+            break;
+        }
+    }
+    return 0;
+}
+
+static PyObject *
+image_load_many(PyObject *self, PyObject *arg, PyObject *kwarg)
+{
+    PyObject *filesobj, *seq, *ret = NULL;
+    PyObject *formatobj = NULL;
+    SDL_Surface *target;
+    LoadManyItem *items = NULL;
+    LoadManyTask *tasks = NULL;
+    SDL_Thread **threads = NULL;
+    SDL_atomic_t next_index;
+    SDL_atomic_t failed;
+    Py_ssize_t count, i;
+    int nthreads = 0;
+    int premultiply = 0;
+    int n;
+    static char *kwds[] = {"files", "threads", "format", "premultiply",
+                           NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O|iOp", kwds, &filesobj,
+                                     &nthreads, &formatobj, &premultiply)) {
+        return NULL;
+    }
+
+    if (nthreads < 0) {
+        return RAISE(PyExc_ValueError, "threads must not be negative");
+    }
+
+    if (!image_get_format_target(formatobj, &target)) {
+        return NULL;
+    }
+
+    seq = PySequence_Fast(filesobj, "files must be a sequence");
+    if (!seq) {
+        return NULL;
+    }
+    count = PySequence_Fast_GET_SIZE(seq);
+    if (count > INT_MAX) {
+        PyErr_SetString(PyExc_ValueError, "too many files");
+        goto cleanup;
+    }
+
+    items = PyMem_Calloc(count ? count : 1, sizeof(LoadManyItem));
+    if (!items) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    /* Every file gets its own RWops, opened while the GIL is held */
+    for (i = 0; i < count; ++i) {
+        items[i].rw = pgRWops_FromObject(PySequence_Fast_GET_ITEM(seq, i),
+                                         &items[i].ext);
+        if (!items[i].rw) {
+            goto cleanup;
+        }
+    }
+
+    if (!nthreads) {
+        nthreads = SDL_GetCPUCount();
+    }
+    if (nthreads > PG_IMAGE_LOAD_MANY_MAX_THREADS) {
+        nthreads = PG_IMAGE_LOAD_MANY_MAX_THREADS;
+    }
+    if (nthreads > count) {
+        nthreads = (int)count;
+    }
+    if (nthreads < 1) {
+        nthreads = 1;
+    }
+#if defined(__EMSCRIPTEN__) || defined(__wasi__)
+    /* no threads on WASM */
+    nthreads = 1;
+#endif
+
+    tasks = PyMem_Calloc(nthreads, sizeof(LoadManyTask));
+    threads = PyMem_Calloc(nthreads, sizeof(SDL_Thread *));
+    if (!tasks || !threads) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+    SDL_AtomicSet(&next_index, 0);
+    SDL_AtomicSet(&failed, 0);
+    for (n = 0; n < nthreads; ++n) {
+        tasks[n].items = items;
+        tasks[n].count = (int)count;
+        tasks[n].target = target;
+        tasks[n].premultiply = premultiply;
+        tasks[n].next_index = &next_index;
+        tasks[n].failed = &failed;
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    /* If a thread cannot be started, its share of the work is simply taken
+     * by the other workers */
+    for (n = 1; n < nthreads; ++n) {
+        threads[n] = SDL_CreateThread(_load_many_worker, "pg_image_load_many",
+                                      &tasks[n]);
+    }
+    _load_many_worker(&tasks[0]);
+    for (n = 1; n < nthreads; ++n) {
+        if (threads[n]) {
+            SDL_WaitThread(threads[n], NULL);
+        }
+    }
+    Py_END_ALLOW_THREADS;
+
+    for (n = 0; n < nthreads; ++n) {
+        if (tasks[n].error[0]) {
+            PyErr_SetString(pgExc_SDLError, tasks[n].error);
+            goto cleanup;
+        }
+    }
+
+    ret = PyList_New(count);
+    if (!ret) {
+        goto cleanup;
+    }
+    for (i = 0; i < count; ++i) {
+        PyObject *surfobj = (PyObject *)pgSurface_New(items[i].surf);
+        if (!surfobj) {
+            Py_CLEAR(ret);
+            goto cleanup;
+        }
+        /* The surface object owns the SDL surface now */
+        items[i].surf = NULL;
+        PyList_SET_ITEM(ret, i, surfobj);
+    }
+
+cleanup:
+    if (items) {
+        for (i = 0; i < count; ++i) {
+            if (items[i].rw) {
+                SDL_RWclose(items[i].rw);
+            }
+            if (items[i].ext) {
+                free(items[i].ext);
+            }
+            if (items[i].surf) {
+                SDL_FreeSurface(items[i].surf);
+            }
+        }
+    }
+    PyMem_Free(items);
+    PyMem_Free(tasks);
+    PyMem_Free(threads);
+    Py_DECREF(seq);
+    return ret;
+}
+
+static PyObject *
+image_load_async(PyObject *self, PyObject *arg, PyObject *kwarg)
+{
+    PyObject *futures, *loadobj, *ret = NULL;
+
+    loadobj = PyObject_GetAttrString(self, "load");
+    if (!loadobj) {
+        return NULL;
+    }
+
+#if defined(__EMSCRIPTEN__) || defined(__wasi__)
+    /* no threads on WASM, the image is loaded before returning */
+    PyObject *result, *done;
+
+    futures = PyImport_ImportModule("concurrent.futures");
+    if (!futures) {
+        Py_DECREF(loadobj);
+        return NULL;
+    }
+    ret = PyObject_CallMethod(futures, "Future", NULL);
+    Py_DECREF(futures);
+    if (!ret) {
+        Py_DECREF(loadobj);
+        return NULL;
+    }
+    result = PyObject_Call(loadobj, arg, kwarg);
+    Py_DECREF(loadobj);
+    if (result) {
+        done = PyObject_CallMethod(ret, "set_result", "O", result);
+        Py_DECREF(result);
     }
     else {
-        return image_load_extended(self, arg, kwarg);
+        PyObject *type, *value, *traceback;
+
+        PyErr_Fetch(&type, &value, &traceback);
+        PyErr_NormalizeException(&type, &value, &traceback);
+        done = PyObject_CallMethod(ret, "set_exception", "O", value);
+        Py_XDECREF(type);
+        Py_XDECREF(value);
+        Py_XDECREF(traceback);
+    }
+    if (!done) {
+        Py_CLEAR(ret);
+    }
+    Py_XDECREF(done);
+#else  /* ~(defined(__EMSCRIPTEN__) || defined(__wasi__)) */
+    PyObject *submit, *submitargs;
+    Py_ssize_t i, nargs = PyTuple_GET_SIZE(arg);
+
+    if (!load_executor) {
+        futures = PyImport_ImportModule("concurrent.futures");
+        if (!futures) {
+            Py_DECREF(loadobj);
+            return NULL;
+        }
+        load_executor =
+            PyObject_CallMethod(futures, "ThreadPoolExecutor", "is",
+                                SDL_GetCPUCount(), "pygame.image");
+        Py_DECREF(futures);
+        if (!load_executor) {
+            Py_DECREF(loadobj);
+            return NULL;
+        }
+    }
+
+    /* submit(load, *args, **kwargs) */
+    submitargs = PyTuple_New(nargs + 1);
+    if (!submitargs) {
+        Py_DECREF(loadobj);
+        return NULL;
+    }
+    PyTuple_SET_ITEM(submitargs, 0, loadobj);
+    for (i = 0; i < nargs; ++i) {
+        PyObject *item = PyTuple_GET_ITEM(arg, i);
+        Py_INCREF(item);
+        PyTuple_SET_ITEM(submitargs, i + 1, item);
+    }
+
+    submit = PyObject_GetAttrString(load_executor, "submit");
+    if (submit) {
+        ret = PyObject_Call(submit, submitargs, kwarg);
+        Py_DECREF(submit);
     }
+    Py_DECREF(submitargs);
+#endif /* ~(defined(__EMSCRIPTEN__) || defined(__wasi__)) */
+    return ret;
 }
 
 #ifdef WIN32
@@ -246,911 +629,1029 @@ image_save(PyObject *self, PyObject *arg, PyObject *kwarg)
     Py_RETURN_NONE;
 }
 
-static PyObject *
-image_get_extended(PyObject *self, PyObject *_null)
+/* Most saves save_async holds at once (queued or being written); also the
+ * most snapshot surfaces kept around for reuse */
+#define PG_IMAGE_SAVE_QUEUE_SIZE 8
+
+typedef struct SaveJob {
+    SDL_Surface *snapshot; /* private copy of the surface to save */
+    char *path;
+    PyObject *future;
+    struct SaveJob *next;
+} SaveJob;
+
+/* The save_async queue, worker and snapshot pool, all guarded by
+ * save_mutex. save_cond is signalled both when a job is queued and when
+ * one is finished. save_mutex is only ever taken with the GIL released,
+ * since a thread holding it may wait for the GIL to be handed back. */
+static SDL_mutex *save_mutex = NULL;
+static SDL_cond *save_cond = NULL;
+static SDL_Thread *save_thread = NULL;
+static SaveJob *save_head = NULL;
+static SaveJob *save_tail = NULL;
+static int save_pending = 0; /* jobs queued or being written */
+static int save_quit = 0;
+static SDL_Surface *save_pool[PG_IMAGE_SAVE_QUEUE_SIZE];
+static int save_pool_count = 0;
+
+/* Future type of concurrent.futures, used for save_async results */
+static PyObject *future_type = NULL;
+
+/* Encode surf by the extension of path and write it out as the encoder
+ * produces it. Runs without the GIL; returns -1 with the SDL error set on
+ * failure. */
+static int
+image_encode_file(SDL_Surface *surf, const char *path)
 {
-    if (extverobj == NULL) {
-        Py_RETURN_FALSE;
+    const char *ext = find_extension(path);
+    SDL_RWops *rw;
+    int result;
+
+    if (ext_encode_rw && (!strcasecmp(ext, "png") || !strcasecmp(ext, "jpg") ||
+                          !strcasecmp(ext, "jpeg"))) {
+        rw = SDL_RWFromFile(path, "wb");
+        if (!rw) {
+            return -1;
+        }
+        result = ext_encode_rw(surf, rw, ext);
+    }
+    else if (!strcasecmp(ext, "bmp")) {
+        rw = SDL_RWFromFile(path, "wb");
+        if (!rw) {
+            return -1;
+        }
+        result = SDL_SaveBMP_RW(surf, rw, 0) == 0 ? 0 : -1;
     }
     else {
-        Py_RETURN_TRUE;
+        /* the snapshot is private, so SaveTGA_RW may change its flags */
+        rw = SDL_RWFromFile(path, "wb");
+        if (!rw) {
+            return -1;
+        }
+        result = SaveTGA_RW(surf, rw, 1);
     }
+
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    if (!SDL_RWclose(rw)) {
+#else
+    if (SDL_RWclose(rw) != 0) {
+#endif
+        result = -1;
+    }
+    return result;
 }
 
-static PyObject *
-image_get_sdl_image_version(PyObject *self, PyObject *args, PyObject *kwargs)
+/* Put a snapshot back in the pool, or free it if the pool is full. Called
+ * with save_mutex held. */
+static void
+save_release_snapshot(SDL_Surface *snapshot)
 {
-    if (extverobj == NULL) {
-        Py_RETURN_NONE;
+    if (save_pool_count < PG_IMAGE_SAVE_QUEUE_SIZE) {
+        save_pool[save_pool_count++] = snapshot;
     }
     else {
-        return PyObject_Call(extverobj, args, kwargs);
+        SDL_FreeSurface(snapshot);
     }
 }
 
-#if PG_COMPILE_SSE4_2
-#define SSE42_ALIGN_NEEDED 16
-#define SSE42_ALIGN __attribute__((aligned(SSE42_ALIGN_NEEDED)))
+/* Copy surf to a pooled surface of the same size and format, along with
+ * everything the encoders read: palette, colorkey, surface alpha and blend
+ * mode. */
+static SDL_Surface *
+save_snapshot(pgSurfaceObject *surfobj)
+{
+    SDL_Surface *surf = pgSurface_AsSurface(surfobj);
+    SDL_Surface *snapshot = NULL;
+    SDL_Palette *palette, *snapshot_palette;
+    Uint32 colorkey;
+    Uint8 alpha;
+    SDL_BlendMode blendmode;
+    size_t row_bytes;
+    int i, y;
 
-#define _SHIFT_N_STEP2ALIGN(shift, step) (shift / 8 + step * 4)
+    Py_BEGIN_ALLOW_THREADS;
+    SDL_LockMutex(save_mutex);
+    for (i = 0; i < save_pool_count; ++i) {
+        SDL_Surface *pooled = save_pool[i];
+
+        if (pooled->w == surf->w && pooled->h == surf->h &&
+            PG_SURF_FORMATENUM(pooled) == PG_SURF_FORMATENUM(surf)) {
+            snapshot = pooled;
+            save_pool[i] = save_pool[--save_pool_count];
+            break;
+        }
+    }
+    SDL_UnlockMutex(save_mutex);
+    Py_END_ALLOW_THREADS;
 
-#if PYGAME_DEBUG_SSE
-/* Useful for debugging/comparing the SSE vectors */
-static void
-_debug_print128_num(__m128i var, const char *msg)
-{
-    uint32_t val[4];
-    memcpy(val, &var, sizeof(val));
-    fprintf(stderr, "%s: %04x%04x%04x%04x\n", msg, val[0], val[1], val[2],
-            val[3]);
-}
-#define DEBUG_PRINT128_NUM(var, msg) _debug_print128_num(var, msg)
-#else
-#define DEBUG_PRINT128_NUM(var, msg) \
-    do { /* do nothing */            \
-    } while (0)
-#endif
+    if (!snapshot) {
+        snapshot =
+            PG_CreateSurface(surf->w, surf->h, PG_SURF_FORMATENUM(surf));
+        if (!snapshot) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            return NULL;
+        }
+    }
 
-/*
- * Generates an SSE vector useful for reordering a SSE vector
- * based on the "in-memory layout" to match the "tobytes layout"
- * It is only useful as second parameter to _mm_shuffle_epi8.
- *
- * A short _mm_shuffle_epi8 primer:
- *
- * - If the highest bit of a byte in the reorder vector is set,
- *   the matching byte in the original vector is cleared:
- * - Otherwise, the 3 lowest bit of the byte in the reorder vector
- *   represent the byte index of where to find the relevant value
- *   from the original vector.
- *
- * As an example, given the following in memory layout (bytes):
- *
- *    R1 G1 B1 A1 R2 G2 B2 A2 ...
- *
- * And we want:
- *
- *    A1 R1 G1 B1 A2 R2 G2 B2
- *
- * Then the reorder vector should look like (in hex):
- *
- *    03 00 01 02 07 04 05 06
- *
- * This is exactly the type of vector that compute_align_vector
- * produces (based on the pixel format and where the alpha should
- * be placed in the output).
- */
-static PG_INLINE __m128i
-compute_align_vector(SDL_PixelFormat *format, int color_offset,
-                     int alpha_offset)
-{
-    int output_align[4];
-    size_t i;
-    size_t limit = sizeof(output_align) / sizeof(int);
-    int a_shift = alpha_offset * 8;
-    int r_shift = (color_offset + 0) * 8;
-    int g_shift = (color_offset + 1) * 8;
-    int b_shift = (color_offset + 2) * 8;
-    for (i = 0; i < limit; i++) {
-        int p = 3 - i;
-        output_align[i] = _SHIFT_N_STEP2ALIGN(format->Rshift, p) << r_shift |
-                          _SHIFT_N_STEP2ALIGN(format->Gshift, p) << g_shift |
-                          _SHIFT_N_STEP2ALIGN(format->Bshift, p) << b_shift |
-                          _SHIFT_N_STEP2ALIGN(format->Ashift, p) << a_shift;
-    }
-    return _mm_set_epi32(output_align[0], output_align[1], output_align[2],
-                         output_align[3]);
+    palette = PG_GetSurfacePalette(surf);
+    snapshot_palette = PG_GetSurfacePalette(snapshot);
+    if (palette && snapshot_palette &&
+        !PG_SetPaletteColors(snapshot_palette, palette->colors, 0,
+                             palette->ncolors)) {
+        goto error;
+    }
+    if (SDL_HasColorKey(surf)) {
+        SDL_GetColorKey(surf, &colorkey);
+        if (!PG_SetSurfaceColorKey(snapshot, SDL_TRUE, colorkey)) {
+            goto error;
+        }
+    }
+    else if (!PG_SetSurfaceColorKey(snapshot, SDL_FALSE, 0)) {
+        goto error;
+    }
+    if (!PG_GetSurfaceAlphaMod(surf, &alpha) ||
+        !PG_SetSurfaceAlphaMod(snapshot, alpha)) {
+        goto error;
+    }
+    if (!PG_GetSurfaceBlendMode(surf, &blendmode) ||
+        !PG_SetSurfaceBlendMode(snapshot, blendmode)) {
+        goto error;
+    }
+
+    row_bytes = (size_t)surf->w * PG_SURF_BytesPerPixel(surf);
+    if (!pgSurface_Lock(surfobj)) {
+        SDL_FreeSurface(snapshot);
+        return NULL;
+    }
+    Py_BEGIN_ALLOW_THREADS;
+    for (y = 0; y < surf->h; ++y) {
+        memcpy((Uint8 *)snapshot->pixels + (size_t)y * snapshot->pitch,
+               (Uint8 *)surf->pixels + (size_t)y * surf->pitch, row_bytes);
+    }
+    Py_END_ALLOW_THREADS;
+    pgSurface_Unlock(surfobj);
+    return snapshot;
+
+error:
+    PyErr_SetString(pgExc_SDLError, SDL_GetError());
+    SDL_FreeSurface(snapshot);
+    return NULL;
 }
 
-static PG_INLINE PG_FUNCTION_TARGET_SSE4_2 void
-tobytes_pixels_32bit_sse4(const __m128i *row, __m128i *data, int loop_max,
-                          __m128i mask_vector, __m128i align_vector)
+/* Resolve job's future with None, or with a pygame.error carrying error
+ * if that is not NULL. Called with the GIL held. */
+static void
+save_finish_job(SaveJob *job, const char *error)
 {
-    int w;
-    for (w = 0; w < loop_max; ++w) {
-        __m128i pvector = _mm_loadu_si128(row + w);
-        DEBUG_PRINT128_NUM(pvector, "Load");
-        pvector = _mm_and_si128(pvector, mask_vector);
-        DEBUG_PRINT128_NUM(pvector, "after _mm_and_si128 (and)");
-        pvector = _mm_shuffle_epi8(pvector, align_vector);
-        DEBUG_PRINT128_NUM(pvector, "after _mm_shuffle_epi8 (reorder)");
-        _mm_storeu_si128(data + w, pvector);
+    PyObject *done;
+
+    if (error) {
+        PyObject *exc = PyObject_CallFunction(pgExc_SDLError, "s", error);
+
+        done = exc ? PyObject_CallMethod(job->future, "set_exception", "O",
+                                         exc)
+                   : NULL;
+        Py_XDECREF(exc);
     }
+    else {
+        done = PyObject_CallMethod(job->future, "set_result", "O", Py_None);
+    }
+    if (!done) {
+        /* nobody to report this to */
+        PyErr_WriteUnraisable(job->future);
+    }
+    Py_XDECREF(done);
+    Py_DECREF(job->future);
+    PyMem_RawFree(job->path);
+    PyMem_RawFree(job);
 }
 
-/*
- * SSE4.2 variant of tobytes_surf_32bpp.
- *
- * It is a lot faster but only works on a subset of the surfaces
- * (plus requires SSE4.2 support from the CPU).
- */
-static PG_FUNCTION_TARGET_SSE4_2 void
-tobytes_surf_32bpp_sse42(SDL_Surface *surf, int flipped, char *data,
-                         int color_offset, int alpha_offset)
+/* Write out queued jobs in order, until told to quit and the queue is
+ * empty. */
+static int SDLCALL
+_save_worker(void *data)
 {
-    const int step_size = 4;
-    int h;
-    SDL_PixelFormat *format = surf->format;
-    int loop_max = surf->w / step_size;
-    int mask = (format->Rloss ? 0 : format->Rmask) |
-               (format->Gloss ? 0 : format->Gmask) |
-               (format->Bloss ? 0 : format->Bmask) |
-               (format->Aloss ? 0 : format->Amask);
-
-    __m128i mask_vector = _mm_set_epi32(mask, mask, mask, mask);
-    __m128i align_vector =
-        compute_align_vector(surf->format, color_offset, alpha_offset);
-    /* How much we would overshoot if we overstep loop_max */
-    int rollback_count = surf->w % step_size;
-    if (rollback_count) {
-        rollback_count = step_size - rollback_count;
-    }
-
-    DEBUG_PRINT128_NUM(mask_vector, "mask-vector");
-    DEBUG_PRINT128_NUM(align_vector, "align-vector");
-
-    /* This code will be horribly wrong if these assumptions do not hold.
-     * They are intended as a debug/testing guard to ensure that nothing
-     * calls this function without ensuring the assumptions during
-     * development
-     */
-    assert(sizeof(int) == sizeof(Uint32));
-    assert(4 * sizeof(Uint32) == sizeof(__m128i));
-    /* If this assertion does not hold, the fallback code will overrun
-     * the buffers.
-     */
-    assert(surf->w >= step_size);
-    assert(format->Rloss % 8 == 0);
-    assert(format->Gloss % 8 == 0);
-    assert(format->Bloss % 8 == 0);
-    assert(format->Aloss % 8 == 0);
-
-    for (h = 0; h < surf->h; ++h) {
-        const char *row =
-            (char *)DATAROW(surf->pixels, h, surf->pitch, surf->h, flipped);
-        tobytes_pixels_32bit_sse4((const __m128i *)row, (__m128i *)data,
-                                  loop_max, mask_vector, align_vector);
-        row += sizeof(__m128i) * loop_max;
-        data += sizeof(__m128i) * loop_max;
-        if (rollback_count) {
-            /* Back up a bit to ensure we stay within the memory boundaries
-             * Technically, we end up redoing part of the computations, but
-             * it does not really matter as the runtime of these operations
-             * are fixed and the results are deterministic.
-             */
-            row -= rollback_count * sizeof(Uint32);
-            data -= rollback_count * sizeof(Uint32);
-
-            tobytes_pixels_32bit_sse4((const __m128i *)row, (__m128i *)data, 1,
-                                      mask_vector, align_vector);
-
-            row += sizeof(__m128i);
-            data += sizeof(__m128i);
+    SaveJob *job;
+    PyGILState_STATE gstate;
+    char error[256];
+
+    SDL_LockMutex(save_mutex);
+    for (;;) {
+        while (!save_head && !save_quit) {
+            SDL_CondWait(save_cond, save_mutex);
+        }
+        job = save_head;
+        if (!job) {
+            break;
+        }
+        save_head = job->next;
+        if (!save_head) {
+            save_tail = NULL;
+        }
+        SDL_UnlockMutex(save_mutex);
+
+        error[0] = '\0';
+        if (image_encode_file(job->snapshot, job->path) < 0) {
+            SDL_strlcpy(error, SDL_GetError(), sizeof(error));
         }
+
+        SDL_LockMutex(save_mutex);
+        save_release_snapshot(job->snapshot);
+        SDL_UnlockMutex(save_mutex);
+
+        gstate = PyGILState_Ensure();
+        save_finish_job(job, error[0] ? error : NULL);
+        PyGILState_Release(gstate);
+
+        SDL_LockMutex(save_mutex);
+        --save_pending;
+        SDL_CondBroadcast(save_cond);
     }
+    SDL_UnlockMutex(save_mutex);
+    return 0;
 }
-#endif /* PG_COMPILE_SSE4_2 */
 
-static void
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-tobytes_surf_32bpp(SDL_Surface *surf,
-                   const SDL_PixelFormatDetails *format_details, int flipped,
-                   int hascolorkey, Uint32 colorkey, char *serialized_image,
-                   int color_offset, int alpha_offset, int padding)
-#else
-tobytes_surf_32bpp(SDL_Surface *surf, SDL_PixelFormat *format_details,
-                   int flipped, int hascolorkey, Uint32 colorkey,
-                   char *serialized_image, int color_offset, int alpha_offset,
-                   int padding)
-#endif
+/* Registered with atexit: let the worker write out what is still queued,
+ * then stop it, so no save is lost or left half written */
+static PyObject *
+image_save_async_shutdown(PyObject *self, PyObject *_null)
 {
-    int w, h;
+    int i;
 
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-    Uint32 Rloss = format_details->Rbits;
-    Uint32 Gloss = format_details->Gbits;
-    Uint32 Bloss = format_details->Bbits;
-    Uint32 Aloss = format_details->Abits;
-#else
-    Uint32 Rloss = format_details->Rloss;
-    Uint32 Gloss = format_details->Gloss;
-    Uint32 Bloss = format_details->Bloss;
-    Uint32 Aloss = format_details->Aloss;
-#endif
-    Uint32 Rmask = format_details->Rmask;
-    Uint32 Gmask = format_details->Gmask;
-    Uint32 Bmask = format_details->Bmask;
-    Uint32 Amask = format_details->Amask;
-    Uint32 Rshift = format_details->Rshift;
-    Uint32 Gshift = format_details->Gshift;
-    Uint32 Bshift = format_details->Bshift;
-    Uint32 Ashift = format_details->Ashift;
-
-#if PG_COMPILE_SSE4_2
-    if (/* SDL uses Uint32, SSE uses int for building vectors.
-         * Related, we assume that Uint32 is packed so 4 of
-         * them perfectly matches an __m128i.
-         * If these assumptions do not match up, we will
-         * produce incorrect results.
-         */
-        sizeof(int) == sizeof(Uint32) &&
-        4 * sizeof(Uint32) == sizeof(__m128i) &&
-        !hascolorkey /* No color key */
-        && !padding &&
-        SDL_HasSSE42() == SDL_TRUE
-        /* The SSE code assumes it will always read at least 4 pixels */
-        && surf->w >= 4
-        /* Our SSE code assumes masks are at most 0xff */
-        && (Rmask >> Rshift) <= 0x0ff && (Gmask >> Gshift) <= 0x0ff &&
-        (Bmask >> Bshift) <= 0x0ff &&
-        (Amask >> Ashift) <= 0x0ff
-        /* Our SSE code cannot handle losses other than 0 or 8
-         * Note the mask check above ensures that losses can be
-         * at most be 8 (assuming the pixel format makes sense
-         * at all).
-         */
-        && (Rloss % 8) == 0 && (Bloss % 8) == 0 && (Gloss % 8) == 0 &&
-        (Aloss % 8) == 0) {
-        tobytes_surf_32bpp_sse42(surf, flipped, serialized_image, color_offset,
-                                 alpha_offset);
-        return;
-    }
-#endif /* PG_COMPILE_SSE4_2 */
-
-    for (h = 0; h < surf->h; ++h) {
-        Uint32 *pixel_row =
-            (Uint32 *)DATAROW(surf->pixels, h, surf->pitch, surf->h, flipped);
-        for (w = 0; w < surf->w; ++w) {
-            Uint32 color = *pixel_row++;
-            serialized_image[color_offset + 0] =
-                (char)(((color & Rmask) >> Rshift) << Rloss);
-            serialized_image[color_offset + 1] =
-                (char)(((color & Gmask) >> Gshift) << Gloss);
-            serialized_image[color_offset + 2] =
-                (char)(((color & Bmask) >> Bshift) << Bloss);
-            serialized_image[alpha_offset] =
-                hascolorkey
-                    ? (char)(color != colorkey) * 255
-                    : (char)(Amask ? (((color & Amask) >> Ashift) << Aloss)
-                                   : 255);
-            serialized_image += 4;
-        }
-        pad(&serialized_image, padding);
+    if (!save_thread) {
+        Py_RETURN_NONE;
+    }
+    Py_BEGIN_ALLOW_THREADS;
+    SDL_LockMutex(save_mutex);
+    save_quit = 1;
+    SDL_CondBroadcast(save_cond);
+    SDL_UnlockMutex(save_mutex);
+    SDL_WaitThread(save_thread, NULL);
+    Py_END_ALLOW_THREADS;
+    save_thread = NULL;
+    save_quit = 0;
+
+    for (i = 0; i < save_pool_count; ++i) {
+        SDL_FreeSurface(save_pool[i]);
     }
+    save_pool_count = 0;
+    Py_RETURN_NONE;
 }
 
-#define PREMUL_PIXEL_ALPHA(pixel, alpha) (char)((((pixel) + 1) * (alpha)) >> 8)
+static PyMethodDef _save_async_shutdown_def = {
+    "_save_async_shutdown", image_save_async_shutdown, METH_NOARGS, NULL};
 
-PyObject *
-image_tobytes(PyObject *self, PyObject *arg, PyObject *kwarg)
+/* Create the queue and start the worker, on first use */
+static int
+save_start(void)
 {
-    pgSurfaceObject *surfobj;
-    PyObject *bytes = NULL;
-    char *format, *data;
-    SDL_Surface *surf;
-    int w, h, flipped = 0, pitch = -1;
-    int byte_width, padding;
-    Py_ssize_t len;
-    Uint32 Rmask, Gmask, Bmask, Amask, Rshift, Gshift, Bshift, Ashift, Rloss,
-        Gloss, Bloss, Aloss;
-    int hascolorkey = 0;
-    Uint32 color, colorkey;
-    Uint32 alpha;
-    static char *kwds[] = {"surface", "format", "flipped", "pitch", NULL};
-
-#ifdef _MSC_VER
-    /* MSVC static analyzer false alarm: assure format is NULL-terminated by
-     * making analyzer assume it was initialised */
-    __analysis_assume(format = "inited");
-#endif
+    PyObject *module, *shutdown, *ret;
 
-    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O!s|ii", kwds,
-                                     &pgSurface_Type, &surfobj, &format,
-                                     &flipped, &pitch)) {
+    if (!future_type) {
+        module = PyImport_ImportModule("concurrent.futures");
+        if (!module) {
+            return 0;
+        }
+        future_type = PyObject_GetAttrString(module, "Future");
+        Py_DECREF(module);
+        if (!future_type) {
+            return 0;
+        }
+    }
+    if (!save_mutex) {
+        save_mutex = SDL_CreateMutex();
+        save_cond = SDL_CreateCond();
+        if (!save_mutex || !save_cond) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            return 0;
+        }
+
+        module = PyImport_ImportModule("atexit");
+        if (!module) {
+            return 0;
+        }
+        shutdown = PyCFunction_New(&_save_async_shutdown_def, NULL);
+        ret = shutdown ? PyObject_CallMethod(module, "register", "O", shutdown)
+                       : NULL;
+        Py_XDECREF(shutdown);
+        Py_DECREF(module);
+        if (!ret) {
+            return 0;
+        }
+        Py_DECREF(ret);
+    }
+#if !defined(__EMSCRIPTEN__) && !defined(__wasi__)
+    if (!save_thread) {
+        save_thread = SDL_CreateThread(_save_worker, "pg_image_save", NULL);
+        if (!save_thread) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            return 0;
+        }
+    }
+#endif
+    return 1;
+}
+
+static PyObject *
+image_save_async(PyObject *self, PyObject *arg, PyObject *kwarg)
+{
+    pgSurfaceObject *surfobj;
+    PyObject *obj, *oencoded;
+    SaveJob *job;
+    const char *ext;
+    int block = 1;
+    int full;
+    static char *kwds[] = {"surface", "file", "block", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O!O|p", kwds,
+                                     &pgSurface_Type, &surfobj, &obj,
+                                     &block)) {
         return NULL;
     }
-    surf = pgSurface_AsSurface(surfobj);
+    if (!pgSurface_AsSurface(surfobj)) {
+        return RAISE(pgExc_SDLError, "display Surface quit");
+    }
 
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-    const SDL_PixelFormatDetails *format_details =
-        SDL_GetPixelFormatDetails(surf->format);
-    if (!format_details) {
-        return RAISE(pgExc_SDLError, SDL_GetError());
+    oencoded = pg_EncodeString(obj, "UTF-8", NULL, pgExc_SDLError);
+    if (!oencoded) {
+        return NULL;
+    }
+    if (oencoded == Py_None) {
+        Py_DECREF(oencoded);
+        return RAISE(PyExc_TypeError,
+                     "save_async needs a file path, not a file object");
+    }
+    ext = find_extension(PyBytes_AS_STRING(oencoded));
+    if (!ext_encode_rw &&
+        (!strcasecmp(ext, "png") || !strcasecmp(ext, "jpg") ||
+         !strcasecmp(ext, "jpeg"))) {
+        Py_DECREF(oencoded);
+        return RAISE(PyExc_NotImplementedError,
+                     "saving images of extended format is not available");
+    }
+
+    if (!save_start()) {
+        Py_DECREF(oencoded);
+        return NULL;
+    }
+
+    /* Take a place in the queue, waiting for one if asked to */
+    Py_BEGIN_ALLOW_THREADS;
+    SDL_LockMutex(save_mutex);
+    full = save_pending >= PG_IMAGE_SAVE_QUEUE_SIZE;
+    if (full && block) {
+        while (save_pending >= PG_IMAGE_SAVE_QUEUE_SIZE) {
+            SDL_CondWait(save_cond, save_mutex);
+        }
+        full = 0;
+    }
+    if (!full) {
+        ++save_pending;
+    }
+    SDL_UnlockMutex(save_mutex);
+    Py_END_ALLOW_THREADS;
+    if (full) {
+        Py_DECREF(oencoded);
+        return RAISE(pgExc_SDLError, "save_async queue is full");
+    }
+
+    job = PyMem_RawCalloc(1, sizeof(SaveJob));
+    if (job) {
+        job->path = PyMem_RawMalloc(PyBytes_GET_SIZE(oencoded) + 1);
+    }
+    if (!job || !job->path) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    memcpy(job->path, PyBytes_AS_STRING(oencoded),
+           PyBytes_GET_SIZE(oencoded) + 1);
+    job->future = PyObject_CallNoArgs(future_type);
+    if (!job->future) {
+        goto error;
+    }
+    job->snapshot = save_snapshot(surfobj);
+    if (!job->snapshot) {
+        goto error;
+    }
+    Py_DECREF(oencoded);
+
+#if defined(__EMSCRIPTEN__) || defined(__wasi__)
+    /* no threads on WASM, so save now and hand back a finished future */
+    {
+        PyObject *future = job->future;
+        int result = image_encode_file(job->snapshot, job->path);
+
+        Py_INCREF(future);
+        save_release_snapshot(job->snapshot);
+        save_finish_job(job, result < 0 ? SDL_GetError() : NULL);
+        --save_pending;
+        return future;
     }
-    SDL_Palette *surf_palette = SDL_GetSurfacePalette(surf);
-    Rloss = format_details->Rbits;
-    Gloss = format_details->Gbits;
-    Bloss = format_details->Bbits;
-    Aloss = format_details->Abits;
 #else
-    SDL_PixelFormat *format_details = surf->format;
-    SDL_Palette *surf_palette = surf->format->palette;
-    Rloss = format_details->Rloss;
-    Gloss = format_details->Gloss;
-    Bloss = format_details->Bloss;
-    Aloss = format_details->Aloss;
+    obj = job->future;
+    Py_INCREF(obj);
+    Py_BEGIN_ALLOW_THREADS;
+    SDL_LockMutex(save_mutex);
+    if (save_tail) {
+        save_tail->next = job;
+    }
+    else {
+        save_head = job;
+    }
+    save_tail = job;
+    SDL_CondBroadcast(save_cond);
+    SDL_UnlockMutex(save_mutex);
+    Py_END_ALLOW_THREADS;
+    return obj;
 #endif
-    Rmask = format_details->Rmask;
-    Gmask = format_details->Gmask;
-    Bmask = format_details->Bmask;
-    Amask = format_details->Amask;
-    Rshift = format_details->Rshift;
-    Gshift = format_details->Gshift;
-    Bshift = format_details->Bshift;
-    Ashift = format_details->Ashift;
+
+error:
+    Py_DECREF(oencoded);
+    if (job) {
+        Py_XDECREF(job->future);
+        PyMem_RawFree(job->path);
+        PyMem_RawFree(job);
+    }
+    Py_BEGIN_ALLOW_THREADS;
+    SDL_LockMutex(save_mutex);
+    --save_pending;
+    SDL_CondBroadcast(save_cond);
+    SDL_UnlockMutex(save_mutex);
+    Py_END_ALLOW_THREADS;
+    return NULL;
+}
+
+static PyObject *
+image_get_extended(PyObject *self, PyObject *_null)
+{
+    if (extverobj == NULL) {
+        Py_RETURN_FALSE;
+    }
+    else {
+        Py_RETURN_TRUE;
+    }
+}
+
+static PyObject *
+image_get_sdl_image_version(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    if (extverobj == NULL) {
+        Py_RETURN_NONE;
+    }
+    else {
+        return PyObject_Call(extverobj, args, kwargs);
+    }
+}
+
+/* Upper bound on the number of threads a tobytes/frombytes frame is split
+ * between, and the least number of bytes worth giving one thread */
+#define PG_IMAGE_ROWS_MAX_THREADS 16
+#define PG_IMAGE_ROWS_MIN_BYTES (256 * 1024)
+
+typedef void (*ImageRowsFunc)(void *ctx, int first, int last);
+
+typedef struct {
+    ImageRowsFunc func;
+    void *ctx;
+    int first;
+    int last;
+} ImageRowsBand;
+
+static int SDLCALL
+_image_rows_worker(void *data)
+{
+    ImageRowsBand *band = (ImageRowsBand *)data;
+
+    band->func(band->ctx, band->first, band->last);
+    return 0;
+}
+
+/* Call func over the rows [0, rows) of a frame of size bytes. Large frames
+ * are split in bands of rows, one per thread. Runs without the GIL. */
+static void
+image_run_rows(ImageRowsFunc func, void *ctx, int rows, Py_ssize_t size)
+{
+    ImageRowsBand bands[PG_IMAGE_ROWS_MAX_THREADS];
+    SDL_Thread *threads[PG_IMAGE_ROWS_MAX_THREADS];
+    int nthreads = 1;
+    int n;
+
+#if !defined(__EMSCRIPTEN__) && !defined(__wasi__)
+    nthreads = SDL_GetCPUCount();
+    if (nthreads > PG_IMAGE_ROWS_MAX_THREADS) {
+        nthreads = PG_IMAGE_ROWS_MAX_THREADS;
+    }
+    if (nthreads > size / PG_IMAGE_ROWS_MIN_BYTES) {
+        nthreads = (int)(size / PG_IMAGE_ROWS_MIN_BYTES);
+    }
+    if (nthreads > rows) {
+        nthreads = rows;
+    }
+    if (nthreads < 1) {
+        nthreads = 1;
+    }
+#endif
+
+    for (n = 0; n < nthreads; ++n) {
+        bands[n].func = func;
+        bands[n].ctx = ctx;
+        bands[n].first = (int)((Sint64)rows * n / nthreads);
+        bands[n].last = (int)((Sint64)rows * (n + 1) / nthreads);
+    }
+    for (n = 1; n < nthreads; ++n) {
+        threads[n] = SDL_CreateThread(_image_rows_worker, "pg_image_rows",
+                                      &bands[n]);
+    }
+    func(ctx, bands[0].first, bands[0].last);
+    for (n = 1; n < nthreads; ++n) {
+        if (threads[n]) {
+            SDL_WaitThread(threads[n], NULL);
+        }
+        else {
+            /* the thread could not be started, do its band here */
+            func(ctx, bands[n].first, bands[n].last);
+        }
+    }
+}
+
+/* Convert the start of a 32 bit row with the best SIMD kernel the CPU has,
+ * returning how many pixels were done */
+static int
+image_swizzle_row(const Uint8 *src, Uint8 *dst, int width,
+                  const PG_ImageSwizzle *swizzle)
+{
+    int done = 0;
+
+    if (image_has_avx2) {
+        done = image_swizzle_row_avx2(src, dst, width, swizzle);
+    }
+    if (!done && image_has_sse2) {
+        done = image_swizzle_row_sse2(src, dst, width, swizzle);
+    }
+    return done;
+}
+
+/* Swap the first and last byte of every 3 byte pixel in a row */
+static void
+image_swap_rgb_row(const Uint8 *src, Uint8 *dst, int width)
+{
+    int x = 0;
+
+    if (image_has_avx2) {
+        x = image_swap_rgb_row_avx2(src, dst, width);
+    }
+    if (!x && image_has_sse2) {
+        x = image_swap_rgb_row_sse2(src, dst, width);
+    }
+    for (src += x * 3, dst += x * 3; x < width; ++x) {
+        dst[0] = src[2];
+        dst[1] = src[1];
+        dst[2] = src[0];
+        src += 3;
+        dst += 3;
+    }
+}
+
+/* How tobytes turns surface rows into output rows. Filled in while the GIL
+ * is held, then only read by tobytes_rows, which may run on several
+ * threads at once. */
+typedef struct {
+    SDL_Surface *surf;
+    char *data;
+    int pitch;      /* bytes per output row */
+    int byte_width; /* bytes of pixels per output row, before the padding */
+    int flipped;
+    int bpp;        /* bytes per output pixel: 1, 3 or 4 */
+    int offsets[4]; /* output byte of R, G, B and A, or -1 */
+    int premultiply;
+    int hascolorkey;
+    Uint32 colorkey;
+    Uint32 masks[4];
+    Uint32 shifts[4];
+    Uint32 losses[4];
+    int copy;  /* the rows are already in the output layout */
+    int swap;  /* 24 bit rows that only need R and B swapped */
+    int simd;  /* 32 bit rows that swizzle can convert */
+    PG_ImageSwizzle swizzle;
+    Uint8 lut[256][4]; /* 8 bit surfaces: output pixel of each index */
+} TobytesPlan;
+
+static void
+tobytes_set_offsets(TobytesPlan *plan, int r, int g, int b, int a)
+{
+    plan->offsets[0] = r;
+    plan->offsets[1] = g;
+    plan->offsets[2] = b;
+    plan->offsets[3] = a;
+}
+
+static PG_INLINE void
+tobytes_pixel(const TobytesPlan *plan, Uint32 color, Uint8 *out)
+{
+    Uint32 value, alpha = 255;
+    int c;
+
+    if (plan->hascolorkey) {
+        alpha = (color != plan->colorkey) * 255;
+    }
+    else if (plan->masks[3]) {
+        alpha = ((color & plan->masks[3]) >> plan->shifts[3])
+                << plan->losses[3];
+    }
+    for (c = 0; c < 3; ++c) {
+        value = ((color & plan->masks[c]) >> plan->shifts[c])
+                << plan->losses[c];
+        if (plan->premultiply) {
+            value = ((value + 1) * alpha) >> 8;
+        }
+        out[plan->offsets[c]] = (Uint8)value;
+    }
+    if (plan->offsets[3] >= 0) {
+        out[plan->offsets[3]] = (Uint8)alpha;
+    }
+}
+
+static void
+tobytes_rows(void *ctx, int first, int last)
+{
+    TobytesPlan *plan = (TobytesPlan *)ctx;
+    SDL_Surface *surf = plan->surf;
+    int surf_bpp = PG_SURF_BytesPerPixel(surf);
+    int padding = plan->pitch - plan->byte_width;
+    const Uint8 *src;
+    Uint8 *dst;
+    Uint32 color = 0;
+    int x, y;
+
+    for (y = first; y < last; ++y) {
+        src = (const Uint8 *)DATAROW(surf->pixels, y, surf->pitch, surf->h,
+                                     plan->flipped);
+        dst = (Uint8 *)plan->data + (Py_ssize_t)y * plan->pitch;
+        x = 0;
+
+        if (plan->copy) {
+            memcpy(dst, src, plan->byte_width);
+            x = surf->w;
+        }
+        else if (plan->swap) {
+            image_swap_rgb_row(src, dst, surf->w);
+            x = surf->w;
+        }
+        else if (plan->simd) {
+            x = image_swizzle_row(src, dst, surf->w, &plan->swizzle);
+        }
+
+        src += x * surf_bpp;
+        dst += x * plan->bpp;
+        if (surf_bpp == 1 && plan->bpp == 4) {
+            for (; x < surf->w; ++x) {
+                memcpy(dst, plan->lut[*src++], 4);
+                dst += 4;
+            }
+        }
+        else if (surf_bpp == 1) {
+            for (; x < surf->w; ++x) {
+                memcpy(dst, plan->lut[*src++], 3);
+                dst += 3;
+            }
+        }
+        for (; x < surf->w; ++x) {
+            switch (surf_bpp) {
+                case 2:
+                    color = *(const Uint16 *)src;
+                    break;
+                case 3:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+                    color = src[0] + (src[1] << 8) + (src[2] << 16);
+#else
+                    color = src[2] + (src[1] << 8) + (src[0] << 16);
+#endif
+                    break;
+                case 4:
+                    color = *(const Uint32 *)src;
+                    break;
+            }
+            tobytes_pixel(plan, color, dst);
+            src += surf_bpp;
+            dst += plan->bpp;
+        }
+
+        if (padding) {
+            memset((Uint8 *)plan->data + (Py_ssize_t)y * plan->pitch +
+                       plan->byte_width,
+                   0, padding);
+        }
+    }
+}
+
+/* Work out how tobytes converts surf to format, and the output pitch.
+ * Returns 0 with an exception set on bad arguments. */
+static int
+tobytes_prepare(TobytesPlan *plan, SDL_Surface *surf, const char *format,
+                int flipped, int pitch)
+{
+    PG_PixelFormat *format_details;
+    SDL_Palette *surf_palette;
+    int surf_bpp = PG_SURF_BytesPerPixel(surf);
+    int i;
+
+    memset(plan, 0, sizeof(TobytesPlan));
+    if (!PG_GetSurfaceDetails(surf, &format_details, &surf_palette)) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        return 0;
+    }
+    plan->surf = surf;
+    plan->flipped = flipped;
+    plan->masks[0] = format_details->Rmask;
+    plan->masks[1] = format_details->Gmask;
+    plan->masks[2] = format_details->Bmask;
+    plan->masks[3] = format_details->Amask;
+    plan->shifts[0] = format_details->Rshift;
+    plan->shifts[1] = format_details->Gshift;
+    plan->shifts[2] = format_details->Bshift;
+    plan->shifts[3] = format_details->Ashift;
+    plan->losses[0] = PG_FORMAT_R_LOSS(format_details);
+    plan->losses[1] = PG_FORMAT_G_LOSS(format_details);
+    plan->losses[2] = PG_FORMAT_B_LOSS(format_details);
+    plan->losses[3] = PG_FORMAT_A_LOSS(format_details);
+    plan->bpp = 4;
 
     if (!strcmp(format, "P")) {
-        if (PG_SURF_BytesPerPixel(surf) != 1) {
-            return RAISE(
+        if (surf_bpp != 1) {
+            PyErr_SetString(
                 PyExc_ValueError,
                 "Can only create \"P\" format data with 8bit Surfaces");
+            return 0;
         }
-        byte_width = surf->w;
+        plan->bpp = 1;
+        plan->copy = 1;
     }
     else if (!strcmp(format, "RGB")) {
-        byte_width = surf->w * 3;
+        plan->bpp = 3;
+        tobytes_set_offsets(plan, 0, 1, 2, -1);
     }
-    else if (!strcmp(format, "RGBA")) {
-        if ((hascolorkey = SDL_HasColorKey(surf))) {
-            SDL_GetColorKey(surf, &colorkey);
+    else if (!strcmp(format, "RGBX") || !strcmp(format, "RGBA")) {
+        if (format[3] == 'A' && SDL_HasColorKey(surf)) {
+            plan->hascolorkey = 1;
+            SDL_GetColorKey(surf, &plan->colorkey);
         }
-        byte_width = surf->w * 4;
+        tobytes_set_offsets(plan, 0, 1, 2, 3);
+    }
+    else if (!strcmp(format, "ARGB")) {
+        tobytes_set_offsets(plan, 1, 2, 3, 0);
+    }
+    else if (!strcmp(format, "BGRA")) {
+        tobytes_set_offsets(plan, 2, 1, 0, 3);
     }
-    else if (!strcmp(format, "RGBX") || !strcmp(format, "ARGB") ||
-             !strcmp(format, "BGRA") || !strcmp(format, "ABGR")) {
-        byte_width = surf->w * 4;
+    else if (!strcmp(format, "ABGR")) {
+        tobytes_set_offsets(plan, 3, 2, 1, 0);
     }
     else if (!strcmp(format, "RGBA_PREMULT") ||
              !strcmp(format, "ARGB_PREMULT")) {
-        if (PG_SURF_BytesPerPixel(surf) == 1 || Amask == 0) {
-            return RAISE(PyExc_ValueError,
-                         "Can only create pre-multiplied alpha bytes if "
-                         "the surface has per-pixel alpha");
+        if (surf_bpp == 1 || plan->masks[3] == 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "Can only create pre-multiplied alpha bytes if "
+                            "the surface has per-pixel alpha");
+            return 0;
+        }
+        plan->premultiply = 1;
+        if (format[0] == 'R') {
+            tobytes_set_offsets(plan, 0, 1, 2, 3);
+        }
+        else {
+            tobytes_set_offsets(plan, 1, 2, 3, 0);
         }
-        byte_width = surf->w * 4;
     }
     else {
-        return RAISE(PyExc_ValueError, "Unrecognized type of format");
+        PyErr_SetString(PyExc_ValueError, "Unrecognized type of format");
+        return 0;
     }
 
+    plan->byte_width = surf->w * plan->bpp;
     if (pitch == -1) {
-        pitch = byte_width;
-        padding = 0;
+        plan->pitch = plan->byte_width;
     }
-    else if (pitch < byte_width) {
-        return RAISE(PyExc_ValueError,
-                     "Pitch must be greater than or equal to the width "
-                     "as per the format");
+    else if (pitch < plan->byte_width) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Pitch must be greater than or equal to the width "
+                        "as per the format");
+        return 0;
     }
     else {
-        padding = pitch - byte_width;
+        plan->pitch = pitch;
     }
 
-    bytes = PyBytes_FromStringAndSize(NULL, (Py_ssize_t)pitch * surf->h);
-    if (!bytes) {
-        return NULL;
+    if (plan->copy) {
+        return 1;
     }
-    PyBytes_AsStringAndSize(bytes, &data, &len);
 
-    if (!strcmp(format, "P")) {
-        pgSurface_Lock(surfobj);
-        for (h = 0; h < surf->h; ++h) {
-            Uint8 *ptr = (Uint8 *)DATAROW(data, h, pitch, surf->h, flipped);
-            memcpy(ptr, (char *)surf->pixels + (h * surf->pitch), surf->w);
-            if (padding) {
-                memset(ptr + byte_width, 0, padding);
+    if (surf_bpp == 1) {
+        /* Look every palette index up once, instead of once per pixel */
+        if (!surf_palette) {
+            PyErr_SetString(pgExc_SDLError, "Surface has no palette");
+            return 0;
+        }
+        for (i = 0; i < 256; ++i) {
+            SDL_Color color = {0, 0, 0, 255};
+
+            if (i < surf_palette->ncolors) {
+                color = surf_palette->colors[i];
+            }
+            plan->lut[i][plan->offsets[0]] = color.r;
+            plan->lut[i][plan->offsets[1]] = color.g;
+            plan->lut[i][plan->offsets[2]] = color.b;
+            if (plan->offsets[3] >= 0) {
+                plan->lut[i][plan->offsets[3]] = 255;
+                if (plan->hascolorkey && (Uint32)i == plan->colorkey) {
+                    plan->lut[i][plan->offsets[3]] = 0;
+                }
             }
         }
-        pgSurface_Unlock(surfobj);
+        return 1;
     }
-    else if (!strcmp(format, "RGB")) {
-        pgSurface_Lock(surfobj);
-
-        switch (PG_SURF_BytesPerPixel(surf)) {
-            case 1:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[0] = (char)surf_palette->colors[color].r;
-                        data[1] = (char)surf_palette->colors[color].g;
-                        data[2] = (char)surf_palette->colors[color].b;
-                        data += 3;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 2:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint16 *ptr = (Uint16 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[0] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[1] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[2] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data += 3;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 3:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
+
 #if SDL_BYTEORDER == SDL_LIL_ENDIAN
-                        color = ptr[0] + (ptr[1] << 8) + (ptr[2] << 16);
-#else
-                        color = ptr[2] + (ptr[1] << 8) + (ptr[0] << 16);
-#endif
-                        ptr += 3;
-                        data[0] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[1] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[2] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data += 3;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 4:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint32 *ptr = (Uint32 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[0] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[1] = (char)(((color & Gmask) >> Gshift) << Rloss);
-                        data[2] = (char)(((color & Bmask) >> Bshift) << Rloss);
-                        data += 3;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-        }
+    /* Whole byte channels are moved around a byte at a time: find the byte
+     * each one sits in, or give up on the fast paths */
+    int chan[4];
+    int c, k;
 
-        pgSurface_Unlock(surfobj);
+    if (plan->hascolorkey || surf_bpp < 3) {
+        return 1;
     }
-    else if (!strcmp(format, "RGBX") || !strcmp(format, "RGBA")) {
-        pgSurface_Lock(surfobj);
-        switch (PG_SURF_BytesPerPixel(surf)) {
-            case 1:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[0] = (char)surf_palette->colors[color].r;
-                        data[1] = (char)surf_palette->colors[color].g;
-                        data[2] = (char)surf_palette->colors[color].b;
-                        data[3] = hascolorkey ? (char)(color != colorkey) * 255
-                                              : (char)255;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 2:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint16 *ptr = (Uint16 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[0] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[1] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[2] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[3] =
-                            hascolorkey
-                                ? (char)(color != colorkey) * 255
-                                : (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 3:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-                        color = ptr[0] + (ptr[1] << 8) + (ptr[2] << 16);
-#else
-                        color = ptr[2] + (ptr[1] << 8) + (ptr[0] << 16);
-#endif
-                        ptr += 3;
-                        data[0] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[1] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[2] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[3] =
-                            hascolorkey
-                                ? (char)(color != colorkey) * 255
-                                : (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 4:
-                tobytes_surf_32bpp(surf, format_details, flipped, hascolorkey,
-                                   colorkey, data, 0, 3, padding);
-                break;
+    for (c = 0; c < 4; ++c) {
+        if (c == 3 && plan->masks[3] == 0) {
+            chan[c] = -1;
+        }
+        else if ((plan->masks[c] >> plan->shifts[c]) == 0xff &&
+                 plan->shifts[c] % 8 == 0) {
+            chan[c] = plan->shifts[c] / 8;
+        }
+        else {
+            return 1;
         }
-        pgSurface_Unlock(surfobj);
     }
-    else if (!strcmp(format, "ARGB")) {
-        pgSurface_Lock(surfobj);
-        switch (PG_SURF_BytesPerPixel(surf)) {
-            case 1:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[1] = (char)surf_palette->colors[color].r;
-                        data[2] = (char)surf_palette->colors[color].g;
-                        data[3] = (char)surf_palette->colors[color].b;
-                        data[0] = (char)255;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 2:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint16 *ptr = (Uint16 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[1] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[2] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[3] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[0] = (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 3:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-                        color = ptr[0] + (ptr[1] << 8) + (ptr[2] << 16);
-#else
-                        color = ptr[2] + (ptr[1] << 8) + (ptr[0] << 16);
-#endif
-                        ptr += 3;
-                        data[1] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[2] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[3] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[0] = (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 4:
-                tobytes_surf_32bpp(surf, format_details, flipped, hascolorkey,
-                                   colorkey, data, 1, 0, padding);
-                break;
+    plan->swizzle.bpp = plan->bpp;
+    plan->swizzle.alpha = plan->premultiply ? plan->offsets[3] : -1;
+    for (c = 0; c < 4; ++c) {
+        if (plan->offsets[c] >= 0) {
+            plan->swizzle.src[plan->offsets[c]] = chan[c];
         }
-        pgSurface_Unlock(surfobj);
     }
-    else if (!strcmp(format, "BGRA")) {
-        pgSurface_Lock(surfobj);
-        switch (PG_SURF_BytesPerPixel(surf)) {
-            case 1:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[2] = (char)surf_palette->colors[color].r;
-                        data[1] = (char)surf_palette->colors[color].g;
-                        data[0] = (char)surf_palette->colors[color].b;
-                        data[3] = (char)255;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 2:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint16 *ptr = (Uint16 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[2] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[1] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[0] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[3] = (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 3:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-                        color = ptr[0] + (ptr[1] << 8) + (ptr[2] << 16);
-#else
-                        color = ptr[2] + (ptr[1] << 8) + (ptr[0] << 16);
-#endif
-                        ptr += 3;
-                        data[2] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[1] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[0] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[3] = (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 4:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint32 *ptr = (Uint32 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[2] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[1] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[0] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[3] = (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
+    for (k = 0; k < plan->bpp; ++k) {
+        if (plan->swizzle.src[k] != k) {
+            break;
         }
-        pgSurface_Unlock(surfobj);
     }
-    else if (!strcmp(format, "ABGR")) {
-        pgSurface_Lock(surfobj);
-        switch (PG_SURF_BytesPerPixel(surf)) {
-            case 1:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[3] = (char)surf_palette->colors[color].r;
-                        data[2] = (char)surf_palette->colors[color].g;
-                        data[1] = (char)surf_palette->colors[color].b;
-                        data[0] = (char)255;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 2:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint16 *ptr = (Uint16 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[3] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[2] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[1] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[0] = (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 3:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-                        color = ptr[0] + (ptr[1] << 8) + (ptr[2] << 16);
-#else
-                        color = ptr[2] + (ptr[1] << 8) + (ptr[0] << 16);
-#endif
-                        ptr += 3;
-                        data[3] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[2] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[1] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[0] = (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 4:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint32 *ptr = (Uint32 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        data[3] = (char)(((color & Rmask) >> Rshift) << Rloss);
-                        data[2] = (char)(((color & Gmask) >> Gshift) << Gloss);
-                        data[1] = (char)(((color & Bmask) >> Bshift) << Bloss);
-                        data[0] = (char)(Amask ? (((color & Amask) >> Ashift)
-                                                  << Aloss)
-                                               : 255);
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-        }
-        pgSurface_Unlock(surfobj);
-    }
-    else if (!strcmp(format, "RGBA_PREMULT")) {
-        pgSurface_Lock(surfobj);
-        switch (PG_SURF_BytesPerPixel(surf)) {
-            case 2:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint16 *ptr = (Uint16 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        alpha = ((color & Amask) >> Ashift) << Aloss;
-                        data[0] = PREMUL_PIXEL_ALPHA(
-                            ((color & Rmask) >> Rshift) << Rloss, alpha);
-                        data[1] = PREMUL_PIXEL_ALPHA(
-                            ((color & Gmask) >> Gshift) << Gloss, alpha);
-                        data[2] = PREMUL_PIXEL_ALPHA(
-                            ((color & Bmask) >> Bshift) << Bloss, alpha);
-                        data[3] = (char)alpha;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 3:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-                        color = ptr[0] + (ptr[1] << 8) + (ptr[2] << 16);
-#else
-                        color = ptr[2] + (ptr[1] << 8) + (ptr[0] << 16);
-#endif
-                        ptr += 3;
-                        alpha = ((color & Amask) >> Ashift) << Aloss;
-                        data[0] = PREMUL_PIXEL_ALPHA(
-                            ((color & Rmask) >> Rshift) << Rloss, alpha);
-                        data[1] = PREMUL_PIXEL_ALPHA(
-                            ((color & Gmask) >> Gshift) << Gloss, alpha);
-                        data[2] = PREMUL_PIXEL_ALPHA(
-                            ((color & Bmask) >> Bshift) << Bloss, alpha);
-                        data[3] = (char)alpha;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 4:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint32 *ptr = (Uint32 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        alpha = ((color & Amask) >> Ashift) << Aloss;
-                        if (alpha == 0) {
-                            data[0] = data[1] = data[2] = 0;
-                        }
-                        else {
-                            data[0] = PREMUL_PIXEL_ALPHA(
-                                ((color & Rmask) >> Rshift) << Rloss, alpha);
-                            data[1] = PREMUL_PIXEL_ALPHA(
-                                ((color & Gmask) >> Gshift) << Gloss, alpha);
-                            data[2] = PREMUL_PIXEL_ALPHA(
-                                ((color & Bmask) >> Bshift) << Bloss, alpha);
-                        }
-                        data[3] = (char)alpha;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-        }
-        pgSurface_Unlock(surfobj);
-    }
-    else if (!strcmp(format, "ARGB_PREMULT")) {
-        pgSurface_Lock(surfobj);
-        switch (PG_SURF_BytesPerPixel(surf)) {
-            case 2:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint16 *ptr = (Uint16 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        alpha = ((color & Amask) >> Ashift) << Aloss;
-                        data[1] = PREMUL_PIXEL_ALPHA(
-                            ((color & Rmask) >> Rshift) << Rloss, alpha);
-                        data[2] = PREMUL_PIXEL_ALPHA(
-                            ((color & Gmask) >> Gshift) << Gloss, alpha);
-                        data[3] = PREMUL_PIXEL_ALPHA(
-                            ((color & Bmask) >> Bshift) << Bloss, alpha);
-                        data[0] = (char)alpha;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 3:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint8 *ptr = (Uint8 *)DATAROW(surf->pixels, h, surf->pitch,
-                                                  surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-                        color = ptr[0] + (ptr[1] << 8) + (ptr[2] << 16);
-#else
-                        color = ptr[2] + (ptr[1] << 8) + (ptr[0] << 16);
-#endif
-                        ptr += 3;
-                        alpha = ((color & Amask) >> Ashift) << Aloss;
-                        data[1] = PREMUL_PIXEL_ALPHA(
-                            ((color & Rmask) >> Rshift) << Rloss, alpha);
-                        data[2] = PREMUL_PIXEL_ALPHA(
-                            ((color & Gmask) >> Gshift) << Gloss, alpha);
-                        data[3] = PREMUL_PIXEL_ALPHA(
-                            ((color & Bmask) >> Bshift) << Bloss, alpha);
-                        data[0] = (char)alpha;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
-            case 4:
-                for (h = 0; h < surf->h; ++h) {
-                    Uint32 *ptr = (Uint32 *)DATAROW(
-                        surf->pixels, h, surf->pitch, surf->h, flipped);
-                    for (w = 0; w < surf->w; ++w) {
-                        color = *ptr++;
-                        alpha = ((color & Amask) >> Ashift) << Aloss;
-                        if (alpha == 0) {
-                            data[1] = data[2] = data[3] = 0;
-                        }
-                        else {
-                            data[1] = PREMUL_PIXEL_ALPHA(
-                                ((color & Rmask) >> Rshift) << Rloss, alpha);
-                            data[2] = PREMUL_PIXEL_ALPHA(
-                                ((color & Gmask) >> Gshift) << Gloss, alpha);
-                            data[3] = PREMUL_PIXEL_ALPHA(
-                                ((color & Bmask) >> Bshift) << Bloss, alpha);
-                        }
-                        data[0] = (char)alpha;
-                        data += 4;
-                    }
-                    pad(&data, padding);
-                }
-                break;
+
+    if (surf_bpp == 3) {
+        if (plan->bpp == 3) {
+            plan->copy = k == 3;
+            plan->swap = plan->swizzle.src[0] == 2 &&
+                         plan->swizzle.src[1] == 1 &&
+                         plan->swizzle.src[2] == 0;
         }
-        pgSurface_Unlock(surfobj);
+    }
+    else {
+        plan->copy = k == plan->bpp && plan->bpp == 4 && !plan->premultiply;
+        plan->simd = !plan->copy;
+    }
+#endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
+    return 1;
+}
+
+/* Fill plan->data (of plan->pitch * height bytes) from the surface */
+static void
+tobytes_run(TobytesPlan *plan, pgSurfaceObject *surfobj)
+{
+    SDL_Surface *surf = plan->surf;
+
+    pgSurface_Lock(surfobj);
+    Py_BEGIN_ALLOW_THREADS;
+    image_run_rows(tobytes_rows, plan, surf->h,
+                   (Py_ssize_t)plan->pitch * surf->h);
+    Py_END_ALLOW_THREADS;
+    pgSurface_Unlock(surfobj);
+}
+
+PyObject *
+image_tobytes(PyObject *self, PyObject *arg, PyObject *kwarg)
+{
+    pgSurfaceObject *surfobj;
+    PyObject *bytes = NULL;
+    char *format;
+    int flipped = 0, pitch = -1;
+    TobytesPlan plan;
+    static char *kwds[] = {"surface", "format", "flipped", "pitch", NULL};
+
+#ifdef _MSC_VER
+    /* MSVC static analyzer false alarm: assure format is NULL-terminated by
+     * making analyzer assume it was initialised */
+    __analysis_assume(format = "inited");
+#endif
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O!s|ii", kwds,
+                                     &pgSurface_Type, &surfobj, &format,
+                                     &flipped, &pitch)) {
+        return NULL;
+    }
+
+    if (!tobytes_prepare(&plan, pgSurface_AsSurface(surfobj), format,
+                         flipped, pitch)) {
+        return NULL;
     }
 
+    bytes = PyBytes_FromStringAndSize(NULL,
+                                      (Py_ssize_t)plan.pitch * plan.surf->h);
+    if (!bytes) {
+        return NULL;
+    }
+    plan.data = PyBytes_AS_STRING(bytes);
+    tobytes_run(&plan, surfobj);
+
     return bytes;
 }
 
+static PyObject *
+image_tobytes_into(PyObject *self, PyObject *arg, PyObject *kwarg)
+{
+    pgSurfaceObject *surfobj;
+    PyObject *bufferobj;
+    Py_buffer view;
+    Py_ssize_t size;
+    char *format;
+    int flipped = 0, pitch = -1;
+    TobytesPlan plan;
+    static char *kwds[] = {"surface", "buffer", "format", "flipped",
+                           "pitch",   NULL};
+
+#ifdef _MSC_VER
+    /* MSVC static analyzer false alarm: assure format is NULL-terminated by
+     * making analyzer assume it was initialised */
+    __analysis_assume(format = "inited");
+#endif
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O!Os|ii", kwds,
+                                     &pgSurface_Type, &surfobj, &bufferobj,
+                                     &format, &flipped, &pitch)) {
+        return NULL;
+    }
+
+    if (!tobytes_prepare(&plan, pgSurface_AsSurface(surfobj), format,
+                         flipped, pitch)) {
+        return NULL;
+    }
+
+    if (PyObject_GetBuffer(bufferobj, &view, PyBUF_WRITABLE) != 0) {
+        return NULL;
+    }
+    size = (Py_ssize_t)plan.pitch * plan.surf->h;
+    if (view.len < size) {
+        PyBuffer_Release(&view);
+        return PyErr_Format(PyExc_ValueError,
+                            "buffer is too small, it needs %zd bytes for "
+                            "this surface and format",
+                            size);
+    }
+    plan.data = (char *)view.buf;
+    tobytes_run(&plan, surfobj);
+    PyBuffer_Release(&view);
+
+    return PyLong_FromSsize_t(size);
+}
+
+/* How frombytes fills the rows of a new surface */
+typedef struct {
+    SDL_Surface *surf;
+    const char *data;
+    int pitch; /* bytes per input row */
+    int flipped;
+    int swap; /* reverse the bytes of each 3 byte pixel */
+} FrombytesPlan;
+
+static void
+frombytes_rows(void *ctx, int first, int last)
+{
+    FrombytesPlan *plan = (FrombytesPlan *)ctx;
+    SDL_Surface *surf = plan->surf;
+    int byte_width = surf->w * PG_SURF_BytesPerPixel(surf);
+    const Uint8 *src;
+    Uint8 *dst;
+    int y;
+
+    for (y = first; y < last; ++y) {
+        src = (const Uint8 *)plan->data + (Py_ssize_t)y * plan->pitch;
+        dst = (Uint8 *)DATAROW(surf->pixels, y, surf->pitch, surf->h,
+                               plan->flipped);
+        if (plan->swap) {
+            image_swap_rgb_row(src, dst, surf->w);
+        }
+        else {
+            memcpy(dst, src, byte_width);
+        }
+    }
+}
+
 PyObject *
 image_frombytes(PyObject *self, PyObject *arg, PyObject *kwds)
 {
@@ -1159,7 +1660,9 @@ image_frombytes(PyObject *self, PyObject *arg, PyObject *kwds)
     SDL_Surface *surf = NULL;
     int w, h, flipped = 0, pitch = -1;
     Py_ssize_t len;
-    int loopw, looph;
+    Uint32 pixelformat;
+    int bpp = 4;
+    FrombytesPlan plan;
 
 #ifdef _MSC_VER
     /* MSVC static analyzer false alarm: assure format is NULL-terminated by
@@ -1182,198 +1685,74 @@ image_frombytes(PyObject *self, PyObject *arg, PyObject *kwds)
 
     PyBytes_AsStringAndSize(bytes, &data, &len);
 
+    memset(&plan, 0, sizeof(FrombytesPlan));
     if (!strcmp(format, "P")) {
-        if (pitch == -1) {
-            pitch = w;
-        }
-        else if (pitch < w) {
-            return RAISE(PyExc_ValueError,
-                         "Pitch must be greater than or equal to the width "
-                         "as per the format");
-        }
-
-        if (len != (Py_ssize_t)pitch * h) {
-            return RAISE(
-                PyExc_ValueError,
-                "Bytes length does not equal format and resolution size");
-        }
-
-        surf = PG_CreateSurface(w, h, SDL_PIXELFORMAT_INDEX8);
-        if (!surf) {
-            return RAISE(pgExc_SDLError, SDL_GetError());
-        }
-        SDL_LockSurface(surf);
-        for (looph = 0; looph < h; ++looph) {
-            memcpy(((char *)surf->pixels) + looph * surf->pitch,
-                   DATAROW(data, looph, pitch, h, flipped), w);
-        }
-        SDL_UnlockSurface(surf);
+        pixelformat = SDL_PIXELFORMAT_INDEX8;
+        bpp = 1;
     }
     else if (!strcmp(format, "RGB")) {
-        if (pitch == -1) {
-            pitch = w * 3;
-        }
-        else if (pitch < w * 3) {
-            return RAISE(PyExc_ValueError,
-                         "Pitch must be greater than or equal to the width * "
-                         "3 as per the format");
-        }
-
-        if (len != (Py_ssize_t)pitch * h) {
-            return RAISE(
-                PyExc_ValueError,
-                "Bytes length does not equal format and resolution size");
-        }
-
 #if SDL_BYTEORDER == SDL_LIL_ENDIAN
-        surf = PG_CreateSurface(w, h, SDL_PIXELFORMAT_BGR24);
+        pixelformat = SDL_PIXELFORMAT_BGR24;
+        plan.swap = 1;
 #else
-        surf = PG_CreateSurface(w, h, SDL_PIXELFORMAT_RGB24);
+        pixelformat = SDL_PIXELFORMAT_RGB24;
 #endif
-        if (!surf) {
-            return RAISE(pgExc_SDLError, SDL_GetError());
-        }
-        SDL_LockSurface(surf);
-        for (looph = 0; looph < h; ++looph) {
-            Uint8 *pix =
-                (Uint8 *)DATAROW(surf->pixels, looph, surf->pitch, h, flipped);
-            for (loopw = 0; loopw < w; ++loopw) {
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-                pix[2] = data[0];
-                pix[1] = data[1];
-                pix[0] = data[2];
-#else
-                pix[0] = data[0];
-                pix[1] = data[1];
-                pix[2] = data[2];
-#endif
-                pix += 3;
-                data += 3;
-            }
-
-            data += pitch - w * 3;
-        }
-        SDL_UnlockSurface(surf);
+        bpp = 3;
     }
-    else if (!strcmp(format, "RGBA") || !strcmp(format, "RGBX")) {
-        if (pitch == -1) {
-            pitch = w * 4;
-        }
-        else if (pitch < w * 4) {
-            return RAISE(PyExc_ValueError,
-                         "Pitch must be greater than or equal to the width * "
-                         "4 as per the format");
-        }
-
-        int alphamult = !strcmp(format, "RGBA");
-        if (len != (Py_ssize_t)pitch * h) {
-            return RAISE(
-                PyExc_ValueError,
-                "Bytes length does not equal format and resolution size");
-        }
-        surf = PG_CreateSurface(
-            w, h,
-            (alphamult ? SDL_PIXELFORMAT_RGBA32 : PG_PIXELFORMAT_RGBX32));
-        if (!surf) {
-            return RAISE(pgExc_SDLError, SDL_GetError());
-        }
-        SDL_LockSurface(surf);
-        for (looph = 0; looph < h; ++looph) {
-            Uint32 *pix = (Uint32 *)DATAROW(surf->pixels, looph, surf->pitch,
-                                            h, flipped);
-            memcpy(pix, data, w * sizeof(Uint32));
-            data += pitch;
-        }
-        SDL_UnlockSurface(surf);
+    else if (!strcmp(format, "RGBA")) {
+        pixelformat = SDL_PIXELFORMAT_RGBA32;
+    }
+    else if (!strcmp(format, "RGBX")) {
+        pixelformat = PG_PIXELFORMAT_RGBX32;
     }
     else if (!strcmp(format, "BGRA")) {
-        if (pitch == -1) {
-            pitch = w * 4;
-        }
-        else if (pitch < w * 4) {
-            return RAISE(PyExc_ValueError,
-                         "Pitch must be greater than or equal to the width * "
-                         "4 as per the format");
-        }
-
-        if (len != (Py_ssize_t)pitch * h) {
-            return RAISE(
-                PyExc_ValueError,
-                "Bytes length does not equal format and resolution size");
-        }
-        surf = PG_CreateSurface(w, h, SDL_PIXELFORMAT_BGRA32);
-        if (!surf) {
-            return RAISE(pgExc_SDLError, SDL_GetError());
-        }
-        SDL_LockSurface(surf);
-        for (looph = 0; looph < h; ++looph) {
-            Uint32 *pix = (Uint32 *)DATAROW(surf->pixels, looph, surf->pitch,
-                                            h, flipped);
-            memcpy(pix, data, w * sizeof(Uint32));
-            data += pitch;
-        }
-        SDL_UnlockSurface(surf);
+        pixelformat = SDL_PIXELFORMAT_BGRA32;
     }
     else if (!strcmp(format, "ARGB")) {
-        if (pitch == -1) {
-            pitch = w * 4;
-        }
-        else if (pitch < w * 4) {
-            return RAISE(PyExc_ValueError,
-                         "Pitch must be greater than or equal to the width * "
-                         "4 as per the format");
-        }
-
-        if (len != (Py_ssize_t)pitch * h) {
-            return RAISE(
-                PyExc_ValueError,
-                "Bytes length does not equal format and resolution size");
-        }
-        surf = PG_CreateSurface(w, h, SDL_PIXELFORMAT_ARGB32);
-        if (!surf) {
-            return RAISE(pgExc_SDLError, SDL_GetError());
-        }
-        SDL_LockSurface(surf);
-        for (looph = 0; looph < h; ++looph) {
-            Uint32 *pix = (Uint32 *)DATAROW(surf->pixels, looph, surf->pitch,
-                                            h, flipped);
-            memcpy(pix, data, w * sizeof(Uint32));
-            data += pitch;
-        }
-        SDL_UnlockSurface(surf);
+        pixelformat = SDL_PIXELFORMAT_ARGB32;
     }
     else if (!strcmp(format, "ABGR")) {
-        if (pitch == -1) {
-            pitch = w * 4;
-        }
-        else if (pitch < w * 4) {
+        pixelformat = SDL_PIXELFORMAT_ABGR32;
+    }
+    else {
+        return RAISE(PyExc_ValueError, "Unrecognized type of format");
+    }
+
+    if (pitch == -1) {
+        pitch = w * bpp;
+    }
+    else if (pitch < w * bpp) {
+        if (bpp == 1) {
             return RAISE(PyExc_ValueError,
-                         "Pitch must be greater than or equal to the width * "
-                         "4 as per the format");
+                         "Pitch must be greater than or equal to the width "
+                         "as per the format");
         }
+        return PyErr_Format(PyExc_ValueError,
+                            "Pitch must be greater than or equal to the "
+                            "width * %d as per the format",
+                            bpp);
+    }
 
-        if (len != (Py_ssize_t)pitch * h) {
-            return RAISE(
-                PyExc_ValueError,
-                "Bytes length does not equal format and resolution size");
-        }
-        surf = PG_CreateSurface(w, h, SDL_PIXELFORMAT_ABGR32);
-        if (!surf) {
-            return RAISE(pgExc_SDLError, SDL_GetError());
-        }
-        SDL_LockSurface(surf);
-        for (looph = 0; looph < h; ++looph) {
-            Uint32 *pix = (Uint32 *)DATAROW(surf->pixels, looph, surf->pitch,
-                                            h, flipped);
-            memcpy(pix, data, w * sizeof(Uint32));
-            data += pitch;
-        }
-        SDL_UnlockSurface(surf);
+    if (len != (Py_ssize_t)pitch * h) {
+        return RAISE(PyExc_ValueError,
+                     "Bytes length does not equal format and resolution size");
     }
-    else {
-        return RAISE(PyExc_ValueError, "Unrecognized type of format");
+
+    surf = PG_CreateSurface(w, h, pixelformat);
+    if (!surf) {
+        return RAISE(pgExc_SDLError, SDL_GetError());
     }
 
+    plan.surf = surf;
+    plan.data = data;
+    plan.pitch = pitch;
+    plan.flipped = flipped;
+    SDL_LockSurface(surf);
+    Py_BEGIN_ALLOW_THREADS;
+    image_run_rows(frombytes_rows, &plan, h, len);
+    Py_END_ALLOW_THREADS;
+    SDL_UnlockSurface(surf);
+
     return (PyObject *)pgSurface_New(surf);
 }
 
@@ -1696,6 +2075,7 @@ SaveTGA_RW(SDL_Surface *surface, SDL_RWops *out, int rle)
     SDL_Rect r;
     int bpp;
     Uint8 *rlebuf = NULL;
+    int ret;
 
     h.infolen = 0;
     SETLE16(h.cmap_start, 0);
@@ -1721,154 +2101,1161 @@ SaveTGA_RW(SDL_Surface *surface, SDL_RWops *out, int rle)
     SDL_PixelFormatEnum output_format;
 #endif
 
-    SDL_GetSurfaceAlphaMod(surface, &surf_alpha);
-    if ((have_surf_colorkey = SDL_HasColorKey(surface))) {
-        SDL_GetColorKey(surface, &surf_colorkey);
+    SDL_GetSurfaceAlphaMod(surface, &surf_alpha);
+    if ((have_surf_colorkey = SDL_HasColorKey(surface))) {
+        SDL_GetColorKey(surface, &surf_colorkey);
+    }
+
+    if (srcbpp == 8) {
+        h.has_cmap = 1;
+        h.type = TGA_TYPE_INDEXED;
+        if (have_surf_colorkey) {
+            h.cmap_bits = 32;
+        }
+        else {
+            h.cmap_bits = 24;
+        }
+        SETLE16(h.cmap_len, surf_palette->ncolors);
+        h.pixel_bits = 8;
+        output_format = SDL_PIXELFORMAT_INDEX8;
+    }
+    else {
+        h.has_cmap = 0;
+        h.type = TGA_TYPE_RGB;
+        h.cmap_bits = 0;
+        SETLE16(h.cmap_len, 0);
+        if (surf_format->Amask) {
+            alpha = 1;
+            h.pixel_bits = 32;
+            output_format = SDL_PIXELFORMAT_BGRA32;
+        }
+        else {
+            h.pixel_bits = 24;
+            output_format = SDL_PIXELFORMAT_BGR24;
+        }
+    }
+    bpp = h.pixel_bits >> 3;
+    if (rle) {
+        h.type += TGA_TYPE_RLE;
+    }
+
+    SETLE16(h.yorigin, 0);
+    SETLE16(h.xorigin, 0);
+    SETLE16(h.width, surface->w);
+    SETLE16(h.height, surface->h);
+    h.flags = TGA_ORIGIN_UPPER | (alpha ? 8 : 0);
+
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    if (!SDL_WriteIO(out, &h, sizeof(h)))
+#else
+    if (!SDL_RWwrite(out, &h, sizeof(h), 1))
+#endif
+        return -1;
+
+    if (h.has_cmap) {
+        int i;
+        Uint8 entry[4];
+        for (i = 0; i < surf_palette->ncolors; i++) {
+            entry[0] = surf_palette->colors[i].b;
+            entry[1] = surf_palette->colors[i].g;
+            entry[2] = surf_palette->colors[i].r;
+            entry[3] = ((unsigned)i == surf_colorkey) ? 0 : 0xff;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+            if (!SDL_WriteIO(out, entry, h.cmap_bits >> 3))
+#else
+            if (!SDL_RWwrite(out, entry, h.cmap_bits >> 3, 1))
+#endif
+                return -1;
+        }
+    }
+
+    linebuf = PG_CreateSurface(surface->w, 1, output_format);
+    if (!linebuf) {
+        return -1;
+    }
+
+    if (h.has_cmap) {
+        if (!PG_SetSurfacePalette(linebuf, surf_palette)) {
+            goto error; /* SDL error already set. */
+        }
+    }
+
+    if (rle) {
+        rlebuf = malloc(bpp * surface->w + 1 + surface->w / TGA_RLE_MAX);
+        if (!rlebuf) {
+            SDL_SetError("out of memory");
+            goto error;
+        }
+    }
+
+    /* Temporarily remove colorkey and alpha from surface so copies are
+       opaque */
+    SDL_SetSurfaceAlphaMod(surface, SDL_ALPHA_OPAQUE);
+    if (have_surf_colorkey) {
+        SDL_SetColorKey(surface, SDL_FALSE, surf_colorkey);
+    }
+
+    r.x = 0;
+    r.w = surface->w;
+    r.h = 1;
+    ret = 0;
+    for (r.y = 0; r.y < surface->h; r.y++) {
+        int n;
+        void *buf;
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+        if (!SDL_BlitSurface(surface, &r, linebuf, NULL))
+#else
+        if (SDL_BlitSurface(surface, &r, linebuf, NULL) < 0)
+#endif
+        {
+            ret = -1;
+            break;
+        }
+        if (rle) {
+            buf = rlebuf;
+            n = rle_line(linebuf->pixels, rlebuf, surface->w, bpp);
+        }
+        else {
+            buf = linebuf->pixels;
+            n = surface->w * bpp;
+        }
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+        if (!SDL_WriteIO(out, buf, n))
+#else
+        if (!SDL_RWwrite(out, buf, n, 1))
+#endif
+        {
+            ret = -1;
+            break;
+        }
+    }
+
+    /* restore flags */
+    SDL_SetSurfaceAlphaMod(surface, surf_alpha);
+    if (have_surf_colorkey) {
+        SDL_SetColorKey(surface, SDL_TRUE, surf_colorkey);
+    }
+
+    free(rlebuf);
+    SDL_FreeSurface(linebuf);
+    return ret;
+
+error:
+    free(rlebuf);
+    SDL_FreeSurface(linebuf);
+    return -1;
+}
+
+static int
+SaveTGA(SDL_Surface *surface, const char *file, int rle)
+{
+    SDL_RWops *out = SDL_RWFromFile(file, "wb");
+    int ret;
+    if (!out) {
+        return -1;
+    }
+    ret = SaveTGA_RW(surface, out, rle);
+    SDL_RWclose(out);
+    return ret;
+}
+
+/*
+ * Mapped surface files hold any number of named surfaces: a header, a table
+ * of entries, the names and palettes, then the pixel data. Uncompressed
+ * pixel data starts on a page boundary, so load_mapped can map the file
+ * copy-on-write and point the surfaces straight at it. Everything is in
+ * native byte order, which the byteorder field guards.
+ */
+#define MAPPED_MAGIC "PGSURFS" /* 8 bytes with the terminator */
+#define MAPPED_VERSION 1
+#define MAPPED_BYTEORDER 0x01020304
+#define MAPPED_PAGE_SIZE 4096
+
+/* entry flags */
+#define MAPPED_RLE 0x1      /* rows are stored as TGA style RLE packets */
+#define MAPPED_BLEND 0x2    /* alpha blending is enabled */
+#define MAPPED_COLORKEY 0x4 /* the colorkey field is used */
+
+struct MappedHeader {
+    char magic[8];
+    Uint32 byteorder;
+    Uint32 version;
+    Uint32 count;
+    Uint32 entry_size;
+};
+
+struct MappedEntry {
+    Uint64 offset; /* of the pixel data */
+    Uint64 size;   /* of the pixel data as stored */
+    Uint64 name_offset;
+    Uint64 palette_offset; /* RGBA quadruplets */
+    Uint32 name_size;
+    Uint32 palette_size; /* in colors */
+    Uint32 width;
+    Uint32 height;
+    Uint32 pitch;
+    Uint32 bpp;
+    Uint32 Rmask;
+    Uint32 Gmask;
+    Uint32 Bmask;
+    Uint32 Amask;
+    Uint32 flags;
+    Uint32 colorkey;
+    Uint32 alpha;
+    Uint32 reserved;
+};
+
+#define MAPPED_ALIGN(n, a) (((n) + (a) - 1) / (a) * (a))
+
+/* Expand the RLE packets written by rle_line for one row of w pixels.
+ * Returns the number of bytes used from src, or -1 if they run short. */
+static Sint64
+unrle_line(const Uint8 *src, Uint64 srclen, Uint8 *dst, int w, int bpp)
+{
+    Uint64 in = 0;
+    int x = 0, n;
+
+    while (x < w) {
+        if (in >= srclen) {
+            return -1;
+        }
+        n = (src[in] & 0x7f) + 1;
+        if (n > w - x) {
+            return -1;
+        }
+        if (src[in++] & 0x80) {
+            if (srclen - in < (Uint64)bpp) {
+                return -1;
+            }
+            for (; n; --n, ++x) {
+                memcpy(dst + x * bpp, src + in, bpp);
+            }
+            in += bpp;
+        }
+        else {
+            if (srclen - in < (Uint64)n * bpp) {
+                return -1;
+            }
+            memcpy(dst + x * bpp, src + in, (size_t)n * bpp);
+            in += (Uint64)n * bpp;
+            x += n;
+        }
+    }
+    return (Sint64)in;
+}
+
+/* Write size bytes. Returns 0 with the SDL error set on failure. */
+static int
+mapped_write(SDL_RWops *out, const void *data, size_t size)
+{
+    if (!size) {
+        return 1;
+    }
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    return SDL_WriteIO(out, data, size) == size;
+#else
+    return SDL_RWwrite(out, data, size, 1) == 1;
+#endif
+}
+
+/* Write zeros up to offset */
+static int
+mapped_pad(SDL_RWops *out, Uint64 *pos, Uint64 offset)
+{
+    static const Uint8 zeros[256] = {0};
+    size_t n;
+
+    while (*pos < offset) {
+        n = (size_t)MIN(offset - *pos, sizeof(zeros));
+        if (!mapped_write(out, zeros, n)) {
+            return 0;
+        }
+        *pos += n;
+    }
+    return 1;
+}
+
+/* Write a mapped surface file whose layout is already set in entries.
+ * Called without the GIL; returns -1 with the SDL error set on failure. */
+static int
+SaveMapped_RW(SDL_RWops *out, struct MappedHeader *header,
+              struct MappedEntry *entries, const char **names,
+              SDL_Surface **surfs, Uint8 **packed)
+{
+    struct MappedEntry *e;
+    SDL_Palette *palette;
+    Uint64 pos = 0;
+    Uint32 i;
+    int c, y;
+
+    if (!mapped_write(out, header, sizeof(*header)) ||
+        !mapped_write(out, entries, sizeof(*entries) * header->count)) {
+        return -1;
+    }
+    pos = sizeof(*header) + sizeof(*entries) * header->count;
+
+    for (i = 0; i < header->count; ++i) {
+        e = &entries[i];
+        if (!mapped_pad(out, &pos, e->name_offset) ||
+            !mapped_write(out, names[i], e->name_size)) {
+            return -1;
+        }
+        pos += e->name_size;
+        if (!e->palette_size) {
+            continue;
+        }
+        palette = PG_GetSurfacePalette(surfs[i]);
+        if (!mapped_pad(out, &pos, e->palette_offset)) {
+            return -1;
+        }
+        for (c = 0; c < (int)e->palette_size; ++c) {
+            Uint8 rgba[4] = {palette->colors[c].r, palette->colors[c].g,
+                             palette->colors[c].b, palette->colors[c].a};
+            if (!mapped_write(out, rgba, 4)) {
+                return -1;
+            }
+        }
+        pos += (Uint64)e->palette_size * 4;
+    }
+
+    for (i = 0; i < header->count; ++i) {
+        e = &entries[i];
+        if (!mapped_pad(out, &pos, e->offset)) {
+            return -1;
+        }
+        if (packed[i]) {
+            if (!mapped_write(out, packed[i], (size_t)e->size)) {
+                return -1;
+            }
+        }
+        else {
+            for (y = 0; y < (int)e->height; ++y) {
+                if (!mapped_write(out,
+                                  (Uint8 *)surfs[i]->pixels + y * e->pitch,
+                                  e->pitch)) {
+                    return -1;
+                }
+            }
+        }
+        pos += e->size;
+    }
+    return 0;
+}
+
+static PyObject *
+image_save_mapped(PyObject *self, PyObject *arg, PyObject *kwarg)
+{
+    PyObject *surfaces, *file, *items;
+    struct MappedHeader header;
+    struct MappedEntry *entries = NULL;
+    const char **names = NULL;
+    SDL_Surface **surfs = NULL;
+    Uint8 **packed = NULL;
+    SDL_RWops *rw;
+    Py_ssize_t count, i, nprepped = 0;
+    Uint64 offset;
+    int compress = 0;
+    int result = -2;
+    static char *kwds[] = {"surfaces", "file", "compress", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "OO|p", kwds, &surfaces,
+                                     &file, &compress)) {
+        return NULL;
+    }
+
+    if (!PyMapping_Check(surfaces) || PySequence_Check(surfaces)) {
+        return RAISE(PyExc_TypeError,
+                     "surfaces must be a mapping of names to Surfaces");
+    }
+    items = PyMapping_Items(surfaces);
+    if (!items) {
+        return NULL;
+    }
+    count = PyList_GET_SIZE(items);
+    if (count > 0xFFFF) {
+        PyErr_SetString(PyExc_ValueError, "too many surfaces");
+        goto cleanup;
+    }
+
+    entries = PyMem_Calloc(count ? count : 1, sizeof(struct MappedEntry));
+    names = PyMem_Calloc(count ? count : 1, sizeof(char *));
+    surfs = PyMem_Calloc(count ? count : 1, sizeof(SDL_Surface *));
+    packed = PyMem_Calloc(count ? count : 1, sizeof(Uint8 *));
+    if (!entries || !names || !surfs || !packed) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, MAPPED_MAGIC, sizeof(header.magic));
+    header.byteorder = MAPPED_BYTEORDER;
+    header.version = MAPPED_VERSION;
+    header.count = (Uint32)count;
+    header.entry_size = sizeof(struct MappedEntry);
+
+    /* The names and palettes follow the entry table */
+    offset = sizeof(header) + sizeof(struct MappedEntry) * count;
+    for (i = 0; i < count; ++i) {
+        PyObject *key = PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 0);
+        PyObject *value = PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 1);
+        struct MappedEntry *e = &entries[i];
+        PG_PixelFormat *format;
+        SDL_Palette *palette;
+        SDL_BlendMode mode;
+        Py_ssize_t size;
+        Uint32 colorkey;
+        Uint8 alpha;
+
+        if (!PyUnicode_Check(key)) {
+            PyErr_SetString(PyExc_TypeError, "surface names must be strings");
+            goto cleanup;
+        }
+        if (!pgSurface_Check(value)) {
+            PyErr_Format(PyExc_TypeError,
+                         "expected a Surface for '%U', got %.200s", key,
+                         Py_TYPE(value)->tp_name);
+            goto cleanup;
+        }
+        surfs[i] = pgSurface_AsSurface(value);
+        if (!surfs[i]) {
+            PyErr_SetString(pgExc_SDLError, "display Surface quit");
+            goto cleanup;
+        }
+        names[i] = PyUnicode_AsUTF8AndSize(key, &size);
+        if (!names[i]) {
+            goto cleanup;
+        }
+        if (!PG_GetSurfaceDetails(surfs[i], &format, &palette)) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            goto cleanup;
+        }
+        if (PG_FORMAT_BitsPerPixel(format) < 8) {
+            PyErr_SetString(PyExc_ValueError,
+                            "cannot save surfaces with less than 8 bits "
+                            "per pixel");
+            goto cleanup;
+        }
+
+        e->width = surfs[i]->w;
+        e->height = surfs[i]->h;
+        e->pitch = surfs[i]->pitch;
+        e->bpp = PG_FORMAT_BitsPerPixel(format);
+        e->Rmask = format->Rmask;
+        e->Gmask = format->Gmask;
+        e->Bmask = format->Bmask;
+        e->Amask = format->Amask;
+        if (SDL_HasColorKey(surfs[i])) {
+            SDL_GetColorKey(surfs[i], &colorkey);
+            e->flags |= MAPPED_COLORKEY;
+            e->colorkey = colorkey;
+        }
+        if (PG_GetSurfaceBlendMode(surfs[i], &mode) &&
+            mode == SDL_BLENDMODE_BLEND) {
+            e->flags |= MAPPED_BLEND;
+        }
+        e->alpha = PG_GetSurfaceAlphaMod(surfs[i], &alpha) ? alpha : 255;
+
+        e->name_offset = offset;
+        e->name_size = (Uint32)size;
+        offset += (Uint64)size;
+        if (palette) {
+            e->palette_offset = offset = MAPPED_ALIGN(offset, 4);
+            e->palette_size = palette->ncolors;
+            offset += (Uint64)palette->ncolors * 4;
+        }
+    }
+
+    for (i = 0; i < count; ++i) {
+        pgSurface_Prep(
+            (pgSurfaceObject *)PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 1));
+        nprepped++;
+    }
+
+    /* Then the pixel data, page aligned unless it is compressed */
+    for (i = 0; i < count; ++i) {
+        struct MappedEntry *e = &entries[i];
+        int bpp = PG_SURF_BytesPerPixel(surfs[i]);
+        Uint64 size = 0;
+        int y;
+
+        if (compress) {
+            /* worst case, one packet header per pixel */
+            packed[i] = PyMem_Malloc(
+                (size_t)e->height * e->width * (bpp + 1) + 1);
+            if (!packed[i]) {
+                PyErr_NoMemory();
+                goto cleanup;
+            }
+            for (y = 0; y < (int)e->height; ++y) {
+                size += rle_line((Uint8 *)surfs[i]->pixels + y * e->pitch,
+                                 packed[i] + size, e->width, bpp);
+            }
+            e->flags |= MAPPED_RLE;
+            e->offset = offset = MAPPED_ALIGN(offset, 8);
+        }
+        else {
+            size = (Uint64)e->pitch * e->height;
+            e->offset = offset = MAPPED_ALIGN(offset, MAPPED_PAGE_SIZE);
+        }
+        e->size = size;
+        offset += size;
+    }
+
+    rw = pgRWops_FromObject(file, NULL);
+    if (!rw) {
+        goto cleanup;
+    }
+    Py_BEGIN_ALLOW_THREADS;
+    result = SaveMapped_RW(rw, &header, entries, names, surfs, packed);
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    if (!SDL_RWclose(rw) && !result) {
+#else
+    if (SDL_RWclose(rw) < 0 && !result) {
+#endif
+        result = -1;
+    }
+    Py_END_ALLOW_THREADS;
+
+cleanup:
+    for (i = 0; i < nprepped; ++i) {
+        pgSurface_Unprep(
+            (pgSurfaceObject *)PyTuple_GET_ITEM(PyList_GET_ITEM(items, i), 1));
+    }
+    if (packed) {
+        for (i = 0; i < count; ++i) {
+            PyMem_Free(packed[i]);
+        }
+    }
+    PyMem_Free(entries);
+    PyMem_Free(names);
+    PyMem_Free(surfs);
+    PyMem_Free(packed);
+    Py_DECREF(items);
+
+    if (result == -2) {
+        /* Python error raised elsewhere */
+        return NULL;
+    }
+    if (result == -1) {
+        return RAISE(pgExc_SDLError, SDL_GetError());
+    }
+    Py_RETURN_NONE;
+}
+
+static inline int
+mapped_in_bounds(Uint64 offset, Uint64 size, Uint64 len)
+{
+    return offset <= len && size <= len - offset;
+}
+
+/* Make the surface for one entry of a mapped surface file, validated
+ * against the len bytes of the file at data. Uncompressed pixels are used
+ * in place. */
+static SDL_Surface *
+mapped_entry_surface(struct MappedEntry *e, Uint8 *data, Uint64 len)
+{
+    PG_PixelFormatEnum format;
+    SDL_Surface *surf;
+    SDL_Palette *palette;
+    Uint64 rowsize, needed, in = 0;
+    Sint64 used;
+    int bpp, y;
+    Uint32 c;
+
+    format = SDL_MasksToPixelFormatEnum(e->bpp, e->Rmask, e->Gmask, e->Bmask,
+                                        e->Amask);
+    if (format == SDL_PIXELFORMAT_UNKNOWN || e->width > INT_MAX ||
+        e->height > INT_MAX || e->pitch > INT_MAX) {
+        SDL_SetError("unsupported surface in mapped surface file");
+        return NULL;
     }
+    bpp = SDL_BYTESPERPIXEL(format);
+    rowsize = (Uint64)e->width * bpp;
 
-    if (srcbpp == 8) {
-        h.has_cmap = 1;
-        h.type = TGA_TYPE_INDEXED;
-        if (have_surf_colorkey) {
-            h.cmap_bits = 32;
+    if (e->flags & MAPPED_RLE) {
+        if (!mapped_in_bounds(e->offset, e->size, len)) {
+            SDL_SetError("mapped surface file is truncated");
+            return NULL;
         }
-        else {
-            h.cmap_bits = 24;
+        surf = PG_CreateSurface(e->width, e->height, format);
+        if (!surf) {
+            return NULL;
+        }
+        for (y = 0; y < (int)e->height; ++y) {
+            used = unrle_line(data + e->offset + in, e->size - in,
+                              (Uint8 *)surf->pixels + y * surf->pitch,
+                              e->width, bpp);
+            if (used < 0) {
+                SDL_FreeSurface(surf);
+                SDL_SetError("corrupt pixel data in mapped surface file");
+                return NULL;
+            }
+            in += used;
         }
-        SETLE16(h.cmap_len, surf_palette->ncolors);
-        h.pixel_bits = 8;
-        output_format = SDL_PIXELFORMAT_INDEX8;
     }
     else {
-        h.has_cmap = 0;
-        h.type = TGA_TYPE_RGB;
-        h.cmap_bits = 0;
-        SETLE16(h.cmap_len, 0);
-        if (surf_format->Amask) {
-            alpha = 1;
-            h.pixel_bits = 32;
-            output_format = SDL_PIXELFORMAT_BGRA32;
+        needed = e->height ? (Uint64)e->pitch * (e->height - 1) + rowsize : 0;
+        if (e->pitch < rowsize || e->size < needed ||
+            !mapped_in_bounds(e->offset, needed, len)) {
+            SDL_SetError("mapped surface file is truncated");
+            return NULL;
         }
-        else {
-            h.pixel_bits = 24;
-            output_format = SDL_PIXELFORMAT_BGR24;
+        surf = PG_CreateSurfaceFrom(e->width, e->height, format,
+                                    data + e->offset, e->pitch);
+        if (!surf) {
+            return NULL;
         }
     }
-    bpp = h.pixel_bits >> 3;
-    if (rle) {
-        h.type += TGA_TYPE_RLE;
-    }
-
-    SETLE16(h.yorigin, 0);
-    SETLE16(h.xorigin, 0);
-    SETLE16(h.width, surface->w);
-    SETLE16(h.height, surface->h);
-    h.flags = TGA_ORIGIN_UPPER | (alpha ? 8 : 0);
 
+    if (SDL_ISPIXELFORMAT_INDEXED(format) && e->palette_size) {
 #if SDL_VERSION_ATLEAST(3, 0, 0)
-    if (!SDL_WriteIO(out, &h, sizeof(h)))
-#else
-    if (!SDL_RWwrite(out, &h, sizeof(h), 1))
-#endif
-        return -1;
-
-    if (h.has_cmap) {
-        int i;
-        Uint8 entry[4];
-        for (i = 0; i < surf_palette->ncolors; i++) {
-            entry[0] = surf_palette->colors[i].b;
-            entry[1] = surf_palette->colors[i].g;
-            entry[2] = surf_palette->colors[i].r;
-            entry[3] = ((unsigned)i == surf_colorkey) ? 0 : 0xff;
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-            if (!SDL_WriteIO(out, entry, h.cmap_bits >> 3))
+        palette = SDL_CreateSurfacePalette(surf);
 #else
-            if (!SDL_RWwrite(out, entry, h.cmap_bits >> 3, 1))
+        palette = surf->format->palette;
 #endif
-                return -1;
+        if (!palette || !mapped_in_bounds(e->palette_offset,
+                                          (Uint64)e->palette_size * 4, len)) {
+            SDL_FreeSurface(surf);
+            SDL_SetError("mapped surface file is truncated");
+            return NULL;
+        }
+        for (c = 0; c < e->palette_size && c < (Uint32)palette->ncolors;
+             ++c) {
+            Uint8 *rgba = data + e->palette_offset + c * 4;
+            SDL_Color color = {rgba[0], rgba[1], rgba[2], rgba[3]};
+            if (!PG_SetPaletteColors(palette, &color, c, 1)) {
+                SDL_FreeSurface(surf);
+                return NULL;
+            }
         }
     }
 
-    linebuf = PG_CreateSurface(surface->w, 1, output_format);
-    if (!linebuf) {
-        return -1;
+    if (e->flags & MAPPED_COLORKEY) {
+        PG_SetSurfaceColorKey(surf, SDL_TRUE, e->colorkey);
     }
+    PG_SetSurfaceBlendMode(surf, (e->flags & MAPPED_BLEND)
+                                     ? SDL_BLENDMODE_BLEND
+                                     : SDL_BLENDMODE_NONE);
+    PG_SetSurfaceAlphaMod(surf, (Uint8)e->alpha);
+    return surf;
+}
 
-    if (h.has_cmap) {
-        if (!PG_SetSurfacePalette(linebuf, surf_palette)) {
-            goto error; /* SDL error already set. */
+static PyObject *
+image_load_mapped(PyObject *self, PyObject *arg, PyObject *kwarg)
+{
+    PyObject *file, *fileobj, *module, *func, *access;
+    PyObject *mapping = NULL, *view = NULL, *ret = NULL;
+    struct MappedHeader header;
+    struct MappedEntry entry;
+    Uint8 *data;
+    Uint64 len;
+    Uint32 i;
+    int fd;
+    static char *kwds[] = {"file", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O", kwds, &file)) {
+        return NULL;
+    }
+
+    /* Paths are opened here, anything else must have a fileno() */
+    if (PyUnicode_Check(file) || PyBytes_Check(file) ||
+        PyObject_HasAttrString(file, "__fspath__")) {
+        module = PyImport_ImportModule("io");
+        if (!module) {
+            return NULL;
+        }
+        fileobj = PyObject_CallMethod(module, "open", "Os", file, "rb");
+        Py_DECREF(module);
+        if (!fileobj) {
+            return NULL;
+        }
+    }
+    else {
+        Py_INCREF(file);
+        fileobj = file;
+    }
+
+    fd = PyObject_AsFileDescriptor(fileobj);
+    if (fd != -1) {
+        /* mmap.mmap(fd, 0, access=mmap.ACCESS_COPY) */
+        module = PyImport_ImportModule("mmap");
+        if (module) {
+            func = PyObject_GetAttrString(module, "mmap");
+            access = PyObject_GetAttrString(module, "ACCESS_COPY");
+            if (func && access) {
+                PyObject *args = Py_BuildValue("(ii)", fd, 0);
+                PyObject *kwargs = Py_BuildValue("{sO}", "access", access);
+                if (args && kwargs) {
+                    mapping = PyObject_Call(func, args, kwargs);
+                }
+                Py_XDECREF(args);
+                Py_XDECREF(kwargs);
+            }
+            Py_XDECREF(func);
+            Py_XDECREF(access);
+            Py_DECREF(module);
+        }
+    }
+    if (fileobj != file) {
+        /* the mapping stays valid after the file is closed */
+        PyObject *closed = PyObject_CallMethod(fileobj, "close", NULL);
+        if (!closed) {
+            Py_CLEAR(mapping);
         }
+        Py_XDECREF(closed);
+    }
+    Py_DECREF(fileobj);
+    if (!mapping) {
+        return NULL;
     }
 
-    if (rle) {
-        rlebuf = malloc(bpp * surface->w + 1 + surface->w / TGA_RLE_MAX);
-        if (!rlebuf) {
-            SDL_SetError("out of memory");
+    /* The memoryview keeps the mapping exported, so it cannot be closed
+     * while surfaces point into it */
+    view = PyMemoryView_FromObject(mapping);
+    Py_DECREF(mapping);
+    if (!view) {
+        return NULL;
+    }
+    data = (Uint8 *)PyMemoryView_GET_BUFFER(view)->buf;
+    len = (Uint64)PyMemoryView_GET_BUFFER(view)->len;
+
+    if (len >= sizeof(header)) {
+        memcpy(&header, data, sizeof(header));
+    }
+    if (len < sizeof(header) ||
+        memcmp(header.magic, MAPPED_MAGIC, sizeof(header.magic))) {
+        PyErr_SetString(pgExc_SDLError, "not a mapped surface file");
+        goto error;
+    }
+    if (header.byteorder != MAPPED_BYTEORDER) {
+        PyErr_SetString(pgExc_SDLError,
+                        "mapped surface file was written with a different "
+                        "byte order");
+        goto error;
+    }
+    if (header.version != MAPPED_VERSION ||
+        header.entry_size < sizeof(entry)) {
+        PyErr_Format(pgExc_SDLError,
+                     "unsupported mapped surface file version %u",
+                     (unsigned int)header.version);
+        goto error;
+    }
+    if ((Uint64)header.entry_size * header.count > len - sizeof(header)) {
+        PyErr_SetString(pgExc_SDLError, "mapped surface file is truncated");
+        goto error;
+    }
+
+    ret = PyDict_New();
+    if (!ret) {
+        goto error;
+    }
+    for (i = 0; i < header.count; ++i) {
+        PyObject *name;
+        pgSurfaceObject *surfobj;
+        SDL_Surface *surf;
+        int status;
+
+        memcpy(&entry, data + sizeof(header) + (Uint64)i * header.entry_size,
+               sizeof(entry));
+        if (!mapped_in_bounds(entry.name_offset, entry.name_size, len)) {
+            PyErr_SetString(pgExc_SDLError,
+                            "mapped surface file is truncated");
+            goto error;
+        }
+        name = PyUnicode_DecodeUTF8((char *)data + entry.name_offset,
+                                    entry.name_size, NULL);
+        if (!name) {
+            goto error;
+        }
+        surf = mapped_entry_surface(&entry, data, len);
+        if (!surf) {
+            Py_DECREF(name);
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            goto error;
+        }
+        surfobj = pgSurface_New(surf);
+        if (!surfobj) {
+            Py_DECREF(name);
+            SDL_FreeSurface(surf);
+            goto error;
+        }
+        if (!(entry.flags & MAPPED_RLE)) {
+            Py_INCREF(view);
+            surfobj->dependency = view;
+        }
+        status = PyDict_SetItem(ret, name, (PyObject *)surfobj);
+        Py_DECREF(name);
+        Py_DECREF(surfobj);
+        if (status) {
             goto error;
         }
     }
+    Py_DECREF(view);
+    return ret;
 
-    /* Temporarily remove colorkey and alpha from surface so copies are
-       opaque */
-    SDL_SetSurfaceAlphaMod(surface, SDL_ALPHA_OPAQUE);
-    if (have_surf_colorkey) {
-        SDL_SetColorKey(surface, SDL_FALSE, surf_colorkey);
+error:
+    Py_XDECREF(ret);
+    Py_DECREF(view);
+    return NULL;
+}
+
+/* A segment of the skyline used to pack atlases: the top of the packed
+ * area from x to x + width is at height y. */
+struct AtlasSkyline {
+    int x, y, width;
+};
+
+/* Sort atlas items by decreasing height, then width */
+static int
+atlas_compare(const void *a, const void *b)
+{
+    const SDL_Rect *ra = *(const SDL_Rect *const *)a;
+    const SDL_Rect *rb = *(const SDL_Rect *const *)b;
+
+    if (ra->h != rb->h) {
+        return rb->h - ra->h;
     }
+    return rb->w - ra->w;
+}
 
-    r.x = 0;
-    r.w = surface->w;
-    r.h = 1;
-    for (r.y = 0; r.y < surface->h; r.y++) {
-        int n;
-        void *buf;
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-        if (!SDL_BlitSurface(surface, &r, linebuf, NULL))
-#else
-        if (SDL_BlitSurface(surface, &r, linebuf, NULL) < 0)
-#endif
+/* Find the bottom-left-most place for a w by h box on the skyline. Returns
+ * the index of the segment it starts on, or -1 if it does not fit. */
+static int
+atlas_find_position(struct AtlasSkyline *line, int nlines, int w, int h,
+                    int max_w, int max_h, int *pos_y)
+{
+    int best = -1, best_top = INT_MAX, best_width = INT_MAX;
+    int i, j, y, remaining;
+
+    for (i = 0; i < nlines; ++i) {
+        if (line[i].x + w > max_w) {
             break;
-        if (rle) {
-            buf = rlebuf;
-            n = rle_line(linebuf->pixels, rlebuf, surface->w, bpp);
         }
-        else {
-            buf = linebuf->pixels;
-            n = surface->w * bpp;
+        /* the box rests on the highest segment below it */
+        y = line[i].y;
+        remaining = w;
+        for (j = i; remaining > 0; ++j) {
+            if (line[j].y > y) {
+                y = line[j].y;
+            }
+            remaining -= line[j].width;
         }
-#if SDL_VERSION_ATLEAST(3, 0, 0)
-        if (!SDL_WriteIO(out, buf, n))
-#else
-        if (!SDL_RWwrite(out, buf, n, 1))
-#endif
+        if (y + h > max_h) {
+            continue;
+        }
+        if (y + h < best_top ||
+            (y + h == best_top && line[i].width < best_width)) {
+            best = i;
+            best_top = y + h;
+            best_width = line[i].width;
+            *pos_y = y;
+        }
+    }
+    return best;
+}
+
+/* Raise the skyline over a box placed on segment index. Returns the new
+ * number of segments. */
+static int
+atlas_add_box(struct AtlasSkyline *line, int nlines, int index, int w,
+              int top)
+{
+    int x = line[index].x, i, shrink;
+
+    memmove(line + index + 1, line + index,
+            sizeof(*line) * (size_t)(nlines - index));
+    line[index].x = x;
+    line[index].y = top;
+    line[index].width = w;
+    nlines++;
+
+    /* trim the segments that are now below the box */
+    for (i = index + 1; i < nlines; ++i) {
+        if (line[i].x >= x + w) {
+            break;
+        }
+        shrink = x + w - line[i].x;
+        line[i].x += shrink;
+        line[i].width -= shrink;
+        if (line[i].width > 0) {
             break;
+        }
+        memmove(line + i, line + i + 1,
+                sizeof(*line) * (size_t)(nlines - i - 1));
+        nlines--;
+        i--;
     }
 
-    /* restore flags */
-    SDL_SetSurfaceAlphaMod(surface, surf_alpha);
-    if (have_surf_colorkey) {
-        SDL_SetColorKey(surface, SDL_TRUE, surf_colorkey);
+    /* merge neighbours of equal height */
+    for (i = 0; i < nlines - 1; ++i) {
+        if (line[i].y == line[i + 1].y) {
+            line[i].width += line[i + 1].width;
+            memmove(line + i + 1, line + i + 2,
+                    sizeof(*line) * (size_t)(nlines - i - 2));
+            nlines--;
+            i--;
+        }
     }
+    return nlines;
+}
 
-    free(rlebuf);
-    SDL_FreeSurface(linebuf);
-    return 0;
+/* Place count boxes of the sizes in rects (padding included) within max_w
+ * by max_h, bottom-left first, filling in their positions. Returns -1 if
+ * they do not all fit. */
+static int
+atlas_pack(SDL_Rect *rects, int count, int max_w, int max_h)
+{
+    struct AtlasSkyline *line;
+    SDL_Rect **order;
+    int nlines = 1, i, index, y;
+    int result = 0;
+
+    line = PyMem_Malloc(sizeof(*line) * ((size_t)count + 2));
+    order = PyMem_Malloc(sizeof(*order) * ((size_t)count + 1));
+    if (!line || !order) {
+        PyMem_Free(line);
+        PyMem_Free(order);
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < count; ++i) {
+        order[i] = &rects[i];
+    }
+    qsort(order, count, sizeof(*order), atlas_compare);
 
-error:
-    free(rlebuf);
-    SDL_FreeSurface(linebuf);
-    return -1;
+    line[0].x = 0;
+    line[0].y = 0;
+    line[0].width = max_w;
+    for (i = 0; i < count; ++i) {
+        SDL_Rect *r = order[i];
+
+        if (!r->w || !r->h) {
+            r->x = r->y = 0;
+            continue;
+        }
+        index = atlas_find_position(line, nlines, r->w, r->h, max_w, max_h,
+                                    &y);
+        if (index < 0) {
+            PyErr_SetString(PyExc_ValueError,
+                            "surfaces do not fit in an atlas of max_size");
+            result = -1;
+            break;
+        }
+        r->x = line[index].x;
+        r->y = y;
+        nlines = atlas_add_box(line, nlines, index, r->w, y + r->h);
+    }
+
+    PyMem_Free(line);
+    PyMem_Free(order);
+    return result;
 }
 
+/* Whether the pixel values of src mean the same colors in dst, which only
+ * differ for indexed surfaces with different palettes */
 static int
-SaveTGA(SDL_Surface *surface, const char *file, int rle)
+atlas_same_palette(SDL_Surface *src, SDL_Surface *dst)
 {
-    SDL_RWops *out = SDL_RWFromFile(file, "wb");
-    int ret;
-    if (!out) {
-        return -1;
+    SDL_Palette *a = PG_GetSurfacePalette(src);
+    SDL_Palette *b = PG_GetSurfacePalette(dst);
+
+    if (!SDL_ISPIXELFORMAT_INDEXED(PG_SURF_FORMATENUM(src)) || a == b) {
+        return 1;
     }
-    ret = SaveTGA_RW(surface, out, rle);
-    SDL_RWclose(out);
+    return a && b && a->ncolors == b->ncolors &&
+           !memcmp(a->colors, b->colors, a->ncolors * sizeof(SDL_Color));
+}
+
+static PyObject *
+image_pack_atlas(PyObject *self, PyObject *arg, PyObject *kwarg)
+{
+    PyObject *surfacesobj, *seq, *sizeobj = NULL;
+    PyObject *atlasobj = NULL, *subsurfaces = NULL, *rectlist = NULL;
+    PyObject *ret = NULL;
+    SDL_Surface *atlas, *src, *converted;
+    SDL_Rect *rects = NULL;
+    Py_ssize_t count, i;
+    int max_w = 4096, max_h = 4096, padding = 0;
+    int width = 0, height = 0, y;
+    Uint32 colorkey;
+    static char *kwds[] = {"surfaces", "max_size", "padding", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(arg, kwarg, "O|Oi", kwds, &surfacesobj,
+                                     &sizeobj, &padding)) {
+        return NULL;
+    }
+    if (sizeobj && !pg_TwoIntsFromObj(sizeobj, &max_w, &max_h)) {
+        return RAISE(PyExc_TypeError, "max_size must be two numbers");
+    }
+    if (max_w <= 0 || max_h <= 0) {
+        return RAISE(PyExc_ValueError,
+                     "both components of max_size must be positive");
+    }
+    if (padding < 0) {
+        return RAISE(PyExc_ValueError, "padding must not be negative");
+    }
+    if (padding > INT_MAX - MAX(max_w, max_h)) {
+        return RAISE(PyExc_ValueError, "padding too large");
+    }
+
+    seq = PySequence_Fast(surfacesobj, "surfaces must be a sequence");
+    if (!seq) {
+        return NULL;
+    }
+    count = PySequence_Fast_GET_SIZE(seq);
+    if (!count) {
+        PyErr_SetString(PyExc_ValueError, "surfaces must not be empty");
+        goto cleanup;
+    }
+    if (count > INT_MAX / 2) {
+        PyErr_SetString(PyExc_ValueError, "too many surfaces");
+        goto cleanup;
+    }
+
+    rects = PyMem_Malloc(sizeof(SDL_Rect) * count);
+    if (!rects) {
+        PyErr_NoMemory();
+        goto cleanup;
+    }
+    for (i = 0; i < count; ++i) {
+        PyObject *item = PySequence_Fast_GET_ITEM(seq, i);
+
+        if (!pgSurface_Check(item)) {
+            PyErr_Format(PyExc_TypeError,
+                         "surfaces must be Surfaces, not %.200s",
+                         Py_TYPE(item)->tp_name);
+            goto cleanup;
+        }
+        src = pgSurface_AsSurface(item);
+        if (!src) {
+            PyErr_SetString(pgExc_SDLError, "display Surface quit");
+            goto cleanup;
+        }
+        if (src->w > INT_MAX - padding || src->h > INT_MAX - padding) {
+            PyErr_SetString(PyExc_ValueError, "surface too large");
+            goto cleanup;
+        }
+        /* padding is kept to the right of and below every surface, empty
+         * ones take no space */
+        rects[i].w = src->w;
+        rects[i].h = src->h;
+        if (src->w && src->h) {
+            rects[i].w += padding;
+            rects[i].h += padding;
+        }
+    }
+
+    if (atlas_pack(rects, (int)count, max_w + padding, max_h + padding)) {
+        goto cleanup;
+    }
+    for (i = 0; i < count; ++i) {
+        if (rects[i].w && rects[i].h) {
+            rects[i].w -= padding;
+            rects[i].h -= padding;
+        }
+        width = MAX(width, rects[i].x + rects[i].w);
+        height = MAX(height, rects[i].y + rects[i].h);
+    }
+
+    /* The atlas takes the pixel format, colorkey and blending of the first
+     * surface */
+    src = pgSurface_AsSurface(PySequence_Fast_GET_ITEM(seq, 0));
+    atlas = PG_CreateSurface(width, height, PG_SURF_FORMATENUM(src));
+    if (!atlas) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        goto cleanup;
+    }
+    atlasobj = (PyObject *)pgSurface_New(atlas);
+    if (!atlasobj) {
+        SDL_FreeSurface(atlas);
+        goto cleanup;
+    }
+    if (SDL_ISPIXELFORMAT_INDEXED(PG_SURF_FORMATENUM(src)) &&
+        !PG_SetSurfacePalette(atlas, PG_GetSurfacePalette(src))) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        goto cleanup;
+    }
+    if (SDL_HasColorKey(src)) {
+        SDL_GetColorKey(src, &colorkey);
+        /* leave the gaps transparent */
+        if (!PG_SetSurfaceColorKey(atlas, SDL_TRUE, colorkey) ||
+            !PG_FillSurfaceRect(atlas, NULL, colorkey)) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            goto cleanup;
+        }
+    }
+    else {
+        SDL_BlendMode mode;
+        if (PG_GetSurfaceBlendMode(src, &mode)) {
+            PG_SetSurfaceBlendMode(atlas, mode);
+        }
+    }
+
+    subsurfaces = PyList_New(count);
+    rectlist = PyList_New(count);
+    if (!subsurfaces || !rectlist) {
+        goto cleanup;
+    }
+    for (i = 0; i < count; ++i) {
+        PyObject *item = PySequence_Fast_GET_ITEM(seq, i);
+        SDL_Rect *r = &rects[i];
+        PyObject *obj;
+        int bpp = PG_SURF_BytesPerPixel(atlas);
+
+        src = pgSurface_AsSurface(item);
+        if (r->w && r->h) {
+            /* Copy the pixels as they are, converting them only when the
+             * formats, or the palettes of indexed ones, differ */
+            if (PG_SURF_FORMATENUM(src) == PG_SURF_FORMATENUM(atlas) &&
+                atlas_same_palette(src, atlas)) {
+                converted = NULL;
+                if (!pgSurface_Lock((pgSurfaceObject *)item)) {
+                    goto cleanup;
+                }
+            }
+            else {
+                converted = PG_ConvertSurface(src, atlas->format);
+                if (!converted) {
+                    PyErr_SetString(pgExc_SDLError, SDL_GetError());
+                    goto cleanup;
+                }
+                src = converted;
+            }
+            for (y = 0; y < r->h; ++y) {
+                memcpy((Uint8 *)atlas->pixels + (r->y + y) * atlas->pitch +
+                           r->x * bpp,
+                       (Uint8 *)src->pixels + y * src->pitch,
+                       (size_t)r->w * bpp);
+            }
+            if (converted) {
+                SDL_FreeSurface(converted);
+            }
+            else {
+                pgSurface_Unlock((pgSurfaceObject *)item);
+            }
+        }
+
+        obj = PyObject_CallMethod(atlasobj, "subsurface", "((iiii))", r->x,
+                                  r->y, r->w, r->h);
+        if (!obj) {
+            goto cleanup;
+        }
+        PyList_SET_ITEM(subsurfaces, i, obj);
+        obj = pgRect_New4(r->x, r->y, r->w, r->h);
+        if (!obj) {
+            goto cleanup;
+        }
+        PyList_SET_ITEM(rectlist, i, obj);
+    }
+
+    ret = PyTuple_Pack(3, atlasobj, subsurfaces, rectlist);
+
+cleanup:
+    Py_XDECREF(atlasobj);
+    Py_XDECREF(subsurfaces);
+    Py_XDECREF(rectlist);
+    PyMem_Free(rects);
+    Py_DECREF(seq);
     return ret;
 }
 
@@ -1900,6 +3287,10 @@ static PyMethodDef _image_methods[] = {
      METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_LOADEXTENDED},
     {"load", (PyCFunction)image_load, METH_VARARGS | METH_KEYWORDS,
      DOC_IMAGE_LOAD},
+    {"load_many", (PyCFunction)image_load_many, METH_VARARGS | METH_KEYWORDS,
+     DOC_IMAGE_LOADMANY},
+    {"load_async", (PyCFunction)image_load_async,
+     METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_LOADASYNC},
     {"load_sized_svg", (PyCFunction)image_load_sized_svg,
      METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_LOADSIZEDSVG},
     {"load_animation", (PyCFunction)image_load_animation,
@@ -1918,12 +3309,22 @@ static PyMethodDef _image_methods[] = {
      DOC_IMAGE_TOSTRING},
     {"tobytes", (PyCFunction)image_tobytes, METH_VARARGS | METH_KEYWORDS,
      DOC_IMAGE_TOBYTES},
+    {"tobytes_into", (PyCFunction)image_tobytes_into,
+     METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_TOBYTESINTO},
     {"fromstring", (PyCFunction)image_fromstring, METH_VARARGS | METH_KEYWORDS,
      DOC_IMAGE_FROMSTRING},
     {"frombytes", (PyCFunction)image_frombytes, METH_VARARGS | METH_KEYWORDS,
      DOC_IMAGE_FROMBYTES},
     {"frombuffer", (PyCFunction)image_frombuffer, METH_VARARGS | METH_KEYWORDS,
      DOC_IMAGE_FROMBUFFER},
+    {"load_mapped", (PyCFunction)image_load_mapped,
+     METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_LOADMAPPED},
+    {"save_async", (PyCFunction)image_save_async,
+     METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_SAVEASYNC},
+    {"save_mapped", (PyCFunction)image_save_mapped,
+     METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_SAVEMAPPED},
+    {"pack_atlas", (PyCFunction)image_pack_atlas,
+     METH_VARARGS | METH_KEYWORDS, DOC_IMAGE_PACKATLAS},
     {NULL, NULL, 0, NULL}};
 
 MODINIT_DEFINE(image)
@@ -1956,6 +3357,13 @@ MODINIT_DEFINE(image)
     if (PyErr_Occurred()) {
         return NULL;
     }
+    import_pygame_rect();
+    if (PyErr_Occurred()) {
+        return NULL;
+    }
+
+    image_has_avx2 = SDL_HasAVX2();
+    image_has_sse2 = SDL_HasSSE2() || SDL_HasNEON();
 
     /* create the module */
     module = PyModule_Create(&_module);
@@ -1989,6 +3397,28 @@ MODINIT_DEFINE(image)
         if (!ext_load_animation) {
             goto error;
         }
+        PyObject *decode_capsule =
+            PyObject_GetAttrString(extmodule, "_decode_rw");
+        if (!decode_capsule) {
+            goto error;
+        }
+        ext_decode_rw = (SDL_Surface * (*)(SDL_RWops *, const char *))
+            PyCapsule_GetPointer(decode_capsule, "pygame.imageext._decode_rw");
+        Py_DECREF(decode_capsule);
+        if (!ext_decode_rw) {
+            goto error;
+        }
+        PyObject *encode_capsule =
+            PyObject_GetAttrString(extmodule, "_encode_rw");
+        if (!encode_capsule) {
+            goto error;
+        }
+        ext_encode_rw = (int (*)(SDL_Surface *, SDL_RWops *, const char *))
+            PyCapsule_GetPointer(encode_capsule, "pygame.imageext._encode_rw");
+        Py_DECREF(encode_capsule);
+        if (!ext_encode_rw) {
+            goto error;
+        }
         Py_DECREF(extmodule);
     }
     else {
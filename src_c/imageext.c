@@ -155,6 +155,44 @@ image_load_ext(PyObject *self, PyObject *arg, PyObject *kwarg)
     return final;
 }
 
+/* Decode an image from rw and close it. This is handed to the image module
+ * in a capsule for the load_many workers, so it must not touch Python
+ * state. */
+static SDL_Surface *
+iext_decode_rw(SDL_RWops *rw, const char *type)
+{
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    return IMG_LoadTyped_IO(rw, 1, type);
+#else
+    return IMG_LoadTyped_RW(rw, 1, type);
+#endif
+}
+
+/* Encode surf as a PNG or JPEG (picked by the file extension type) to rw,
+ * which is left open. Like iext_decode_rw this is handed to the image
+ * module in a capsule, for the save_async worker. Returns 0 on success, -1
+ * with the SDL error set otherwise. */
+static int
+iext_encode_rw(SDL_Surface *surf, SDL_RWops *rw, const char *type)
+{
+    if (!strcasecmp(type, "jpeg") || !strcasecmp(type, "jpg")) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+        return IMG_SaveJPG_IO(surf, rw, 0, JPEG_QUALITY) ? 0 : -1;
+#else
+        return IMG_SaveJPG_RW(surf, rw, 0, JPEG_QUALITY) == 0 ? 0 : -1;
+#endif
+    }
+    if (!strcasecmp(type, "png")) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+        return IMG_SavePNG_IO(surf, rw, 0) ? 0 : -1;
+#else
+        return IMG_SavePNG_RW(surf, rw, 0) == 0 ? 0 : -1;
+#endif
+    }
+    SDL_SetError("Unrecognized image type");
+    return -1;
+}
+
 static PyObject *
 imageext_load_sized_svg(PyObject *self, PyObject *arg, PyObject *kwargs)
 {
@@ -440,6 +478,8 @@ static PyMethodDef _imageext_methods[] = {
 
 MODINIT_DEFINE(imageext)
 {
+    PyObject *module, *capsule;
+
     static struct PyModuleDef _module = {PyModuleDef_HEAD_INIT,
                                          "imageext",
                                          _imageext_doc,
@@ -478,5 +518,22 @@ MODINIT_DEFINE(imageext)
     */
 
     /* create the module */
-    return PyModule_Create(&_module);
+    module = PyModule_Create(&_module);
+    if (module == NULL) {
+        return NULL;
+    }
+
+    capsule = PyCapsule_New((void *)iext_decode_rw,
+                            "pygame.imageext._decode_rw", NULL);
+    if (PyModule_Add(module, "_decode_rw", capsule)) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    capsule = PyCapsule_New((void *)iext_encode_rw,
+                            "pygame.imageext._encode_rw", NULL);
+    if (PyModule_Add(module, "_encode_rw", capsule)) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
 }
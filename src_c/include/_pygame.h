@@ -310,6 +310,7 @@ typedef struct {
  * SURFACE module
  */
 struct pgSubSurface_Data;
+struct pgBlitCache;
 struct SDL_Surface;
 
 typedef struct {
@@ -320,6 +321,8 @@ typedef struct {
     PyObject *weakreflist;
     PyObject *locklist;
     PyObject *dependency;
+    Uint64 generation; /* bumped by writes, see pgSurface_Touch */
+    struct pgBlitCache *blitcache; /* slow blit tracking, see surface.c */
 } pgSurfaceObject;
 #define pgSurface_AsSurface(x) (((pgSurfaceObject *)x)->surf)
 
@@ -340,6 +343,9 @@ typedef struct {
     (*(int (*)(pgSurfaceObject *, pgSurfaceObject *, SDL_Rect *, SDL_Rect *, \
                int))PYGAMEAPI_GET_SLOT(surface, 2))
 
+#define pgSurface_PremulAlpha                     \
+    (*(int (*)(SDL_Surface *, SDL_Surface *))PYGAMEAPI_GET_SLOT(surface, 4))
+
 #define import_pygame_surface()         \
     do {                                \
         IMPORT_PYGAME_MODULE(surface);  \
@@ -412,6 +418,9 @@ typedef struct pgEventObject pgEventObject;
 #define pgEvent_GetMouseButtonUpInfo \
     (*(char *(*)(void))PYGAMEAPI_GET_SLOT(event, 9))
 
+#define pgEvent_GetDict \
+    (*(PyObject * (*)(PyObject *)) PYGAMEAPI_GET_SLOT(event, 10))
+
 #define import_pygame_event() IMPORT_PYGAME_MODULE(event)
 #endif
 
@@ -542,6 +551,11 @@ typedef struct {
     pgWindowObject *window;
     pgTextureObject *target;
     SDL_bool _is_borrowed;
+    PyObject *mirrors; /* surfaces blitted, see renderer_surface_mirror */
+    Uint64 upload_bytes; /* uploaded by mirrors since the last present */
+    int uploads;
+    Uint64 last_upload_bytes; /* the same, for the frame before */
+    int last_uploads;
 } pgRendererObject;
 
 struct pgTextureObject {
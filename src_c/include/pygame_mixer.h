@@ -34,6 +34,7 @@ typedef struct {
     PyObject_HEAD Mix_Chunk *chunk;
     Uint8 *mem;
     PyObject *weakreflist;
+    Py_buffer *source; /* the buffer played from, for Sound(copy=False) */
 } pgSoundObject;
 
 typedef struct {
@@ -64,6 +65,13 @@ PYGAMEAPI_DEFINE_SLOTS(mixer);
 
 #define pgChannel_New (*(PyObject * (*)(int)) PYGAMEAPI_GET_SLOT(mixer, 4))
 
+#define pgStreamChannel_Type (*(PyTypeObject *)PYGAMEAPI_GET_SLOT(mixer, 5))
+#define pgStreamChannel_Check(x) \
+    (PyObject_IsInstance(x, (PyObject *)&pgStreamChannel_Type))
+
+#define pgStreamChannel_Push                      \
+    (*(int (*)(PyObject *, const void *, int))PYGAMEAPI_GET_SLOT(mixer, 6))
+
 #define import_pygame_mixer() _IMPORT_PYGAME_MODULE(mixer)
 
 #endif /* PYGAMEAPI_MIXER_INTERNAL */
@@ -34,6 +34,11 @@
 
 #define PyBUF_HAS_FLAG(f, F) (((f) & (F)) == (F))
 
+/* A Sound made with copy=False from a read-only buffer must stay read-only */
+#define SND_READONLY(x)                        \
+    (((pgSoundObject *)(x))->source != NULL && \
+     ((pgSoundObject *)(x))->source->readonly)
+
 #define CHECK_CHUNK_VALID(CHUNK, RET)                                      \
     if ((CHUNK) == NULL) {                                                 \
         PyErr_SetString(PyExc_RuntimeError,                                \
@@ -81,6 +86,7 @@ sound_init(PyObject *, PyObject *, PyObject *);
 
 static PyTypeObject pgSound_Type;
 static PyTypeObject pgChannel_Type;
+static PyTypeObject pgEffect_Type;
 static PyObject *
 pgSound_New(Mix_Chunk *);
 static PyObject *
@@ -88,11 +94,14 @@ pgChannel_New(int);
 #define pgSound_Check(x) (PyObject_IsInstance(x, (PyObject *)&pgSound_Type))
 #define pgChannel_Check(x) \
     (PyObject_IsInstance(x, (PyObject *)&pgChannel_Type))
+#define pgEffect_Check(x) (PyObject_IsInstance(x, (PyObject *)&pgEffect_Type))
 
 static int
 snd_getbuffer(PyObject *, Py_buffer *, int);
 static void
 snd_releasebuffer(PyObject *, Py_buffer *);
+static int
+_chunk_from_buf(const void *, Py_ssize_t, Mix_Chunk **, Uint8 **);
 
 static int request_frequency = PYGAME_MIXER_DEFAULT_FREQUENCY;
 static int request_size = PYGAME_MIXER_DEFAULT_SIZE;
@@ -101,17 +110,145 @@ static int request_chunksize = PYGAME_MIXER_DEFAULT_CHUNKSIZE;
 static int request_allowedchanges = PYGAME_MIXER_DEFAULT_ALLOWEDCHANGES;
 static char *request_devicename = NULL;
 
+/* The frames queued on a StreamChannel. The producer, the Python side or
+   one C caller, only moves head and the audio thread only moves tail, so
+   neither ever waits on the other. Both count frames and wrap around. The
+   channel plays chunk, silence looped forever, and _stream_effect puts the
+   queued frames in its place. The ring belongs to both the StreamChannel
+   and the registered effect, and whichever lets go last frees it. */
+typedef struct {
+    SDL_atomic_t refcount;
+    SDL_atomic_t head;
+    SDL_atomic_t tail;
+    SDL_atomic_t underruns;
+    Uint8 *buf;
+    Uint32 mask; /* frames held - 1 */
+    int frame;   /* bytes per frame */
+    int freq, channels;
+    Uint16 format;
+    int starved; /* audio thread only: ran dry and not refilled yet */
+    Mix_Chunk chunk;
+} pgStreamRing;
+
+/* frames in the silence a StreamChannel plays under its ring */
+#define PG_STREAM_SILENCE_FRAMES 2048
+
+typedef struct {
+    pgChannelObject channel;
+    pgStreamRing *ring;
+} pgStreamChannelObject;
+
 struct ChannelData {
     PyObject *sound;
     PyObject *queue;
     int endevent;
+    PyObject *effects;     /* tuple of Effect objects, or NULL */
+    pgEffectChain *chain;  /* the chain running them */
+    pgEffectChain *active; /* chain, while SDL_mixer has it registered */
+    pgStreamRing *stream;  /* the ring, while a StreamChannel plays here */
+    Mix_Chunk *pending;    /* queued sound _effects_post starts, see there */
 };
 static struct ChannelData *channeldata = NULL;
 static int numchanneldata = 0;
 
+/* Effect chains. A channel's chain is registered with Mix_RegisterEffect,
+   but SDL_mixer drops channel effects each time a sound on the channel
+   ends, so a post mix effect, which stays, registers them again before the
+   next block is mixed. The master chain is that post mix effect's data.
+   A StreamChannel runs the chain of its channel itself, after its ring.
+   effects_lock guards the chain, active and stream fields, and channeldata
+   itself while set_num_channels moves it, against the audio thread, along
+   with pending. A chain is only freed once it has been unregistered, which
+   waits for the audio thread to be done with it. */
+static SDL_SpinLock effects_lock = 0;
+static int effects_post = 0;
+static PyObject *master_effects = NULL;
+static pgEffectChain *master_chain = NULL;
+
 Mix_Music **mx_current_music;
 Mix_Music **mx_queue_music;
 
+/* Sample memory for Sounds made from buffers and arrays comes from a pool of
+   power of two sized blocks, from 1 KiB up to 8 MiB, so sounds that are made
+   and dropped many times a second reuse memory instead of going back to the
+   allocator. Each block remembers its size class in a header. Freed blocks
+   are kept until PG_SOUND_POOL_MAX_CACHED bytes are cached; larger sounds
+   bypass the pool. Only touched with the GIL held. */
+#define PG_SOUND_POOL_MIN_SHIFT 10
+#define PG_SOUND_POOL_CLASSES 14
+#define PG_SOUND_POOL_MAX_CACHED (16 * 1024 * 1024)
+
+typedef struct pgSoundBlock {
+    struct pgSoundBlock *next;
+    size_t size_class;
+} pgSoundBlock;
+
+static pgSoundBlock *sound_pool[PG_SOUND_POOL_CLASSES];
+static size_t sound_pool_cached = 0;
+
+static Uint8 *
+_sound_mem_alloc(size_t size)
+{
+    size_t size_class = 0;
+    pgSoundBlock *block;
+
+    while (size_class < PG_SOUND_POOL_CLASSES &&
+           ((size_t)1 << (size_class + PG_SOUND_POOL_MIN_SHIFT)) < size) {
+        ++size_class;
+    }
+
+    if (size_class < PG_SOUND_POOL_CLASSES && sound_pool[size_class]) {
+        block = sound_pool[size_class];
+        sound_pool[size_class] = block->next;
+        sound_pool_cached -= (size_t)1
+                             << (size_class + PG_SOUND_POOL_MIN_SHIFT);
+    }
+    else {
+        if (size_class < PG_SOUND_POOL_CLASSES) {
+            size = (size_t)1 << (size_class + PG_SOUND_POOL_MIN_SHIFT);
+        }
+        block = (pgSoundBlock *)PyMem_Malloc(sizeof(pgSoundBlock) + size);
+        if (!block) {
+            return NULL;
+        }
+    }
+    block->size_class = size_class;
+    return (Uint8 *)(block + 1);
+}
+
+static void
+_sound_mem_free(Uint8 *mem)
+{
+    pgSoundBlock *block = (pgSoundBlock *)mem - 1;
+    size_t size_class = block->size_class;
+    size_t size = (size_t)1 << (size_class + PG_SOUND_POOL_MIN_SHIFT);
+
+    if (size_class < PG_SOUND_POOL_CLASSES &&
+        sound_pool_cached + size <= PG_SOUND_POOL_MAX_CACHED) {
+        block->next = sound_pool[size_class];
+        sound_pool[size_class] = block;
+        sound_pool_cached += size;
+    }
+    else {
+        PyMem_Free(block);
+    }
+}
+
+static void
+_sound_pool_clear(void)
+{
+    pgSoundBlock *block;
+    int i;
+
+    for (i = 0; i < PG_SOUND_POOL_CLASSES; ++i) {
+        while ((block = sound_pool[i])) {
+            sound_pool[i] = block->next;
+            PyMem_Free(block);
+        }
+    }
+    sound_pool_cached = 0;
+}
+
 static int
 _format_itemsize(Uint16 format)
 {
@@ -301,9 +438,21 @@ endsound_callback(int channel)
             channeldata[channel].sound = channeldata[channel].queue;
             channeldata[channel].queue = NULL;
             PyGILState_Release(gstate);
-            channelnum = Mix_PlayChannelTimed(channel, sound, 0, -1);
-            if (channelnum != -1) {
-                Mix_GroupChannel(channelnum, (int)(intptr_t)sound);
+
+            /* SDL_mixer drops the channel's effects after this returns, and
+               would mix the rest of the block without them, so a channel
+               with a chain starts the sound from _effects_post instead */
+            SDL_AtomicLock(&effects_lock);
+            if (channeldata[channel].chain && !channeldata[channel].stream) {
+                channeldata[channel].pending = sound;
+                sound = NULL;
+            }
+            SDL_AtomicUnlock(&effects_lock);
+            if (sound) {
+                channelnum = Mix_PlayChannelTimed(channel, sound, 0, -1);
+                if (channelnum != -1) {
+                    Mix_GroupChannel(channelnum, (int)(intptr_t)sound);
+                }
             }
         }
         else {
@@ -316,6 +465,384 @@ endsound_callback(int channel)
     }
 }
 
+static void
+_effects_channel(int channel, void *stream, int len, void *udata)
+{
+    pgEffectChain_Process((pgEffectChain *)udata, stream, len);
+}
+
+static void
+_effects_channel_done(int channel, void *udata)
+{
+    SDL_AtomicLock(&effects_lock);
+    if (channeldata && channel < numchanneldata &&
+        channeldata[channel].active == udata) {
+        channeldata[channel].active = NULL;
+    }
+    SDL_AtomicUnlock(&effects_lock);
+}
+
+/* Registers the chain of a channel if SDL_mixer does not have it and no
+   StreamChannel runs it. Called without the GIL, from Python and from the
+   audio thread. */
+static void
+_effects_attach(int channel)
+{
+    pgEffectChain *chain = NULL;
+
+    SDL_AtomicLock(&effects_lock);
+    if (channeldata && channel < numchanneldata &&
+        channeldata[channel].chain && !channeldata[channel].active &&
+        !channeldata[channel].stream) {
+        chain = channeldata[channel].active = channeldata[channel].chain;
+    }
+    SDL_AtomicUnlock(&effects_lock);
+
+    if (chain && !Mix_RegisterEffect(channel, _effects_channel,
+                                     _effects_channel_done, chain)) {
+        SDL_AtomicLock(&effects_lock);
+        if (channeldata && channel < numchanneldata &&
+            channeldata[channel].active == chain) {
+            channeldata[channel].active = NULL;
+        }
+        SDL_AtomicUnlock(&effects_lock);
+    }
+}
+
+/* SDL_mixer mixes a block with its audio device locked, but does not say
+   which device that is. pygame.mixer opens it right after starting the
+   audio subsystem, so it is the one open device then, found by
+   _mixer_find_device out of SDL 2's table of 16 IDs. Locking it starts a
+   sound and attaches its chain before the next block is mixed. SDL 3 has no
+   device lock, the chain is attached after the first block there. Called
+   without the GIL, since the audio thread takes it in endsound_callback. */
+#define PG_MAX_AUDIO_DEVICES 16
+
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+static SDL_AudioDeviceID mixer_device = 0;
+
+static void
+_mixer_find_device(void)
+{
+    SDL_AudioDeviceID id;
+
+    mixer_device = 0;
+    for (id = 1; id <= PG_MAX_AUDIO_DEVICES; ++id) {
+        if (SDL_GetAudioDeviceStatus(id) != SDL_AUDIO_STOPPED) {
+            mixer_device = id;
+            return;
+        }
+    }
+}
+#endif
+
+static void
+_mixer_lock_audio(int lock)
+{
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+    if (!mixer_device) {
+        return;
+    }
+    if (lock) {
+        SDL_LockAudioDevice(mixer_device);
+    }
+    else {
+        SDL_UnlockAudioDevice(mixer_device);
+    }
+#endif
+}
+
+/* Attaches the chains SDL_mixer dropped, and starts the queued sounds that
+   endsound_callback left for a channel with a chain, after attaching it.
+   Those start at the next block, rather than part way through this one
+   without their chain. */
+static void
+_effects_post(int channel, void *stream, int len, void *udata)
+{
+    int i, count = Mix_AllocateChannels(-1);
+    Mix_Chunk *pending;
+
+    for (i = 0; i < count; ++i) {
+        pending = NULL;
+        SDL_AtomicLock(&effects_lock);
+        if (channeldata && i < numchanneldata) {
+            pending = channeldata[i].pending;
+            channeldata[i].pending = NULL;
+        }
+        SDL_AtomicUnlock(&effects_lock);
+
+        _effects_attach(i);
+        if (pending && Mix_PlayChannelTimed(i, pending, 0, -1) != -1) {
+            Mix_GroupChannel(i, (int)(intptr_t)pending);
+        }
+    }
+    if (udata) {
+        pgEffectChain_Process((pgEffectChain *)udata, stream, len);
+    }
+}
+
+/* Checks effects is a sequence of Effect objects, returning it as a new
+   tuple. */
+static PyObject *
+_effects_tuple(PyObject *effects)
+{
+    PyObject *tuple, *item;
+    Py_ssize_t i;
+
+    tuple = PySequence_Tuple(effects);
+    if (!tuple) {
+        return NULL;
+    }
+    if (PyTuple_GET_SIZE(tuple) > PG_EFFECT_MAX_UNITS) {
+        Py_DECREF(tuple);
+        return PyErr_Format(PyExc_ValueError, "too many effects, at most %d",
+                            PG_EFFECT_MAX_UNITS);
+    }
+    for (i = 0; i < PyTuple_GET_SIZE(tuple); ++i) {
+        item = PyTuple_GET_ITEM(tuple, i);
+        if (!pgEffect_Check(item)) {
+            PyErr_Format(PyExc_TypeError, "expected Effect objects, got %s",
+                         Py_TYPE(item)->tp_name);
+            Py_DECREF(tuple);
+            return NULL;
+        }
+        if (!((pgEffectObject *)item)->ready) {
+            Py_DECREF(tuple);
+            return RAISE(PyExc_RuntimeError,
+                         "__init__() was not called on Effect object");
+        }
+    }
+    return tuple;
+}
+
+/* A chain for a tuple from _effects_tuple, in the format of the mixer. */
+static pgEffectChain *
+_effects_chain_new(PyObject *effects)
+{
+    pgEffectParams *params[PG_EFFECT_MAX_UNITS];
+    pgEffectChain *chain;
+    int freq, channels, i;
+    Uint16 format;
+
+    if (!Mix_QuerySpec(&freq, &format, &channels)) {
+        PyErr_SetString(pgExc_SDLError, "mixer not initialized");
+        return NULL;
+    }
+    for (i = 0; i < PyTuple_GET_SIZE(effects); ++i) {
+        params[i] = &((pgEffectObject *)PyTuple_GET_ITEM(effects, i))->params;
+    }
+    chain = pgEffectChain_New(params, (int)PyTuple_GET_SIZE(effects), freq,
+                              format, channels);
+    if (!chain) {
+        PyErr_NoMemory();
+    }
+    return chain;
+}
+
+/* Runs effects, a tuple from _effects_tuple, on a channel, or on the whole
+   mix for MIX_CHANNEL_POST. */
+static int
+_effects_set(int channel, PyObject *effects)
+{
+    pgEffectChain *chain = NULL, *old;
+    int ok = 1;
+
+    if (PyTuple_GET_SIZE(effects)) {
+        chain = _effects_chain_new(effects);
+        if (!chain) {
+            return -1;
+        }
+    }
+
+    if (channel == MIX_CHANNEL_POST) {
+        Py_BEGIN_ALLOW_THREADS;
+        if (effects_post) {
+            Mix_UnregisterEffect(MIX_CHANNEL_POST, _effects_post);
+        }
+        ok = Mix_RegisterEffect(MIX_CHANNEL_POST, _effects_post, NULL, chain);
+        Py_END_ALLOW_THREADS;
+        effects_post = ok;
+        pgEffectChain_Free(master_chain);
+        Py_CLEAR(master_effects);
+        master_chain = NULL;
+        if (!ok) {
+            pgEffectChain_Free(chain);
+            PyErr_SetString(pgExc_SDLError, Mix_GetError());
+            return -1;
+        }
+        if (chain) {
+            master_chain = chain;
+            master_effects = effects;
+            Py_INCREF(effects);
+        }
+        return 0;
+    }
+
+    if (!effects_post) {
+        Py_BEGIN_ALLOW_THREADS;
+        ok = Mix_RegisterEffect(MIX_CHANNEL_POST, _effects_post, NULL, NULL);
+        Py_END_ALLOW_THREADS;
+        if (!ok) {
+            pgEffectChain_Free(chain);
+            PyErr_SetString(pgExc_SDLError, Mix_GetError());
+            return -1;
+        }
+        effects_post = 1;
+    }
+
+    SDL_AtomicLock(&effects_lock);
+    old = channeldata[channel].chain;
+    channeldata[channel].chain = chain;
+    SDL_AtomicUnlock(&effects_lock);
+
+    Py_BEGIN_ALLOW_THREADS;
+    if (old) {
+        Mix_UnregisterEffect(channel, _effects_channel);
+    }
+    _effects_attach(channel);
+    Py_END_ALLOW_THREADS;
+
+    pgEffectChain_Free(old);
+    Py_CLEAR(channeldata[channel].effects);
+    if (chain) {
+        channeldata[channel].effects = effects;
+        Py_INCREF(effects);
+    }
+    return 0;
+}
+
+/* Drops every chain, before the mixer closes. */
+static void
+_effects_clear(void)
+{
+    pgEffectChain *chain;
+    int i;
+
+    if (effects_post) {
+        Py_BEGIN_ALLOW_THREADS;
+        Mix_UnregisterEffect(MIX_CHANNEL_POST, _effects_post);
+        Py_END_ALLOW_THREADS;
+        effects_post = 0;
+    }
+    pgEffectChain_Free(master_chain);
+    master_chain = NULL;
+    Py_CLEAR(master_effects);
+
+    for (i = 0; i < numchanneldata; ++i) {
+        SDL_AtomicLock(&effects_lock);
+        chain = channeldata[i].chain;
+        channeldata[i].chain = NULL;
+        SDL_AtomicUnlock(&effects_lock);
+        if (chain) {
+            Py_BEGIN_ALLOW_THREADS;
+            Mix_UnregisterEffect(i, _effects_channel);
+            Py_END_ALLOW_THREADS;
+            pgEffectChain_Free(chain);
+        }
+        Py_CLEAR(channeldata[i].effects);
+    }
+}
+
+static void
+_stream_release(pgStreamRing *ring)
+{
+    if (SDL_AtomicDecRef(&ring->refcount)) {
+        free(ring->chunk.abuf);
+        free(ring->buf);
+        free(ring);
+    }
+}
+
+/* Takes the frames the channel needs from the ring, filling what is
+   missing with silence, then runs the channel's chain. */
+static void
+_stream_effect(int channel, void *stream, int len, void *udata)
+{
+    pgStreamRing *ring = (pgStreamRing *)udata;
+    pgEffectChain *chain = NULL;
+    Uint8 *out = (Uint8 *)stream;
+    Uint32 tail, count, start, first;
+    int frames = len / ring->frame, done, size;
+
+    tail = (Uint32)SDL_AtomicGet(&ring->tail);
+    count = (Uint32)SDL_AtomicGet(&ring->head) - tail;
+    SDL_MemoryBarrierAcquire();
+    if (count > (Uint32)frames) {
+        count = (Uint32)frames;
+    }
+    start = tail & ring->mask;
+    first = MIN(count, ring->mask + 1 - start);
+    memcpy(out, ring->buf + start * ring->frame, first * ring->frame);
+    memcpy(out + first * ring->frame, ring->buf,
+           (count - first) * ring->frame);
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&ring->tail, (int)(tail + count));
+
+    if (count) {
+        ring->starved = 0;
+    }
+    if (count < (Uint32)frames) {
+        /* an underrun is each time the ring runs dry after playing */
+        if (!ring->starved) {
+            SDL_AtomicAdd(&ring->underruns, 1);
+            ring->starved = 1;
+        }
+    }
+    for (done = count * ring->frame; done < len; done += size) {
+        size = MIN(len - done, (int)ring->chunk.alen);
+        memcpy(out + done, ring->chunk.abuf, size);
+    }
+
+    SDL_AtomicLock(&effects_lock);
+    if (channeldata && channel < numchanneldata) {
+        chain = channeldata[channel].chain;
+    }
+    SDL_AtomicUnlock(&effects_lock);
+    if (chain) {
+        pgEffectChain_Process(chain, stream, len);
+    }
+}
+
+static void
+_stream_done(int channel, void *udata)
+{
+    SDL_AtomicLock(&effects_lock);
+    if (channeldata && channel < numchanneldata &&
+        channeldata[channel].stream == udata) {
+        channeldata[channel].stream = NULL;
+    }
+    SDL_AtomicUnlock(&effects_lock);
+    _stream_release((pgStreamRing *)udata);
+}
+
+/* Queues up to frames frames from data on a StreamChannel, returning how
+   many fit. Does not need the GIL, but only one thread may push to a
+   StreamChannel at a time. */
+static int
+pgStreamChannel_Push(PyObject *self, const void *data, int frames)
+{
+    pgStreamRing *ring = ((pgStreamChannelObject *)self)->ring;
+    Uint32 head, count, start, first;
+
+    if (!ring || frames <= 0) {
+        return 0;
+    }
+    head = (Uint32)SDL_AtomicGet(&ring->head);
+    count = ring->mask + 1 - (head - (Uint32)SDL_AtomicGet(&ring->tail));
+    SDL_MemoryBarrierAcquire();
+    if (count > (Uint32)frames) {
+        count = (Uint32)frames;
+    }
+    start = head & ring->mask;
+    first = MIN(count, ring->mask + 1 - start);
+    memcpy(ring->buf + start * ring->frame, data, first * ring->frame);
+    memcpy(ring->buf, (const Uint8 *)data + first * ring->frame,
+           (count - first) * ring->frame);
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&ring->head, (int)(head + count));
+    return (int)count;
+}
+
 static PyObject *
 import_music(void)
 {
@@ -427,6 +954,11 @@ _init(int freq, int size, int channels, int chunk, char *devicename,
                 channeldata[i].sound = NULL;
                 channeldata[i].queue = NULL;
                 channeldata[i].endevent = 0;
+                channeldata[i].effects = NULL;
+                channeldata[i].chain = NULL;
+                channeldata[i].active = NULL;
+                channeldata[i].stream = NULL;
+                channeldata[i].pending = NULL;
             }
         }
 
@@ -453,6 +985,9 @@ _init(int freq, int size, int channels, int chunk, char *devicename,
             SDL_QuitSubSystem(SDL_INIT_AUDIO);
             return RAISE(pgExc_SDLError, SDL_GetError());
         }
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+        _mixer_find_device();
+#endif
         Mix_ChannelFinished(endsound_callback);
         Mix_VolumeMusic(127);
     }
@@ -516,13 +1051,16 @@ mixer_quit(PyObject *self, PyObject *_null)
         Py_END_ALLOW_THREADS;
 
         if (channeldata) {
+            _effects_clear();
             for (i = 0; i < numchanneldata; ++i) {
                 Py_XDECREF(channeldata[i].sound);
                 Py_XDECREF(channeldata[i].queue);
             }
+            SDL_AtomicLock(&effects_lock);
             free(channeldata);
             channeldata = NULL;
             numchanneldata = 0;
+            SDL_AtomicUnlock(&effects_lock);
         }
 
         if (mx_current_music) {
@@ -548,6 +1086,11 @@ mixer_quit(PyObject *self, PyObject *_null)
         Mix_CloseAudio();
         SDL_QuitSubSystem(SDL_INIT_AUDIO);
         Py_END_ALLOW_THREADS;
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+        mixer_device = 0;
+#endif
+
+        _sound_pool_clear();
     }
     Py_RETURN_NONE;
 }
@@ -640,6 +1183,160 @@ pre_init(PyObject *self, PyObject *args, PyObject *keywds)
     Py_RETURN_NONE;
 }
 
+/* effect object methods */
+
+static int
+_effect_update(pgEffectObject *self, PyObject *kwargs)
+{
+    const pgEffectKindInfo *info = pg_effect_kinds + self->params.kind;
+    float values[PG_EFFECT_MAX_PARAMS];
+    PyObject *key, *value;
+    Py_ssize_t pos = 0;
+    const char *name;
+    char msg[128];
+    double v;
+    int i;
+
+    memcpy(values, self->params.values, sizeof(values));
+    while (PyDict_Next(kwargs, &pos, &key, &value)) {
+        name = PyUnicode_AsUTF8(key);
+        if (!name) {
+            return -1;
+        }
+        for (i = 0; i < info->n_params; ++i) {
+            if (!strcmp(name, info->params[i].name)) {
+                break;
+            }
+        }
+        if (i == info->n_params) {
+            PyErr_Format(PyExc_TypeError, "%s effect has no parameter '%s'",
+                         info->name, name);
+            return -1;
+        }
+        v = PyFloat_AsDouble(value);
+        if (v == -1.0 && PyErr_Occurred()) {
+            return -1;
+        }
+        if (!(v >= info->params[i].min && v <= info->params[i].max)) {
+            PyOS_snprintf(msg, sizeof(msg), "%s must be from %g to %g", name,
+                          info->params[i].min, info->params[i].max);
+            PyErr_SetString(PyExc_ValueError, msg);
+            return -1;
+        }
+        values[i] = (float)v;
+    }
+
+    SDL_AtomicLock(&self->params.lock);
+    memcpy(self->params.values, values, sizeof(values));
+    SDL_AtomicAdd(&self->params.serial, 1);
+    SDL_AtomicUnlock(&self->params.lock);
+    return 0;
+}
+
+static PyObject *
+effect_set(pgEffectObject *self, PyObject *args, PyObject *kwargs)
+{
+    if (PyTuple_GET_SIZE(args)) {
+        return RAISE(PyExc_TypeError, "set() takes keyword arguments only");
+    }
+    if (!self->ready) {
+        return RAISE(PyExc_RuntimeError,
+                     "__init__() was not called on Effect object");
+    }
+    if (kwargs && _effect_update(self, kwargs)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+effect_get_kind(pgEffectObject *self, void *closure)
+{
+    return PyUnicode_FromString(pg_effect_kinds[self->params.kind].name);
+}
+
+static PyObject *
+effect_get_params(pgEffectObject *self, void *closure)
+{
+    const pgEffectKindInfo *info = pg_effect_kinds + self->params.kind;
+    PyObject *dict, *value;
+    int i;
+
+    dict = PyDict_New();
+    if (!dict) {
+        return NULL;
+    }
+    for (i = 0; i < info->n_params; ++i) {
+        value = PyFloat_FromDouble(self->params.values[i]);
+        if (!value ||
+            PyDict_SetItemString(dict, info->params[i].name, value)) {
+            Py_XDECREF(value);
+            Py_DECREF(dict);
+            return NULL;
+        }
+        Py_DECREF(value);
+    }
+    return dict;
+}
+
+static PyMethodDef effect_methods[] = {
+    {"set", (PyCFunction)effect_set, METH_VARARGS | METH_KEYWORDS,
+     DOC_MIXER_EFFECT_SET},
+    {NULL, NULL, 0, NULL}};
+
+static PyGetSetDef effect_getset[] = {
+    {"kind", (getter)effect_get_kind, NULL, DOC_MIXER_EFFECT_KIND, NULL},
+    {"params", (getter)effect_get_params, NULL, DOC_MIXER_EFFECT_PARAMS,
+     NULL},
+    {NULL, NULL, NULL, NULL, NULL}};
+
+static int
+effect_init(pgEffectObject *self, PyObject *args, PyObject *kwargs)
+{
+    const pgEffectKindInfo *info;
+    const char *kind;
+    int i;
+
+    if (!PyArg_ParseTuple(args, "s", &kind)) {
+        return -1;
+    }
+    if (self->ready) {
+        /* a chain may be running it, so it can not change kind */
+        PyErr_SetString(PyExc_RuntimeError, "Effect is already initialized");
+        return -1;
+    }
+    for (i = 0; i < PG_EFFECT_KINDS; ++i) {
+        if (!strcmp(kind, pg_effect_kinds[i].name)) {
+            break;
+        }
+    }
+    if (i == PG_EFFECT_KINDS) {
+        PyErr_Format(PyExc_ValueError, "unknown effect kind '%s'", kind);
+        return -1;
+    }
+    info = pg_effect_kinds + i;
+    self->params.kind = (pgEffectKind)i;
+    for (i = 0; i < info->n_params; ++i) {
+        self->params.values[i] = info->params[i].value;
+    }
+    if (kwargs && _effect_update(self, kwargs)) {
+        return -1;
+    }
+    self->ready = 1;
+    return 0;
+}
+
+static PyTypeObject pgEffect_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.mixer.Effect",
+    .tp_basicsize = sizeof(pgEffectObject),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = DOC_MIXER_EFFECT,
+    .tp_methods = effect_methods,
+    .tp_getset = effect_getset,
+    .tp_init = (initproc)effect_init,
+    .tp_new = PyType_GenericNew,
+};
+
 /* sound object methods */
 
 static PyObject *
@@ -658,6 +1355,7 @@ pgSound_Play(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     Py_BEGIN_ALLOW_THREADS;
+    _mixer_lock_audio(1);
     if (fade_ms > 0) {
         channelnum =
             Mix_FadeInChannelTimed(-1, chunk, loops, fade_ms, playtime);
@@ -665,6 +1363,13 @@ pgSound_Play(PyObject *self, PyObject *args, PyObject *kwargs)
     else {
         channelnum = Mix_PlayChannelTimed(-1, chunk, loops, playtime);
     }
+    if (channelnum != -1) {
+        // make sure volume on this arbitrary channel is set to full
+        Mix_Volume(channelnum, 128);
+        Mix_GroupChannel(channelnum, (int)(intptr_t)chunk);
+        _effects_attach(channelnum);
+    }
+    _mixer_lock_audio(0);
     Py_END_ALLOW_THREADS;
     if (channelnum == -1) {
         Py_RETURN_NONE;
@@ -676,13 +1381,6 @@ pgSound_Play(PyObject *self, PyObject *args, PyObject *kwargs)
     channeldata[channelnum].sound = self;
     Py_INCREF(self);
 
-    // make sure volume on this arbitrary channel is set to full
-    Mix_Volume(channelnum, 128);
-
-    Py_BEGIN_ALLOW_THREADS;
-    Mix_GroupChannel(channelnum, (int)(intptr_t)chunk);
-    Py_END_ALLOW_THREADS;
-
     return pgChannel_New(channelnum);
 }
 
@@ -807,7 +1505,8 @@ snd_get_arraystruct(PyObject *self, void *closure)
     Py_buffer view;
     PyObject *cobj;
 
-    if (snd_getbuffer(self, &view, PyBUF_RECORDS)) {
+    if (snd_getbuffer(self, &view,
+                      SND_READONLY(self) ? PyBUF_RECORDS_RO : PyBUF_RECORDS)) {
         return 0;
     }
     cobj = pgBuffer_AsArrayStruct(&view);
@@ -822,7 +1521,8 @@ snd_get_arrayinterface(PyObject *self, void *closure)
     Py_buffer view;
     PyObject *dict;
 
-    if (snd_getbuffer(self, &view, PyBUF_RECORDS)) {
+    if (snd_getbuffer(self, &view,
+                      SND_READONLY(self) ? PyBUF_RECORDS_RO : PyBUF_RECORDS)) {
         return 0;
     }
     dict = pgBuffer_AsArrayInterface(&view);
@@ -847,8 +1547,52 @@ snd_get_samples_address(PyObject *self, PyObject *closure)
 #endif
 }
 
-PyMethodDef sound_methods[] = {
-    {"play", (PyCFunction)pgSound_Play, METH_VARARGS | METH_KEYWORDS,
+static PyObject *
+snd_apply_effects(PyObject *self, PyObject *effects)
+{
+    Mix_Chunk *chunk = pgSound_AsChunk(self), *new_chunk;
+    pgEffectChain *chain;
+    PyObject *tuple, *sound;
+    Uint8 *mem;
+
+    CHECK_CHUNK_VALID(chunk, NULL);
+    MIXER_INIT_CHECK();
+
+    tuple = _effects_tuple(effects);
+    if (!tuple) {
+        return NULL;
+    }
+    chain = PyTuple_GET_SIZE(tuple) ? _effects_chain_new(tuple) : NULL;
+    if (PyTuple_GET_SIZE(tuple) && !chain) {
+        Py_DECREF(tuple);
+        return NULL;
+    }
+    if (_chunk_from_buf(chunk->abuf, chunk->alen, &new_chunk, &mem)) {
+        pgEffectChain_Free(chain);
+        Py_DECREF(tuple);
+        return NULL;
+    }
+    if (chain) {
+        Py_BEGIN_ALLOW_THREADS;
+        pgEffectChain_Process(chain, mem, (int)chunk->alen);
+        Py_END_ALLOW_THREADS;
+        pgEffectChain_Free(chain);
+    }
+    Py_DECREF(tuple);
+
+    new_chunk->volume = chunk->volume;
+    sound = pgSound_New(new_chunk);
+    if (!sound) {
+        Mix_FreeChunk(new_chunk);
+        _sound_mem_free(mem);
+        return NULL;
+    }
+    ((pgSoundObject *)sound)->mem = mem;
+    return sound;
+}
+
+PyMethodDef sound_methods[] = {
+    {"play", (PyCFunction)pgSound_Play, METH_VARARGS | METH_KEYWORDS,
      DOC_MIXER_SOUND_PLAY},
     {"get_num_channels", snd_get_num_channels, METH_NOARGS,
      DOC_MIXER_SOUND_GETNUMCHANNELS},
@@ -858,6 +1602,8 @@ PyMethodDef sound_methods[] = {
     {"get_volume", snd_get_volume, METH_NOARGS, DOC_MIXER_SOUND_GETVOLUME},
     {"get_length", snd_get_length, METH_NOARGS, DOC_MIXER_SOUND_GETLENGTH},
     {"get_raw", snd_get_raw, METH_NOARGS, DOC_MIXER_SOUND_GETRAW},
+    {"apply_effects", snd_apply_effects, METH_O,
+     DOC_MIXER_SOUND_APPLYEFFECTS},
     {NULL, NULL, 0, NULL}};
 
 static PyGetSetDef sound_getset[] = {
@@ -961,6 +1707,11 @@ snd_getbuffer(PyObject *obj, Py_buffer *view, int flags)
     CHECK_CHUNK_VALID(chunk, -1);
 
     view->obj = 0;
+    if (SND_READONLY(obj) && PyBUF_HAS_FLAG(flags, PyBUF_WRITABLE)) {
+        PyErr_SetString(pgExc_BufferError,
+                        "Sound plays from a read-only buffer");
+        return -1;
+    }
     if (snd_buffer_iteminfo(&format, &itemsize, &channels)) {
         return -1;
     }
@@ -989,7 +1740,7 @@ snd_getbuffer(PyObject *obj, Py_buffer *view, int flags)
     view->obj = obj;
     view->buf = chunk->abuf;
     view->len = (Py_ssize_t)chunk->alen;
-    view->readonly = 0;
+    view->readonly = SND_READONLY(obj);
     view->itemsize = itemsize;
     view->format = PyBUF_HAS_FLAG(flags, PyBUF_FORMAT) ? format : 0;
     view->ndim = ndim;
@@ -1022,7 +1773,11 @@ sound_dealloc(pgSoundObject *self)
         Py_END_ALLOW_THREADS;
     }
     if (self->mem) {
-        PyMem_Free(self->mem);
+        _sound_mem_free(self->mem);
+    }
+    if (self->source) {
+        PyBuffer_Release(self->source);
+        PyMem_Free(self->source);
     }
     if (self->weakreflist) {
         PyObject_ClearWeakRefs((PyObject *)self);
@@ -1063,6 +1818,7 @@ chan_play(PyObject *self, PyObject *args, PyObject *kwargs)
     CHECK_CHUNK_VALID(chunk, NULL);
 
     Py_BEGIN_ALLOW_THREADS;
+    _mixer_lock_audio(1);
     if (fade_ms > 0) {
         channelnum = Mix_FadeInChannelTimed(channelnum, chunk, loops, fade_ms,
                                             playtime);
@@ -1072,7 +1828,9 @@ chan_play(PyObject *self, PyObject *args, PyObject *kwargs)
     }
     if (channelnum != -1) {
         Mix_GroupChannel(channelnum, (int)(intptr_t)chunk);
+        _effects_attach(channelnum);
     }
+    _mixer_lock_audio(0);
     Py_END_ALLOW_THREADS;
 
     Py_XDECREF(channeldata[channelnum].sound);
@@ -1109,10 +1867,13 @@ chan_queue(PyObject *self, PyObject *sound)
     if (!channeldata[channelnum].sound) /*nothing playing*/
     {
         Py_BEGIN_ALLOW_THREADS;
+        _mixer_lock_audio(1);
         channelnum = Mix_PlayChannelTimed(channelnum, chunk, 0, -1);
         if (channelnum != -1) {
             Mix_GroupChannel(channelnum, (int)(intptr_t)chunk);
+            _effects_attach(channelnum);
         }
+        _mixer_lock_audio(0);
         Py_END_ALLOW_THREADS;
 
         channeldata[channelnum].sound = sound;
@@ -1335,6 +2096,45 @@ chan_get_endevent(PyObject *self, PyObject *_null)
     return PyLong_FromLong(channeldata[channelnum].endevent);
 }
 
+static PyObject *
+chan_set_effects(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    int channelnum = pgChannel_AsInt(self);
+    PyObject *effects = NULL, *tuple;
+
+    static char *kwids[] = {"effects", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", kwids, &effects)) {
+        return NULL;
+    }
+
+    MIXER_INIT_CHECK();
+    tuple = effects ? _effects_tuple(effects) : PyTuple_New(0);
+    if (!tuple) {
+        return NULL;
+    }
+    if (_effects_set(channelnum, tuple)) {
+        Py_DECREF(tuple);
+        return NULL;
+    }
+    Py_DECREF(tuple);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+chan_get_effects(PyObject *self, PyObject *_null)
+{
+    int channelnum = pgChannel_AsInt(self);
+    PyObject *effects;
+
+    MIXER_INIT_CHECK();
+    effects = channeldata[channelnum].effects;
+    if (!effects) {
+        return PyTuple_New(0);
+    }
+    Py_INCREF(effects);
+    return effects;
+}
+
 static PyGetSetDef _channel_getsets[] = {
     {"id", (getter)chan_get_id, NULL, DOC_MIXER_CHANNEL_ID, NULL},
     {NULL, NULL, NULL, NULL, NULL}};
@@ -1365,6 +2165,10 @@ static PyMethodDef channel_methods[] = {
      DOC_MIXER_CHANNEL_SETENDEVENT},
     {"get_endevent", (PyCFunction)chan_get_endevent, METH_NOARGS,
      DOC_MIXER_CHANNEL_GETENDEVENT},
+    {"set_effects", (PyCFunction)chan_set_effects,
+     METH_VARARGS | METH_KEYWORDS, DOC_MIXER_CHANNEL_SETEFFECTS},
+    {"get_effects", (PyCFunction)chan_get_effects, METH_NOARGS,
+     DOC_MIXER_CHANNEL_GETEFFECTS},
 
     {NULL, NULL, 0, NULL}};
 
@@ -1414,6 +2218,246 @@ static PyTypeObject pgChannel_Type = {
     .tp_getset = _channel_getsets,
 };
 
+/* stream channel object */
+
+static PyObject *
+stream_play(PyObject *self, PyObject *_null)
+{
+    pgStreamRing *ring = ((pgStreamChannelObject *)self)->ring;
+    int channelnum = pgChannel_AsInt(self);
+    int freq, channels, playing, ok = 1;
+    Uint16 format;
+
+    MIXER_INIT_CHECK();
+    if (!ring) {
+        return RAISE(PyExc_RuntimeError,
+                     "__init__() was not called on StreamChannel object");
+    }
+    if (!Mix_QuerySpec(&freq, &format, &channels)) {
+        return RAISE(pgExc_SDLError, "mixer not initialized");
+    }
+    if (freq != ring->freq || format != ring->format ||
+        channels != ring->channels) {
+        return RAISE(pgExc_SDLError,
+                     "the mixer format changed since the StreamChannel "
+                     "was made");
+    }
+    Py_CLEAR(channeldata[channelnum].queue);
+
+    Py_BEGIN_ALLOW_THREADS;
+    SDL_AtomicLock(&effects_lock);
+    playing = channeldata[channelnum].stream == ring;
+    channeldata[channelnum].stream = ring;
+    SDL_AtomicUnlock(&effects_lock);
+
+    if (!playing) {
+        /* the chain runs after the ring, in _stream_effect */
+        Mix_UnregisterEffect(channelnum, _effects_channel);
+        ok = Mix_PlayChannelTimed(channelnum, &ring->chunk, -1, -1) != -1;
+        if (ok) {
+            SDL_AtomicIncRef(&ring->refcount);
+            ok = Mix_RegisterEffect(channelnum, _stream_effect, _stream_done,
+                                    ring);
+            if (!ok) {
+                _stream_release(ring);
+                Mix_HaltChannel(channelnum);
+            }
+        }
+        if (!ok) {
+            SDL_AtomicLock(&effects_lock);
+            if (channeldata[channelnum].stream == ring) {
+                channeldata[channelnum].stream = NULL;
+            }
+            SDL_AtomicUnlock(&effects_lock);
+            _effects_attach(channelnum);
+        }
+    }
+    Py_END_ALLOW_THREADS;
+
+    if (!ok) {
+        return RAISE(pgExc_SDLError, Mix_GetError());
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+stream_push(PyObject *self, PyObject *arg)
+{
+    pgStreamRing *ring = ((pgStreamChannelObject *)self)->ring;
+    Py_buffer view;
+    Py_ssize_t frames;
+    int count;
+
+    if (!ring) {
+        return RAISE(PyExc_RuntimeError,
+                     "__init__() was not called on StreamChannel object");
+    }
+    if (PyObject_GetBuffer(arg, &view, PyBUF_SIMPLE)) {
+        return NULL;
+    }
+    if (view.len % ring->frame) {
+        PyErr_Format(PyExc_ValueError,
+                     "buffer length %zd is not a multiple of the frame size "
+                     "%d",
+                     view.len, ring->frame);
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+    frames = MIN(view.len / ring->frame, INT_MAX);
+    count = pgStreamChannel_Push(self, view.buf, (int)frames);
+    PyBuffer_Release(&view);
+    return PyLong_FromLong(count);
+}
+
+static PyObject *
+stream_get_queued(PyObject *self, PyObject *_null)
+{
+    pgStreamRing *ring = ((pgStreamChannelObject *)self)->ring;
+
+    if (!ring) {
+        return PyLong_FromLong(0);
+    }
+    return PyLong_FromUnsignedLong((Uint32)SDL_AtomicGet(&ring->head) -
+                                   (Uint32)SDL_AtomicGet(&ring->tail));
+}
+
+static PyObject *
+stream_get_free(PyObject *self, PyObject *_null)
+{
+    pgStreamRing *ring = ((pgStreamChannelObject *)self)->ring;
+
+    if (!ring) {
+        return PyLong_FromLong(0);
+    }
+    return PyLong_FromUnsignedLong(ring->mask + 1 -
+                                   ((Uint32)SDL_AtomicGet(&ring->head) -
+                                    (Uint32)SDL_AtomicGet(&ring->tail)));
+}
+
+static PyObject *
+stream_get_underruns(PyObject *self, PyObject *_null)
+{
+    pgStreamRing *ring = ((pgStreamChannelObject *)self)->ring;
+
+    return PyLong_FromLong(ring ? SDL_AtomicGet(&ring->underruns) : 0);
+}
+
+static PyMethodDef stream_methods[] = {
+    {"play", (PyCFunction)stream_play, METH_NOARGS,
+     DOC_MIXER_STREAMCHANNEL_PLAY},
+    {"push", stream_push, METH_O, DOC_MIXER_STREAMCHANNEL_PUSH},
+    {"get_queued", (PyCFunction)stream_get_queued, METH_NOARGS,
+     DOC_MIXER_STREAMCHANNEL_GETQUEUED},
+    {"get_free", (PyCFunction)stream_get_free, METH_NOARGS,
+     DOC_MIXER_STREAMCHANNEL_GETFREE},
+    {"get_underruns", (PyCFunction)stream_get_underruns, METH_NOARGS,
+     DOC_MIXER_STREAMCHANNEL_GETUNDERRUNS},
+    {NULL, NULL, 0, NULL}};
+
+static void
+stream_dealloc(pgStreamChannelObject *self)
+{
+    if (self->ring) {
+        _stream_release(self->ring);
+    }
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static pgStreamRing *
+_stream_ring_new(int frames, int freq, Uint16 format, int channels)
+{
+    pgStreamRing *ring;
+    Uint32 size = 1;
+    int i, n;
+
+    ring = (pgStreamRing *)calloc(1, sizeof(pgStreamRing));
+    if (!ring) {
+        return NULL;
+    }
+    while (size < (Uint32)frames) {
+        size <<= 1;
+    }
+    ring->mask = size - 1;
+    ring->frame = SDL_AUDIO_BITSIZE(format) / 8 * channels;
+    ring->freq = freq;
+    ring->format = format;
+    ring->channels = channels;
+    ring->starved = 1;
+    SDL_AtomicSet(&ring->refcount, 1);
+    ring->buf = (Uint8 *)malloc((size_t)size * ring->frame);
+    ring->chunk.alen = PG_STREAM_SILENCE_FRAMES * ring->frame;
+    ring->chunk.abuf = (Uint8 *)malloc(ring->chunk.alen);
+    ring->chunk.volume = MIX_MAX_VOLUME;
+    if (!ring->buf || !ring->chunk.abuf) {
+        free(ring->chunk.abuf);
+        free(ring->buf);
+        free(ring);
+        return NULL;
+    }
+
+    if (format == AUDIO_U8) {
+        memset(ring->chunk.abuf, 0x80, ring->chunk.alen);
+    }
+    else if (format == AUDIO_U16SYS) {
+        n = (int)ring->chunk.alen / 2;
+        for (i = 0; i < n; ++i) {
+            ((Uint16 *)ring->chunk.abuf)[i] = 0x8000;
+        }
+    }
+    else {
+        memset(ring->chunk.abuf, 0, ring->chunk.alen);
+    }
+    return ring;
+}
+
+static int
+stream_init(pgStreamChannelObject *self, PyObject *args, PyObject *kwargs)
+{
+    int channelnum, frames = 4096, freq, channels;
+    Uint16 format;
+
+    static char *kwids[] = {"id", "frames", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "i|i", kwids, &channelnum,
+                                     &frames)) {
+        return -1;
+    }
+    if (self->ring) {
+        PyErr_SetString(PyExc_RuntimeError,
+                        "StreamChannel is already initialized");
+        return -1;
+    }
+    if (frames < 1 || frames > (1 << 24)) {
+        PyErr_SetString(PyExc_ValueError,
+                        "frames must be between 1 and 16777216");
+        return -1;
+    }
+    if (_channel_init(&self->channel, channelnum)) {
+        return -1;
+    }
+    if (!Mix_QuerySpec(&freq, &format, &channels)) {
+        PyErr_SetString(pgExc_SDLError, "mixer not initialized");
+        return -1;
+    }
+    self->ring = _stream_ring_new(frames, freq, format, channels);
+    if (!self->ring) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+static PyTypeObject pgStreamChannel_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0).tp_name = "pygame.mixer.StreamChannel",
+    .tp_basicsize = sizeof(pgStreamChannelObject),
+    .tp_dealloc = (destructor)stream_dealloc,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = DOC_MIXER_STREAMCHANNEL,
+    .tp_methods = stream_methods,
+    .tp_base = &pgChannel_Type,
+    .tp_init = (initproc)stream_init,
+    .tp_new = PyType_GenericNew,
+};
+
 /*mixer module methods*/
 
 static PyObject *
@@ -1434,19 +2478,27 @@ set_num_channels(PyObject *self, PyObject *args)
     MIXER_INIT_CHECK();
     if (numchans > numchanneldata) {
         struct ChannelData *cd_org = channeldata;
+        SDL_AtomicLock(&effects_lock);
         channeldata = (struct ChannelData *)realloc(
             channeldata, sizeof(struct ChannelData) * numchans);
         if (!channeldata) {
             /* Restore the original to avoid leaking it */
             channeldata = cd_org;
+            SDL_AtomicUnlock(&effects_lock);
             return PyErr_NoMemory();
         }
         for (i = numchanneldata; i < numchans; ++i) {
             channeldata[i].sound = NULL;
             channeldata[i].queue = NULL;
             channeldata[i].endevent = 0;
+            channeldata[i].effects = NULL;
+            channeldata[i].chain = NULL;
+            channeldata[i].active = NULL;
+            channeldata[i].stream = NULL;
+            channeldata[i].pending = NULL;
         }
         numchanneldata = numchans;
+        SDL_AtomicUnlock(&effects_lock);
     }
 
     Py_BEGIN_ALLOW_THREADS;
@@ -1553,6 +2605,40 @@ mixer_get_soundfont(PyObject *self, PyObject *_null)
     Py_RETURN_NONE;
 }
 
+static PyObject *
+mixer_set_effects(PyObject *self, PyObject *args, PyObject *kwargs)
+{
+    PyObject *effects = NULL, *tuple;
+
+    static char *kwids[] = {"effects", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", kwids, &effects)) {
+        return NULL;
+    }
+
+    MIXER_INIT_CHECK();
+    tuple = effects ? _effects_tuple(effects) : PyTuple_New(0);
+    if (!tuple) {
+        return NULL;
+    }
+    if (_effects_set(MIX_CHANNEL_POST, tuple)) {
+        Py_DECREF(tuple);
+        return NULL;
+    }
+    Py_DECREF(tuple);
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+mixer_get_effects(PyObject *self, PyObject *_null)
+{
+    MIXER_INIT_CHECK();
+    if (!master_effects) {
+        return PyTuple_New(0);
+    }
+    Py_INCREF(master_effects);
+    return master_effects;
+}
+
 static PyObject *
 mixer_fadeout(PyObject *self, PyObject *args)
 {
@@ -1637,11 +2723,100 @@ mixer_get_sdl_mixer_version(PyObject *self, PyObject *args, PyObject *kwargs)
                          PG_FIND_VNUM_MICRO(version));
 }
 
+static int
+_check_array_shape(int ndim, Py_ssize_t *shape, int channels)
+{
+    if (channels == 1) {
+        if (ndim != 1) {
+            PyErr_SetString(PyExc_ValueError,
+                            "Array must be 1-dimensional for mono mixer");
+            return -1;
+        }
+    }
+    else {
+        if (ndim != 2) {
+            PyErr_SetString(PyExc_ValueError,
+                            "Array must be 2-dimensional for stereo mixer");
+            return -1;
+        }
+        if (shape[1] != channels) {
+            PyErr_SetString(PyExc_ValueError,
+                            "Array depth must match number of mixer channels");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Makes a chunk that plays straight from view, for Sound(copy=False). The
+   samples must already be in the mixer format: whole frames for a buffer,
+   and the mixer's sample size and channel count for an array. On success
+   the Sound takes over view and releases it when freed. */
+static int
+_chunk_from_view(pgSoundObject *self, Py_buffer *view, int is_array,
+                 Mix_Chunk **chunk)
+{
+    int freq;
+    Uint16 format;
+    int channels;
+    int itemsize;
+    PG_sample_format_t view_format;
+    Py_buffer *source;
+
+    if (!Mix_QuerySpec(&freq, &format, &channels)) {
+        PyErr_SetString(pgExc_SDLError, "mixer not initialized");
+        return -1;
+    }
+    itemsize = _format_itemsize(format);
+    if (itemsize < 0) {
+        return -1;
+    }
+
+    if (is_array) {
+        view_format = _format_view_to_audio(view);
+        if (!view_format) {
+            return -1;
+        }
+        if (_check_array_shape(view->ndim, view->shape, channels)) {
+            return -1;
+        }
+        if ((int)PG_SAMPLE_SIZE(view_format) != itemsize) {
+            PyErr_Format(PyExc_ValueError,
+                         "Array samples must be %d bytes, like the mixer's, "
+                         "to play without a copy",
+                         itemsize);
+            return -1;
+        }
+    }
+    else if (view->len % (itemsize * channels)) {
+        PyErr_Format(PyExc_ValueError,
+                     "Buffer length must be a multiple of the mixer frame "
+                     "size (%d bytes) to play without a copy",
+                     itemsize * channels);
+        return -1;
+    }
+
+    source = PyMem_New(Py_buffer, 1);
+    if (!source) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    *chunk = Mix_QuickLoad_RAW((Uint8 *)view->buf, (Uint32)view->len);
+    if (!*chunk) {
+        PyMem_Free(source);
+        PyErr_NoMemory();
+        return -1;
+    }
+    *source = *view;
+    self->source = source;
+    return 0;
+}
+
 static int
 _chunk_from_buf(const void *buf, Py_ssize_t len, Mix_Chunk **chunk,
                 Uint8 **mem)
 {
-    Uint8 *m = (Uint8 *)PyMem_Malloc((size_t)len);
+    Uint8 *m = _sound_mem_alloc((size_t)len);
 
     if (!m) {
         PyErr_NoMemory();
@@ -1649,7 +2824,7 @@ _chunk_from_buf(const void *buf, Py_ssize_t len, Mix_Chunk **chunk,
     }
     *chunk = Mix_QuickLoad_RAW(m, (Uint32)len);
     if (!*chunk) {
-        PyMem_Free(m);
+        _sound_mem_free(m);
         PyErr_NoMemory();
         return -1;
     }
@@ -1683,24 +2858,8 @@ _chunk_from_array(void *buf, PG_sample_format_t view_format, int ndim,
 
     /* Check for compatible values.
      */
-    if (channels == 1) {
-        if (ndim != 1) {
-            PyErr_SetString(PyExc_ValueError,
-                            "Array must be 1-dimensional for mono mixer");
-            return -1;
-        }
-    }
-    else {
-        if (ndim != 2) {
-            PyErr_SetString(PyExc_ValueError,
-                            "Array must be 2-dimensional for stereo mixer");
-            return -1;
-        }
-        if (shape[1] != channels) {
-            PyErr_SetString(PyExc_ValueError,
-                            "Array depth must match number of mixer channels");
-            return -1;
-        }
+    if (_check_array_shape(ndim, shape, channels)) {
+        return -1;
     }
     itemsize = _format_itemsize(format);
     /*
@@ -1730,14 +2889,14 @@ _chunk_from_array(void *buf, PG_sample_format_t view_format, int ndim,
 
     /* Create chunk.
      */
-    dst = (Uint8 *)PyMem_Malloc((size_t)memsize);
+    dst = _sound_mem_alloc((size_t)memsize);
     if (!dst) {
         PyErr_NoMemory();
         return -1;
     }
     *chunk = Mix_QuickLoad_RAW(dst, (Uint32)memsize);
     if (!*chunk) {
-        PyMem_Free(dst);
+        _sound_mem_free(dst);
         PyErr_NoMemory();
         return -1;
     }
@@ -1818,14 +2977,19 @@ sound_init(PyObject *self, PyObject *arg, PyObject *kwarg)
     PyObject *file = NULL;
     PyObject *buffer = NULL;
     PyObject *array = NULL;
-    PyObject *keys;
+    PyObject *key;
+    PyObject *value;
     PyObject *kencoded;
     SDL_RWops *rw;
     Mix_Chunk *chunk = NULL;
     Uint8 *mem = NULL;
+    Py_ssize_t nkwargs = 0;
+    Py_ssize_t pos = 0;
+    int copy = 1;
 
     ((pgSoundObject *)self)->chunk = NULL;
     ((pgSoundObject *)self)->mem = NULL;
+    ((pgSoundObject *)self)->source = NULL;
 
     /* Similar to MIXER_INIT_CHECK(), but different return value. */
     if (!SDL_WasInit(SDL_INIT_AUDIO)) {
@@ -1834,11 +2998,22 @@ sound_init(PyObject *self, PyObject *arg, PyObject *kwarg)
     }
 
     /* Process arguments, returning cleaner error messages than
-       PyArg_ParseTupleAndKeywords would.
+       PyArg_ParseTupleAndKeywords would. 'copy' may go with any of them.
     */
+    if (kwarg != NULL) {
+        nkwargs = PyDict_Size(kwarg);
+        value = PyDict_GetItemString(kwarg, "copy");
+        if (value != NULL) {
+            copy = PyObject_IsTrue(value);
+            if (copy == -1) {
+                return -1;
+            }
+            --nkwargs;
+        }
+    }
+
     if (arg != NULL && PyTuple_GET_SIZE(arg)) {
-        if ((kwarg != NULL && PyDict_Size(kwarg)) || /* conditional and */
-            PyTuple_GET_SIZE(arg) != 1) {
+        if (nkwargs || PyTuple_GET_SIZE(arg) != 1) {
             PyErr_SetString(PyExc_TypeError, arg_cnt_err_msg);
             return -1;
         }
@@ -1849,26 +3024,29 @@ sound_init(PyObject *self, PyObject *arg, PyObject *kwarg)
             file = obj;
             obj = NULL;
         }
+        else if (!copy) {
+            buffer = obj;
+        }
         else {
             file = obj;
             buffer = obj;
         }
     }
-    else if (kwarg != NULL) {
-        if (PyDict_Size(kwarg) != 1) {
+    else if (nkwargs) {
+        if (nkwargs != 1) {
             PyErr_SetString(PyExc_TypeError, arg_cnt_err_msg);
             return -1;
         }
         if ((file = PyDict_GetItemString(kwarg, "file")) == NULL &&
             (buffer = PyDict_GetItemString(kwarg, "buffer")) == NULL &&
             (array = PyDict_GetItemString(kwarg, "array")) == NULL) {
-            keys = PyDict_Keys(kwarg);
-            if (keys == NULL) {
-                return -1;
+            while (PyDict_Next(kwarg, &pos, &key, &value)) {
+                if (!PyUnicode_Check(key) ||
+                    PyUnicode_CompareWithASCIIString(key, "copy")) {
+                    break;
+                }
             }
-            kencoded =
-                pg_EncodeString(PyList_GET_ITEM(keys, 0), NULL, NULL, NULL);
-            Py_DECREF(keys);
+            kencoded = pg_EncodeString(key, NULL, NULL, NULL);
             if (kencoded == NULL) {
                 return -1;
             }
@@ -1889,6 +3067,12 @@ sound_init(PyObject *self, PyObject *arg, PyObject *kwarg)
         return -1;
     }
 
+    if (file != NULL && !copy) {
+        PyErr_SetString(PyExc_TypeError,
+                        "copy=False needs a buffer or an array, not a file");
+        return -1;
+    }
+
     if (file != NULL) {
         rw = pgRWops_FromObject(file, NULL);
 
@@ -1931,6 +3115,12 @@ LOAD_BUFFER:
                 return -1;
             }
         }
+        else if (!copy) {
+            if (_chunk_from_view((pgSoundObject *)self, &view, 0, &chunk)) {
+                PyBuffer_Release(&view);
+                return -1;
+            }
+        }
         else {
             rcode = _chunk_from_buf(view.buf, view.len, &chunk, &mem);
             PyBuffer_Release(&view);
@@ -1941,7 +3131,19 @@ LOAD_BUFFER:
         }
     }
 
-    if (array != NULL) {
+    if (array != NULL && !copy) {
+        Py_buffer view;
+
+        if (PyObject_GetBuffer(array, &view,
+                               PyBUF_FORMAT | PyBUF_C_CONTIGUOUS)) {
+            return -1;
+        }
+        if (_chunk_from_view((pgSoundObject *)self, &view, 1, &chunk)) {
+            PyBuffer_Release(&view);
+            return -1;
+        }
+    }
+    else if (array != NULL) {
         pg_buffer pg_view;
         PG_sample_format_t view_format;
         int rcode;
@@ -2012,6 +3214,10 @@ static PyMethodDef _mixer_methods[] = {
     {"unpause", (PyCFunction)mixer_unpause, METH_NOARGS, DOC_MIXER_UNPAUSE},
     {"get_sdl_mixer_version", (PyCFunction)mixer_get_sdl_mixer_version,
      METH_VARARGS | METH_KEYWORDS, DOC_MIXER_GETSDLMIXERVERSION},
+    {"set_effects", (PyCFunction)mixer_set_effects,
+     METH_VARARGS | METH_KEYWORDS, DOC_MIXER_SETEFFECTS},
+    {"get_effects", (PyCFunction)mixer_get_effects, METH_NOARGS,
+     DOC_MIXER_GETEFFECTS},
     /*  { "lookup_frequency", lookup_frequency, 1, doc_lookup_frequency
        },*/
 
@@ -2094,6 +3300,12 @@ MODINIT_DEFINE(mixer)
     if (PyType_Ready(&pgChannel_Type) < 0) {
         return NULL;
     }
+    if (PyType_Ready(&pgEffect_Type) < 0) {
+        return NULL;
+    }
+    if (PyType_Ready(&pgStreamChannel_Type) < 0) {
+        return NULL;
+    }
 
     /* create the module */
     module = PyModule_Create(&_module);
@@ -2120,12 +3332,23 @@ MODINIT_DEFINE(mixer)
         Py_DECREF(module);
         return NULL;
     }
+    if (PyModule_AddObjectRef(module, "Effect", (PyObject *)&pgEffect_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    if (PyModule_AddObjectRef(module, "StreamChannel",
+                              (PyObject *)&pgStreamChannel_Type)) {
+        Py_DECREF(module);
+        return NULL;
+    }
     /* export the c api */
     c_api[0] = &pgSound_Type;
     c_api[1] = pgSound_New;
     c_api[2] = pgSound_Play;
     c_api[3] = &pgChannel_Type;
     c_api[4] = pgChannel_New;
+    c_api[5] = &pgStreamChannel_Type;
+    c_api[6] = pgStreamChannel_Push;
     apiobj = encapsulate_api(c_api, "mixer");
     if (PyModule_AddObject(module, PYGAMEAPI_LOCAL_ENTRY, apiobj)) {
         Py_XDECREF(apiobj);
@@ -8,7 +8,64 @@
     if (!SDL_WasInit(SDL_INIT_AUDIO)) \
     return RAISE(pgExc_SDLError, "mixer not initialized")
 
-#define PYGAMEAPI_MIXER_NUMSLOTS 5
+#define PYGAMEAPI_MIXER_NUMSLOTS 7
 #include "include/pygame_mixer.h"
 
+/* mixer.Effect, the native effect chain in mixer_effects.c */
+typedef enum {
+    PG_EFFECT_LOWPASS,
+    PG_EFFECT_HIGHPASS,
+    PG_EFFECT_BANDPASS,
+    PG_EFFECT_DELAY,
+    PG_EFFECT_REVERB,
+    PG_EFFECT_GAIN,
+    PG_EFFECT_PAN,
+    PG_EFFECT_PITCH,
+    PG_EFFECT_KINDS
+} pgEffectKind;
+
+#define PG_EFFECT_MAX_PARAMS 3
+/* the most effects one chain can hold */
+#define PG_EFFECT_MAX_UNITS 16
+
+typedef struct {
+    const char *name;
+    float value, min, max; /* the default and the accepted range */
+} pgEffectParamInfo;
+
+typedef struct {
+    const char *name;
+    int n_params;
+    pgEffectParamInfo params[PG_EFFECT_MAX_PARAMS];
+} pgEffectKindInfo;
+
+extern const pgEffectKindInfo pg_effect_kinds[PG_EFFECT_KINDS];
+
+/* The parameters of one effect. The audio thread copies them out under the
+   lock when serial has moved since it last looked. */
+typedef struct {
+    pgEffectKind kind;
+    SDL_SpinLock lock;
+    SDL_atomic_t serial;
+    float values[PG_EFFECT_MAX_PARAMS];
+} pgEffectParams;
+
+typedef struct {
+    PyObject_HEAD pgEffectParams params;
+    int ready; /* set by __init__ */
+} pgEffectObject;
+
+/* A chain runs effects one after another over interleaved audio of the
+   format, frequency and channel count it was made for. Each chain keeps its
+   own filter and delay state, so one Effect can be used by many chains. */
+typedef struct pgEffectChain pgEffectChain;
+
+pgEffectChain *
+pgEffectChain_New(pgEffectParams **params, int count, int freq,
+                  Uint16 format, int channels);
+void
+pgEffectChain_Free(pgEffectChain *chain);
+void
+pgEffectChain_Process(pgEffectChain *chain, void *stream, int len);
+
 #endif /* ~MIXER_INTERNAL_H */
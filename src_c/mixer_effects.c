@@ -0,0 +1,701 @@
+/*
+  pygame-ce - Python Game Library
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Library General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Library General Public License for more details.
+
+  You should have received a copy of the GNU Library General Public
+  License along with this library; if not, write to the Free
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+*/
+
+/*
+ *  effect chains for mixer channels, run on the audio thread
+ *
+ *  Audio is taken in blocks of PG_EFFECT_BLOCK frames, turned into floats
+ *  in [-1, 1), run through each effect in turn and turned back. Nothing here
+ *  touches Python; mixer.c owns the Effect objects and registers chains
+ *  with SDL_mixer.
+ */
+#define NO_PYGAME_C_API
+#include "pygame.h"
+
+#include "mixer.h"
+
+#include "simd_mixer.h"
+
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.1415926535897932384626433832795
+#endif
+
+#define PG_EFFECT_BLOCK 256
+#define PG_EFFECT_MAX_CHANNELS 8
+
+/* longest delay time, in seconds */
+#define PG_EFFECT_DELAY_MAX 2
+/* the window the pitch shifter reads across, in seconds */
+#define PG_EFFECT_PITCH_WINDOW 0.05
+
+/* stops decaying feedback from falling into slow denormal floats */
+#define PG_EFFECT_FLUSH(x)         \
+    do {                           \
+        if (fabsf(x) < 1.0e-18f) { \
+            (x) = 0.0f;            \
+        }                          \
+    } while (0)
+
+const pgEffectKindInfo pg_effect_kinds[PG_EFFECT_KINDS] = {
+    {"lowpass",
+     2,
+     {{"frequency", 1000.0f, 1.0f, 100000.0f}, {"q", 0.7071f, 0.01f, 100.0f}}},
+    {"highpass",
+     2,
+     {{"frequency", 1000.0f, 1.0f, 100000.0f}, {"q", 0.7071f, 0.01f, 100.0f}}},
+    {"bandpass",
+     2,
+     {{"frequency", 1000.0f, 1.0f, 100000.0f}, {"q", 0.7071f, 0.01f, 100.0f}}},
+    {"delay",
+     3,
+     {{"time", 250.0f, 1.0f, PG_EFFECT_DELAY_MAX * 1000.0f},
+      {"feedback", 0.5f, 0.0f, 0.99f},
+      {"mix", 0.5f, 0.0f, 1.0f}}},
+    {"reverb",
+     3,
+     {{"room", 0.5f, 0.0f, 1.0f},
+      {"damping", 0.5f, 0.0f, 1.0f},
+      {"mix", 0.3f, 0.0f, 1.0f}}},
+    {"gain",
+     2,
+     {{"volume", 1.0f, 0.0f, 16.0f}, {"ramp", 0.0f, 0.0f, 60000.0f}}},
+    {"pan", 2, {{"pan", 0.0f, -1.0f, 1.0f}, {"ramp", 0.0f, 0.0f, 60000.0f}}},
+    {"pitch", 1, {{"ratio", 1.0f, 0.25f, 4.0f}}},
+};
+
+/* The reverb is a small Freeverb: four damped combs into two allpasses per
+   channel. Lengths are in frames at 44100 Hz; odd channels are spread a
+   little longer so stereo input gets a wider tail. */
+#define PG_REVERB_COMBS 4
+#define PG_REVERB_ALLPASSES 2
+#define PG_REVERB_SPREAD 23
+#define PG_REVERB_INPUT_GAIN 0.015f
+#define PG_REVERB_WET_GAIN 3.0f
+
+static const int reverb_comb_lengths[PG_REVERB_COMBS] = {1116, 1188, 1277,
+                                                         1356};
+static const int reverb_allpass_lengths[PG_REVERB_ALLPASSES] = {556, 441};
+
+typedef struct {
+    float *buf;
+    int len, pos;
+    float store;
+} pgEffectLine;
+
+typedef struct {
+    pgEffectParams *params;
+    int serial; /* the params serial the fields below were set from */
+    float values[PG_EFFECT_MAX_PARAMS];
+
+    /* lowpass, highpass and bandpass */
+    float b0, b1, b2, a1, a2;
+    float z1[PG_EFFECT_MAX_CHANNELS], z2[PG_EFFECT_MAX_CHANNELS];
+
+    /* gain and pan */
+    float gain[PG_EFFECT_MAX_CHANNELS], target[PG_EFFECT_MAX_CHANNELS];
+    float step[PG_EFFECT_MAX_CHANNELS];
+    int ramp; /* frames left until gain reaches target */
+
+    /* delay and pitch: an interleaved ring of len frames */
+    float *mem;
+    int len, pos, delay;
+    float phase;
+
+    /* reverb, using mem for the lines */
+    pgEffectLine combs[PG_EFFECT_MAX_CHANNELS][PG_REVERB_COMBS];
+    pgEffectLine allpasses[PG_EFFECT_MAX_CHANNELS][PG_REVERB_ALLPASSES];
+} pgEffectUnit;
+
+struct pgEffectChain {
+    int freq, channels;
+    Uint16 format;
+    int has_avx2, has_sse2;
+    int n_units;
+    pgEffectUnit units[PG_EFFECT_MAX_UNITS];
+    float work[PG_EFFECT_BLOCK * PG_EFFECT_MAX_CHANNELS];
+};
+
+static int
+_effect_format_size(Uint16 format)
+{
+    switch (format) {
+        case AUDIO_U8:
+        case AUDIO_S8:
+            return 1;
+        case AUDIO_U16SYS:
+        case AUDIO_S16SYS:
+            return 2;
+        case AUDIO_S32SYS:
+        case AUDIO_F32SYS:
+            return 4;
+    }
+    return 0;
+}
+
+static int
+_effect_unit_init(pgEffectUnit *unit, pgEffectParams *params, int freq,
+                  int channels)
+{
+    double scale = freq / 44100.0;
+    int c, k, total = 0, spread;
+    float *mem;
+
+    memset(unit, 0, sizeof(pgEffectUnit));
+    unit->params = params;
+    unit->serial = -1;
+
+    switch (params->kind) {
+        case PG_EFFECT_DELAY:
+            unit->len = PG_EFFECT_DELAY_MAX * freq + 1;
+            break;
+        case PG_EFFECT_PITCH:
+            unit->len = (int)(PG_EFFECT_PITCH_WINDOW * freq) + 4;
+            break;
+        case PG_EFFECT_REVERB:
+            for (c = 0; c < channels; ++c) {
+                spread = (c & 1) ? PG_REVERB_SPREAD : 0;
+                for (k = 0; k < PG_REVERB_COMBS; ++k) {
+                    unit->combs[c][k].len = MAX(
+                        1, (int)((reverb_comb_lengths[k] + spread) * scale));
+                    total += unit->combs[c][k].len;
+                }
+                for (k = 0; k < PG_REVERB_ALLPASSES; ++k) {
+                    unit->allpasses[c][k].len = MAX(
+                        1,
+                        (int)((reverb_allpass_lengths[k] + spread) * scale));
+                    total += unit->allpasses[c][k].len;
+                }
+            }
+            mem = (float *)calloc(total, sizeof(float));
+            if (!mem) {
+                return -1;
+            }
+            unit->mem = mem;
+            for (c = 0; c < channels; ++c) {
+                for (k = 0; k < PG_REVERB_COMBS; ++k) {
+                    unit->combs[c][k].buf = mem;
+                    mem += unit->combs[c][k].len;
+                }
+                for (k = 0; k < PG_REVERB_ALLPASSES; ++k) {
+                    unit->allpasses[c][k].buf = mem;
+                    mem += unit->allpasses[c][k].len;
+                }
+            }
+            return 0;
+        default:
+            return 0;
+    }
+
+    unit->mem = (float *)calloc((size_t)unit->len * channels, sizeof(float));
+    return unit->mem ? 0 : -1;
+}
+
+pgEffectChain *
+pgEffectChain_New(pgEffectParams **params, int count, int freq,
+                  Uint16 format, int channels)
+{
+    pgEffectChain *chain;
+    int i;
+
+    if (count > PG_EFFECT_MAX_UNITS || channels < 1 ||
+        channels > PG_EFFECT_MAX_CHANNELS || freq < 1) {
+        return NULL;
+    }
+    chain = (pgEffectChain *)calloc(1, sizeof(pgEffectChain));
+    if (!chain) {
+        return NULL;
+    }
+    chain->freq = freq;
+    chain->format = format;
+    chain->channels = channels;
+    chain->has_avx2 = SDL_HasAVX2();
+    chain->has_sse2 = SDL_HasSSE2() || SDL_HasNEON();
+    for (i = 0; i < count; ++i) {
+        if (_effect_unit_init(chain->units + i, params[i], freq, channels)) {
+            pgEffectChain_Free(chain);
+            return NULL;
+        }
+        chain->n_units = i + 1;
+    }
+    return chain;
+}
+
+void
+pgEffectChain_Free(pgEffectChain *chain)
+{
+    int i;
+
+    if (!chain) {
+        return;
+    }
+    for (i = 0; i < chain->n_units; ++i) {
+        free(chain->units[i].mem);
+    }
+    free(chain);
+}
+
+/* conversion to and from float, count is in samples */
+
+static void
+_effect_to_float(pgEffectChain *chain, const Uint8 *src, float *dst,
+                 int count)
+{
+    int i = 0;
+
+    switch (chain->format) {
+        case AUDIO_U8:
+            for (; i < count; ++i) {
+                dst[i] = ((int)src[i] - 128) * (1.0f / 128.0f);
+            }
+            break;
+        case AUDIO_S8:
+            for (; i < count; ++i) {
+                dst[i] = ((const Sint8 *)src)[i] * (1.0f / 128.0f);
+            }
+            break;
+        case AUDIO_U16SYS:
+            for (; i < count; ++i) {
+                dst[i] = ((int)((const Uint16 *)src)[i] - 32768) *
+                         (1.0f / 32768.0f);
+            }
+            break;
+        case AUDIO_S16SYS:
+            if (chain->has_avx2) {
+                i = mixer_s16_to_float_avx2((const Sint16 *)src, dst, count);
+            }
+            if (!i && chain->has_sse2) {
+                i = mixer_s16_to_float_sse2((const Sint16 *)src, dst, count);
+            }
+            for (; i < count; ++i) {
+                dst[i] = ((const Sint16 *)src)[i] * (1.0f / 32768.0f);
+            }
+            break;
+        case AUDIO_S32SYS:
+            for (; i < count; ++i) {
+                dst[i] = (float)(((const Sint32 *)src)[i] / 2147483648.0);
+            }
+            break;
+        case AUDIO_F32SYS:
+            memcpy(dst, src, count * sizeof(float));
+            break;
+    }
+}
+
+/* NaN and out of range values clamp the same way as the SIMD kernels */
+static float
+_effect_clamp(float v, float lo, float hi)
+{
+    if (!(v >= lo)) {
+        return lo;
+    }
+    return v > hi ? hi : v;
+}
+
+static void
+_effect_from_float(pgEffectChain *chain, const float *src, Uint8 *dst,
+                   int count)
+{
+    int i = 0;
+
+    switch (chain->format) {
+        case AUDIO_U8:
+            for (; i < count; ++i) {
+                dst[i] = (Uint8)(lrintf(_effect_clamp(src[i] * 128.0f,
+                                                      -128.0f, 127.0f)) +
+                                 128);
+            }
+            break;
+        case AUDIO_S8:
+            for (; i < count; ++i) {
+                ((Sint8 *)dst)[i] = (Sint8)lrintf(
+                    _effect_clamp(src[i] * 128.0f, -128.0f, 127.0f));
+            }
+            break;
+        case AUDIO_U16SYS:
+            for (; i < count; ++i) {
+                ((Uint16 *)dst)[i] =
+                    (Uint16)(lrintf(_effect_clamp(src[i] * 32768.0f,
+                                                  -32768.0f, 32767.0f)) +
+                             32768);
+            }
+            break;
+        case AUDIO_S16SYS:
+            if (chain->has_avx2) {
+                i = mixer_float_to_s16_avx2(src, (Sint16 *)dst, count);
+            }
+            if (!i && chain->has_sse2) {
+                i = mixer_float_to_s16_sse2(src, (Sint16 *)dst, count);
+            }
+            for (; i < count; ++i) {
+                ((Sint16 *)dst)[i] = (Sint16)lrintf(
+                    _effect_clamp(src[i] * 32768.0f, -32768.0f, 32767.0f));
+            }
+            break;
+        case AUDIO_S32SYS:
+            for (; i < count; ++i) {
+                double v = src[i] * 2147483648.0;
+                if (!(v >= -2147483648.0)) {
+                    v = -2147483648.0;
+                }
+                else if (v > 2147483647.0) {
+                    v = 2147483647.0;
+                }
+                ((Sint32 *)dst)[i] = (Sint32)lrint(v);
+            }
+            break;
+        case AUDIO_F32SYS:
+            memcpy(dst, src, count * sizeof(float));
+            break;
+    }
+}
+
+/* Pick up changed parameters, recomputing whatever depends on them. */
+static void
+_effect_unit_update(pgEffectUnit *unit, pgEffectChain *chain)
+{
+    pgEffectParams *params = unit->params;
+    int serial = SDL_AtomicGet(&params->serial);
+    int first = unit->serial == -1;
+    int c, channels = chain->channels;
+    double w0, alpha, cosw, a0, freq, q;
+    float pan;
+
+    if (serial == unit->serial) {
+        return;
+    }
+    SDL_AtomicLock(&params->lock);
+    memcpy(unit->values, params->values, sizeof(unit->values));
+    unit->serial = SDL_AtomicGet(&params->serial);
+    SDL_AtomicUnlock(&params->lock);
+
+    switch (params->kind) {
+        case PG_EFFECT_LOWPASS:
+        case PG_EFFECT_HIGHPASS:
+        case PG_EFFECT_BANDPASS:
+            /* the biquads of the Audio EQ Cookbook by Robert
+             * Bristow-Johnson, kept under the Nyquist frequency */
+            freq = MIN(unit->values[0], chain->freq * 0.49);
+            q = unit->values[1];
+            w0 = 2.0 * M_PI * freq / chain->freq;
+            cosw = cos(w0);
+            alpha = sin(w0) / (2.0 * q);
+            a0 = 1.0 + alpha;
+            if (params->kind == PG_EFFECT_LOWPASS) {
+                unit->b0 = (float)((1.0 - cosw) / 2.0 / a0);
+                unit->b1 = (float)((1.0 - cosw) / a0);
+                unit->b2 = unit->b0;
+            }
+            else if (params->kind == PG_EFFECT_HIGHPASS) {
+                unit->b0 = (float)((1.0 + cosw) / 2.0 / a0);
+                unit->b1 = (float)(-(1.0 + cosw) / a0);
+                unit->b2 = unit->b0;
+            }
+            else {
+                unit->b0 = (float)(alpha / a0);
+                unit->b1 = 0.0f;
+                unit->b2 = -unit->b0;
+            }
+            unit->a1 = (float)(-2.0 * cosw / a0);
+            unit->a2 = (float)((1.0 - alpha) / a0);
+            break;
+        case PG_EFFECT_DELAY:
+            unit->delay = (int)lrint(unit->values[0] * chain->freq / 1000.0);
+            unit->delay = MAX(1, MIN(unit->delay, unit->len - 1));
+            break;
+        case PG_EFFECT_GAIN:
+        case PG_EFFECT_PAN:
+            for (c = 0; c < channels; ++c) {
+                unit->target[c] = unit->values[0];
+            }
+            if (params->kind == PG_EFFECT_PAN) {
+                /* balance: the far side fades out, the near side stays */
+                pan = unit->values[0];
+                for (c = 0; c < channels; ++c) {
+                    unit->target[c] = 1.0f;
+                }
+                if (channels == 2) {
+                    unit->target[0] = MIN(1.0f, 1.0f - pan);
+                    unit->target[1] = MIN(1.0f, 1.0f + pan);
+                }
+            }
+            unit->ramp =
+                first ? 0
+                      : (int)(unit->values[1] * chain->freq / 1000.0f);
+            for (c = 0; c < channels; ++c) {
+                if (unit->ramp > 0) {
+                    unit->step[c] =
+                        (unit->target[c] - unit->gain[c]) / unit->ramp;
+                }
+                else {
+                    unit->gain[c] = unit->target[c];
+                    unit->step[c] = 0.0f;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static void
+_effect_biquad(pgEffectUnit *unit, float *buf, int frames, int channels)
+{
+    float b0 = unit->b0, b1 = unit->b1, b2 = unit->b2;
+    float a1 = unit->a1, a2 = unit->a2;
+    float x, y, z1, z2;
+    int i, c;
+
+    /* transposed direct form II, each channel on its own */
+    for (c = 0; c < channels; ++c) {
+        z1 = unit->z1[c];
+        z2 = unit->z2[c];
+        for (i = 0; i < frames; ++i) {
+            x = buf[i * channels + c];
+            y = b0 * x + z1;
+            z1 = b1 * x - a1 * y + z2;
+            z2 = b2 * x - a2 * y;
+            PG_EFFECT_FLUSH(z1);
+            PG_EFFECT_FLUSH(z2);
+            buf[i * channels + c] = y;
+        }
+        unit->z1[c] = z1;
+        unit->z2[c] = z2;
+    }
+}
+
+/* buf[i][c] *= start[c] + step[c] * i */
+static void
+_effect_ramp(pgEffectChain *chain, float *buf, int frames, const float *start,
+             const float *step)
+{
+    int channels = chain->channels;
+    int i = 0, c;
+
+    if (chain->has_avx2) {
+        i = mixer_ramp_avx2(buf, frames, channels, start, step);
+    }
+    if (!i && chain->has_sse2) {
+        i = mixer_ramp_sse2(buf, frames, channels, start, step);
+    }
+    for (; i < frames; ++i) {
+        for (c = 0; c < channels; ++c) {
+            buf[i * channels + c] *= start[c] + step[c] * (float)i;
+        }
+    }
+}
+
+static void
+_effect_gain(pgEffectUnit *unit, pgEffectChain *chain, float *buf,
+             int frames)
+{
+    static const float still[PG_EFFECT_MAX_CHANNELS] = {0.0f};
+    int c, channels = chain->channels;
+    int n = MIN(frames, unit->ramp);
+
+    if (n > 0) {
+        _effect_ramp(chain, buf, n, unit->gain, unit->step);
+        unit->ramp -= n;
+        for (c = 0; c < channels; ++c) {
+            unit->gain[c] =
+                unit->ramp ? unit->gain[c] + unit->step[c] * n
+                           : unit->target[c];
+        }
+    }
+    if (n < frames) {
+        _effect_ramp(chain, buf + n * channels, frames - n, unit->gain,
+                     still);
+    }
+}
+
+static void
+_effect_delay(pgEffectUnit *unit, float *buf, int frames, int channels)
+{
+    float feedback = unit->values[1], mix = unit->values[2];
+    float *mem = unit->mem;
+    int len = unit->len, pos = unit->pos;
+    int i, c, back;
+    float x, d, w;
+
+    for (i = 0; i < frames; ++i) {
+        back = pos - unit->delay;
+        if (back < 0) {
+            back += len;
+        }
+        for (c = 0; c < channels; ++c) {
+            x = buf[i * channels + c];
+            d = mem[back * channels + c];
+            buf[i * channels + c] = x + mix * d;
+            w = x + feedback * d;
+            PG_EFFECT_FLUSH(w);
+            mem[pos * channels + c] = w;
+        }
+        if (++pos == len) {
+            pos = 0;
+        }
+    }
+    unit->pos = pos;
+}
+
+static void
+_effect_reverb(pgEffectUnit *unit, float *buf, int frames, int channels)
+{
+    float feedback = 0.7f + 0.28f * unit->values[0];
+    float damp = unit->values[1] * 0.4f;
+    float mix = unit->values[2];
+    pgEffectLine *line;
+    float x, in, out, y, b;
+    int i, c, k;
+
+    for (c = 0; c < channels; ++c) {
+        for (i = 0; i < frames; ++i) {
+            x = buf[i * channels + c];
+            in = x * PG_REVERB_INPUT_GAIN;
+            out = 0.0f;
+            for (k = 0; k < PG_REVERB_COMBS; ++k) {
+                line = unit->combs[c] + k;
+                y = line->buf[line->pos];
+                line->store = y * (1.0f - damp) + line->store * damp;
+                PG_EFFECT_FLUSH(line->store);
+                line->buf[line->pos] = in + line->store * feedback;
+                if (++line->pos == line->len) {
+                    line->pos = 0;
+                }
+                out += y;
+            }
+            for (k = 0; k < PG_REVERB_ALLPASSES; ++k) {
+                line = unit->allpasses[c] + k;
+                b = line->buf[line->pos];
+                y = out + b * 0.5f;
+                PG_EFFECT_FLUSH(y);
+                line->buf[line->pos] = y;
+                if (++line->pos == line->len) {
+                    line->pos = 0;
+                }
+                out = b - out;
+            }
+            buf[i * channels + c] =
+                x * (1.0f - mix) + out * (PG_REVERB_WET_GAIN * mix);
+        }
+    }
+}
+
+/* Pitch shifting by two read taps that sweep through a short delay line at
+   a speed set by the ratio, half a window apart. Each tap fades in and out
+   with a triangle window, so the jump back when a tap wraps is silent and
+   the two always sum to full level. */
+static void
+_effect_pitch(pgEffectUnit *unit, float *buf, int frames, int channels)
+{
+    float window = (float)(unit->len - 4);
+    float inc = (1.0f - unit->values[0]) / window;
+    float *mem = unit->mem;
+    int len = unit->len, pos = unit->pos;
+    float phase = unit->phase, tap_phase, at, frac, w;
+    float out[PG_EFFECT_MAX_CHANNELS];
+    int i, c, k, a, b;
+
+    for (i = 0; i < frames; ++i) {
+        for (c = 0; c < channels; ++c) {
+            mem[pos * channels + c] = buf[i * channels + c];
+            out[c] = 0.0f;
+        }
+        for (k = 0; k < 2; ++k) {
+            tap_phase = k ? phase + 0.5f : phase;
+            if (tap_phase >= 1.0f) {
+                tap_phase -= 1.0f;
+            }
+            w = 1.0f - fabsf(2.0f * tap_phase - 1.0f);
+            at = pos - (1.0f + tap_phase * window);
+            if (at < 0.0f) {
+                at += len;
+            }
+            a = (int)at;
+            frac = at - a;
+            b = a + 1 == len ? 0 : a + 1;
+            for (c = 0; c < channels; ++c) {
+                out[c] += w * (mem[a * channels + c] * (1.0f - frac) +
+                               mem[b * channels + c] * frac);
+            }
+        }
+        for (c = 0; c < channels; ++c) {
+            buf[i * channels + c] = out[c];
+        }
+        phase += inc;
+        if (phase >= 1.0f) {
+            phase -= 1.0f;
+        }
+        else if (phase < 0.0f) {
+            phase += 1.0f;
+        }
+        if (++pos == len) {
+            pos = 0;
+        }
+    }
+    unit->phase = phase;
+    unit->pos = pos;
+}
+
+void
+pgEffectChain_Process(pgEffectChain *chain, void *stream, int len)
+{
+    int channels = chain->channels;
+    int frame_size = _effect_format_size(chain->format) * channels;
+    int frames, done, n, u;
+    pgEffectUnit *unit;
+    Uint8 *data;
+
+    if (!frame_size || !chain->n_units) {
+        return;
+    }
+    frames = len / frame_size;
+    for (done = 0; done < frames; done += n) {
+        n = MIN(frames - done, PG_EFFECT_BLOCK);
+        data = (Uint8 *)stream + (size_t)done * frame_size;
+        _effect_to_float(chain, data, chain->work, n * channels);
+        for (u = 0; u < chain->n_units; ++u) {
+            unit = chain->units + u;
+            _effect_unit_update(unit, chain);
+            switch (unit->params->kind) {
+                case PG_EFFECT_LOWPASS:
+                case PG_EFFECT_HIGHPASS:
+                case PG_EFFECT_BANDPASS:
+                    _effect_biquad(unit, chain->work, n, channels);
+                    break;
+                case PG_EFFECT_DELAY:
+                    _effect_delay(unit, chain->work, n, channels);
+                    break;
+                case PG_EFFECT_REVERB:
+                    _effect_reverb(unit, chain->work, n, channels);
+                    break;
+                case PG_EFFECT_GAIN:
+                case PG_EFFECT_PAN:
+                    _effect_gain(unit, chain, chain->work, n);
+                    break;
+                case PG_EFFECT_PITCH:
+                    _effect_pitch(unit, chain->work, n, channels);
+                    break;
+                default:
+                    break;
+            }
+        }
+        _effect_from_float(chain, chain->work, data, n * channels);
+    }
+}
@@ -0,0 +1,227 @@
+/*
+  pygame-ce - Python Game Library
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Library General Public
+  License as published by the Free Software Foundation; either
+  version 2 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Library General Public License for more details.
+
+  You should have received a copy of the GNU Library General Public
+  License along with this library; if not, write to the Free
+  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+/* Hot path counters, read from python with pygame.system.get_perf_counters.
+ *
+ * Include after _pygame.h. The counters live in the base module and are
+ * handed out through its C API. A module that counts defines pg_perf_state
+ * with PG_PERF_DEFINE_STATE and sets it with PG_PERF_IMPORT_STATE after
+ * import_pygame_base(); its other files see it through the extern below.
+ *
+ * Counting is off until pygame.system.enable_perf_counters() is called, and
+ * otherwise costs a load and a branch per kernel call. Building with the
+ * perf_counters meson option off (PG_PERF_COUNTERS 0) compiles it out. The
+ * counters are not atomic, so count with the GIL held: start before
+ * Py_BEGIN_ALLOW_THREADS and count after Py_END_ALLOW_THREADS.
+ *
+ * The state also carries the pygame.system.set_blit_diagnostics mode, which
+ * pgSurface_Blit reads. */
+
+#ifndef PGPERF_H
+#define PGPERF_H
+
+#ifndef PG_PERF_COUNTERS
+#define PG_PERF_COUNTERS 1
+#endif
+
+/* X(id, name): every kernel that is counted, name is the key in
+ * get_perf_counters. Paths are avx2, sse2 (also NEON through sse2neon) and
+ * scalar; a kernel without a suffix has a single path. */
+#define PG_PERF_KERNELS(X)                                          \
+    X(BLIT_SOLID, "blit.solid")                                     \
+    X(BLIT_COLORKEY, "blit.colorkey")                               \
+    X(BLIT_ALPHA_AVX2, "blit.alpha.avx2")                           \
+    X(BLIT_ALPHA_SSE2, "blit.alpha.sse2")                           \
+    X(BLIT_ALPHA_SCALAR, "blit.alpha.scalar")                       \
+    X(BLIT_ADD_AVX2, "blit.add.avx2")                               \
+    X(BLIT_ADD_SSE2, "blit.add.sse2")                               \
+    X(BLIT_ADD_SCALAR, "blit.add.scalar")                           \
+    X(BLIT_SUB_AVX2, "blit.sub.avx2")                               \
+    X(BLIT_SUB_SSE2, "blit.sub.sse2")                               \
+    X(BLIT_SUB_SCALAR, "blit.sub.scalar")                           \
+    X(BLIT_MULT_AVX2, "blit.mult.avx2")                             \
+    X(BLIT_MULT_SSE2, "blit.mult.sse2")                             \
+    X(BLIT_MULT_SCALAR, "blit.mult.scalar")                         \
+    X(BLIT_MIN_AVX2, "blit.min.avx2")                               \
+    X(BLIT_MIN_SSE2, "blit.min.sse2")                               \
+    X(BLIT_MIN_SCALAR, "blit.min.scalar")                           \
+    X(BLIT_MAX_AVX2, "blit.max.avx2")                               \
+    X(BLIT_MAX_SSE2, "blit.max.sse2")                               \
+    X(BLIT_MAX_SCALAR, "blit.max.scalar")                           \
+    X(BLIT_RGBA_ADD_AVX2, "blit.rgba_add.avx2")                     \
+    X(BLIT_RGBA_ADD_SSE2, "blit.rgba_add.sse2")                     \
+    X(BLIT_RGBA_ADD_SCALAR, "blit.rgba_add.scalar")                 \
+    X(BLIT_RGBA_SUB_AVX2, "blit.rgba_sub.avx2")                     \
+    X(BLIT_RGBA_SUB_SSE2, "blit.rgba_sub.sse2")                     \
+    X(BLIT_RGBA_SUB_SCALAR, "blit.rgba_sub.scalar")                 \
+    X(BLIT_RGBA_MULT_AVX2, "blit.rgba_mult.avx2")                   \
+    X(BLIT_RGBA_MULT_SSE2, "blit.rgba_mult.sse2")                   \
+    X(BLIT_RGBA_MULT_SCALAR, "blit.rgba_mult.scalar")               \
+    X(BLIT_RGBA_MIN_AVX2, "blit.rgba_min.avx2")                     \
+    X(BLIT_RGBA_MIN_SSE2, "blit.rgba_min.sse2")                     \
+    X(BLIT_RGBA_MIN_SCALAR, "blit.rgba_min.scalar")                 \
+    X(BLIT_RGBA_MAX_AVX2, "blit.rgba_max.avx2")                     \
+    X(BLIT_RGBA_MAX_SSE2, "blit.rgba_max.sse2")                     \
+    X(BLIT_RGBA_MAX_SCALAR, "blit.rgba_max.scalar")                 \
+    X(BLIT_PREMULTIPLIED_AVX2, "blit.premultiplied.avx2")           \
+    X(BLIT_PREMULTIPLIED_SSE2, "blit.premultiplied.sse2")           \
+    X(BLIT_PREMULTIPLIED_SCALAR, "blit.premultiplied.scalar")       \
+    X(BLIT_SDL, "blit.sdl")                                         \
+    X(FILL_SOLID, "fill.solid")                                     \
+    X(FILL_ADD_AVX2, "fill.add.avx2")                               \
+    X(FILL_ADD_SSE2, "fill.add.sse2")                               \
+    X(FILL_ADD_SCALAR, "fill.add.scalar")                           \
+    X(FILL_SUB_AVX2, "fill.sub.avx2")                               \
+    X(FILL_SUB_SSE2, "fill.sub.sse2")                               \
+    X(FILL_SUB_SCALAR, "fill.sub.scalar")                           \
+    X(FILL_MULT_AVX2, "fill.mult.avx2")                             \
+    X(FILL_MULT_SSE2, "fill.mult.sse2")                             \
+    X(FILL_MULT_SCALAR, "fill.mult.scalar")                         \
+    X(FILL_MIN_AVX2, "fill.min.avx2")                               \
+    X(FILL_MIN_SSE2, "fill.min.sse2")                               \
+    X(FILL_MIN_SCALAR, "fill.min.scalar")                           \
+    X(FILL_MAX_AVX2, "fill.max.avx2")                               \
+    X(FILL_MAX_SSE2, "fill.max.sse2")                               \
+    X(FILL_MAX_SCALAR, "fill.max.scalar")                           \
+    X(FILL_RGBA_ADD_AVX2, "fill.rgba_add.avx2")                     \
+    X(FILL_RGBA_ADD_SSE2, "fill.rgba_add.sse2")                     \
+    X(FILL_RGBA_ADD_SCALAR, "fill.rgba_add.scalar")                 \
+    X(FILL_RGBA_SUB_AVX2, "fill.rgba_sub.avx2")                     \
+    X(FILL_RGBA_SUB_SSE2, "fill.rgba_sub.sse2")                     \
+    X(FILL_RGBA_SUB_SCALAR, "fill.rgba_sub.scalar")                 \
+    X(FILL_RGBA_MULT_AVX2, "fill.rgba_mult.avx2")                   \
+    X(FILL_RGBA_MULT_SSE2, "fill.rgba_mult.sse2")                   \
+    X(FILL_RGBA_MULT_SCALAR, "fill.rgba_mult.scalar")               \
+    X(FILL_RGBA_MIN_AVX2, "fill.rgba_min.avx2")                     \
+    X(FILL_RGBA_MIN_SSE2, "fill.rgba_min.sse2")                     \
+    X(FILL_RGBA_MIN_SCALAR, "fill.rgba_min.scalar")                 \
+    X(FILL_RGBA_MAX_AVX2, "fill.rgba_max.avx2")                     \
+    X(FILL_RGBA_MAX_SSE2, "fill.rgba_max.sse2")                     \
+    X(FILL_RGBA_MAX_SCALAR, "fill.rgba_max.scalar")                 \
+    X(CONVERT, "convert")                                           \
+    X(CONVERT_ALPHA, "convert_alpha")                               \
+    X(PREMUL_ALPHA_AVX2, "premul_alpha.avx2")                       \
+    X(PREMUL_ALPHA_SSE2, "premul_alpha.sse2")                       \
+    X(PREMUL_ALPHA_SCALAR, "premul_alpha.scalar")                   \
+    X(TRANSFORM_SCALE, "transform.scale")                           \
+    X(TRANSFORM_SMOOTHSCALE_SSE2, "transform.smoothscale.sse2")     \
+    X(TRANSFORM_SMOOTHSCALE_MMX, "transform.smoothscale.mmx")       \
+    X(TRANSFORM_SMOOTHSCALE_SCALAR, "transform.smoothscale.scalar") \
+    X(TRANSFORM_ROTATE, "transform.rotate")                         \
+    X(TRANSFORM_ROTOZOOM, "transform.rotozoom")                     \
+    X(TRANSFORM_FLIP, "transform.flip")                             \
+    X(TRANSFORM_GRAYSCALE_AVX2, "transform.grayscale.avx2")         \
+    X(TRANSFORM_GRAYSCALE_SSE2, "transform.grayscale.sse2")         \
+    X(TRANSFORM_GRAYSCALE_SCALAR, "transform.grayscale.scalar")     \
+    X(TRANSFORM_INVERT_AVX2, "transform.invert.avx2")               \
+    X(TRANSFORM_INVERT_SSE2, "transform.invert.sse2")               \
+    X(TRANSFORM_INVERT_SCALAR, "transform.invert.scalar")           \
+    X(TRANSFORM_BOX_BLUR, "transform.box_blur")                     \
+    X(TRANSFORM_GAUSSIAN_BLUR, "transform.gaussian_blur")           \
+    X(DRAW_LINE, "draw.line")                                       \
+    X(DRAW_LINES, "draw.lines")                                     \
+    X(DRAW_AALINE, "draw.aaline")                                   \
+    X(DRAW_AALINES, "draw.aalines")                                 \
+    X(DRAW_RECT, "draw.rect")                                       \
+    X(DRAW_CIRCLE, "draw.circle")                                   \
+    X(DRAW_AACIRCLE, "draw.aacircle")                               \
+    X(DRAW_ELLIPSE, "draw.ellipse")                                 \
+    X(DRAW_ARC, "draw.arc")                                         \
+    X(DRAW_POLYGON, "draw.polygon")
+
+#define PG_PERF_ENUM(id, name) PG_PERF_##id,
+typedef enum {
+    PG_PERF_KERNELS(PG_PERF_ENUM) PG_PERF_NUM_KERNELS
+} pgPerfKernel;
+#undef PG_PERF_ENUM
+
+typedef struct {
+    Uint64 calls;
+    Uint64 pixels;
+    Uint64 ticks; /* SDL_GetPerformanceCounter ticks */
+} pgPerfCounter;
+
+/* blit_diagnostics modes */
+#define PG_BLIT_DIAGNOSTICS_OFF 0
+#define PG_BLIT_DIAGNOSTICS_WARN 1
+#define PG_BLIT_DIAGNOSTICS_CONVERT 2
+
+typedef struct {
+    int enabled;
+    pgPerfCounter counters[PG_PERF_NUM_KERNELS];
+    int blit_diagnostics; /* PG_BLIT_DIAGNOSTICS_* */
+    int blit_threshold;   /* slow blits of a source before acting */
+} pgPerfState;
+
+#define PG_PERF_STATE_SLOT 30
+
+#ifndef BUILD_STATIC
+#define PG_PERF_DEFINE_STATE pgPerfState *pg_perf_state = NULL;
+#define PG_PERF_IMPORT_STATE()                                      \
+    pg_perf_state =                                                 \
+        (pgPerfState *)PYGAMEAPI_GET_SLOT(base, PG_PERF_STATE_SLOT)
+#else /* static builds, where base.c defines pg_perf_state for everyone */
+#define PG_PERF_DEFINE_STATE
+#define PG_PERF_IMPORT_STATE()
+#endif /* ~BUILD_STATIC */
+
+extern pgPerfState *pg_perf_state;
+
+#if PG_PERF_COUNTERS
+
+static PG_INLINE Uint64
+pg_perf_start(void)
+{
+    if (pg_perf_state && pg_perf_state->enabled) {
+        return SDL_GetPerformanceCounter();
+    }
+    return 0;
+}
+
+static PG_INLINE void
+pg_perf_add(pgPerfKernel kernel, Uint64 pixels, Uint64 start)
+{
+    pgPerfCounter *counter = &pg_perf_state->counters[kernel];
+
+    counter->calls++;
+    counter->pixels += pixels;
+    counter->ticks += SDL_GetPerformanceCounter() - start;
+}
+
+/* PG_PERF_START(t) declares t and starts timing when counting is on,
+ * PG_PERF_COUNT(t, ID, pixels) adds a call of PG_PERF_ID since then and
+ * PG_PERF_COUNT_KERNEL does the same for a pgPerfKernel value. */
+#define PG_PERF_START(t) Uint64 t = pg_perf_start()
+#define PG_PERF_COUNT(t, id, pixels) \
+    PG_PERF_COUNT_KERNEL(t, PG_PERF_##id, pixels)
+#define PG_PERF_COUNT_KERNEL(t, kernel, pixels)           \
+    do {                                                  \
+        if (t) {                                          \
+            pg_perf_add((kernel), (Uint64)(pixels), (t)); \
+        }                                                 \
+    } while (0)
+
+#else /* ~PG_PERF_COUNTERS */
+
+#define PG_PERF_START(t)
+#define PG_PERF_COUNT(t, id, pixels)
+#define PG_PERF_COUNT_KERNEL(t, kernel, pixels)
+
+#endif /* ~PG_PERF_COUNTERS */
+
+#endif /* ~PGPERF_H */
@@ -168,6 +168,7 @@ _cleanup_array(pgPixelArrayObject *array)
         Py_DECREF(array->parent);
     }
     else {
+        pgSurface_Touch(array->surface);
         pgSurface_UnlockBy(array->surface, (PyObject *)array);
     }
     Py_DECREF(array->surface);
@@ -549,6 +549,7 @@ array_to_surface(PyObject *self, PyObject *arg)
         pgBuffer_Release(&pg_view);
         return RAISE(PyExc_ValueError, "array must match surface dimensions");
     }
+    pgSurface_Touch(surfobj);
     if (!pgSurface_LockBy(surfobj, arrayobj)) {
         pgBuffer_Release(&pg_view);
         return NULL;
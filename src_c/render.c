@@ -237,6 +237,10 @@ static PyObject *
 renderer_present(pgRendererObject *self, PyObject *_null)
 {
     SDL_RenderPresent(self->renderer);
+    self->last_upload_bytes = self->upload_bytes;
+    self->last_uploads = self->uploads;
+    self->upload_bytes = 0;
+    self->uploads = 0;
     Py_RETURN_NONE;
 }
 
@@ -329,6 +333,7 @@ renderer_to_surface(pgRendererObject *self, PyObject *args, PyObject *kwargs)
             return RAISE(PyExc_ValueError, "the surface is too small");
         }
         format = surf->format->format;
+        pgSurface_Touch(surface);
     }
     else {
         format = SDL_GetWindowPixelFormat(self->window->_win);
@@ -347,6 +352,453 @@ renderer_to_surface(pgRendererObject *self, PyObject *args, PyObject *kwargs)
     return (PyObject *)surface;
 }
 
+/* Surface mirrors. Renderer.blit keeps a texture for each surface it is
+ * given and only uploads it again when the surface has been written to
+ * (pgSurface_GetGeneration). Surfaces over memory pygame doesn't own, or
+ * held locked, can be written without that showing, so they are uploaded
+ * on every blit. The colorkey is baked into the texture's alpha, so a new
+ * colorkey makes a new texture. A mirror goes away with its surface. */
+typedef struct {
+    SDL_Texture *texture;
+    Uint32 format;       /* the texture's */
+    int w, h;
+    PyObject *surfref;   /* weak reference to the surface */
+    PyObject *mirrors;   /* the renderer's dict this is in, borrowed */
+    PyObject *key;       /* this mirror's key in it */
+    Uint64 generation;
+    int has_colorkey;
+    Uint32 colorkey;
+} pgSurfaceMirror;
+
+static void
+mirror_free(pgSurfaceMirror *mirror)
+{
+    SDL_DestroyTexture(mirror->texture);
+    Py_XDECREF(mirror->surfref);
+    Py_XDECREF(mirror->key);
+    PyMem_Free(mirror);
+}
+
+static void
+mirror_capsule_destructor(PyObject *capsule)
+{
+    mirror_free((pgSurfaceMirror *)PyCapsule_GetPointer(capsule, "mirror"));
+}
+
+/* The weak reference callback of a mirror, with the mirror as self. */
+static PyObject *
+mirror_surface_deleted(PyObject *self, PyObject *weakref)
+{
+    pgSurfaceMirror *mirror =
+        (pgSurfaceMirror *)PyCapsule_GetPointer(self, "mirror");
+    PyObject *key, *capsule;
+    int result = 0;
+
+    if (!mirror) {
+        return NULL;
+    }
+    /* deleting the mirror releases the weak reference being called back */
+    Py_INCREF(weakref);
+    key = mirror->key;
+    Py_INCREF(key);
+    capsule = PyDict_GetItemWithError(mirror->mirrors, key);
+    if (capsule && PyCapsule_GetPointer(capsule, "mirror") == mirror) {
+        result = PyDict_DelItem(mirror->mirrors, key);
+    }
+    else if (!capsule && PyErr_Occurred()) {
+        result = -1;
+    }
+    Py_DECREF(key);
+    Py_DECREF(weakref);
+    if (result < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef mirror_surface_deleted_def = {
+    "_mirror_surface_deleted", mirror_surface_deleted, METH_O, NULL};
+
+/* Whether the surface may have been written without its generation
+ * changing: its pixels are in memory pygame doesn't own, like
+ * image.frombuffer() ones, or it is locked, under a surfarray array for
+ * example. Subsurfaces share their owner's pixels. */
+static int
+mirror_always_dirty(pgSurfaceObject *surfobj)
+{
+    while (surfobj) {
+        if (surfobj->dependency ||
+            (surfobj->locklist && PyList_GET_SIZE(surfobj->locklist) > 0)) {
+            return 1;
+        }
+        surfobj = surfobj->subsurface
+                      ? (pgSurfaceObject *)surfobj->subsurface->owner
+                      : NULL;
+    }
+    return 0;
+}
+
+/* Uploads the surface, which has the same size as the texture, again. */
+static int
+mirror_update(pgRendererObject *self, pgSurfaceMirror *mirror,
+              SDL_Surface *surf)
+{
+    SDL_Surface *current = surf;
+    int result = 0;
+
+    if (surf->format->format != mirror->format || SDL_HasColorKey(surf) ||
+        SDL_MUSTLOCK(surf)) {
+        current = SDL_ConvertSurfaceFormat(surf, mirror->format, 0);
+        if (!current) {
+            PyErr_SetString(pgExc_SDLError, SDL_GetError());
+            return -1;
+        }
+    }
+    if (SDL_UpdateTexture(mirror->texture, NULL, current->pixels,
+                          current->pitch) < 0) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        result = -1;
+    }
+    else {
+        self->upload_bytes += (Uint64)current->w * current->h *
+                              current->format->BytesPerPixel;
+        self->uploads++;
+    }
+    if (current != surf) {
+        SDL_FreeSurface(current);
+    }
+    return result;
+}
+
+static pgSurfaceMirror *
+mirror_new(pgRendererObject *self, pgSurfaceObject *surfobj, PyObject *key)
+{
+    SDL_Surface *surf = pgSurface_AsSurface(surfobj);
+    pgSurfaceMirror *mirror;
+    PyObject *mirrorobj, *callback;
+
+    mirror = (pgSurfaceMirror *)PyMem_Calloc(1, sizeof(pgSurfaceMirror));
+    if (!mirror) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    mirror->mirrors = self->mirrors;
+    mirror->key = key;
+    Py_INCREF(key);
+    mirrorobj = PyCapsule_New(mirror, "mirror", NULL);
+    callback = mirrorobj
+                   ? PyCFunction_New(&mirror_surface_deleted_def, mirrorobj)
+                   : NULL;
+    Py_XDECREF(mirrorobj);
+    if (!callback) {
+        mirror_free(mirror);
+        return NULL;
+    }
+    mirror->surfref = PyWeakref_NewRef((PyObject *)surfobj, callback);
+    Py_DECREF(callback);
+    if (!mirror->surfref) {
+        mirror_free(mirror);
+        return NULL;
+    }
+    mirror->texture = SDL_CreateTextureFromSurface(self->renderer, surf);
+    if (!mirror->texture ||
+        SDL_QueryTexture(mirror->texture, &mirror->format, NULL, NULL,
+                         NULL) < 0) {
+        PyErr_SetString(pgExc_SDLError, SDL_GetError());
+        mirror_free(mirror);
+        return NULL;
+    }
+    mirror->w = surf->w;
+    mirror->h = surf->h;
+    if ((mirror->has_colorkey = SDL_HasColorKey(surf))) {
+        SDL_GetColorKey(surf, &mirror->colorkey);
+    }
+    self->upload_bytes +=
+        (Uint64)surf->w * surf->h * SDL_BYTESPERPIXEL(mirror->format);
+    self->uploads++;
+    return mirror;
+}
+
+/* Returns the mirror of a surface, up to date with its pixels, alpha,
+ * color modulation and blend mode. */
+static pgSurfaceMirror *
+renderer_surface_mirror(pgRendererObject *self, pgSurfaceObject *surfobj)
+{
+    SDL_Surface *surf = pgSurface_AsSurface(surfobj);
+    Uint64 generation = pgSurface_GetGeneration(surfobj);
+    pgSurfaceMirror *mirror = NULL;
+    PyObject *key, *capsule, *ref = NULL;
+    SDL_BlendMode blend;
+    int has_colorkey;
+    Uint32 colorkey = 0;
+    Uint8 r, g, b, a;
+
+    if ((has_colorkey = SDL_HasColorKey(surf))) {
+        SDL_GetColorKey(surf, &colorkey);
+    }
+    if (!self->mirrors && !(self->mirrors = PyDict_New())) {
+        return NULL;
+    }
+    if (!(key = PyLong_FromVoidPtr(surfobj))) {
+        return NULL;
+    }
+    capsule = PyDict_GetItemWithError(self->mirrors, key);
+    if (capsule) {
+        mirror = (pgSurfaceMirror *)PyCapsule_GetPointer(capsule, "mirror");
+        /* the display surface changes size, and set_colorkey doesn't
+         * write */
+        if (PyWeakref_GetRef(mirror->surfref, &ref) != 1 ||
+            ref != (PyObject *)surfobj || mirror->w != surf->w ||
+            mirror->h != surf->h || mirror->has_colorkey != has_colorkey ||
+            mirror->colorkey != colorkey) {
+            mirror = NULL;
+        }
+        Py_XDECREF(ref);
+    }
+    else if (PyErr_Occurred()) {
+        Py_DECREF(key);
+        return NULL;
+    }
+
+    if (!mirror) {
+        if (!(mirror = mirror_new(self, surfobj, key))) {
+            Py_DECREF(key);
+            return NULL;
+        }
+        capsule =
+            PyCapsule_New(mirror, "mirror", mirror_capsule_destructor);
+        if (!capsule) {
+            mirror_free(mirror);
+        }
+        if (!capsule || PyDict_SetItem(self->mirrors, key, capsule) < 0) {
+            Py_XDECREF(capsule);
+            Py_DECREF(key);
+            return NULL;
+        }
+        Py_DECREF(capsule);
+    }
+    else if ((mirror->generation != generation ||
+              mirror_always_dirty(surfobj)) &&
+             mirror_update(self, mirror, surf) < 0) {
+        Py_DECREF(key);
+        return NULL;
+    }
+    Py_DECREF(key);
+    mirror->generation = generation;
+
+    /* these don't change the pixels, so copy them every time, the same
+     * way SDL_CreateTextureFromSurface does */
+    SDL_GetSurfaceColorMod(surf, &r, &g, &b);
+    SDL_SetTextureColorMod(mirror->texture, r, g, b);
+    SDL_GetSurfaceAlphaMod(surf, &a);
+    SDL_SetTextureAlphaMod(mirror->texture, a);
+    if (has_colorkey) {
+        blend = SDL_BLENDMODE_BLEND;
+    }
+    else {
+        SDL_GetSurfaceBlendMode(surf, &blend);
+    }
+    SDL_SetTextureBlendMode(mirror->texture, blend);
+    return mirror;
+}
+
+static int
+renderer_draw_surface(pgRendererObject *self, pgSurfaceObject *surfobj,
+                      PyObject *area, PyObject *dest)
+{
+    SDL_Surface *surf = pgSurface_AsSurface(surfobj);
+    SDL_Rect srcrect, *srcptr = NULL;
+    SDL_FRect dstrect, *dstptr = NULL;
+    pgSurfaceMirror *mirror;
+
+    if (!surf) {
+        RAISERETURN(pgExc_SDLError, "display Surface quit", -1);
+    }
+    if (!Py_IsNone(area) && !(srcptr = pgRect_FromObject(area, &srcrect))) {
+        RAISERETURN(PyExc_TypeError, "area must be a rect or None", -1);
+    }
+    if (!Py_IsNone(dest) && !(dstptr = pgFRect_FromObject(dest, &dstrect))) {
+        if (!pg_TwoFloatsFromObj(dest, &dstrect.x, &dstrect.y)) {
+            RAISERETURN(PyExc_TypeError,
+                        "dest must be a rect, a position or None", -1);
+        }
+        dstrect.w = (float)(srcptr ? srcrect.w : surf->w);
+        dstrect.h = (float)(srcptr ? srcrect.h : surf->h);
+        dstptr = &dstrect;
+    }
+    if (!(mirror = renderer_surface_mirror(self, surfobj))) {
+        return -1;
+    }
+
+    if (SDL_RenderCopyF(self->renderer, mirror->texture, srcptr, dstptr) <
+        0) {
+        RAISERETURN(pgExc_SDLError, SDL_GetError(), -1);
+    }
+    return 0;
+}
+
+static PyObject *
+renderer_get_upload_stats(pgRendererObject *self, PyObject *_null)
+{
+    return Py_BuildValue("Ki", (unsigned long long)self->last_upload_bytes,
+                         self->last_uploads);
+}
+
+/* Gets a C contiguous view of packed items for the batch functions. A
+ * typed buffer (array.array, numpy, ...) must hold items of itemsize bytes
+ * with one of the struct codes in types, or records of stride bytes when
+ * types is NULL. Plain bytes are taken as they are. Either way the length
+ * must be a whole number of strides. */
+static int
+renderer_get_packed(PyObject *obj, Py_buffer *view, const char *types,
+                    Py_ssize_t itemsize, Py_ssize_t stride, const char *name)
+{
+    const char *format;
+    int single, typed;
+
+    if (PyObject_GetBuffer(obj, view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS)) {
+        return -1;
+    }
+    format = view->format ? view->format : "B";
+    if (*format == '@' || *format == '=') {
+        format++;
+    }
+    single = format[0] != '\0' && format[1] == '\0';
+    if (types) {
+        typed = single && view->itemsize == itemsize &&
+                strchr(types, format[0]);
+    }
+    else {
+        typed = view->itemsize == stride;
+    }
+    if (!typed && !(single && strchr("Bbc", format[0]))) {
+        PyErr_Format(PyExc_TypeError, "%s has the wrong item format '%s'",
+                     name, view->format);
+        PyBuffer_Release(view);
+        return -1;
+    }
+    if (view->len % stride || view->len / stride > INT_MAX) {
+        PyErr_Format(PyExc_ValueError,
+                     "%s must be a whole number of %zd byte items", name,
+                     stride);
+        PyBuffer_Release(view);
+        return -1;
+    }
+    if ((size_t)view->buf % 4) {
+        PyErr_Format(PyExc_ValueError, "%s is not aligned to 4 bytes", name);
+        PyBuffer_Release(view);
+        return -1;
+    }
+    return 0;
+}
+
+static PyObject *
+renderer_fill_rects(pgRendererObject *self, PyObject *args, PyObject *kwargs)
+{
+    PyObject *rectsobj;
+    Py_buffer view;
+    int result;
+    static char *keywords[] = {"rects", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", keywords,
+                                     &rectsobj)) {
+        return NULL;
+    }
+    if (renderer_get_packed(rectsobj, &view, "f", sizeof(float),
+                            sizeof(SDL_FRect), "rects") < 0) {
+        return NULL;
+    }
+    result = SDL_RenderFillRectsF(self->renderer, (SDL_FRect *)view.buf,
+                                  (int)(view.len / sizeof(SDL_FRect)));
+    PyBuffer_Release(&view);
+    RENDERER_ERROR_CHECK(result)
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+renderer_draw_lines(pgRendererObject *self, PyObject *args, PyObject *kwargs)
+{
+    PyObject *pointsobj;
+    Py_buffer view;
+    int result = 0;
+    static char *keywords[] = {"points", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O", keywords,
+                                     &pointsobj)) {
+        return NULL;
+    }
+    if (renderer_get_packed(pointsobj, &view, "f", sizeof(float),
+                            sizeof(SDL_FPoint), "points") < 0) {
+        return NULL;
+    }
+    /* SDL wants at least one point */
+    if (view.len) {
+        result = SDL_RenderDrawLinesF(self->renderer, (SDL_FPoint *)view.buf,
+                                      (int)(view.len / sizeof(SDL_FPoint)));
+    }
+    PyBuffer_Release(&view);
+    RENDERER_ERROR_CHECK(result)
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+renderer_draw_geometry(pgRendererObject *self, PyObject *args,
+                       PyObject *kwargs)
+{
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    PyObject *verticesobj, *indicesobj = Py_None, *textureobj = Py_None;
+    Py_buffer vertices, indices = {0};
+    SDL_Texture *texture = NULL;
+    pgSurfaceMirror *mirror;
+    int result;
+    static char *keywords[] = {"vertices", "indices", "texture", NULL};
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OO", keywords,
+                                     &verticesobj, &indicesobj,
+                                     &textureobj)) {
+        return NULL;
+    }
+    if (pgSurface_Check(textureobj)) {
+        if (!pgSurface_AsSurface(textureobj)) {
+            return RAISE(pgExc_SDLError, "display Surface quit");
+        }
+        if (!(mirror = renderer_surface_mirror(
+                  self, (pgSurfaceObject *)textureobj))) {
+            return NULL;
+        }
+        texture = mirror->texture;
+    }
+    else if (pgTexture_Check(textureobj)) {
+        texture = ((pgTextureObject *)textureobj)->texture;
+    }
+    else if (!Py_IsNone(textureobj)) {
+        return RAISE(PyExc_TypeError,
+                     "texture must be a Texture, a Surface or None");
+    }
+
+    if (renderer_get_packed(verticesobj, &vertices, NULL, 0,
+                            sizeof(SDL_Vertex), "vertices") < 0) {
+        return NULL;
+    }
+    if (!Py_IsNone(indicesobj) &&
+        renderer_get_packed(indicesobj, &indices, "il", sizeof(int),
+                            sizeof(int), "indices") < 0) {
+        PyBuffer_Release(&vertices);
+        return NULL;
+    }
+    result = SDL_RenderGeometry(
+        self->renderer, texture, (SDL_Vertex *)vertices.buf,
+        (int)(vertices.len / sizeof(SDL_Vertex)), (int *)indices.buf,
+        (int)(indices.len / sizeof(int)));
+    PyBuffer_Release(&vertices);
+    if (indices.obj) {
+        PyBuffer_Release(&indices);
+    }
+    RENDERER_ERROR_CHECK(result)
+    Py_RETURN_NONE;
+#else
+    return RAISE(PyExc_NotImplementedError,
+                 "draw_geometry() requires SDL 2.0.18 or newer");
+#endif
+}
+
 static PyObject *
 renderer_blit(pgRendererObject *self, PyObject *args, PyObject *kwargs)
 {
@@ -366,6 +818,12 @@ renderer_blit(pgRendererObject *self, PyObject *args, PyObject *kwargs)
     else if (pgImage_Check(sourceobj)) {
         image_renderer_draw((pgImageObject *)sourceobj, areaobj, destobj);
     }
+    else if (pgSurface_Check(sourceobj)) {
+        if (renderer_draw_surface(self, (pgSurfaceObject *)sourceobj, areaobj,
+                                  destobj) < 0) {
+            return NULL;
+        }
+    }
     else {
         if (!PyObject_CallFunctionObjArgs(
                 PyObject_GetAttrString(sourceobj, "draw"), areaobj, destobj,
@@ -536,6 +994,8 @@ renderer_init(pgRendererObject *self, PyObject *args, PyObject *kwargs)
 static void
 renderer_dealloc(pgRendererObject *self, PyObject *_null)
 {
+    /* the mirrors' textures go before the renderer they belong to */
+    Py_CLEAR(self->mirrors);
     if (!self->_is_borrowed && self->renderer) {
         SDL_DestroyRenderer(self->renderer);
     }
@@ -574,6 +1034,12 @@ static PyMethodDef renderer_methods[] = {
      METH_VARARGS | METH_KEYWORDS, DOC_SDL2_VIDEO_RENDERER_FILLTRIANGLE},
     {"fill_quad", (PyCFunction)renderer_fill_quad,
      METH_VARARGS | METH_KEYWORDS, DOC_SDL2_VIDEO_RENDERER_FILLQUAD},
+    {"fill_rects", (PyCFunction)renderer_fill_rects,
+     METH_VARARGS | METH_KEYWORDS, DOC_SDL2_VIDEO_RENDERER_FILLRECTS},
+    {"draw_lines", (PyCFunction)renderer_draw_lines,
+     METH_VARARGS | METH_KEYWORDS, DOC_SDL2_VIDEO_RENDERER_DRAWLINES},
+    {"draw_geometry", (PyCFunction)renderer_draw_geometry,
+     METH_VARARGS | METH_KEYWORDS, DOC_SDL2_VIDEO_RENDERER_DRAWGEOMETRY},
     {"present", (PyCFunction)renderer_present, METH_NOARGS,
      DOC_SDL2_VIDEO_RENDERER_PRESENT},
     {"clear", (PyCFunction)renderer_clear, METH_NOARGS,
@@ -593,6 +1059,8 @@ static PyMethodDef renderer_methods[] = {
      METH_VARARGS | METH_KEYWORDS, DOC_SDL2_VIDEO_RENDERER_TOSURFACE},
     {"blit", (PyCFunction)renderer_blit, METH_VARARGS | METH_KEYWORDS,
      DOC_SDL2_VIDEO_RENDERER_SETVIEWPORT},
+    {"get_upload_stats", (PyCFunction)renderer_get_upload_stats, METH_NOARGS,
+     DOC_SDL2_VIDEO_RENDERER_GETUPLOADSTATS},
     {NULL, NULL, 0, NULL}};
 
 static PyGetSetDef renderer_getset[] = {
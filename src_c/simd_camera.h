@@ -0,0 +1,85 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+
+#if PG_SDL3
+// SDL3 no longer includes intrinsics by default, we need to do it explicitly
+#include <SDL3/SDL_intrin.h>
+
+/* If SDL_AVX2_INTRINSICS is defined by SDL3, we need to set macros that our
+ * code checks for avx2 build time support */
+#ifdef SDL_AVX2_INTRINSICS
+#ifndef HAVE_IMMINTRIN_H
+#define HAVE_IMMINTRIN_H 1
+#endif /* HAVE_IMMINTRIN_H*/
+#endif /* SDL_AVX2_INTRINSICS*/
+#endif /* PG_SDL3 */
+
+#if !defined(PG_ENABLE_ARM_NEON) && defined(__aarch64__)
+// arm64 has neon optimisations enabled by default, even when fpu=neon is not
+// passed
+#define PG_ENABLE_ARM_NEON 1
+#endif
+
+#ifndef SIMD_CAMERA_H
+#define SIMD_CAMERA_H
+
+/* How the camera kernels write a pixel of three 8 bit channels (R, G, B or
+ * Y, U, V, in that order). Three byte output stores them in reverse order,
+ * like the scalar converters do; four byte output puts each one at its
+ * shift, which must be a whole byte, and leaves the other byte 0. */
+typedef struct {
+    int bpp;      /* bytes per output pixel, 3 or 4 */
+    int shift[3]; /* bit shift of each channel, for 4 bytes per pixel */
+} PG_CameraPacking;
+
+/* The kernels convert the start of their input and return how many pixels
+ * they did, leaving the rest to the caller, or 0 when the instruction set
+ * they need is not compiled in. They follow the fixed point math of the
+ * scalar converters in _camera.c exactly, so the output does not depend on
+ * which one runs.
+ *
+ * yuyv_to_rgb: length pixels of YUYV (or UYVY when uyvy is set).
+ * rgb_to_yuv: length pixels of src_bpp (3 or 4) bytes, whose R, G and B
+ *     are the bytes at rshift, gshift and bshift of the little endian pixel.
+ *     src may be dst, when src_bpp is pack->bpp.
+ * yuv420_to_yuv: one row of width pixels, from its Y row and the U and V
+ *     rows shared by its pair of rows.
+ * bggr_to_rgb: length inner pixels of a row of a BGGR Bayer frame, from
+ *     src[1] to dst[1] (src and dst point at the start of the row); the rows
+ *     pitch bytes above and below must exist. blue_row tells which kind of
+ *     row the scalar converter takes it for, and green_first if it takes
+ *     src[1] for a green sample. */
+
+// SSE2 functions (also NEON, through sse2neon)
+int
+camera_yuyv_to_rgb_sse2(const Uint8 *src, Uint8 *dst, int length, int uyvy,
+                        const PG_CameraPacking *pack);
+int
+camera_rgb_to_yuv_sse2(const Uint8 *src, Uint8 *dst, int length, int src_bpp,
+                       int rshift, int gshift, int bshift,
+                       const PG_CameraPacking *pack);
+int
+camera_yuv420_to_yuv_sse2(const Uint8 *y, const Uint8 *u, const Uint8 *v,
+                          Uint8 *dst, int width, const PG_CameraPacking *pack);
+int
+camera_bggr_to_rgb_sse2(const Uint8 *src, Uint8 *dst, int length, int pitch,
+                        int blue_row, int green_first,
+                        const PG_CameraPacking *pack);
+
+// AVX2 functions
+int
+camera_yuyv_to_rgb_avx2(const Uint8 *src, Uint8 *dst, int length, int uyvy,
+                        const PG_CameraPacking *pack);
+int
+camera_rgb_to_yuv_avx2(const Uint8 *src, Uint8 *dst, int length, int src_bpp,
+                       int rshift, int gshift, int bshift,
+                       const PG_CameraPacking *pack);
+int
+camera_yuv420_to_yuv_avx2(const Uint8 *y, const Uint8 *u, const Uint8 *v,
+                          Uint8 *dst, int width, const PG_CameraPacking *pack);
+int
+camera_bggr_to_rgb_avx2(const Uint8 *src, Uint8 *dst, int length, int pitch,
+                        int blue_row, int green_first,
+                        const PG_CameraPacking *pack);
+
+#endif /* SIMD_CAMERA_H */
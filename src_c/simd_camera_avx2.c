@@ -0,0 +1,309 @@
+#include "simd_camera.h"
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#include <immintrin.h>
+#endif /* defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+
+/* See camera_shifts_sse2 */
+static void
+camera_shifts_avx2(const PG_CameraPacking *pack, __m128i *s0, __m128i *s1,
+                   __m128i *s2)
+{
+    if (pack->bpp == 3) {
+        *s0 = _mm_cvtsi32_si128(16);
+        *s1 = _mm_cvtsi32_si128(8);
+        *s2 = _mm_cvtsi32_si128(0);
+    }
+    else {
+        *s0 = _mm_cvtsi32_si128(pack->shift[0]);
+        *s1 = _mm_cvtsi32_si128(pack->shift[1]);
+        *s2 = _mm_cvtsi32_si128(pack->shift[2]);
+    }
+}
+
+/* Write twelve bytes, the low ones of a */
+static PG_INLINE void
+camera_store12_avx2(Uint8 *dst, __m128i a)
+{
+    Uint32 last = (Uint32)_mm_cvtsi128_si32(_mm_srli_si128(a, 8));
+
+    _mm_storel_epi64((__m128i *)dst, a);
+    memcpy(dst + 8, &last, 4);
+}
+
+/* Write sixteen pixels, given each channel as 16 bit lanes of 0 to 255 */
+static PG_INLINE void
+camera_store_avx2(Uint8 *dst, __m256i c0, __m256i c1, __m256i c2,
+                  __m128i s0, __m128i s1, __m128i s2, int bpp)
+{
+    /* drops the high byte of each 32 bit pixel, in each 128 bit lane */
+    __m256i compact = _mm256_setr_epi8(
+        0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1, 0, 1, 2, 4, 5,
+        6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    __m256i px;
+    int half;
+
+    for (half = 0; half < 2; ++half) {
+        __m128i h0 = half ? _mm256_extracti128_si256(c0, 1)
+                          : _mm256_castsi256_si128(c0);
+        __m128i h1 = half ? _mm256_extracti128_si256(c1, 1)
+                          : _mm256_castsi256_si128(c1);
+        __m128i h2 = half ? _mm256_extracti128_si256(c2, 1)
+                          : _mm256_castsi256_si128(c2);
+
+        px = _mm256_or_si256(_mm256_sll_epi32(_mm256_cvtepu16_epi32(h0), s0),
+                             _mm256_sll_epi32(_mm256_cvtepu16_epi32(h1), s1));
+        px = _mm256_or_si256(px,
+                             _mm256_sll_epi32(_mm256_cvtepu16_epi32(h2), s2));
+        if (bpp == 4) {
+            _mm256_storeu_si256((__m256i *)(dst + half * 32), px);
+        }
+        else {
+            px = _mm256_shuffle_epi8(px, compact);
+            camera_store12_avx2(dst + half * 24, _mm256_castsi256_si128(px));
+            camera_store12_avx2(dst + half * 24 + 12,
+                                _mm256_extracti128_si256(px, 1));
+        }
+    }
+}
+
+/* See camera_saturate_sse2 */
+static PG_INLINE __m256i
+camera_saturate_avx2(__m256i c)
+{
+    return _mm256_max_epi16(_mm256_min_epi16(c, _mm256_set1_epi16(255)),
+                            _mm256_setzero_si256());
+}
+
+/* See camera_channel_sse2, this does sixteen pixels, in order */
+static PG_INLINE __m256i
+camera_channel_avx2(__m256i a, __m256i b, __m128i shift)
+{
+    __m256i mask = _mm256_set1_epi32(0xff);
+    __m256i c =
+        _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(a, shift), mask),
+                           _mm256_and_si256(_mm256_srl_epi32(b, shift), mask));
+
+    /* packs works within each 128 bit lane, put the halves back in order */
+    return _mm256_permute4x64_epi64(c, 0xD8);
+}
+
+/* See camera_load_sse2, this loads eight pixels */
+static PG_INLINE __m256i
+camera_load_avx2(const Uint8 *src, int bpp)
+{
+    Uint32 p[8];
+    int k;
+
+    if (bpp == 4) {
+        return _mm256_loadu_si256((const __m256i *)src);
+    }
+    for (k = 0; k < 8; ++k) {
+        memcpy(p + k, src + k * 3, 4);
+    }
+    return _mm256_loadu_si256((const __m256i *)p);
+}
+
+/* Sixteen bytes as 16 bit lanes */
+static PG_INLINE __m256i
+camera_load16_avx2(const Uint8 *src)
+{
+    return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)src));
+}
+
+/* See camera_select_sse2 */
+static PG_INLINE __m256i
+camera_select_avx2(__m256i mask, __m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, mask);
+}
+
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+int
+camera_yuyv_to_rgb_avx2(const Uint8 *src, Uint8 *dst, int length, int uyvy,
+                        const PG_CameraPacking *pack)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    __m256i low = _mm256_set1_epi32(0xffff);
+    __m256i bias = _mm256_set1_epi16(128);
+    __m256i in, y, uv, u, v, u1, rg, v1;
+    __m128i s0, s1, s2;
+    int x;
+
+    camera_shifts_avx2(pack, &s0, &s1, &s2);
+    for (x = 0; x + 16 <= length; x += 16) {
+        in = _mm256_loadu_si256((const __m256i *)(src + x * 2));
+        if (uyvy) {
+            y = _mm256_srli_epi16(in, 8);
+            uv = _mm256_and_si256(in, _mm256_set1_epi16(0xff));
+        }
+        else {
+            y = _mm256_and_si256(in, _mm256_set1_epi16(0xff));
+            uv = _mm256_srli_epi16(in, 8);
+        }
+        u = _mm256_or_si256(_mm256_and_si256(uv, low),
+                            _mm256_slli_epi32(uv, 16));
+        v = _mm256_or_si256(_mm256_srli_epi32(uv, 16),
+                            _mm256_andnot_si256(low, uv));
+        u = _mm256_sub_epi16(u, bias);
+        v = _mm256_sub_epi16(v, bias);
+
+        u1 = _mm256_srai_epi16(_mm256_mullo_epi16(u, _mm256_set1_epi16(129)),
+                               6);
+        rg = _mm256_srai_epi16(
+            _mm256_add_epi16(_mm256_mullo_epi16(u, _mm256_set1_epi16(3)),
+                             _mm256_mullo_epi16(v, _mm256_set1_epi16(6))),
+            3);
+        v1 = _mm256_srai_epi16(_mm256_mullo_epi16(v, _mm256_set1_epi16(3)),
+                               1);
+
+        camera_store_avx2(dst + x * pack->bpp,
+                          camera_saturate_avx2(_mm256_add_epi16(y, v1)),
+                          camera_saturate_avx2(_mm256_sub_epi16(y, rg)),
+                          camera_saturate_avx2(_mm256_add_epi16(y, u1)), s0,
+                          s1, s2, pack->bpp);
+    }
+    return x;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+int
+camera_rgb_to_yuv_avx2(const Uint8 *src, Uint8 *dst, int length, int src_bpp,
+                       int rshift, int gshift, int bshift,
+                       const PG_CameraPacking *pack)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    __m128i rs = _mm_cvtsi32_si128(rshift);
+    __m128i gs = _mm_cvtsi32_si128(gshift);
+    __m128i bs = _mm_cvtsi32_si128(bshift);
+    __m128i s0, s1, s2;
+    __m256i a, b, r, g, bl, y, u, v;
+    int end = src_bpp == 3 ? length - 1 : length;
+    int x;
+
+    camera_shifts_avx2(pack, &s0, &s1, &s2);
+    for (x = 0; x + 16 <= end; x += 16) {
+        a = camera_load_avx2(src + x * src_bpp, src_bpp);
+        b = camera_load_avx2(src + (x + 8) * src_bpp, src_bpp);
+        r = camera_channel_avx2(a, b, rs);
+        g = camera_channel_avx2(a, b, gs);
+        bl = camera_channel_avx2(a, b, bs);
+
+        y = _mm256_add_epi16(_mm256_mullo_epi16(r, _mm256_set1_epi16(77)),
+                             _mm256_mullo_epi16(g, _mm256_set1_epi16(150)));
+        y = _mm256_add_epi16(y,
+                             _mm256_mullo_epi16(bl, _mm256_set1_epi16(29)));
+        y = _mm256_srli_epi16(_mm256_add_epi16(y, _mm256_set1_epi16(128)), 8);
+        u = _mm256_add_epi16(_mm256_mullo_epi16(r, _mm256_set1_epi16(-38)),
+                             _mm256_mullo_epi16(g, _mm256_set1_epi16(-74)));
+        u = _mm256_add_epi16(u,
+                             _mm256_mullo_epi16(bl, _mm256_set1_epi16(112)));
+        u = _mm256_srai_epi16(_mm256_add_epi16(u, _mm256_set1_epi16(128)), 8);
+        u = _mm256_add_epi16(u, _mm256_set1_epi16(128));
+        v = _mm256_add_epi16(_mm256_mullo_epi16(r, _mm256_set1_epi16(112)),
+                             _mm256_mullo_epi16(g, _mm256_set1_epi16(-94)));
+        v = _mm256_add_epi16(v,
+                             _mm256_mullo_epi16(bl, _mm256_set1_epi16(-18)));
+        v = _mm256_srai_epi16(_mm256_add_epi16(v, _mm256_set1_epi16(128)), 8);
+        v = _mm256_add_epi16(v, _mm256_set1_epi16(128));
+
+        camera_store_avx2(dst + x * pack->bpp, y, u, v, s0, s1, s2,
+                          pack->bpp);
+    }
+    return x;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+int
+camera_yuv420_to_yuv_avx2(const Uint8 *y, const Uint8 *u, const Uint8 *v,
+                          Uint8 *dst, int width, const PG_CameraPacking *pack)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    __m128i s0, s1, s2, uu, vv;
+    int x;
+
+    camera_shifts_avx2(pack, &s0, &s1, &s2);
+    for (x = 0; x + 16 <= width; x += 16) {
+        uu = _mm_loadl_epi64((const __m128i *)(u + x / 2));
+        vv = _mm_loadl_epi64((const __m128i *)(v + x / 2));
+        camera_store_avx2(dst + x * pack->bpp, camera_load16_avx2(y + x),
+                          _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(uu, uu)),
+                          _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(vv, vv)), s0,
+                          s1, s2, pack->bpp);
+    }
+    return x;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+int
+camera_bggr_to_rgb_avx2(const Uint8 *src, Uint8 *dst, int length, int pitch,
+                        int blue_row, int green_first,
+                        const PG_CameraPacking *pack)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    __m256i green =
+        _mm256_set1_epi32(green_first ? 0x0000ffff : (int)0xffff0000);
+    __m256i c, l, r, up, down, cross, diag, horiz, vert;
+    __m128i s0, s1, s2;
+    const Uint8 *p;
+    int x;
+
+    camera_shifts_avx2(pack, &s0, &s1, &s2);
+    for (x = 0; x + 16 <= length; x += 16) {
+        p = src + 1 + x;
+        c = camera_load16_avx2(p);
+        l = camera_load16_avx2(p - 1);
+        r = camera_load16_avx2(p + 1);
+        up = camera_load16_avx2(p - pitch);
+        down = camera_load16_avx2(p + pitch);
+        horiz = _mm256_add_epi16(l, r);
+        vert = _mm256_add_epi16(up, down);
+        cross = _mm256_srli_epi16(_mm256_add_epi16(horiz, vert), 2);
+        horiz = _mm256_srli_epi16(horiz, 1);
+        vert = _mm256_srli_epi16(vert, 1);
+        diag = _mm256_add_epi16(
+            _mm256_add_epi16(camera_load16_avx2(p - pitch - 1),
+                             camera_load16_avx2(p - pitch + 1)),
+            _mm256_add_epi16(camera_load16_avx2(p + pitch - 1),
+                             camera_load16_avx2(p + pitch + 1)));
+        diag = _mm256_srli_epi16(diag, 2);
+
+        if (blue_row) {
+            camera_store_avx2(dst + (1 + x) * pack->bpp,
+                              camera_select_avx2(green, vert, diag),
+                              camera_select_avx2(green, c, cross),
+                              camera_select_avx2(green, horiz, c), s0, s1, s2,
+                              pack->bpp);
+        }
+        else {
+            camera_store_avx2(dst + (1 + x) * pack->bpp,
+                              camera_select_avx2(green, horiz, c),
+                              camera_select_avx2(green, c, cross),
+                              camera_select_avx2(green, vert, diag), s0, s1,
+                              s2, pack->bpp);
+        }
+    }
+    return x;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
@@ -0,0 +1,285 @@
+#include "simd_camera.h"
+
+#if PG_ENABLE_ARM_NEON
+// sse2neon.h is from here: https://github.com/DLTcollab/sse2neon
+#include "include/sse2neon.h"
+#endif /* PG_ENABLE_ARM_NEON */
+
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+
+/* The bit shift of each channel in an output pixel. Three byte pixels are
+ * built as 32 bit ones, with the last channel in the low byte. */
+static void
+camera_shifts_sse2(const PG_CameraPacking *pack, __m128i *s0, __m128i *s1,
+                   __m128i *s2)
+{
+    if (pack->bpp == 3) {
+        *s0 = _mm_cvtsi32_si128(16);
+        *s1 = _mm_cvtsi32_si128(8);
+        *s2 = _mm_cvtsi32_si128(0);
+    }
+    else {
+        *s0 = _mm_cvtsi32_si128(pack->shift[0]);
+        *s1 = _mm_cvtsi32_si128(pack->shift[1]);
+        *s2 = _mm_cvtsi32_si128(pack->shift[2]);
+    }
+}
+
+/* Write eight pixels, given each channel as 16 bit lanes of 0 to 255 */
+static PG_INLINE void
+camera_store_sse2(Uint8 *dst, __m128i c0, __m128i c1, __m128i c2,
+                  __m128i s0, __m128i s1, __m128i s2, int bpp)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i lo, hi;
+    Uint32 pixels[8];
+    int k;
+
+    lo = _mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(c0, zero), s0),
+                      _mm_sll_epi32(_mm_unpacklo_epi16(c1, zero), s1));
+    lo = _mm_or_si128(lo, _mm_sll_epi32(_mm_unpacklo_epi16(c2, zero), s2));
+    hi = _mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(c0, zero), s0),
+                      _mm_sll_epi32(_mm_unpackhi_epi16(c1, zero), s1));
+    hi = _mm_or_si128(hi, _mm_sll_epi32(_mm_unpackhi_epi16(c2, zero), s2));
+
+    if (bpp == 4) {
+        _mm_storeu_si128((__m128i *)dst, lo);
+        _mm_storeu_si128((__m128i *)(dst + 16), hi);
+        return;
+    }
+    /* SSE2 has no byte shuffle, so three byte pixels go out one by one */
+    _mm_storeu_si128((__m128i *)pixels, lo);
+    _mm_storeu_si128((__m128i *)(pixels + 4), hi);
+    for (k = 0; k < 8; ++k) {
+        memcpy(dst + k * 3, pixels + k, 3);
+    }
+}
+
+/* Clamp signed 16 bit lanes to 0 to 255, like SAT2 */
+static PG_INLINE __m128i
+camera_saturate_sse2(__m128i c)
+{
+    return _mm_max_epi16(_mm_min_epi16(c, _mm_set1_epi16(255)),
+                         _mm_setzero_si128());
+}
+
+/* One channel of eight pixels (four in a, four in b) as 16 bit lanes */
+static PG_INLINE __m128i
+camera_channel_sse2(__m128i a, __m128i b, __m128i shift)
+{
+    __m128i mask = _mm_set1_epi32(0xff);
+
+    return _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(a, shift), mask),
+                           _mm_and_si128(_mm_srl_epi32(b, shift), mask));
+}
+
+/* Four pixels of bpp bytes as 32 bit lanes. Three byte pixels are read four
+ * bytes at a time, so one byte past the last is read too. */
+static PG_INLINE __m128i
+camera_load_sse2(const Uint8 *src, int bpp)
+{
+    Uint32 p0, p1, p2, p3;
+
+    if (bpp == 4) {
+        return _mm_loadu_si128((const __m128i *)src);
+    }
+    memcpy(&p0, src, 4);
+    memcpy(&p1, src + 3, 4);
+    memcpy(&p2, src + 6, 4);
+    memcpy(&p3, src + 9, 4);
+    return _mm_set_epi32((int)p3, (int)p2, (int)p1, (int)p0);
+}
+
+/* Eight bytes as 16 bit lanes */
+static PG_INLINE __m128i
+camera_load8_sse2(const Uint8 *src)
+{
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)src),
+                             _mm_setzero_si128());
+}
+
+/* Take lanes of a where mask is set and lanes of b elsewhere */
+static PG_INLINE __m128i
+camera_select_sse2(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+
+int
+camera_yuyv_to_rgb_sse2(const Uint8 *src, Uint8 *dst, int length, int uyvy,
+                        const PG_CameraPacking *pack)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    __m128i low = _mm_set1_epi32(0xffff);
+    __m128i bias = _mm_set1_epi16(128);
+    __m128i s0, s1, s2, in, y, uv, u, v, u1, rg, v1;
+    int x;
+
+    camera_shifts_sse2(pack, &s0, &s1, &s2);
+    for (x = 0; x + 8 <= length; x += 8) {
+        in = _mm_loadu_si128((const __m128i *)(src + x * 2));
+        if (uyvy) {
+            y = _mm_srli_epi16(in, 8);
+            uv = _mm_and_si128(in, _mm_set1_epi16(0xff));
+        }
+        else {
+            y = _mm_and_si128(in, _mm_set1_epi16(0xff));
+            uv = _mm_srli_epi16(in, 8);
+        }
+        /* both pixels of a pair share its u and v */
+        u = _mm_or_si128(_mm_and_si128(uv, low), _mm_slli_epi32(uv, 16));
+        v = _mm_or_si128(_mm_srli_epi32(uv, 16), _mm_andnot_si128(low, uv));
+        u = _mm_sub_epi16(u, bias);
+        v = _mm_sub_epi16(v, bias);
+
+        /* the libv4l terms, see yuyv_to_rgb */
+        u1 = _mm_srai_epi16(_mm_mullo_epi16(u, _mm_set1_epi16(129)), 6);
+        rg = _mm_srai_epi16(
+            _mm_add_epi16(_mm_mullo_epi16(u, _mm_set1_epi16(3)),
+                          _mm_mullo_epi16(v, _mm_set1_epi16(6))),
+            3);
+        v1 = _mm_srai_epi16(_mm_mullo_epi16(v, _mm_set1_epi16(3)), 1);
+
+        camera_store_sse2(dst + x * pack->bpp,
+                          camera_saturate_sse2(_mm_add_epi16(y, v1)),
+                          camera_saturate_sse2(_mm_sub_epi16(y, rg)),
+                          camera_saturate_sse2(_mm_add_epi16(y, u1)), s0, s1,
+                          s2, pack->bpp);
+    }
+    return x;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
+
+int
+camera_rgb_to_yuv_sse2(const Uint8 *src, Uint8 *dst, int length, int src_bpp,
+                       int rshift, int gshift, int bshift,
+                       const PG_CameraPacking *pack)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    __m128i rs = _mm_cvtsi32_si128(rshift);
+    __m128i gs = _mm_cvtsi32_si128(gshift);
+    __m128i bs = _mm_cvtsi32_si128(bshift);
+    __m128i s0, s1, s2, a, b, r, g, bl, y, u, v;
+    /* leave room for the byte read past three byte pixels */
+    int end = src_bpp == 3 ? length - 1 : length;
+    int x;
+
+    camera_shifts_sse2(pack, &s0, &s1, &s2);
+    for (x = 0; x + 8 <= end; x += 8) {
+        a = camera_load_sse2(src + x * src_bpp, src_bpp);
+        b = camera_load_sse2(src + (x + 4) * src_bpp, src_bpp);
+        r = camera_channel_sse2(a, b, rs);
+        g = camera_channel_sse2(a, b, gs);
+        bl = camera_channel_sse2(a, b, bs);
+
+        /* the same sums as rgb_to_yuv, see simd_display_sse2.c for their
+         * range in 16 bit lanes */
+        y = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(77)),
+                          _mm_mullo_epi16(g, _mm_set1_epi16(150)));
+        y = _mm_add_epi16(y, _mm_mullo_epi16(bl, _mm_set1_epi16(29)));
+        y = _mm_srli_epi16(_mm_add_epi16(y, _mm_set1_epi16(128)), 8);
+        u = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(-38)),
+                          _mm_mullo_epi16(g, _mm_set1_epi16(-74)));
+        u = _mm_add_epi16(u, _mm_mullo_epi16(bl, _mm_set1_epi16(112)));
+        u = _mm_srai_epi16(_mm_add_epi16(u, _mm_set1_epi16(128)), 8);
+        u = _mm_add_epi16(u, _mm_set1_epi16(128));
+        v = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(112)),
+                          _mm_mullo_epi16(g, _mm_set1_epi16(-94)));
+        v = _mm_add_epi16(v, _mm_mullo_epi16(bl, _mm_set1_epi16(-18)));
+        v = _mm_srai_epi16(_mm_add_epi16(v, _mm_set1_epi16(128)), 8);
+        v = _mm_add_epi16(v, _mm_set1_epi16(128));
+
+        camera_store_sse2(dst + x * pack->bpp, y, u, v, s0, s1, s2,
+                          pack->bpp);
+    }
+    return x;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
+
+int
+camera_yuv420_to_yuv_sse2(const Uint8 *y, const Uint8 *u, const Uint8 *v,
+                          Uint8 *dst, int width, const PG_CameraPacking *pack)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    __m128i zero = _mm_setzero_si128();
+    __m128i s0, s1, s2, uu, vv;
+    Uint32 chroma;
+    int x;
+
+    camera_shifts_sse2(pack, &s0, &s1, &s2);
+    for (x = 0; x + 8 <= width; x += 8) {
+        /* each u and v byte covers two pixels of the row */
+        memcpy(&chroma, u + x / 2, 4);
+        uu = _mm_cvtsi32_si128((int)chroma);
+        uu = _mm_unpacklo_epi8(_mm_unpacklo_epi8(uu, uu), zero);
+        memcpy(&chroma, v + x / 2, 4);
+        vv = _mm_cvtsi32_si128((int)chroma);
+        vv = _mm_unpacklo_epi8(_mm_unpacklo_epi8(vv, vv), zero);
+
+        camera_store_sse2(dst + x * pack->bpp, camera_load8_sse2(y + x), uu,
+                          vv, s0, s1, s2, pack->bpp);
+    }
+    return x;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
+
+int
+camera_bggr_to_rgb_sse2(const Uint8 *src, Uint8 *dst, int length, int pitch,
+                        int blue_row, int green_first,
+                        const PG_CameraPacking *pack)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    __m128i green =
+        _mm_set1_epi32(green_first ? 0x0000ffff : (int)0xffff0000);
+    __m128i s0, s1, s2, c, l, r, up, down, cross, diag, horiz, vert;
+    const Uint8 *p;
+    int x;
+
+    camera_shifts_sse2(pack, &s0, &s1, &s2);
+    for (x = 0; x + 8 <= length; x += 8) {
+        p = src + 1 + x;
+        c = camera_load8_sse2(p);
+        l = camera_load8_sse2(p - 1);
+        r = camera_load8_sse2(p + 1);
+        up = camera_load8_sse2(p - pitch);
+        down = camera_load8_sse2(p + pitch);
+        horiz = _mm_add_epi16(l, r);
+        vert = _mm_add_epi16(up, down);
+        cross = _mm_srli_epi16(_mm_add_epi16(horiz, vert), 2);
+        horiz = _mm_srli_epi16(horiz, 1);
+        vert = _mm_srli_epi16(vert, 1);
+        diag = _mm_add_epi16(_mm_add_epi16(camera_load8_sse2(p - pitch - 1),
+                                           camera_load8_sse2(p - pitch + 1)),
+                             _mm_add_epi16(camera_load8_sse2(p + pitch - 1),
+                                           camera_load8_sse2(p + pitch + 1)));
+        diag = _mm_srli_epi16(diag, 2);
+
+        /* green samples alternate with blue ones, or with red ones */
+        if (blue_row) {
+            camera_store_sse2(dst + (1 + x) * pack->bpp,
+                              camera_select_sse2(green, vert, diag),
+                              camera_select_sse2(green, c, cross),
+                              camera_select_sse2(green, horiz, c), s0, s1, s2,
+                              pack->bpp);
+        }
+        else {
+            camera_store_sse2(dst + (1 + x) * pack->bpp,
+                              camera_select_sse2(green, horiz, c),
+                              camera_select_sse2(green, c, cross),
+                              camera_select_sse2(green, vert, diag), s0, s1,
+                              s2, pack->bpp);
+        }
+    }
+    return x;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
@@ -0,0 +1,45 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+
+#if PG_SDL3
+// SDL3 no longer includes intrinsics by default, we need to do it explicitly
+#include <SDL3/SDL_intrin.h>
+
+/* If SDL_AVX2_INTRINSICS is defined by SDL3, we need to set macros that our
+ * code checks for avx2 build time support */
+#ifdef SDL_AVX2_INTRINSICS
+#ifndef HAVE_IMMINTRIN_H
+#define HAVE_IMMINTRIN_H 1
+#endif /* HAVE_IMMINTRIN_H*/
+#endif /* SDL_AVX2_INTRINSICS*/
+#endif /* PG_SDL3 */
+
+#if !defined(PG_ENABLE_ARM_NEON) && defined(__aarch64__)
+// arm64 has neon optimisations enabled by default, even when fpu=neon is not
+// passed
+#define PG_ENABLE_ARM_NEON 1
+#endif
+
+#ifndef SIMD_DISPLAY_H
+#define SIMD_DISPLAY_H
+
+/* The RGB to YUV 4:2:0 kernels convert the start of a pair of rows of 32 bit
+ * pixels, whose R, G and B are whole bytes at rshift, gshift and bshift.
+ * Each writes a row of Y for both input rows, plus one row of U and one of
+ * V at half width from the average of each 2x2 block. They return how many
+ * pixels they did (always even), leaving the rest of the rows to the caller,
+ * or 0 when the instruction set they need is not compiled in. */
+
+// SSE2 functions (also NEON, through sse2neon)
+int
+display_rgb_to_yuv420_sse2(const Uint8 *row0, const Uint8 *row1, Uint8 *y0,
+                           Uint8 *y1, Uint8 *u, Uint8 *v, int width,
+                           int rshift, int gshift, int bshift);
+
+// AVX2 functions
+int
+display_rgb_to_yuv420_avx2(const Uint8 *row0, const Uint8 *row1, Uint8 *y0,
+                           Uint8 *y1, Uint8 *u, Uint8 *v, int width,
+                           int rshift, int gshift, int bshift);
+
+#endif /* SIMD_DISPLAY_H */
@@ -0,0 +1,120 @@
+#include "simd_display.h"
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#include <immintrin.h>
+#endif /* defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+
+/* See channel_sse2, this does sixteen pixels, in order */
+static PG_INLINE __m256i
+channel_avx2(__m256i a, __m256i b, __m128i shift)
+{
+    __m256i mask = _mm256_set1_epi32(0xff);
+    __m256i c =
+        _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(a, shift), mask),
+                           _mm256_and_si256(_mm256_srl_epi32(b, shift), mask));
+
+    /* packs works within each 128 bit lane, put the halves back in order */
+    return _mm256_permute4x64_epi64(c, 0xD8);
+}
+
+/* See luma_sse2 */
+static PG_INLINE __m256i
+luma_avx2(__m256i r, __m256i g, __m256i b)
+{
+    __m256i y =
+        _mm256_add_epi16(_mm256_mullo_epi16(r, _mm256_set1_epi16(77)),
+                         _mm256_mullo_epi16(g, _mm256_set1_epi16(150)));
+
+    y = _mm256_add_epi16(y, _mm256_mullo_epi16(b, _mm256_set1_epi16(29)));
+    return _mm256_srli_epi16(_mm256_add_epi16(y, _mm256_set1_epi16(128)), 8);
+}
+
+/* See chroma_sse2 */
+static PG_INLINE __m256i
+chroma_avx2(__m256i r, __m256i g, __m256i b, short cr, short cg, short cb)
+{
+    __m256i c = _mm256_add_epi16(_mm256_mullo_epi16(r, _mm256_set1_epi16(cr)),
+                                 _mm256_mullo_epi16(g, _mm256_set1_epi16(cg)));
+
+    c = _mm256_add_epi16(c, _mm256_mullo_epi16(b, _mm256_set1_epi16(cb)));
+    c = _mm256_srai_epi16(_mm256_add_epi16(c, _mm256_set1_epi16(128)), 8);
+    return _mm256_add_epi16(c, _mm256_set1_epi16(128));
+}
+
+/* See average_2x2_sse2; the eight averages land in the low 128 bits */
+static PG_INLINE __m256i
+average_2x2_avx2(__m256i sum)
+{
+    __m256i quad = _mm256_madd_epi16(sum, _mm256_set1_epi16(1));
+
+    quad = _mm256_srli_epi32(_mm256_add_epi32(quad, _mm256_set1_epi32(2)), 2);
+    return _mm256_permute4x64_epi64(_mm256_packs_epi32(quad, quad), 0xD8);
+}
+
+/* Pack the low eight 16 bit lanes of c to bytes, in the low 64 bits */
+static PG_INLINE __m128i
+pack_low_avx2(__m256i c)
+{
+    __m128i lo = _mm256_castsi256_si128(c);
+
+    return _mm_packus_epi16(lo, lo);
+}
+
+/* Pack all sixteen 16 bit lanes of c to bytes, in order */
+static PG_INLINE __m128i
+pack_avx2(__m256i c)
+{
+    return _mm_packus_epi16(_mm256_castsi256_si128(c),
+                            _mm256_extracti128_si256(c, 1));
+}
+
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+int
+display_rgb_to_yuv420_avx2(const Uint8 *row0, const Uint8 *row1, Uint8 *y0,
+                           Uint8 *y1, Uint8 *u, Uint8 *v, int width,
+                           int rshift, int gshift, int bshift)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    __m128i rs = _mm_cvtsi32_si128(rshift);
+    __m128i gs = _mm_cvtsi32_si128(gshift);
+    __m128i bs = _mm_cvtsi32_si128(bshift);
+    __m256i a, b, r0, g0, b0, r1, g1, b1, ra, ga, ba;
+    int x;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        a = _mm256_loadu_si256((const __m256i *)(row0 + x * 4));
+        b = _mm256_loadu_si256((const __m256i *)(row0 + x * 4 + 32));
+        r0 = channel_avx2(a, b, rs);
+        g0 = channel_avx2(a, b, gs);
+        b0 = channel_avx2(a, b, bs);
+        a = _mm256_loadu_si256((const __m256i *)(row1 + x * 4));
+        b = _mm256_loadu_si256((const __m256i *)(row1 + x * 4 + 32));
+        r1 = channel_avx2(a, b, rs);
+        g1 = channel_avx2(a, b, gs);
+        b1 = channel_avx2(a, b, bs);
+
+        _mm_storeu_si128((__m128i *)(y0 + x),
+                         pack_avx2(luma_avx2(r0, g0, b0)));
+        _mm_storeu_si128((__m128i *)(y1 + x),
+                         pack_avx2(luma_avx2(r1, g1, b1)));
+
+        ra = average_2x2_avx2(_mm256_add_epi16(r0, r1));
+        ga = average_2x2_avx2(_mm256_add_epi16(g0, g1));
+        ba = average_2x2_avx2(_mm256_add_epi16(b0, b1));
+        _mm_storel_epi64((__m128i *)(u + x / 2),
+                         pack_low_avx2(chroma_avx2(ra, ga, ba, -38, -74, 112)));
+        _mm_storel_epi64((__m128i *)(v + x / 2),
+                         pack_low_avx2(chroma_avx2(ra, ga, ba, 112, -94, -18)));
+    }
+    return x;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
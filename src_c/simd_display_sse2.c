@@ -0,0 +1,104 @@
+#include "simd_display.h"
+
+#if PG_ENABLE_ARM_NEON
+// sse2neon.h is from here: https://github.com/DLTcollab/sse2neon
+#include "include/sse2neon.h"
+#endif /* PG_ENABLE_ARM_NEON */
+
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+
+/* One channel of eight 32 bit pixels (four in a, four in b) as 16 bit
+ * lanes */
+static PG_INLINE __m128i
+channel_sse2(__m128i a, __m128i b, __m128i shift)
+{
+    __m128i mask = _mm_set1_epi32(0xff);
+
+    return _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(a, shift), mask),
+                           _mm_and_si128(_mm_srl_epi32(b, shift), mask));
+}
+
+/* Full range Y of eight pixels, as in _camera.c's rgb_to_yuv:
+ * (77 * r + 150 * g + 29 * b + 128) >> 8. The sum never passes 65535, so
+ * it fits unsigned 16 bit lanes. */
+static PG_INLINE __m128i
+luma_sse2(__m128i r, __m128i g, __m128i b)
+{
+    __m128i y = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(77)),
+                              _mm_mullo_epi16(g, _mm_set1_epi16(150)));
+
+    y = _mm_add_epi16(y, _mm_mullo_epi16(b, _mm_set1_epi16(29)));
+    return _mm_srli_epi16(_mm_add_epi16(y, _mm_set1_epi16(128)), 8);
+}
+
+/* ((cr * r + cg * g + cb * b + 128) >> 8) + 128, in signed 16 bit lanes;
+ * every partial sum stays within +-28688 for the U and V weights */
+static PG_INLINE __m128i
+chroma_sse2(__m128i r, __m128i g, __m128i b, short cr, short cg, short cb)
+{
+    __m128i c = _mm_add_epi16(_mm_mullo_epi16(r, _mm_set1_epi16(cr)),
+                              _mm_mullo_epi16(g, _mm_set1_epi16(cg)));
+
+    c = _mm_add_epi16(c, _mm_mullo_epi16(b, _mm_set1_epi16(cb)));
+    c = _mm_srai_epi16(_mm_add_epi16(c, _mm_set1_epi16(128)), 8);
+    return _mm_add_epi16(c, _mm_set1_epi16(128));
+}
+
+/* Rounded average of each 2x2 block, given the vertical sums of a channel
+ * over eight pixels; the four averages land in the low 16 bit lanes */
+static PG_INLINE __m128i
+average_2x2_sse2(__m128i sum)
+{
+    __m128i quad = _mm_madd_epi16(sum, _mm_set1_epi16(1));
+
+    quad = _mm_srli_epi32(_mm_add_epi32(quad, _mm_set1_epi32(2)), 2);
+    return _mm_packs_epi32(quad, quad);
+}
+
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+
+int
+display_rgb_to_yuv420_sse2(const Uint8 *row0, const Uint8 *row1, Uint8 *y0,
+                           Uint8 *y1, Uint8 *u, Uint8 *v, int width,
+                           int rshift, int gshift, int bshift)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    __m128i rs = _mm_cvtsi32_si128(rshift);
+    __m128i gs = _mm_cvtsi32_si128(gshift);
+    __m128i bs = _mm_cvtsi32_si128(bshift);
+    __m128i a, b, r0, g0, b0, r1, g1, b1, ra, ga, ba, out;
+    Uint32 chroma;
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        a = _mm_loadu_si128((const __m128i *)(row0 + x * 4));
+        b = _mm_loadu_si128((const __m128i *)(row0 + x * 4 + 16));
+        r0 = channel_sse2(a, b, rs);
+        g0 = channel_sse2(a, b, gs);
+        b0 = channel_sse2(a, b, bs);
+        a = _mm_loadu_si128((const __m128i *)(row1 + x * 4));
+        b = _mm_loadu_si128((const __m128i *)(row1 + x * 4 + 16));
+        r1 = channel_sse2(a, b, rs);
+        g1 = channel_sse2(a, b, gs);
+        b1 = channel_sse2(a, b, bs);
+
+        out = luma_sse2(r0, g0, b0);
+        _mm_storel_epi64((__m128i *)(y0 + x), _mm_packus_epi16(out, out));
+        out = luma_sse2(r1, g1, b1);
+        _mm_storel_epi64((__m128i *)(y1 + x), _mm_packus_epi16(out, out));
+
+        ra = average_2x2_sse2(_mm_add_epi16(r0, r1));
+        ga = average_2x2_sse2(_mm_add_epi16(g0, g1));
+        ba = average_2x2_sse2(_mm_add_epi16(b0, b1));
+        out = chroma_sse2(ra, ga, ba, -38, -74, 112);
+        chroma = (Uint32)_mm_cvtsi128_si32(_mm_packus_epi16(out, out));
+        memcpy(u + x / 2, &chroma, 4);
+        out = chroma_sse2(ra, ga, ba, 112, -94, -18);
+        chroma = (Uint32)_mm_cvtsi128_si32(_mm_packus_epi16(out, out));
+        memcpy(v + x / 2, &chroma, 4);
+    }
+    return x;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
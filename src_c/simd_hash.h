@@ -0,0 +1,46 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+
+#if PG_SDL3
+// SDL3 no longer includes intrinsics by default, we need to do it explicitly
+#include <SDL3/SDL_intrin.h>
+
+/* If SDL_AVX2_INTRINSICS is defined by SDL3, we need to set macros that our
+ * code checks for avx2 build time support */
+#ifdef SDL_AVX2_INTRINSICS
+#ifndef HAVE_IMMINTRIN_H
+#define HAVE_IMMINTRIN_H 1
+#endif /* HAVE_IMMINTRIN_H*/
+#endif /* SDL_AVX2_INTRINSICS*/
+#endif /* PG_SDL3 */
+
+#if !defined(PG_ENABLE_ARM_NEON) && defined(__aarch64__)
+// arm64 has neon optimisations enabled by default, even when fpu=neon is not
+// passed
+#define PG_ENABLE_ARM_NEON 1
+#endif
+#ifndef SIMD_HASH_H
+#define SIMD_HASH_H
+
+/* Surface.get_hash reads pixel data in 64 byte stripes, each one folded
+ * into eight 64 bit accumulator lanes:
+ *
+ *     d = stripe lane i (little endian), k = d ^ key[i]
+ *     acc[i] += d + (k & 0xffffffff) * (k >> 32)
+ *
+ * The kernels do this for nstripes consecutive stripes and return how many
+ * they did, or 0 when the instruction set they need is not compiled in.
+ * They give exactly what the scalar loop in surface.c gives, on little
+ * endian machines. */
+
+// SSE2 functions (also NEON, through sse2neon)
+int
+surface_hash_stripes_sse2(Uint64 *acc, const Uint64 *key, const Uint8 *data,
+                          int nstripes);
+
+// AVX2 functions
+int
+surface_hash_stripes_avx2(Uint64 *acc, const Uint64 *key, const Uint8 *data,
+                          int nstripes);
+
+#endif /* SIMD_HASH_H */
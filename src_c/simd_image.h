@@ -0,0 +1,52 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+
+#if PG_SDL3
+// SDL3 no longer includes intrinsics by default, we need to do it explicitly
+#include <SDL3/SDL_intrin.h>
+
+/* If SDL_AVX2_INTRINSICS is defined by SDL3, we need to set macros that our
+ * code checks for avx2 build time support */
+#ifdef SDL_AVX2_INTRINSICS
+#ifndef HAVE_IMMINTRIN_H
+#define HAVE_IMMINTRIN_H 1
+#endif /* HAVE_IMMINTRIN_H*/
+#endif /* SDL_AVX2_INTRINSICS*/
+#endif /* PG_SDL3 */
+
+#if !defined(PG_ENABLE_ARM_NEON) && defined(__aarch64__)
+// arm64 has neon optimisations enabled by default, even when fpu=neon is not
+// passed
+#define PG_ENABLE_ARM_NEON 1
+#endif
+
+#ifndef SIMD_IMAGE_H
+#define SIMD_IMAGE_H
+
+/* Where each byte of a tobytes output pixel comes from, for 32 bit
+ * surfaces whose channels are all whole bytes (little endian only). */
+typedef struct {
+    int src[4]; /* source byte of each output byte, or -1 for 0xff */
+    int bpp;    /* bytes per output pixel, 3 or 4 */
+    int alpha;  /* output byte to premultiply the others by, or -1 */
+} PG_ImageSwizzle;
+
+/* The row kernels convert the start of a row and return how many pixels
+ * they did, leaving the rest of the row to the caller. They return 0 when
+ * the instruction set they need is not compiled in. */
+
+// SSE2 functions (also NEON, through sse2neon)
+int
+image_swizzle_row_sse2(const Uint8 *src, Uint8 *dst, int width,
+                       const PG_ImageSwizzle *swizzle);
+int
+image_swap_rgb_row_sse2(const Uint8 *src, Uint8 *dst, int width);
+
+// AVX2 functions
+int
+image_swizzle_row_avx2(const Uint8 *src, Uint8 *dst, int width,
+                       const PG_ImageSwizzle *swizzle);
+int
+image_swap_rgb_row_avx2(const Uint8 *src, Uint8 *dst, int width);
+
+#endif /* SIMD_IMAGE_H */
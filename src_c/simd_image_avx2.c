@@ -0,0 +1,139 @@
+#include "simd_image.h"
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#include <immintrin.h>
+#endif /* defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+
+/* See premultiply_sse2, this does eight pixels at once */
+static PG_INLINE __m256i
+premultiply_avx2(__m256i pixels, int alpha)
+{
+    __m256i zero = _mm256_setzero_si256();
+    __m256i one = _mm256_set1_epi16(1);
+    __m256i amask = _mm256_set1_epi32((int)(0xffu << (alpha * 8)));
+    __m256i lo = _mm256_unpacklo_epi8(pixels, zero);
+    __m256i hi = _mm256_unpackhi_epi8(pixels, zero);
+    __m256i alo, ahi;
+
+    if (alpha == 0) {
+        alo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(lo, 0x00), 0x00);
+        ahi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(hi, 0x00), 0x00);
+    }
+    else {
+        alo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(lo, 0xff), 0xff);
+        ahi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(hi, 0xff), 0xff);
+    }
+    lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_add_epi16(lo, one), alo),
+                           8);
+    hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_add_epi16(hi, one), ahi),
+                           8);
+
+    return _mm256_or_si256(
+        _mm256_andnot_si256(amask, _mm256_packus_epi16(lo, hi)),
+        _mm256_and_si256(amask, pixels));
+}
+
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+int
+image_swizzle_row_avx2(const Uint8 *src, Uint8 *dst, int width,
+                       const PG_ImageSwizzle *swizzle)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    /* One byte shuffle puts every output byte in place, eight pixels at a
+     * time. The shuffle works within each 16 byte lane, so the control
+     * repeats every four pixels. For 3 byte pixels the shuffle also packs
+     * each lane's 12 output bytes together, and a dword permute then joins
+     * the two lanes into 24 bytes. */
+    Sint8 control[32];
+    __m256i shuffle, fill, pixels, out;
+    __m256i pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+    __m256i store_mask = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+    Uint32 fill_bits = 0;
+    int bpp = swizzle->bpp;
+    int i, k, x;
+
+    if (swizzle->alpha != -1 && swizzle->alpha != 0 && swizzle->alpha != 3) {
+        return 0;
+    }
+    for (i = 0; i < 32; ++i) {
+        int lane_byte = i % 16;
+        int p = lane_byte / bpp;
+
+        k = lane_byte % bpp;
+        if (p > 3 || swizzle->src[k] < 0) {
+            control[i] = (Sint8)0x80;
+        }
+        else {
+            control[i] = (Sint8)(p * 4 + swizzle->src[k]);
+        }
+    }
+    for (k = 0; k < bpp; ++k) {
+        if (swizzle->src[k] < 0) {
+            /* only 4 byte output has constant bytes */
+            fill_bits |= 0xffu << (k * 8);
+        }
+    }
+    shuffle = _mm256_loadu_si256((const __m256i *)control);
+    fill = _mm256_set1_epi32((int)fill_bits);
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        pixels = _mm256_loadu_si256((const __m256i *)(src + x * 4));
+        out = _mm256_shuffle_epi8(pixels, shuffle);
+
+        if (bpp == 4) {
+            out = _mm256_or_si256(out, fill);
+            if (swizzle->alpha >= 0) {
+                out = premultiply_avx2(out, swizzle->alpha);
+            }
+            _mm256_storeu_si256((__m256i *)(dst + x * 4), out);
+        }
+        else {
+            out = _mm256_permutevar8x32_epi32(out, pack);
+            _mm256_maskstore_epi32((int *)(dst + x * 3), store_mask, out);
+        }
+    }
+    return x;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+int
+image_swap_rgb_row_avx2(const Uint8 *src, Uint8 *dst, int width)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    /* Ten pixels per step: the two lanes are loaded from 15 bytes apart so
+     * neither has a pixel split across it, and each swaps five pixels. The
+     * low lane's 16th byte is left unswapped, then overwritten by the high
+     * lane's store. */
+    const __m256i control = _mm256_setr_epi8(
+        2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15, 2, 1, 0, 5, 4, 3,
+        8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+    __m256i pixels;
+    int x;
+
+    for (x = 0; x + 11 <= width; x += 10) {
+        pixels = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(
+                _mm_loadu_si128((const __m128i *)(src + x * 3))),
+            _mm_loadu_si128((const __m128i *)(src + x * 3 + 15)), 1);
+        pixels = _mm256_shuffle_epi8(pixels, control);
+        _mm_storeu_si128((__m128i *)(dst + x * 3),
+                         _mm256_castsi256_si128(pixels));
+        _mm_storeu_si128((__m128i *)(dst + x * 3 + 15),
+                         _mm256_extracti128_si256(pixels, 1));
+    }
+    return x;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
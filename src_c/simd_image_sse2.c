@@ -0,0 +1,129 @@
+#include "simd_image.h"
+
+#if PG_ENABLE_ARM_NEON
+// sse2neon.h is from here: https://github.com/DLTcollab/sse2neon
+#include "include/sse2neon.h"
+#endif /* PG_ENABLE_ARM_NEON */
+
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+
+/* Scale the color bytes of four 32 bit pixels by the alpha byte (at byte 0
+ * or 3 of each pixel), rounding like tobytes' scalar code:
+ * ((color + 1) * alpha) >> 8 */
+static PG_INLINE __m128i
+premultiply_sse2(__m128i pixels, int alpha)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i one = _mm_set1_epi16(1);
+    __m128i amask = _mm_set1_epi32((int)(0xffu << (alpha * 8)));
+    __m128i lo = _mm_unpacklo_epi8(pixels, zero);
+    __m128i hi = _mm_unpackhi_epi8(pixels, zero);
+    __m128i alo, ahi;
+
+    if (alpha == 0) {
+        alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, 0x00), 0x00);
+        ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, 0x00), 0x00);
+    }
+    else {
+        alo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, 0xff), 0xff);
+        ahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, 0xff), 0xff);
+    }
+    lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_add_epi16(lo, one), alo), 8);
+    hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_add_epi16(hi, one), ahi), 8);
+
+    return _mm_or_si128(_mm_andnot_si128(amask, _mm_packus_epi16(lo, hi)),
+                        _mm_and_si128(amask, pixels));
+}
+
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+
+int
+image_swizzle_row_sse2(const Uint8 *src, Uint8 *dst, int width,
+                       const PG_ImageSwizzle *swizzle)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    /* SSE2 has no byte shuffle, so every output byte is shifted into place
+     * from its source byte, four pixels at a time */
+    __m128i rshift[4], lshift[4];
+    __m128i byte_mask = _mm_set1_epi32(0xff);
+    __m128i fill, pixels, out;
+    Uint32 fill_bits = 0;
+    Uint32 block[4];
+    int bpp = swizzle->bpp;
+    int limit = width;
+    int k, x;
+
+    if (swizzle->alpha != -1 && swizzle->alpha != 0 && swizzle->alpha != 3) {
+        return 0;
+    }
+    for (k = 0; k < bpp; ++k) {
+        if (swizzle->src[k] < 0) {
+            fill_bits |= 0xffu << (k * 8);
+        }
+        else {
+            rshift[k] = _mm_cvtsi32_si128(swizzle->src[k] * 8);
+            lshift[k] = _mm_cvtsi32_si128(k * 8);
+        }
+    }
+    fill = _mm_set1_epi32((int)fill_bits);
+
+    /* 3 byte pixels are written 4 bytes at a time, which spills into the
+     * next pixel, so the last pixel of the row is left to the caller */
+    if (bpp == 3) {
+        limit = width - 1;
+    }
+
+    for (x = 0; x + 4 <= limit; x += 4) {
+        pixels = _mm_loadu_si128((const __m128i *)(src + x * 4));
+        out = fill;
+        for (k = 0; k < bpp; ++k) {
+            if (swizzle->src[k] >= 0) {
+                out = _mm_or_si128(
+                    out, _mm_sll_epi32(
+                             _mm_and_si128(_mm_srl_epi32(pixels, rshift[k]),
+                                           byte_mask),
+                             lshift[k]));
+            }
+        }
+        if (swizzle->alpha >= 0) {
+            out = premultiply_sse2(out, swizzle->alpha);
+        }
+
+        if (bpp == 4) {
+            _mm_storeu_si128((__m128i *)(dst + x * 4), out);
+        }
+        else {
+            _mm_storeu_si128((__m128i *)block, out);
+            for (k = 0; k < 4; ++k) {
+                memcpy(dst + (x + k) * 3, block + k, 4);
+            }
+        }
+    }
+    return x;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
+
+int
+image_swap_rgb_row_sse2(const Uint8 *src, Uint8 *dst, int width)
+{
+#if PG_ENABLE_ARM_NEON
+    /* Only NEON has a byte shuffle to offer here (plain SSE2 does not).
+     * Five pixels are swapped per 16 bytes; the 16th byte is the first
+     * byte of the next pixel, which the next step (or the caller) redoes. */
+    const __m128i control = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10,
+                                          9, 14, 13, 12, 15);
+    __m128i pixels;
+    int x;
+
+    for (x = 0; x + 6 <= width; x += 5) {
+        pixels = _mm_loadu_si128((const __m128i *)(src + x * 3));
+        _mm_storeu_si128((__m128i *)(dst + x * 3),
+                         _mm_shuffle_epi8(pixels, control));
+    }
+    return x;
+#else
+    return 0;
+#endif /* PG_ENABLE_ARM_NEON */
+}
@@ -0,0 +1,55 @@
+#define NO_PYGAME_C_API
+#include "_surface.h"
+
+#if PG_SDL3
+// SDL3 no longer includes intrinsics by default, we need to do it explicitly
+#include <SDL3/SDL_intrin.h>
+
+/* If SDL_AVX2_INTRINSICS is defined by SDL3, we need to set macros that our
+ * code checks for avx2 build time support */
+#ifdef SDL_AVX2_INTRINSICS
+#ifndef HAVE_IMMINTRIN_H
+#define HAVE_IMMINTRIN_H 1
+#endif /* HAVE_IMMINTRIN_H*/
+#endif /* SDL_AVX2_INTRINSICS*/
+#endif /* PG_SDL3 */
+
+#if !defined(PG_ENABLE_ARM_NEON) && defined(__aarch64__)
+// arm64 has neon optimisations enabled by default, even when fpu=neon is not
+// passed
+#define PG_ENABLE_ARM_NEON 1
+#endif
+
+#ifndef SIMD_MIXER_H
+#define SIMD_MIXER_H
+
+/* The kernels do the start of their input and return how many samples (or
+ * frames, for ramp) they did, leaving the rest to the caller, or 0 when the
+ * instruction set they need is not compiled in. They compute exactly what
+ * the scalar loops in mixer_effects.c do.
+ *
+ * s16_to_float: count samples, scaled by 1 / 32768.
+ * float_to_s16: count samples, scaled by 32768, clamped to the 16 bit range
+ *     and rounded to nearest even.
+ * ramp: multiplies frames of 1 or 2 interleaved channels by a gain that
+ *     moves in a straight line, start[c] + step[c] * i for frame i. */
+
+// SSE2 functions (also NEON, through sse2neon)
+int
+mixer_s16_to_float_sse2(const Sint16 *src, float *dst, int count);
+int
+mixer_float_to_s16_sse2(const float *src, Sint16 *dst, int count);
+int
+mixer_ramp_sse2(float *buf, int frames, int channels, const float *start,
+                const float *step);
+
+// AVX2 functions
+int
+mixer_s16_to_float_avx2(const Sint16 *src, float *dst, int count);
+int
+mixer_float_to_s16_avx2(const float *src, Sint16 *dst, int count);
+int
+mixer_ramp_avx2(float *buf, int frames, int channels, const float *start,
+                const float *step);
+
+#endif /* SIMD_MIXER_H */
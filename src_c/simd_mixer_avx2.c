@@ -0,0 +1,114 @@
+#include "simd_mixer.h"
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#include <immintrin.h>
+#endif /* defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+int
+mixer_s16_to_float_avx2(const Sint16 *src, float *dst, int count)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    __m256 scale = _mm256_set1_ps(1.0f / 32768.0f);
+    __m128i lo, hi;
+    int i;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        lo = _mm_loadu_si128((const __m128i *)(src + i));
+        hi = _mm_loadu_si128((const __m128i *)(src + i + 8));
+        _mm256_storeu_ps(
+            dst + i,
+            _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(lo)),
+                          scale));
+        _mm256_storeu_ps(
+            dst + i + 8,
+            _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(hi)),
+                          scale));
+    }
+    return i;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+int
+mixer_float_to_s16_avx2(const float *src, Sint16 *dst, int count)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    __m256 scale = _mm256_set1_ps(32768.0f);
+    __m256 lo = _mm256_set1_ps(-32768.0f);
+    __m256 hi = _mm256_set1_ps(32767.0f);
+    __m256 a, b;
+    int i;
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        /* see mixer_float_to_s16_sse2 */
+        a = _mm256_min_ps(
+            _mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i), scale), lo),
+            hi);
+        b = _mm256_min_ps(
+            _mm256_max_ps(_mm256_mul_ps(_mm256_loadu_ps(src + i + 8), scale),
+                          lo),
+            hi);
+        /* packs works per 128 bit lane, put the halves back in order */
+        _mm256_storeu_si256(
+            (__m256i *)(dst + i),
+            _mm256_permute4x64_epi64(
+                _mm256_packs_epi32(_mm256_cvtps_epi32(a),
+                                   _mm256_cvtps_epi32(b)),
+                0xD8));
+    }
+    return i;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
+
+int
+mixer_ramp_avx2(float *buf, int frames, int channels, const float *start,
+                const float *step)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    __m256 s, d, index, inc;
+    int i;
+
+    if (channels == 1) {
+        s = _mm256_set1_ps(start[0]);
+        d = _mm256_set1_ps(step[0]);
+        index = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+        inc = _mm256_set1_ps(8.0f);
+        for (i = 0; i + 8 <= frames; i += 8) {
+            _mm256_storeu_ps(
+                buf + i,
+                _mm256_mul_ps(_mm256_loadu_ps(buf + i),
+                              _mm256_add_ps(s, _mm256_mul_ps(d, index))));
+            index = _mm256_add_ps(index, inc);
+        }
+        return i;
+    }
+    if (channels == 2) {
+        s = _mm256_setr_ps(start[0], start[1], start[0], start[1], start[0],
+                           start[1], start[0], start[1]);
+        d = _mm256_setr_ps(step[0], step[1], step[0], step[1], step[0],
+                           step[1], step[0], step[1]);
+        index = _mm256_setr_ps(0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 2.0f, 3.0f, 3.0f);
+        inc = _mm256_set1_ps(4.0f);
+        for (i = 0; i + 4 <= frames; i += 4) {
+            _mm256_storeu_ps(
+                buf + i * 2,
+                _mm256_mul_ps(_mm256_loadu_ps(buf + i * 2),
+                              _mm256_add_ps(s, _mm256_mul_ps(d, index))));
+            index = _mm256_add_ps(index, inc);
+        }
+        return i;
+    }
+    return 0;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
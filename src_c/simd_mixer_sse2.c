@@ -0,0 +1,99 @@
+#include "simd_mixer.h"
+
+#if PG_ENABLE_ARM_NEON
+// sse2neon.h is from here: https://github.com/DLTcollab/sse2neon
+#include "include/sse2neon.h"
+#endif /* PG_ENABLE_ARM_NEON */
+
+int
+mixer_s16_to_float_sse2(const Sint16 *src, float *dst, int count)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    __m128 scale = _mm_set1_ps(1.0f / 32768.0f);
+    __m128i s;
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        s = _mm_loadu_si128((const __m128i *)(src + i));
+        /* sign extend by putting each sample in the top half of a lane */
+        _mm_storeu_ps(dst + i,
+                      _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(
+                                     _mm_unpacklo_epi16(s, s), 16)),
+                                 scale));
+        _mm_storeu_ps(dst + i + 4,
+                      _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(
+                                     _mm_unpackhi_epi16(s, s), 16)),
+                                 scale));
+    }
+    return i;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
+
+int
+mixer_float_to_s16_sse2(const float *src, Sint16 *dst, int count)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    __m128 scale = _mm_set1_ps(32768.0f);
+    __m128 lo = _mm_set1_ps(-32768.0f);
+    __m128 hi = _mm_set1_ps(32767.0f);
+    __m128 a, b;
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        /* max() takes lo for a NaN, like the scalar clamp */
+        a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale),
+                                  lo),
+                       hi);
+        b = _mm_min_ps(
+            _mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale), lo), hi);
+        _mm_storeu_si128(
+            (__m128i *)(dst + i),
+            _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+    }
+    return i;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
+
+int
+mixer_ramp_sse2(float *buf, int frames, int channels, const float *start,
+                const float *step)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    __m128 s, d, index, inc;
+    int i;
+
+    if (channels == 1) {
+        s = _mm_set1_ps(start[0]);
+        d = _mm_set1_ps(step[0]);
+        index = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+        inc = _mm_set1_ps(4.0f);
+        for (i = 0; i + 4 <= frames; i += 4) {
+            _mm_storeu_ps(buf + i,
+                          _mm_mul_ps(_mm_loadu_ps(buf + i),
+                                     _mm_add_ps(s, _mm_mul_ps(d, index))));
+            index = _mm_add_ps(index, inc);
+        }
+        return i;
+    }
+    if (channels == 2) {
+        s = _mm_setr_ps(start[0], start[1], start[0], start[1]);
+        d = _mm_setr_ps(step[0], step[1], step[0], step[1]);
+        index = _mm_setr_ps(0.0f, 0.0f, 1.0f, 1.0f);
+        inc = _mm_set1_ps(2.0f);
+        for (i = 0; i + 2 <= frames; i += 2) {
+            _mm_storeu_ps(buf + i * 2,
+                          _mm_mul_ps(_mm_loadu_ps(buf + i * 2),
+                                     _mm_add_ps(s, _mm_mul_ps(d, index))));
+            index = _mm_add_ps(index, inc);
+        }
+        return i;
+    }
+    return 0;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
@@ -0,0 +1,40 @@
+#include "simd_hash.h"
+
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#include <immintrin.h>
+#endif /* defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) */
+
+int
+surface_hash_stripes_avx2(Uint64 *acc, const Uint64 *key, const Uint8 *data,
+                          int nstripes)
+{
+#if defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H)
+    __m256i a0 = _mm256_loadu_si256((const __m256i *)acc);
+    __m256i a1 = _mm256_loadu_si256((const __m256i *)(acc + 4));
+    __m256i k0 = _mm256_loadu_si256((const __m256i *)key);
+    __m256i k1 = _mm256_loadu_si256((const __m256i *)(key + 4));
+    __m256i d0, d1, dk0, dk1;
+    int i;
+
+    for (i = 0; i < nstripes; ++i, data += 64) {
+        d0 = _mm256_loadu_si256((const __m256i *)data);
+        d1 = _mm256_loadu_si256((const __m256i *)(data + 32));
+        dk0 = _mm256_xor_si256(d0, k0);
+        dk1 = _mm256_xor_si256(d1, k1);
+        /* see surface_hash_stripes_sse2 */
+        a0 = _mm256_add_epi64(
+            a0, _mm256_add_epi64(
+                    d0, _mm256_mul_epu32(dk0, _mm256_srli_epi64(dk0, 32))));
+        a1 = _mm256_add_epi64(
+            a1, _mm256_add_epi64(
+                    d1, _mm256_mul_epu32(dk1, _mm256_srli_epi64(dk1, 32))));
+    }
+    _mm256_storeu_si256((__m256i *)acc, a0);
+    _mm256_storeu_si256((__m256i *)(acc + 4), a1);
+    return nstripes;
+#else
+    return 0;
+#endif /* defined(__AVX2__) && defined(HAVE_IMMINTRIN_H) && \
+          !defined(SDL_DISABLE_IMMINTRIN_H) */
+}
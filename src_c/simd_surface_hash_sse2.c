@@ -0,0 +1,37 @@
+#include "simd_hash.h"
+
+#if PG_ENABLE_ARM_NEON
+// sse2neon.h is from here: https://github.com/DLTcollab/sse2neon
+#include "include/sse2neon.h"
+#endif /* PG_ENABLE_ARM_NEON */
+
+int
+surface_hash_stripes_sse2(Uint64 *acc, const Uint64 *key, const Uint8 *data,
+                          int nstripes)
+{
+#if (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON))
+    __m128i a[4], k[4], d, dk;
+    int i, j;
+
+    for (j = 0; j < 4; ++j) {
+        a[j] = _mm_loadu_si128((const __m128i *)(acc + j * 2));
+        k[j] = _mm_loadu_si128((const __m128i *)(key + j * 2));
+    }
+    for (i = 0; i < nstripes; ++i, data += 64) {
+        for (j = 0; j < 4; ++j) {
+            d = _mm_loadu_si128((const __m128i *)(data + j * 16));
+            dk = _mm_xor_si128(d, k[j]);
+            /* mul_epu32 multiplies the low halves of each 64 bit lane */
+            a[j] = _mm_add_epi64(
+                a[j], _mm_add_epi64(d, _mm_mul_epu32(
+                                           dk, _mm_srli_epi64(dk, 32))));
+        }
+    }
+    for (j = 0; j < 4; ++j) {
+        _mm_storeu_si128((__m128i *)(acc + j * 2), a[j]);
+    }
+    return nstripes;
+#else
+    return 0;
+#endif /* (defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)) */
+}
@@ -430,13 +430,26 @@ PyInit_pygame_static()
 #include "surface.c"
 #include "simd_blitters_avx2.c"
 #include "simd_blitters_sse2.c"
+#include "simd_surface_hash_avx2.c"
+#include "simd_surface_hash_sse2.c"
 
 #include "window.c"
 
 #undef pgVidInfo_Type
 #undef pgVidInfo_New
+#undef pg_EncodeString
+#undef pgRWops_FromObject
+
+/* display.Recorder opens its file through rwobject, which comes later */
+static PyObject *
+pg_EncodeString(PyObject *obj, const char *encoding, const char *errors,
+                PyObject *eclass);
+static SDL_RWops *
+pgRWops_FromObject(PyObject *obj, char **extptr);
 
 #include "display.c"
+#include "simd_display_avx2.c"
+#include "simd_display_sse2.c"
 
 #include "draw.c"
 
@@ -452,6 +465,8 @@ PyInit_pygame_static()
 #define pgSurface_New(surface) (pgSurfaceObject *)pgSurface_New2((surface), 1)
 #include "render.c"
 #include "image.c"
+#include "simd_image_avx2.c"
+#include "simd_image_sse2.c"
 
 #include "imageext.c"
 
@@ -462,6 +477,7 @@ PyInit_pygame_static()
 #undef pgEvent_FillUserEvent
 #undef pgEvent_Type
 #undef pgEvent_New
+#undef pgEvent_GetDict
 
 #include "joystick.c"
 
@@ -487,6 +503,9 @@ PyInit_pygame_static()
 #include "font.c"
 
 #include "mixer.c"
+#include "mixer_effects.c"
+#include "simd_mixer_avx2.c"
+#include "simd_mixer_sse2.c"
 
 #include "music.c"
 
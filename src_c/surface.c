@@ -29,7 +29,9 @@
 
 #include "structmember.h"
 #include "pgcompat.h"
+#include "pgperf.h"
 #include "doc/surface_doc.h"
+#include "simd_hash.h"
 
 /* stdint.h is missing from some versions of MSVC. */
 #ifdef _MSC_VER
@@ -62,6 +64,24 @@ typedef struct pg_bufferinternal_s {
     Py_ssize_t mem[6];      /* Enough memory for dim 3 shape and strides  */
 } pg_bufferinternal;
 
+PG_PERF_DEFINE_STATE
+
+/* Slow blit tracking of a source surface for set_blit_diagnostics, allocated
+ * on its first slow blit. converted is a copy of the source that blits fast
+ * onto dst_format, valid while the source generation, alpha, blend mode and
+ * colorkey are still the ones it was made with. */
+struct pgBlitCache {
+    int slow_blits;
+    int warned;
+    SDL_Surface *converted;
+    Uint64 generation;
+    PG_PixelFormatEnum dst_format;
+    Uint8 alpha;
+    SDL_BlendMode blendmode;
+    int has_colorkey;
+    Uint32 colorkey;
+};
+
 int
 pgSurface_Blit(pgSurfaceObject *dstobj, pgSurfaceObject *srcobj,
                SDL_Rect *dstrect, SDL_Rect *srcrect, int blend_flags);
@@ -192,6 +212,10 @@ static PyObject *
 surf_premul_alpha(pgSurfaceObject *self, PyObject *args);
 static PyObject *
 surf_premul_alpha_ip(pgSurfaceObject *self, PyObject *args);
+static PyObject *
+surf_get_generation(pgSurfaceObject *self, PyObject *args);
+static PyObject *
+surf_get_hash(pgSurfaceObject *self, PyObject *args);
 static int
 _view_kind(PyObject *obj, void *view_kind_vptr);
 static int
@@ -318,6 +342,9 @@ static struct PyMethodDef surface_methods[] = {
      DOC_SURFACE_PREMULALPHA},
     {"premul_alpha_ip", (PyCFunction)surf_premul_alpha_ip, METH_NOARGS,
      DOC_SURFACE_PREMULALPHAIP},
+    {"get_generation", (PyCFunction)surf_get_generation, METH_NOARGS,
+     DOC_SURFACE_GETGENERATION},
+    {"get_hash", (PyCFunction)surf_get_hash, METH_NOARGS, DOC_SURFACE_GETHASH},
 
     {NULL, NULL, 0, NULL}};
 
@@ -359,6 +386,7 @@ pgSurface_SetSurface(pgSurfaceObject *self, SDL_Surface *s, int owner)
     surface_cleanup(self);
     self->surf = s;
     self->owner = owner;
+    pgSurface_Touch(self);
     return 0;
 }
 
@@ -393,6 +421,8 @@ surface_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
         self->weakreflist = NULL;
         self->dependency = NULL;
         self->locklist = NULL;
+        self->generation = 0;
+        self->blitcache = NULL;
     }
     return (PyObject *)self;
 }
@@ -419,6 +449,13 @@ surface_cleanup(pgSurfaceObject *self)
         Py_DECREF(self->locklist);
         self->locklist = NULL;
     }
+    if (self->blitcache) {
+        if (self->blitcache->converted) {
+            SDL_FreeSurface(self->blitcache->converted);
+        }
+        PyMem_Free(self->blitcache);
+        self->blitcache = NULL;
+    }
     self->owner = 0;
 }
 
@@ -998,6 +1035,7 @@ surf_set_at(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
         return NULL;
     }
 
+    pgSurface_Touch((pgSurfaceObject *)self);
     if (!pgSurface_Lock((pgSurfaceObject *)self)) {
         return NULL;
     }
@@ -1168,6 +1206,8 @@ static PyObject *
 surf_unlock(PyObject *self, PyObject *_null)
 {
     SURF_INIT_CHECK(pgSurface_AsSurface(self))
+    /* the pixels may have been written through the lock */
+    pgSurface_Touch((pgSurfaceObject *)self);
     pgSurface_Unlock((pgSurfaceObject *)self);
     Py_RETURN_NONE;
 }
@@ -1363,6 +1403,7 @@ surf_set_palette(PyObject *self, PyObject *seq)
     if (!PG_SetPaletteColors(pal, colors, 0, len)) {
         return RAISE(pgExc_SDLError, SDL_GetError());
     }
+    pgSurface_Touch((pgSurfaceObject *)self);
     Py_RETURN_NONE;
 }
 
@@ -1407,6 +1448,7 @@ surf_set_palette_at(PyObject *self, PyObject *args)
     if (!PG_SetPaletteColors(pal, &color, _index, 1)) {
         return RAISE(pgExc_SDLError, SDL_GetError());
     }
+    pgSurface_Touch((pgSurfaceObject *)self);
 
     Py_RETURN_NONE;
 }
@@ -1656,6 +1698,7 @@ surf_convert(pgSurfaceObject *self, PyObject *args)
 
     SURF_INIT_CHECK(surf)
 
+    PG_PERF_START(perf);
     pgSurface_Prep(self);
 
 #if SDL_VERSION_ATLEAST(3, 0, 0)
@@ -1985,6 +2028,7 @@ surf_convert(pgSurfaceObject *self, PyObject *args)
 #endif
 
     pgSurface_Unprep(self);
+    PG_PERF_COUNT(perf, CONVERT, (Uint64)surf->w * surf->h);
 
     final = surf_subtype_new(Py_TYPE(self), newsurf, 1);
     if (!final) {
@@ -2006,19 +2050,11 @@ pg_DisplayFormat(SDL_Surface *surface)
     return PG_ConvertSurfaceFormat(surface, default_format);
 }
 
-static SDL_Surface *
-pg_DisplayFormatAlpha(SDL_Surface *surface)
+/* The 32 bit format with alpha that blits fastest onto format */
+static PG_PixelFormatEnum
+pg_AlphaFormatFor(PG_PixelFormatEnum format)
 {
-    PG_PixelFormatEnum pfe = SDL_PIXELFORMAT_ARGB8888;
-    PG_PixelFormatEnum dformat = pg_GetDefaultConvertFormat();
-    if (!dformat) {
-        SDL_SetError(
-            "No convert format has been set, try display.set_mode()"
-            " or Window.get_surface().");
-        return NULL;
-    }
-
-    switch (dformat) {
+    switch (format) {
 #if SDL_VERSION_ATLEAST(3, 0, 0)
         case SDL_PIXELFORMAT_XBGR1555:
 #else
@@ -2028,8 +2064,7 @@ pg_DisplayFormatAlpha(SDL_Surface *surface)
         case SDL_PIXELFORMAT_BGR565:
         case SDL_PIXELFORMAT_XBGR8888:
         case SDL_PIXELFORMAT_ABGR8888:
-            pfe = SDL_PIXELFORMAT_ABGR8888;
-            break;
+            return SDL_PIXELFORMAT_ABGR8888;
 
         case SDL_PIXELFORMAT_BGRX8888:
         case SDL_PIXELFORMAT_BGRA8888:
@@ -2038,13 +2073,24 @@ pg_DisplayFormatAlpha(SDL_Surface *surface)
 #else
         case SDL_PIXELFORMAT_RGB24:
 #endif
-            pfe = SDL_PIXELFORMAT_BGRA8888;
-            break;
+            return SDL_PIXELFORMAT_BGRA8888;
 
         default:
-            break;
+            return SDL_PIXELFORMAT_ARGB8888;
+    }
+}
+
+static SDL_Surface *
+pg_DisplayFormatAlpha(SDL_Surface *surface)
+{
+    PG_PixelFormatEnum dformat = pg_GetDefaultConvertFormat();
+    if (!dformat) {
+        SDL_SetError(
+            "No convert format has been set, try display.set_mode()"
+            " or Window.get_surface().");
+        return NULL;
     }
-    return PG_ConvertSurfaceFormat(surface, pfe);
+    return PG_ConvertSurfaceFormat(surface, pg_AlphaFormatFor(dformat));
 }
 
 static PyObject *
@@ -2074,9 +2120,11 @@ surf_convert_alpha(pgSurfaceObject *self, PyObject *args)
         }
     }
 
+    PG_PERF_START(perf);
     newsurf = pg_DisplayFormatAlpha(surf);
     if (newsurf) {
         SDL_SetSurfaceBlendMode(newsurf, SDL_BLENDMODE_BLEND);
+        PG_PERF_COUNT(perf, CONVERT_ALPHA, (Uint64)surf->w * surf->h);
     }
     final = surf_subtype_new(Py_TYPE(self), newsurf, 1);
 
@@ -2191,13 +2239,16 @@ surf_fill(pgSurfaceObject *self, PyObject *args, PyObject *keywds)
         return pgRect_New(&sdlrect);
     }
 
+    pgSurface_Touch(self);
     if (blendargs != 0) {
         result = surface_fill_blend(surf, &sdlrect, color, blendargs);
     }
     else {
         pgSurface_Prep(self);
         pgSurface_Lock((pgSurfaceObject *)self);
+        PG_PERF_START(perf);
         result = PG_FillSurfaceRect(surf, &sdlrect, color) - 1;
+        PG_PERF_COUNT(perf, FILL_SOLID, (Uint64)sdlrect.w * sdlrect.h);
         pgSurface_Unlock((pgSurfaceObject *)self);
         pgSurface_Unprep(self);
     }
@@ -2937,6 +2988,7 @@ surf_scroll(PyObject *self, PyObject *args, PyObject *keywds)
     if (!repeat) {
         if (dx >= w || dx <= -w || dy >= h || dy <= -h) {
             if (erase) {
+                pgSurface_Touch((pgSurfaceObject *)self);
                 if (!PG_FillSurfaceRect(surf, NULL, 0)) {
                     PyErr_SetString(pgExc_SDLError, SDL_GetError());
                     return NULL;
@@ -2949,6 +3001,7 @@ surf_scroll(PyObject *self, PyObject *args, PyObject *keywds)
     dx = dx % w;
     dy = dy % h;
 
+    pgSurface_Touch((pgSurfaceObject *)self);
     if (!pgSurface_Lock((pgSurfaceObject *)self)) {
         return NULL;
     }
@@ -3761,7 +3814,7 @@ surf_premul_alpha(pgSurfaceObject *self, PyObject *_null)
     if ((surf->w > 0 && surf->h > 0)) {
         // If the surface has no pixels we don't need to premul
         // just return the copy.
-        int result = premul_surf_color_by_alpha(surf, newsurf);
+        int result = premul_surf_color_by_alpha_counted(surf, newsurf);
         if (result == -1) {
             return RAISE(PyExc_ValueError,
                          "source surface to be alpha pre-multiplied must have "
@@ -3792,8 +3845,9 @@ surf_premul_alpha_ip(pgSurfaceObject *self, PyObject *_null)
     }
 
     pgSurface_Prep(self);
+    pgSurface_Touch(self);
 
-    int result = premul_surf_color_by_alpha(surf, surf);
+    int result = premul_surf_color_by_alpha_counted(surf, surf);
     if (result == -1) {
         return RAISE(PyExc_ValueError,
                      "source surface to be alpha pre-multiplied must have "
@@ -3809,6 +3863,183 @@ surf_premul_alpha_ip(pgSurfaceObject *self, PyObject *_null)
     return (PyObject *)self;
 }
 
+static PyObject *
+surf_get_generation(pgSurfaceObject *self, PyObject *_null)
+{
+    SURF_INIT_CHECK(pgSurface_AsSurface(self))
+
+    return PyLong_FromUnsignedLongLong(pgSurface_GetGeneration(self));
+}
+
+/* Surface.get_hash, see simd_hash.h for how a stripe is folded in. Every
+ * SURFACE_HASH_BLOCK stripes the accumulators are scrambled, so that a
+ * change in one stripe can't be cancelled out by one in another. The
+ * constants are from xxHash. */
+#define SURFACE_HASH_BLOCK 16
+#define SURFACE_HASH_PRIME32 0x9E3779B1U
+#define SURFACE_HASH_PRIME64_1 0x9E3779B185EBCA87ULL
+#define SURFACE_HASH_PRIME64_2 0xC2B2AE3D27D4EB4FULL
+#define SURFACE_HASH_PRIME64_4 0x85EBCA77C2B2AE63ULL
+
+static int surface_has_avx2 = 0;
+static int surface_has_sse2 = 0;
+
+static const Uint64 surface_hash_key[8] = {
+    0xE220A8397B1DCDAFULL, 0x6E789E6AA1B965F4ULL, 0x06C45D188009454FULL,
+    0xF88BB8A8724C81ECULL, 0x1B39896A51A8749BULL, 0x53CB9F0C747EA2EAULL,
+    0x2C829ABE1F4532E1ULL, 0xC584133AC916AB3CULL};
+
+typedef struct {
+    Uint64 acc[8];
+    Uint8 buf[64]; /* the start of a stripe split across rows */
+    size_t buffered;
+    int stripes; /* since the last scramble */
+    Uint64 length;
+} SurfaceHashState;
+
+static void
+surface_hash_stripes(Uint64 *acc, const Uint8 *data, int nstripes)
+{
+    Uint64 lane, k;
+    int i = 0, j;
+
+#if !defined(__EMSCRIPTEN__)
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    if (surface_has_avx2) {
+        i = surface_hash_stripes_avx2(acc, surface_hash_key, data, nstripes);
+    }
+    if (!i && surface_has_sse2) {
+        i = surface_hash_stripes_sse2(acc, surface_hash_key, data, nstripes);
+    }
+#endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
+#endif /* __EMSCRIPTEN__ */
+
+    for (data += i * 64; i < nstripes; ++i, data += 64) {
+        for (j = 0; j < 8; ++j) {
+            memcpy(&lane, data + j * 8, sizeof(lane));
+            lane = SDL_SwapLE64(lane);
+            k = lane ^ surface_hash_key[j];
+            acc[j] += lane + (k & 0xFFFFFFFF) * (k >> 32);
+        }
+    }
+}
+
+static void
+surface_hash_consume(SurfaceHashState *state, const Uint8 *data,
+                     size_t nstripes)
+{
+    int n, j;
+
+    while (nstripes) {
+        n = (int)MIN(nstripes, (size_t)(SURFACE_HASH_BLOCK - state->stripes));
+        surface_hash_stripes(state->acc, data, n);
+        data += (size_t)n * 64;
+        nstripes -= n;
+        state->stripes += n;
+        if (state->stripes == SURFACE_HASH_BLOCK) {
+            for (j = 0; j < 8; ++j) {
+                state->acc[j] ^= state->acc[j] >> 47;
+                state->acc[j] ^= surface_hash_key[j];
+                state->acc[j] *= SURFACE_HASH_PRIME32;
+            }
+            state->stripes = 0;
+        }
+    }
+}
+
+static void
+surface_hash_update(SurfaceHashState *state, const Uint8 *data, size_t len)
+{
+    size_t n;
+
+    state->length += len;
+    if (state->buffered) {
+        n = MIN(64 - state->buffered, len);
+        memcpy(state->buf + state->buffered, data, n);
+        state->buffered += n;
+        data += n;
+        len -= n;
+        if (state->buffered < 64) {
+            return;
+        }
+        surface_hash_consume(state, state->buf, 1);
+        state->buffered = 0;
+    }
+    n = len / 64;
+    surface_hash_consume(state, data, n);
+    memcpy(state->buf, data + n * 64, len - n * 64);
+    state->buffered = len - n * 64;
+}
+
+static Uint64
+surface_hash_avalanche(Uint64 h)
+{
+    h ^= h >> 33;
+    h *= SURFACE_HASH_PRIME64_2;
+    h ^= h >> 29;
+    h *= 0x165667B19E3779F9ULL;
+    h ^= h >> 32;
+    return h;
+}
+
+static Uint64
+surface_hash_digest(SurfaceHashState *state, Uint64 seed)
+{
+    Uint64 h;
+    int j;
+
+    if (state->buffered) {
+        memset(state->buf + state->buffered, 0, 64 - state->buffered);
+        surface_hash_consume(state, state->buf, 1);
+    }
+    h = (state->length * SURFACE_HASH_PRIME64_1) ^ seed;
+    for (j = 0; j < 8; ++j) {
+        h ^= surface_hash_avalanche(state->acc[j] ^ surface_hash_key[j]);
+        h = ((h << 27) | (h >> 37)) * SURFACE_HASH_PRIME64_1 +
+            SURFACE_HASH_PRIME64_4;
+    }
+    return surface_hash_avalanche(h);
+}
+
+static PyObject *
+surf_get_hash(pgSurfaceObject *self, PyObject *_null)
+{
+    SDL_Surface *surf = pgSurface_AsSurface(self);
+    SurfaceHashState state;
+    size_t row_bytes;
+    Uint8 *row;
+    Uint64 seed;
+    int y;
+
+    SURF_INIT_CHECK(surf)
+
+    memset(&state, 0, sizeof(state));
+    /* the hash covers the size and format too, not only the pixel bytes */
+    seed = ((Uint64)surf->w << 32 | (Uint64)surf->h) ^
+           (Uint64)PG_SURF_FORMATENUM(surf) * SURFACE_HASH_PRIME64_2;
+
+    if (!pgSurface_Lock(self)) {
+        return NULL;
+    }
+    row_bytes = (size_t)surf->w * PG_SURF_BytesPerPixel(surf);
+    row = (Uint8 *)surf->pixels;
+    if ((size_t)surf->pitch == row_bytes) {
+        surface_hash_update(&state, row, row_bytes * surf->h);
+    }
+    else {
+        /* skip the padding at the end of rows, and whatever is past the
+         * subsurface's edge in its parent */
+        for (y = 0; y < surf->h; ++y, row += surf->pitch) {
+            surface_hash_update(&state, row, row_bytes);
+        }
+    }
+    if (!pgSurface_Unlock(self)) {
+        return NULL;
+    }
+
+    return PyLong_FromUnsignedLongLong(surface_hash_digest(&state, seed));
+}
+
 static int
 _get_buffer_0D(PyObject *obj, Py_buffer *view_p, int flags)
 {
@@ -4272,6 +4503,8 @@ _release_buffer(Py_buffer *view_p)
         PyErr_Clear();  // ignore any errors here
     }
 
+    /* surface buffers are writable, so assume they were written to */
+    pgSurface_Touch((pgSurfaceObject *)view_p->obj);
     if (!pgSurface_UnlockBy((pgSurfaceObject *)view_p->obj, consumer)) {
         PyErr_Clear();
     }
@@ -4451,6 +4684,145 @@ surface_do_overlap(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
     return dstoffset < span || dstoffset > src->pitch - span;
 }
 
+/* Why blitting src onto dst can't take the fast paths, which want the same
+ * format for SDL or 32 bit surfaces with the same color layout for the SIMD
+ * blitters, or NULL when it can */
+static const char *
+blit_slow_reason(SDL_Surface *src, SDL_Surface *dst)
+{
+    PG_PixelFormat *srcfmt, *dstfmt;
+
+    if (PG_SURF_FORMATENUM(src) == PG_SURF_FORMATENUM(dst)) {
+        return NULL;
+    }
+    if (PG_SURF_BytesPerPixel(src) != PG_SURF_BytesPerPixel(dst)) {
+        return "their pixel sizes differ";
+    }
+    if (PG_SURF_BytesPerPixel(src) != 4) {
+        return "their pixel formats differ";
+    }
+    srcfmt = PG_GetSurfaceFormat(src);
+    dstfmt = PG_GetSurfaceFormat(dst);
+    if (!srcfmt || !dstfmt || (srcfmt->Rmask == dstfmt->Rmask &&
+                               srcfmt->Gmask == dstfmt->Gmask &&
+                               srcfmt->Bmask == dstfmt->Bmask)) {
+        return NULL;
+    }
+    return "their color channels are in a different order";
+}
+
+/* Counts a slow path blit of srcobj for pygame.system.set_blit_diagnostics.
+ * Past the threshold it warns once or, in convert mode, returns a copy of src
+ * converted for dst that is kept until the source changes. Returns the
+ * surface to blit from, or NULL with an exception set. */
+static SDL_Surface *
+blit_diagnose(pgSurfaceObject *srcobj, SDL_Surface *src, SDL_Surface *dst)
+{
+    struct pgBlitCache *cache = srcobj->blitcache;
+    const char *reason = blit_slow_reason(src, dst);
+    PG_PixelFormatEnum dst_format = PG_SURF_FORMATENUM(dst);
+    PG_PixelFormat *dstfmt;
+    SDL_Surface *converted;
+    Uint8 alpha = 255;
+    SDL_BlendMode blendmode = SDL_BLENDMODE_NONE;
+    int has_colorkey;
+    Uint32 colorkey = 0;
+
+    if (!reason || src == dst) {
+        return src;
+    }
+    if (!cache) {
+        cache = PyMem_Calloc(1, sizeof(struct pgBlitCache));
+        if (!cache) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+        srcobj->blitcache = cache;
+    }
+    if (cache->slow_blits < INT_MAX) {
+        cache->slow_blits++;
+    }
+    if (cache->slow_blits < pg_perf_state->blit_threshold) {
+        return src;
+    }
+
+    /* subsurfaces change with their owner, palettes without a lock, and
+     * pixels pygame doesn't own, like image.frombuffer() or
+     * image.load_mapped() ones, without pygame knowing at all */
+    if (pg_perf_state->blit_diagnostics != PG_BLIT_DIAGNOSTICS_CONVERT ||
+        srcobj->subsurface || srcobj->dependency ||
+        (src->flags & SDL_PREALLOC) || PG_SURF_BytesPerPixel(src) == 1 ||
+        PG_SURF_BytesPerPixel(dst) == 1) {
+        if (!cache->warned) {
+            cache->warned = 1;
+            if (PyErr_WarnFormat(
+                    PyExc_RuntimeWarning, 1,
+                    "%d blits of a %s surface onto a %s surface took a slow "
+                    "path because %s, convert() or convert_alpha() the "
+                    "source first",
+                    cache->slow_blits,
+                    SDL_GetPixelFormatName(PG_SURF_FORMATENUM(src)),
+                    SDL_GetPixelFormatName(dst_format), reason) == -1) {
+                return NULL;
+            }
+        }
+        return src;
+    }
+    /* a locked source, say under a surfarray or get_view() array, can be
+     * written without bumping its generation */
+    if (srcobj->locklist && PyList_Size(srcobj->locklist) > 0) {
+        return src;
+    }
+
+    PG_GetSurfaceAlphaMod(src, &alpha);
+    PG_GetSurfaceBlendMode(src, &blendmode);
+    if ((has_colorkey = SDL_HasColorKey(src))) {
+        SDL_GetColorKey(src, &colorkey);
+    }
+    if (cache->converted && cache->generation == srcobj->generation &&
+        cache->dst_format == dst_format && cache->alpha == alpha &&
+        cache->blendmode == blendmode &&
+        cache->has_colorkey == has_colorkey && cache->colorkey == colorkey) {
+        return cache->converted;
+    }
+
+    if (cache->converted) {
+        SDL_FreeSurface(cache->converted);
+        cache->converted = NULL;
+    }
+    if (SDL_ISPIXELFORMAT_ALPHA(PG_SURF_FORMATENUM(src))) {
+        /* like convert_alpha(), but for dst rather than the display */
+        converted =
+            PG_ConvertSurfaceFormat(src, pg_AlphaFormatFor(dst_format));
+        if (converted) {
+            PG_SetSurfaceBlendMode(converted, blendmode);
+        }
+    }
+    else {
+        /* like convert(), leaving out an alpha channel src doesn't have */
+        dstfmt = PG_GetSurfaceFormat(dst);
+        converted =
+            dstfmt ? PG_ConvertSurfaceFormat(
+                         src, SDL_MasksToPixelFormatEnum(
+                                  PG_FORMAT_BitsPerPixel(dstfmt),
+                                  dstfmt->Rmask, dstfmt->Gmask,
+                                  dstfmt->Bmask, 0))
+                   : NULL;
+    }
+    if (!converted) {
+        /* keep blitting the slow way */
+        return src;
+    }
+    cache->converted = converted;
+    cache->generation = srcobj->generation;
+    cache->dst_format = dst_format;
+    cache->alpha = alpha;
+    cache->blendmode = blendmode;
+    cache->has_colorkey = has_colorkey;
+    cache->colorkey = colorkey;
+    return converted;
+}
+
 /*this internal blit function is accessible through the C api*/
 int
 pgSurface_Blit(pgSurfaceObject *dstobj, pgSurfaceObject *srcobj,
@@ -4463,6 +4835,14 @@ pgSurface_Blit(pgSurfaceObject *dstobj, pgSurfaceObject *srcobj,
     SDL_Rect orig_clip, sub_clip;
     Uint8 alpha;
 
+    if (pg_perf_state->blit_diagnostics != PG_BLIT_DIAGNOSTICS_OFF) {
+        src = blit_diagnose(srcobj, src, dst);
+        if (!src) {
+            return 1;
+        }
+    }
+    pgSurface_Touch(dstobj);
+
     /* passthrough blits to the real surface */
     if (((pgSurfaceObject *)dstobj)->subsurface) {
         PyObject *owner;
@@ -4498,6 +4878,7 @@ pgSurface_Blit(pgSurfaceObject *dstobj, pgSurfaceObject *srcobj,
 
     pgSurface_Prep(srcobj);
 
+    PG_PERF_START(perf);
     if ((blend_flags != 0 && blend_flags != PYGAME_BLEND_ALPHA_SDL2) ||
         ((SDL_HasColorKey(src) || _PgSurface_SrcAlpha(src) == 1) &&
          /* This simplification is possible because a source subsurface
@@ -4546,6 +4927,8 @@ pgSurface_Blit(pgSurfaceObject *dstobj, pgSurfaceObject *srcobj,
             src = PG_ConvertSurface(src, &newfmt);
             if (src) {
                 result = SDL_BlitSurface(src, srcrect, dst, dstrect);
+                PG_PERF_COUNT(perf, BLIT_SDL,
+                              (Uint64)dstrect->w * dstrect->h);
                 SDL_FreeSurface(src);
             }
             else {
@@ -4570,6 +4953,7 @@ pgSurface_Blit(pgSurfaceObject *dstobj, pgSurfaceObject *srcobj,
     else {
         /* Py_BEGIN_ALLOW_THREADS */
         result = SDL_BlitSurface(src, srcrect, dst, dstrect);
+        PG_PERF_COUNT(perf, BLIT_SDL, (Uint64)dstrect->w * dstrect->h);
         /* Py_END_ALLOW_THREADS */
     }
 
@@ -4605,6 +4989,7 @@ exec_surface(PyObject *module)
     if (PyErr_Occurred()) {
         return -1;
     }
+    PG_PERF_IMPORT_STATE();
     import_pygame_color();
     if (PyErr_Occurred()) {
         return -1;
@@ -4622,6 +5007,9 @@ exec_surface(PyObject *module)
         return -1;
     }
 
+    surface_has_avx2 = SDL_HasAVX2();
+    surface_has_sse2 = SDL_HasSSE2() || SDL_HasNEON();
+
     /* type preparation */
     if (PyType_Ready(&pgSurface_Type) < 0) {
         return -1;
@@ -4649,6 +5037,7 @@ exec_surface(PyObject *module)
     c_api[1] = pgSurface_New2;
     c_api[2] = pgSurface_Blit;
     c_api[3] = pgSurface_SetSurface;
+    c_api[4] = premul_surf_color_by_alpha;
     apiobj = encapsulate_api(c_api, "surface");
     if (PyModule_Add(module, PYGAMEAPI_LOCAL_ENTRY, apiobj) < 0) {
         return -1;
@@ -362,6 +362,9 @@ pygame_Blit(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst,
 int
 premul_surf_color_by_alpha(SDL_Surface *src, SDL_Surface *dst);
 
+int
+premul_surf_color_by_alpha_counted(SDL_Surface *src, SDL_Surface *dst);
+
 int
 pg_warn_simd_at_runtime_but_uncompiled();
 
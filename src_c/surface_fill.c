@@ -20,6 +20,7 @@
 #define NO_PYGAME_C_API
 
 #include "simd_fill.h"
+#include "pgperf.h"
 
 /*
  * Changes SDL_Rect to respect any clipping rect defined on the surface.
@@ -916,6 +917,9 @@ surface_fill_blend_rgba_max(SDL_Surface *surface, SDL_Rect *rect, Uint32 color)
     return result;
 }
 
+/* counts the fill kernel that just ran, see pgperf.h */
+#define COUNT_FILL(id) PG_PERF_COUNT(perf, id, (Uint64)rect->w * rect->h)
+
 int
 surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
                    int blendargs)
@@ -933,6 +937,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
         locked = 1;
     }
 
+    PG_PERF_START(perf);
     switch (blendargs) {
         case PYGAME_BLEND_ADD: {
 #if !defined(__EMSCRIPTEN__)
@@ -940,11 +945,13 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
             if (PG_SURF_BytesPerPixel(surface) == 4) {
                 if (_pg_has_avx2()) {
                     result = surface_fill_blend_add_avx2(surface, rect, color);
+                    COUNT_FILL(FILL_ADD_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result = surface_fill_blend_add_sse2(surface, rect, color);
+                    COUNT_FILL(FILL_ADD_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -952,6 +959,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_add(surface, rect, color);
+            COUNT_FILL(FILL_ADD_SCALAR);
             break;
         }
         case PYGAME_BLEND_SUB: {
@@ -960,11 +968,13 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
             if (PG_SURF_BytesPerPixel(surface) == 4) {
                 if (_pg_has_avx2()) {
                     result = surface_fill_blend_sub_avx2(surface, rect, color);
+                    COUNT_FILL(FILL_SUB_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result = surface_fill_blend_sub_sse2(surface, rect, color);
+                    COUNT_FILL(FILL_SUB_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -972,6 +982,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_sub(surface, rect, color);
+            COUNT_FILL(FILL_SUB_SCALAR);
             break;
         }
         case PYGAME_BLEND_MULT: {
@@ -981,12 +992,14 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
                 if (_pg_has_avx2()) {
                     result =
                         surface_fill_blend_mult_avx2(surface, rect, color);
+                    COUNT_FILL(FILL_MULT_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result =
                         surface_fill_blend_mult_sse2(surface, rect, color);
+                    COUNT_FILL(FILL_MULT_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -994,6 +1007,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_mult(surface, rect, color);
+            COUNT_FILL(FILL_MULT_SCALAR);
             break;
         }
         case PYGAME_BLEND_MIN: {
@@ -1002,11 +1016,13 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
             if (PG_SURF_BytesPerPixel(surface) == 4) {
                 if (_pg_has_avx2()) {
                     result = surface_fill_blend_min_avx2(surface, rect, color);
+                    COUNT_FILL(FILL_MIN_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result = surface_fill_blend_min_sse2(surface, rect, color);
+                    COUNT_FILL(FILL_MIN_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -1014,6 +1030,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_min(surface, rect, color);
+            COUNT_FILL(FILL_MIN_SCALAR);
             break;
         }
         case PYGAME_BLEND_MAX: {
@@ -1022,11 +1039,13 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
             if (PG_SURF_BytesPerPixel(surface) == 4) {
                 if (_pg_has_avx2()) {
                     result = surface_fill_blend_max_avx2(surface, rect, color);
+                    COUNT_FILL(FILL_MAX_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result = surface_fill_blend_max_sse2(surface, rect, color);
+                    COUNT_FILL(FILL_MAX_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -1034,6 +1053,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_max(surface, rect, color);
+            COUNT_FILL(FILL_MAX_SCALAR);
             break;
         }
 
@@ -1044,12 +1064,14 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
                 if (_pg_has_avx2()) {
                     result =
                         surface_fill_blend_rgba_add_avx2(surface, rect, color);
+                    COUNT_FILL(FILL_RGBA_ADD_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result =
                         surface_fill_blend_rgba_add_sse2(surface, rect, color);
+                    COUNT_FILL(FILL_RGBA_ADD_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -1057,6 +1079,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_rgba_add(surface, rect, color);
+            COUNT_FILL(FILL_RGBA_ADD_SCALAR);
             break;
         }
         case PYGAME_BLEND_RGBA_SUB: {
@@ -1066,12 +1089,14 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
                 if (_pg_has_avx2()) {
                     result =
                         surface_fill_blend_rgba_sub_avx2(surface, rect, color);
+                    COUNT_FILL(FILL_RGBA_SUB_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result =
                         surface_fill_blend_rgba_sub_sse2(surface, rect, color);
+                    COUNT_FILL(FILL_RGBA_SUB_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -1079,6 +1104,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_rgba_sub(surface, rect, color);
+            COUNT_FILL(FILL_RGBA_SUB_SCALAR);
             break;
         }
         case PYGAME_BLEND_RGBA_MULT: {
@@ -1088,12 +1114,14 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
                 if (_pg_has_avx2()) {
                     result = surface_fill_blend_rgba_mult_avx2(surface, rect,
                                                                color);
+                    COUNT_FILL(FILL_RGBA_MULT_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result = surface_fill_blend_rgba_mult_sse2(surface, rect,
                                                                color);
+                    COUNT_FILL(FILL_RGBA_MULT_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -1101,6 +1129,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_rgba_mult(surface, rect, color);
+            COUNT_FILL(FILL_RGBA_MULT_SCALAR);
             break;
         }
         case PYGAME_BLEND_RGBA_MIN: {
@@ -1110,12 +1139,14 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
                 if (_pg_has_avx2()) {
                     result =
                         surface_fill_blend_rgba_min_avx2(surface, rect, color);
+                    COUNT_FILL(FILL_RGBA_MIN_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result =
                         surface_fill_blend_rgba_min_sse2(surface, rect, color);
+                    COUNT_FILL(FILL_RGBA_MIN_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -1123,6 +1154,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_rgba_min(surface, rect, color);
+            COUNT_FILL(FILL_RGBA_MIN_SCALAR);
             break;
         }
         case PYGAME_BLEND_RGBA_MAX: {
@@ -1132,12 +1164,14 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
                 if (_pg_has_avx2()) {
                     result =
                         surface_fill_blend_rgba_max_avx2(surface, rect, color);
+                    COUNT_FILL(FILL_RGBA_MAX_AVX2);
                     break;
                 }
 #if PG_ENABLE_SSE_NEON
                 if (_pg_HasSSE_NEON()) {
                     result =
                         surface_fill_blend_rgba_max_sse2(surface, rect, color);
+                    COUNT_FILL(FILL_RGBA_MAX_SSE2);
                     break;
                 }
 #endif /* PG_ENABLE_SSE_NEON */
@@ -1145,6 +1179,7 @@ surface_fill_blend(SDL_Surface *surface, SDL_Rect *rect, Uint32 color,
 #endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
 #endif /* __EMSCRIPTEN__ */
             result = surface_fill_blend_rgba_max(surface, rect, color);
+            COUNT_FILL(FILL_RGBA_MAX_SCALAR);
             break;
         }
 
@@ -1,9 +1,12 @@
 #include "pygame.h"
 
 #include "pgcompat.h"
+#include "pgperf.h"
 
 #include "doc/system_doc.h"
 
+PG_PERF_DEFINE_STATE
+
 static PyObject *
 pg_system_get_cpu_instruction_sets(PyObject *self, PyObject *_null)
 {
@@ -251,6 +254,105 @@ pg_system_get_power_state(PyObject *self, PyObject *_null)
     return PyObject_Call(PowerState_class, return_args, return_kwargs);
 }
 
+static PyObject *
+pg_system_enable_perf_counters(PyObject *self, PyObject *args,
+                               PyObject *kwargs)
+{
+    int enable = 1;
+    static char *kwids[] = {"enable", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|p", kwids, &enable)) {
+        return NULL;
+    }
+#if PG_PERF_COUNTERS
+    pg_perf_state->enabled = enable;
+    Py_RETURN_NONE;
+#else
+    if (!enable) {
+        Py_RETURN_NONE;
+    }
+    return RAISE(PyExc_NotImplementedError,
+                 "pygame was built without perf counters");
+#endif /* ~PG_PERF_COUNTERS */
+}
+
+static PyObject *
+pg_system_get_perf_counters(PyObject *self, PyObject *_null)
+{
+    static const char *names[] = {
+#define PG_PERF_NAME(id, name) name,
+        PG_PERF_KERNELS(PG_PERF_NAME)
+#undef PG_PERF_NAME
+    };
+    double ns_per_tick = 1e9 / (double)SDL_GetPerformanceFrequency();
+    PyObject *counters, *counter;
+    int i;
+
+    counters = PyDict_New();
+    if (!counters) {
+        return NULL;
+    }
+    for (i = 0; i < PG_PERF_NUM_KERNELS; i++) {
+        pgPerfCounter *c = &pg_perf_state->counters[i];
+
+        if (!c->calls) {
+            continue;
+        }
+        counter = Py_BuildValue(
+            "{sKsKsK}", "calls", (unsigned long long)c->calls, "pixels",
+            (unsigned long long)c->pixels, "ns",
+            (unsigned long long)(c->ticks * ns_per_tick));
+        if (!counter || PyDict_SetItemString(counters, names[i], counter)) {
+            Py_XDECREF(counter);
+            Py_DECREF(counters);
+            return NULL;
+        }
+        Py_DECREF(counter);
+    }
+    return counters;
+}
+
+static PyObject *
+pg_system_reset_perf_counters(PyObject *self, PyObject *_null)
+{
+    memset(pg_perf_state->counters, 0, sizeof(pg_perf_state->counters));
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+pg_system_set_blit_diagnostics(PyObject *self, PyObject *args,
+                               PyObject *kwargs)
+{
+    const char *mode = NULL;
+    int threshold = 10;
+    int diagnostics;
+    static char *kwids[] = {"mode", "threshold", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|zi", kwids, &mode,
+                                     &threshold)) {
+        return NULL;
+    }
+    if (!mode) {
+        diagnostics = PG_BLIT_DIAGNOSTICS_OFF;
+    }
+    else if (!strcmp(mode, "warn")) {
+        diagnostics = PG_BLIT_DIAGNOSTICS_WARN;
+    }
+    else if (!strcmp(mode, "convert")) {
+        diagnostics = PG_BLIT_DIAGNOSTICS_CONVERT;
+    }
+    else {
+        return RAISE(PyExc_ValueError,
+                     "mode must be None, 'warn' or 'convert'");
+    }
+    if (threshold < 1) {
+        return RAISE(PyExc_ValueError, "threshold must be at least 1");
+    }
+    pg_perf_state->blit_diagnostics = diagnostics;
+    pg_perf_state->blit_threshold = threshold;
+    Py_RETURN_NONE;
+}
+
 static PyMethodDef _system_methods[] = {
     {"get_cpu_instruction_sets", pg_system_get_cpu_instruction_sets,
      METH_NOARGS, DOC_SYSTEM_GETCPUINSTRUCTIONSETS},
@@ -262,6 +364,14 @@ static PyMethodDef _system_methods[] = {
      DOC_SYSTEM_GETPREFLOCALES},
     {"get_power_state", pg_system_get_power_state, METH_NOARGS,
      DOC_SYSTEM_GETPOWERSTATE},
+    {"enable_perf_counters", (PyCFunction)pg_system_enable_perf_counters,
+     METH_VARARGS | METH_KEYWORDS, DOC_SYSTEM_ENABLEPERFCOUNTERS},
+    {"get_perf_counters", pg_system_get_perf_counters, METH_NOARGS,
+     DOC_SYSTEM_GETPERFCOUNTERS},
+    {"reset_perf_counters", pg_system_reset_perf_counters, METH_NOARGS,
+     DOC_SYSTEM_RESETPERFCOUNTERS},
+    {"set_blit_diagnostics", (PyCFunction)pg_system_set_blit_diagnostics,
+     METH_VARARGS | METH_KEYWORDS, DOC_SYSTEM_SETBLITDIAGNOSTICS},
     {NULL, NULL, 0, NULL}};
 
 MODINIT_DEFINE(system)
@@ -282,6 +392,7 @@ MODINIT_DEFINE(system)
     if (PyErr_Occurred()) {
         return NULL;
     }
+    PG_PERF_IMPORT_STATE();
 
     PyObject *data_classes_module =
         PyImport_ImportModule("pygame._data_classes");
@@ -26,8 +26,18 @@
 
 #include "doc/time_doc.h"
 
+#include <math.h>
+
+#if !SDL_VERSION_ATLEAST(3, 0, 0) && !defined(_WIN32)
+#include <errno.h>
+#include <time.h>
+#endif
+
 #define WORST_CLOCK_ACCURACY 12
 
+/* Number of frame times kept by a Clock for its frame statistics */
+#define PG_CLOCK_HISTORY 512
+
 /* Enum containing some error codes used by timer related functions */
 typedef enum {
     PG_TIMER_NO_ERROR,
@@ -414,7 +424,6 @@ time_set_timer(PyObject *self, PyObject *args, PyObject *kwargs)
     int ticks, loops = 0;
     PyObject *obj, *ev_dict = NULL;
     int ev_type;
-    pgEventObject *e;
     pgSetTimerErr ecode = PG_TIMER_NO_ERROR;
 
     static char *kwids[] = {"event", "millis", "loops", NULL};
@@ -442,9 +451,11 @@ time_set_timer(PyObject *self, PyObject *args, PyObject *kwargs)
         }
     }
     else if (pgEvent_Check(obj)) {
-        e = (pgEventObject *)obj;
-        ev_type = e->type;
-        ev_dict = e->dict;
+        ev_type = ((pgEventObject *)obj)->type;
+        ev_dict = pgEvent_GetDict(obj);
+        if (!ev_dict) {
+            return NULL;
+        }
     }
     else {
         return RAISE(PyExc_TypeError,
@@ -523,19 +534,78 @@ end_no_mutex:
     }
 }
 
+/* Sleeps for about ns nanoseconds, with better than millisecond resolution
+ * where the platform allows it. Does not need the GIL */
+static void
+_pg_sleep_ns(Uint64 ns)
+{
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+    SDL_DelayNS(ns);
+#elif !defined(_WIN32)
+    struct timespec ts;
+    ts.tv_sec = (time_t)(ns / 1000000000);
+    ts.tv_nsec = (long)(ns % 1000000000);
+    while (nanosleep(&ts, &ts) == -1 && errno == EINTR) {
+    }
+#else
+    SDL_Delay((Uint32)(ns / 1000000));
+#endif
+}
+
 /*clock object interface*/
 typedef struct {
     PyObject_HEAD Uint64 last_tick, fps_count, fps_tick;
     float fps;
     Uint64 timepassed, rawpassed;
+    /* performance counter values of the previous tick and of the previous
+     * tick_precise deadline (0 when there is none) */
+    Uint64 last_counter, deadline;
+    /* ring buffer of the last frame times, in milliseconds */
+    float frame_times[PG_CLOCK_HISTORY];
+    int frame_index, frame_count;
 } pgClockObject;
 
+/* frame bookkeeping shared by all the tick functions */
+static PyObject *
+clock_update(pgClockObject *self, float framerate)
+{
+    Uint64 nowtime, counter;
+
+    counter = SDL_GetPerformanceCounter();
+    self->frame_times[self->frame_index] =
+        (float)((counter - self->last_counter) * 1000.0 /
+                SDL_GetPerformanceFrequency());
+    self->frame_index = (self->frame_index + 1) % PG_CLOCK_HISTORY;
+    if (self->frame_count < PG_CLOCK_HISTORY) {
+        self->frame_count++;
+    }
+    self->last_counter = counter;
+
+    nowtime = PG_GetTicks();
+    self->timepassed = nowtime - self->last_tick;
+    self->fps_count += 1;
+    self->last_tick = nowtime;
+    if (!framerate) {
+        self->rawpassed = self->timepassed;
+    }
+
+    if (!self->fps_tick) {
+        self->fps_count = 0;
+        self->fps_tick = nowtime;
+    }
+    else if (self->fps_count >= 10) {
+        self->fps = self->fps_count / ((nowtime - self->fps_tick) / 1000.0f);
+        self->fps_count = 0;
+        self->fps_tick = nowtime;
+    }
+    return PyLong_FromUnsignedLongLong(self->timepassed);
+}
+
 // to be called by the other tick functions.
 static PyObject *
 clock_tick_base(pgClockObject *self, PyObject *arg, int use_accurate_delay)
 {
     float framerate = 0.0f;
-    Uint64 nowtime;
 
     if (!PyArg_ParseTuple(arg, "|f", &framerate)) {
         return NULL;
@@ -573,25 +643,10 @@ clock_tick_base(pgClockObject *self, PyObject *arg, int use_accurate_delay)
             return NULL;
         }
     }
+    /* tick and tick_busy_loop do not keep the tick_precise cadence */
+    self->deadline = 0;
 
-    nowtime = PG_GetTicks();
-    self->timepassed = nowtime - self->last_tick;
-    self->fps_count += 1;
-    self->last_tick = nowtime;
-    if (!framerate) {
-        self->rawpassed = self->timepassed;
-    }
-
-    if (!self->fps_tick) {
-        self->fps_count = 0;
-        self->fps_tick = nowtime;
-    }
-    else if (self->fps_count >= 10) {
-        self->fps = self->fps_count / ((nowtime - self->fps_tick) / 1000.0f);
-        self->fps_count = 0;
-        self->fps_tick = nowtime;
-    }
-    return PyLong_FromUnsignedLongLong(self->timepassed);
+    return clock_update(self, framerate);
 }
 
 static PyObject *
@@ -606,6 +661,198 @@ clock_tick_busy_loop(pgClockObject *self, PyObject *arg)
     return clock_tick_base(self, arg, 1);
 }
 
+/* Frame pacer based on the performance counter. Frames are scheduled on a
+ * fixed cadence of deadlines, so that sleeping late on one frame is made up
+ * on the next one instead of drifting. Most of the wait is spent sleeping,
+ * only the last `spin` milliseconds are busy waited to hit the deadline */
+static PyObject *
+clock_tick_precise(pgClockObject *self, PyObject *args, PyObject *kwargs)
+{
+    float framerate = 0.0f;
+    double spin = 1.0;
+    Uint64 freq, period, spin_ticks, deadline, now;
+
+    static char *kwids[] = {"framerate", "spin", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|fd", kwids, &framerate,
+                                     &spin)) {
+        return NULL;
+    }
+    if (spin < 0) {
+        return RAISE(PyExc_ValueError, "spin must be at least 0");
+    }
+
+    if (framerate <= 0) {
+        self->deadline = 0;
+        return clock_update(self, 0.0f);
+    }
+
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+    /*just doublecheck that timer is initialized*/
+    if (!SDL_WasInit(SDL_INIT_TIMER)) {
+        if (!PG_InitSubSystem(SDL_INIT_TIMER)) {
+            return RAISE(pgExc_SDLError, SDL_GetError());
+        }
+    }
+#endif
+
+    self->rawpassed = PG_GetTicks() - self->last_tick;
+
+    freq = SDL_GetPerformanceFrequency();
+    period = (Uint64)(freq / (double)framerate);
+    spin_ticks = (Uint64)(freq * spin / 1000.0);
+    now = SDL_GetPerformanceCounter();
+
+    if (self->deadline) {
+        deadline = self->deadline + period;
+        if (deadline + period < now) {
+            /* more than a frame late, start a new cadence from here */
+            deadline = now;
+        }
+    }
+    else {
+        deadline = self->last_counter + period;
+    }
+
+    Py_BEGIN_ALLOW_THREADS;
+    if (now + spin_ticks < deadline) {
+        _pg_sleep_ns(
+            (Uint64)((deadline - spin_ticks - now) * 1e9 / (double)freq));
+    }
+    while (SDL_GetPerformanceCounter() < deadline) {
+        /* spin until the deadline */
+    }
+    Py_END_ALLOW_THREADS;
+
+    self->deadline = deadline;
+    return clock_update(self, framerate);
+}
+
+static int
+_pg_compare_floats(const void *a, const void *b)
+{
+    float fa = *(const float *)a, fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+static PyObject *
+clock_get_frame_percentiles(pgClockObject *self, PyObject *args,
+                            PyObject *kwargs)
+{
+    float sorted[PG_CLOCK_HISTORY];
+    PyObject *percentiles = NULL, *seq, *ret;
+    Py_ssize_t i, len;
+    double p;
+
+    static char *kwids[] = {"percentiles", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|O", kwids,
+                                     &percentiles)) {
+        return NULL;
+    }
+
+    if (percentiles) {
+        seq = PySequence_Fast(percentiles, "percentiles must be a sequence");
+    }
+    else {
+        seq = Py_BuildValue("(iii)", 50, 95, 99);
+    }
+    if (!seq) {
+        return NULL;
+    }
+    len = PySequence_Fast_GET_SIZE(seq);
+
+    /* the ring buffer is filled from index 0, so the first frame_count
+     * entries are always the valid ones */
+    memcpy(sorted, self->frame_times, sizeof(float) * self->frame_count);
+    qsort(sorted, self->frame_count, sizeof(float), _pg_compare_floats);
+
+    ret = PyTuple_New(len);
+    if (!ret) {
+        Py_DECREF(seq);
+        return NULL;
+    }
+    for (i = 0; i < len; i++) {
+        p = PyFloat_AsDouble(PySequence_Fast_GET_ITEM(seq, i));
+        if (p == -1.0 && PyErr_Occurred()) {
+            goto error;
+        }
+        if (p < 0 || p > 100) {
+            PyErr_SetString(PyExc_ValueError,
+                            "percentiles must be between 0 and 100");
+            goto error;
+        }
+        if (!self->frame_count) {
+            PyTuple_SET_ITEM(ret, i, PyFloat_FromDouble(0.0));
+        }
+        else {
+            /* nearest rank, ceil(p / 100 * n) counted from 1. p is
+             * multiplied first so that exact ranks stay exact */
+            Py_ssize_t rank =
+                (Py_ssize_t)ceil(p * self->frame_count / 100.0) - 1;
+            if (rank < 0) {
+                rank = 0;
+            }
+            PyTuple_SET_ITEM(ret, i, PyFloat_FromDouble(sorted[rank]));
+        }
+    }
+    Py_DECREF(seq);
+    return ret;
+
+error:
+    Py_DECREF(seq);
+    Py_DECREF(ret);
+    return NULL;
+}
+
+static PyObject *
+clock_get_frame_histogram(pgClockObject *self, PyObject *args,
+                          PyObject *kwargs)
+{
+    double bin_width = 1.0;
+    int bins = 32, i;
+    double bin;
+    Py_ssize_t *counts;
+    PyObject *ret;
+
+    static char *kwids[] = {"bin_width", "bins", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|di", kwids, &bin_width,
+                                     &bins)) {
+        return NULL;
+    }
+    if (bin_width <= 0) {
+        return RAISE(PyExc_ValueError, "bin_width must be positive");
+    }
+    if (bins < 1) {
+        return RAISE(PyExc_ValueError, "bins must be at least 1");
+    }
+
+    counts = PyMem_Calloc(bins, sizeof(Py_ssize_t));
+    if (!counts) {
+        return PyErr_NoMemory();
+    }
+    for (i = 0; i < self->frame_count; i++) {
+        bin = self->frame_times[i] / bin_width;
+        /* the last bin also counts all the longer frames */
+        counts[bin < bins ? (int)bin : bins - 1]++;
+    }
+
+    ret = PyList_New(bins);
+    if (ret) {
+        for (i = 0; i < bins; i++) {
+            PyObject *count = PyLong_FromSsize_t(counts[i]);
+            if (!count) {
+                Py_CLEAR(ret);
+                break;
+            }
+            PyList_SET_ITEM(ret, i, count);
+        }
+    }
+    PyMem_Free(counts);
+    return ret;
+}
+
 static PyObject *
 clock_get_fps(pgClockObject *self, PyObject *_null)
 {
@@ -636,6 +883,12 @@ static struct PyMethodDef clock_methods[] = {
      DOC_TIME_CLOCK_GETRAWTIME},
     {"tick_busy_loop", (PyCFunction)clock_tick_busy_loop, METH_VARARGS,
      DOC_TIME_CLOCK_TICKBUSYLOOP},
+    {"tick_precise", (PyCFunction)clock_tick_precise,
+     METH_VARARGS | METH_KEYWORDS, DOC_TIME_CLOCK_TICKPRECISE},
+    {"get_frame_percentiles", (PyCFunction)clock_get_frame_percentiles,
+     METH_VARARGS | METH_KEYWORDS, DOC_TIME_CLOCK_GETFRAMEPERCENTILES},
+    {"get_frame_histogram", (PyCFunction)clock_get_frame_histogram,
+     METH_VARARGS | METH_KEYWORDS, DOC_TIME_CLOCK_GETFRAMEHISTOGRAM},
     {NULL, NULL, 0, NULL}};
 
 static void
@@ -684,6 +937,9 @@ clock_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
     self->last_tick = PG_GetTicks();
     self->fps = 0.0f;
     self->fps_count = 0;
+    self->last_counter = SDL_GetPerformanceCounter();
+    self->deadline = 0;
+    self->frame_index = self->frame_count = 0;
 
     return (PyObject *)self;
 }
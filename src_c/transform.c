@@ -27,6 +27,7 @@
 #include "pygame.h"
 
 #include "pgcompat.h"
+#include "pgperf.h"
 
 #include "doc/transform_doc.h"
 
@@ -49,6 +50,8 @@ struct _module_state {
 
 #define GETSTATE(m) ((struct _module_state *)PyModule_GetState(m))
 
+PG_PERF_DEFINE_STATE
+
 void
 scale2x(SDL_Surface *src, SDL_Surface *dst);
 extern SDL_Surface *
@@ -501,11 +504,13 @@ scale_to(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj, int width,
      * happen here. */
     if ((width && height) && (src->w && src->h)) {
         pgSurface_Lock(srcobj);
+        PG_PERF_START(perf);
         Py_BEGIN_ALLOW_THREADS;
 
         stretch_result_num = PG_SoftStretchNearest(src, NULL, modsurf, NULL);
 
         Py_END_ALLOW_THREADS;
+        PG_PERF_COUNT(perf, TRANSFORM_SCALE, (Uint64)width * height);
         pgSurface_Unlock(srcobj);
 
         if (modsurf != retsurf) {
@@ -549,6 +554,7 @@ surf_scale(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     if (surfobj2) {
+        pgSurface_Touch(surfobj2);
         Py_INCREF(surfobj2);
         return (PyObject *)surfobj2;
     }
@@ -587,6 +593,7 @@ surf_scale_by(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     if (surfobj2) {
+        pgSurface_Touch(surfobj2);
         Py_INCREF(surfobj2);
         return (PyObject *)surfobj2;
     }
@@ -650,6 +657,7 @@ surf_scale2x(PyObject *self, PyObject *args, PyObject *kwargs)
     SDL_UnlockSurface(newsurf);
 
     if (surfobj2) {
+        pgSurface_Touch((pgSurfaceObject *)surfobj2);
         Py_INCREF(surfobj2);
         return surfobj2;
     }
@@ -690,10 +698,12 @@ surf_rotate(PyObject *self, PyObject *args, PyObject *kwargs)
 
     if (!(fmod((double)angle, (double)90.0f))) {
         pgSurface_Lock(surfobj);
+        PG_PERF_START(perf);
 
         /* The function releases GIL internally, don't release here */
         newsurf = rotate90(surf, (int)angle);
 
+        PG_PERF_COUNT(perf, TRANSFORM_ROTATE, (Uint64)surf->w * surf->h);
         pgSurface_Unlock(surfobj);
         if (!newsurf) {
             return NULL;
@@ -759,9 +769,11 @@ surf_rotate(PyObject *self, PyObject *args, PyObject *kwargs)
     SDL_LockSurface(newsurf);
     pgSurface_Lock(surfobj);
 
+    PG_PERF_START(perf);
     Py_BEGIN_ALLOW_THREADS;
     rotate(surf, newsurf, bgcolor, sangle, cangle);
     Py_END_ALLOW_THREADS;
+    PG_PERF_COUNT(perf, TRANSFORM_ROTATE, (Uint64)newsurf->w * newsurf->h);
 
     pgSurface_Unlock(surfobj);
     SDL_UnlockSurface(newsurf);
@@ -802,6 +814,7 @@ surf_flip(PyObject *self, PyObject *args, PyObject *kwargs)
     srcpix = (Uint8 *)surf->pixels;
     dstpix = (Uint8 *)newsurf->pixels;
 
+    PG_PERF_START(perf);
     Py_BEGIN_ALLOW_THREADS;
 
     if (!xaxis) {
@@ -923,6 +936,7 @@ surf_flip(PyObject *self, PyObject *args, PyObject *kwargs)
         }
     }
     Py_END_ALLOW_THREADS;
+    PG_PERF_COUNT(perf, TRANSFORM_FLIP, (Uint64)surf->w * surf->h);
 
     pgSurface_Unlock(surfobj);
     SDL_UnlockSurface(newsurf);
@@ -961,6 +975,7 @@ surf_rotozoom(PyObject *self, PyObject *args, PyObject *kwargs)
         Py_END_ALLOW_THREADS;
     }
 
+    PG_PERF_START(perf);
     Py_BEGIN_ALLOW_THREADS;
     newsurf = rotozoomSurface(surf32, angle, scale, 1);
     Py_END_ALLOW_THREADS;
@@ -968,6 +983,7 @@ surf_rotozoom(PyObject *self, PyObject *args, PyObject *kwargs)
         PyErr_SetString(pgExc_SDLError, SDL_GetError());
         return NULL;
     }
+    PG_PERF_COUNT(perf, TRANSFORM_ROTOZOOM, (Uint64)newsurf->w * newsurf->h);
 
     if (surf32 == surf) {
         pgSurface_Unlock(surfobj);
@@ -1508,6 +1524,19 @@ scalesmooth(SDL_Surface *src, SDL_Surface *dst, struct _module_state *st)
     }
 }
 
+/* the get_perf_counters kernel the current smoothscale backend counts as */
+static PG_INLINE pgPerfKernel
+smoothscale_perf_kernel(struct _module_state *st)
+{
+    if (!strcmp(st->filter_type, "SSE2") || !strcmp(st->filter_type, "NEON")) {
+        return PG_PERF_TRANSFORM_SMOOTHSCALE_SSE2;
+    }
+    if (!strcmp(st->filter_type, "GENERIC")) {
+        return PG_PERF_TRANSFORM_SMOOTHSCALE_SCALAR;
+    }
+    return PG_PERF_TRANSFORM_SMOOTHSCALE_MMX;
+}
+
 static SDL_Surface *
 smoothscale_to(PyObject *self, pgSurfaceObject *srcobj,
                pgSurfaceObject *dstobj, int width, int height)
@@ -1567,9 +1596,12 @@ smoothscale_to(PyObject *self, pgSurfaceObject *srcobj,
         }
         else {
             struct _module_state *st = GETSTATE(self);
+            PG_PERF_START(perf);
             Py_BEGIN_ALLOW_THREADS;
             scalesmooth(src, retsurf, st);
             Py_END_ALLOW_THREADS;
+            PG_PERF_COUNT_KERNEL(perf, smoothscale_perf_kernel(st),
+                                 (Uint64)width * height);
         }
 
         pgSurface_Unlock(srcobj);
@@ -1609,6 +1641,7 @@ surf_scalesmooth(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     if (surfobj2) {
+        pgSurface_Touch(surfobj2);
         Py_INCREF(surfobj2);
         return (PyObject *)surfobj2;
     }
@@ -1647,6 +1680,7 @@ surf_scalesmooth_by(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     if (surfobj2) {
+        pgSurface_Touch(surfobj2);
         Py_INCREF(surfobj2);
         return (PyObject *)surfobj2;
     }
@@ -2121,6 +2155,7 @@ surf_threshold(PyObject *self, PyObject *args, PyObject *kwds)
     }
 
     if (dest_surf) {
+        pgSurface_Touch((pgSurfaceObject *)dest_surf_obj);
         pgSurface_Lock((pgSurfaceObject *)dest_surf_obj);
     }
     pgSurface_Lock(surf_obj);
@@ -2273,6 +2308,9 @@ grayscale_non_simd(SDL_Surface *src, PG_PixelFormat *src_format,
     }
 }
 
+/* counts the grayscale or invert kernel that just ran, see pgperf.h */
+#define COUNT_PIXELWISE(id) PG_PERF_COUNT(perf, id, (Uint64)src->w * src->h)
+
 SDL_Surface *
 grayscale(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj)
 {
@@ -2307,8 +2345,10 @@ grayscale(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj)
         return (SDL_Surface *)(RAISE(pgExc_SDLError, SDL_GetError()));
     }
 
+    PG_PERF_START(perf);
 #if defined(__EMSCRIPTEN__)
     grayscale_non_simd(src, src_format, newsurf, newsurf_format);
+    COUNT_PIXELWISE(TRANSFORM_GRAYSCALE_SCALAR);
 #else  // !defined(__EMSCRIPTEN__)
     if (PG_FORMAT_BytesPerPixel(src_format) == 4 &&
         src_format->Rmask == newsurf_format->Rmask &&
@@ -2317,18 +2357,22 @@ grayscale(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj)
         (newsurf->pitch == (newsurf->w * 4))) {
         if (pg_has_avx2()) {
             grayscale_avx2(src, src_format, newsurf);
+            COUNT_PIXELWISE(TRANSFORM_GRAYSCALE_AVX2);
         }
 #if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
         else if (pg_HasSSE_NEON()) {
             grayscale_sse2(src, src_format, newsurf);
+            COUNT_PIXELWISE(TRANSFORM_GRAYSCALE_SSE2);
         }
 #endif  // defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
         else {
             grayscale_non_simd(src, src_format, newsurf, newsurf_format);
+            COUNT_PIXELWISE(TRANSFORM_GRAYSCALE_SCALAR);
         }
     }
     else {
         grayscale_non_simd(src, src_format, newsurf, newsurf_format);
+        COUNT_PIXELWISE(TRANSFORM_GRAYSCALE_SCALAR);
     }
 #endif  // !defined(__EMSCRIPTEN__)
 
@@ -2359,6 +2403,7 @@ surf_grayscale(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     if (surfobj2) {
+        pgSurface_Touch(surfobj2);
         Py_INCREF(surfobj2);
         return (PyObject *)surfobj2;
     }
@@ -2595,6 +2640,7 @@ surf_solid_overlay(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     if (surfobj2) {
+        pgSurface_Touch(surfobj2);
         Py_INCREF(surfobj2);
         return (PyObject *)surfobj2;
     }
@@ -2881,6 +2927,7 @@ surf_hsl(PyObject *self, PyObject *args, PyObject *kwargs)
     Py_END_ALLOW_THREADS;
 
     if (surfobj2) {
+        pgSurface_Touch(surfobj2);
         Py_INCREF(surfobj2);
         return (PyObject *)surfobj2;
     }
@@ -3148,6 +3195,7 @@ surf_laplacian(PyObject *self, PyObject *args, PyObject *kwargs)
     SDL_UnlockSurface(newsurf);
 
     if (surfobj2) {
+        pgSurface_Touch((pgSurfaceObject *)surfobj2);
         Py_INCREF(surfobj2);
         return surfobj2;
     }
@@ -3479,6 +3527,7 @@ surf_average_surfaces(PyObject *self, PyObject *args, PyObject *kwargs)
         SDL_UnlockSurface(newsurf);
 
         if (surfobj2) {
+            pgSurface_Touch((pgSurfaceObject *)surfobj2);
             Py_INCREF(surfobj2);
             ret = surfobj2;
         }
@@ -4020,6 +4069,7 @@ blur(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj, int radius,
     SDL_LockSurface(retsurf);
     pgSurface_Lock(srcobj);
 
+    PG_PERF_START(perf);
     Py_BEGIN_ALLOW_THREADS;
 
     if (algorithm == 'b') {
@@ -4030,6 +4080,12 @@ blur(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj, int radius,
     }
 
     Py_END_ALLOW_THREADS;
+    if (algorithm == 'b') {
+        PG_PERF_COUNT(perf, TRANSFORM_BOX_BLUR, (Uint64)src->w * src->h);
+    }
+    else {
+        PG_PERF_COUNT(perf, TRANSFORM_GAUSSIAN_BLUR, (Uint64)src->w * src->h);
+    }
 
     pgSurface_Unlock(srcobj);
     SDL_UnlockSurface(retsurf);
@@ -4070,6 +4126,7 @@ surf_box_blur(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     if (dst_surf_obj) {
+        pgSurface_Touch(dst_surf_obj);
         Py_INCREF(dst_surf_obj);
         return (PyObject *)dst_surf_obj;
     }
@@ -4103,6 +4160,7 @@ surf_gaussian_blur(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     if (dst_surf_obj) {
+        pgSurface_Touch(dst_surf_obj);
         Py_INCREF(dst_surf_obj);
         return (PyObject *)dst_surf_obj;
     }
@@ -4166,8 +4224,10 @@ invert(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj)
         return (SDL_Surface *)(RAISE(pgExc_SDLError, SDL_GetError()));
     }
 
+    PG_PERF_START(perf);
 #if defined(__EMSCRIPTEN__)
     invert_non_simd(src, src_format, newsurf, newsurf_format);
+    COUNT_PIXELWISE(TRANSFORM_INVERT_SCALAR);
 #else  // !defined(__EMSCRIPTEN__)
     if (PG_FORMAT_BytesPerPixel(src_format) == 4 &&
         src_format->Rmask == newsurf_format->Rmask &&
@@ -4176,18 +4236,22 @@ invert(pgSurfaceObject *srcobj, pgSurfaceObject *dstobj)
         (newsurf->pitch == (newsurf->w * 4))) {
         if (pg_has_avx2()) {
             invert_avx2(src, src_format, newsurf);
+            COUNT_PIXELWISE(TRANSFORM_INVERT_AVX2);
         }
 #if defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
         else if (pg_HasSSE_NEON()) {
             invert_sse2(src, src_format, newsurf);
+            COUNT_PIXELWISE(TRANSFORM_INVERT_SSE2);
         }
 #endif  // defined(__SSE2__) || defined(PG_ENABLE_ARM_NEON)
         else {
             invert_non_simd(src, src_format, newsurf, newsurf_format);
+            COUNT_PIXELWISE(TRANSFORM_INVERT_SCALAR);
         }
     }
     else {
         invert_non_simd(src, src_format, newsurf, newsurf_format);
+        COUNT_PIXELWISE(TRANSFORM_INVERT_SCALAR);
     }
 #endif  // !defined(__EMSCRIPTEN__)
 
@@ -4218,6 +4282,7 @@ surf_invert(PyObject *self, PyObject *args, PyObject *kwargs)
     }
 
     if (surfobj2) {
+        pgSurface_Touch(surfobj2);
         Py_INCREF(surfobj2);
         return (PyObject *)surfobj2;
     }
@@ -4291,6 +4356,7 @@ MODINIT_DEFINE(transform)
     if (PyErr_Occurred()) {
         return NULL;
     }
+    PG_PERF_IMPORT_STATE();
     import_pygame_color();
     if (PyErr_Occurred()) {
         return NULL;
@@ -78,17 +78,18 @@ def samples(sound):
     return numpy.array(sound, copy=False)
 
 
-def make_sound(array):
-    """pygame.sndarray.make_sound(array): return Sound
+def make_sound(array, copy=True):
+    """pygame.sndarray.make_sound(array, copy=True): return Sound
 
     Convert an array into a Sound object.
 
     Create a new playable Sound object from an array. The mixer module
     must be initialized and the array format must be similar to the mixer
-    audio format.
+    audio format. With copy=False the Sound plays from the array itself,
+    which must then be C contiguous and in the mixer's sample size.
     """
 
-    return mixer.Sound(array=array)
+    return mixer.Sound(array=array, copy=copy)
 
 
 def use_arraytype(arraytype):
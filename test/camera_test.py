@@ -1,5 +1,189 @@
+import platform
+import random
 import unittest
 
+import pygame
+
+try:
+    from pygame import _camera
+except ImportError:
+    _camera = None
+
+IS_PYPY = "PyPy" == platform.python_implementation()
+
+
+def clamp(c):
+    return min(max(c, 0), 255)
+
+
+def yuyv_to_rgb(y, u, v):
+    """The libv4l fixed point conversion the camera module uses"""
+    u1 = (((u - 128) << 7) + (u - 128)) >> 6
+    rg = (((u - 128) << 1) + (u - 128) + ((v - 128) << 2) + ((v - 128) << 1)) >> 3
+    v1 = (((v - 128) << 1) + (v - 128)) >> 1
+    return clamp(y + v1), clamp(y - rg), clamp(y + u1)
+
+
+def rgb_to_yuv(r, g, b):
+    y = (77 * r + 150 * g + 29 * b + 128) >> 8
+    u = ((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128
+    v = ((112 * r - 94 * g - 18 * b + 128) >> 8) + 128
+    return y, u, v
+
 
 class CameraModuleTest(unittest.TestCase):
     pass
+
+
+@unittest.skipIf(_camera is None, "pygame._camera is not available")
+class ConvertFrameTest(unittest.TestCase):
+    # 44 pixels leave a tail after the 8 and 16 pixel SIMD kernels, and keep
+    # the rows of a 24 bit surface unpadded
+    size = (44, 6)
+
+    def surfaces(self):
+        return [pygame.Surface(self.size, depth=depth) for depth in (24, 32)]
+
+    def random_frame(self, bpp):
+        rand = random.Random(38)
+        count = int(self.size[0] * self.size[1] * bpp)
+        return bytes(rand.randrange(256) for _ in range(count))
+
+    def test_yuyv(self):
+        frame = self.random_frame(2)
+        for fourcc in ("YUYV", "UYVY"):
+            for surf in self.surfaces():
+                _camera._convert_frame(frame, fourcc, surf)
+                for i in range(0, len(frame), 4):
+                    if fourcc == "YUYV":
+                        y1, u, y2, v = frame[i : i + 4]
+                    else:
+                        u, y1, v, y2 = frame[i : i + 4]
+                    pos = divmod(i // 2, self.size[0])[::-1]
+                    self.assertEqual(surf.get_at(pos)[:3], yuyv_to_rgb(y1, u, v))
+                    pos = (pos[0] + 1, pos[1])
+                    self.assertEqual(surf.get_at(pos)[:3], yuyv_to_rgb(y2, u, v))
+
+    def test_rgb_to_yuv(self):
+        frame = self.random_frame(4)
+        for surf in self.surfaces():
+            _camera._convert_frame(frame, "XR24", surf, "YUV")
+            for i in range(0, len(frame), 4):
+                b, g, r = frame[i : i + 3]
+                pos = divmod(i // 4, self.size[0])[::-1]
+                self.assertEqual(surf.get_at(pos)[:3], rgb_to_yuv(r, g, b))
+
+    def test_yuv420(self):
+        w, h = self.size
+        frame = self.random_frame(1.5)
+        u_plane = frame[w * h :]
+        v_plane = u_plane[w * h // 4 :]
+        for surf in self.surfaces():
+            _camera._convert_frame(frame, "YU12", surf, "YUV")
+            for y in range(h):
+                for x in range(w):
+                    chroma = y // 2 * w // 2 + x // 2
+                    expected = (frame[y * w + x], u_plane[chroma], v_plane[chroma])
+                    self.assertEqual(surf.get_at((x, y))[:3], expected)
+
+    def test_bayer(self):
+        w, h = self.size
+        # a Bayer mosaic of one flat color
+        rows = [bytes([10, 20] * (w // 2)), bytes([20, 30] * (w // 2))]
+        frame = b"".join(rows[y % 2] for y in range(h))
+        for surf in self.surfaces():
+            _camera._convert_frame(frame, "BA81", surf)
+            # the inner pixels see all of their neighbours
+            for y in range(1, h - 1):
+                for x in range(1, w - 1):
+                    self.assertEqual(surf.get_at((x, y))[:3], (10, 20, 30))
+
+    def test_bad_arguments(self):
+        surf = pygame.Surface(self.size, depth=32)
+        frame = self.random_frame(2)
+        with self.assertRaises(ValueError):
+            _camera._convert_frame(frame[:-4], "YUYV", surf)
+        with self.assertRaises(ValueError):
+            _camera._convert_frame(frame, "ABCD", surf)
+        with self.assertRaises(ValueError):
+            _camera._convert_frame(frame, "YUYV", surf, "HSV")
+        with self.assertRaises(ValueError):
+            _camera._convert_frame(frame, "YUYV", pygame.Surface((43, 6), depth=24))
+
+
+@unittest.skipIf(
+    not hasattr(_camera, "_start_mock"), "needs the _camera (V4L2) backend"
+)
+class RawViewTest(unittest.TestCase):
+    # _start_mock runs the camera on an in-memory stand-in for the driver,
+    # which fills frame n with the byte n % 256
+    size = (44, 6)
+
+    def setUp(self):
+        self.cam = _camera.Camera("/dev/null", self.size)
+        _camera._start_mock(self.cam, "YUYV", buffers=3)
+
+    def tearDown(self):
+        self.cam.stop()
+
+    def test_view_is_the_frame(self):
+        length = self.size[0] * self.size[1] * 2
+        for sequence in range(4):
+            with self.cam.get_raw_view() as view:
+                self.assertEqual(view.sequence, sequence)
+                with memoryview(view) as mem:
+                    self.assertTrue(mem.readonly)
+                    self.assertEqual(mem.tobytes(), bytes([sequence]) * length)
+
+    def test_hold_views(self):
+        views = [self.cam.get_raw_view() for _ in range(2)]
+        # the last buffer stays with the camera
+        self.assertRaises(BufferError, self.cam.get_raw_view)
+        self.assertRaises(BufferError, self.cam.stop)
+
+        views[0].release()
+        self.assertTrue(views[0].released)
+        views[0].release()
+        self.assertRaises(BufferError, memoryview, views[0])
+        views.append(self.cam.get_raw_view())
+        self.assertEqual([view.sequence for view in views], [0, 1, 2])
+
+        for view in views:
+            view.release()
+        self.cam.get_raw_view().release()
+
+    def test_release_while_exported(self):
+        view = self.cam.get_raw_view()
+        mem = memoryview(view)
+        self.assertRaises(BufferError, view.release)
+        self.assertFalse(view.released)
+        mem.release()
+        view.release()
+        self.assertTrue(view.released)
+
+    @unittest.skipIf(IS_PYPY, "relies on views being freed right away")
+    def test_collected_view_is_released(self):
+        for _ in range(5):
+            self.cam.get_raw_view()
+        self.assertEqual(self.cam.get_raw_view().sequence, 5)
+
+    def test_to_surface(self):
+        surf = pygame.Surface(self.size, depth=32)
+        for _ in range(3):
+            with self.cam.get_raw_view() as view:
+                n = view.sequence
+                self.assertIs(view.to_surface(surf), surf)
+                new_surf = view.to_surface()
+
+            self.assertEqual(new_surf.get_size(), self.size)
+            for s in (surf, new_surf):
+                self.assertEqual(s.get_at((43, 5))[:3], yuyv_to_rgb(n, n, n))
+
+        self.assertRaises(BufferError, view.to_surface)
+        with self.cam.get_raw_view() as view:
+            with self.assertRaises(ValueError):
+                view.to_surface(pygame.Surface((43, 6), depth=32))
+
+
+if __name__ == "__main__":
+    unittest.main()
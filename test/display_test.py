@@ -1,5 +1,7 @@
+import io
 import os
 import sys
+import tempfile
 import time
 import unittest
 
@@ -850,6 +852,61 @@ class DisplayUpdateTest(unittest.TestCase):
             pygame.display.update()
 
 
+class DisplayUpdateScaledTest(DisplayUpdateTest):
+    """The same, with a SCALED display, which uploads only the updated rects
+    to its texture."""
+
+    def setUp(self):
+        display.init()
+        self.screen = pygame.display.set_mode((500, 500), pygame.SCALED)
+        self.screen.fill("black")
+        pygame.display.flip()
+        pygame.event.pump()  # so mac updates
+
+    def test_update_overlapping(self):
+        """takes overlapping, touching and off screen rects."""
+        from pygame._sdl2.video import Renderer, Window
+
+        # SCALED presents through a renderer, which only gets the updated
+        # rects. The software renderer keeps the presented frame in its
+        # back buffer, so it can be read back after the update.
+        old_driver = os.environ.get("SDL_RENDER_DRIVER")
+        os.environ["SDL_RENDER_DRIVER"] = "software"
+        try:
+            self.screen = pygame.display.set_mode((500, 500), pygame.SCALED)
+        finally:
+            if old_driver is None:
+                del os.environ["SDL_RENDER_DRIVER"]
+            else:
+                os.environ["SDL_RENDER_DRIVER"] = old_driver
+        self.screen.fill("black")
+        pygame.display.flip()
+
+        self.screen.fill("green")
+        rects = [
+            pygame.Rect(0, 0, 100, 100),
+            pygame.Rect(50, 50, 100, 100),
+            pygame.Rect(100, 0, 100, 100),
+            pygame.Rect(450, 450, 100, 100),
+            pygame.Rect(600, 600, 10, 10),
+        ]
+        pygame.display.update(rects)
+        pygame.display.update([pygame.Rect(i, i, 2, 2) for i in range(300)])
+        pygame.display.update([])
+        pygame.event.pump()  # so mac updates
+
+        presented = Renderer.from_window(Window.from_display_module()).to_surface()
+        if presented.get_size() != (500, 500):
+            self.skipTest("the display is scaled")
+        for random_point in ((50, 50), (149, 149), (199, 0), (499, 499)):
+            self.assertEqual(presented.get_at(random_point), (0, 255, 0))
+        # only the updated rects were presented
+        for random_point in ((300, 50), (0, 499), (449, 400)):
+            self.assertEqual(presented.get_at(random_point), (0, 0, 0))
+
+        self.question(f"Is the screen green in {rects}?")
+
+
 class DisplayUpdateInteractiveTest(DisplayUpdateTest):
     """Because we want these tests to run as interactive and not interactive."""
 
@@ -860,6 +917,115 @@ class DisplayUpdateInteractiveTest(DisplayUpdateTest):
         question(qstr)
 
 
+class PresentStatsTest(unittest.TestCase):
+    def setUp(self):
+        display.init()
+
+    def tearDown(self):
+        display.quit()
+
+    def test_present_stats(self):
+        """Ensures every frame presented through a renderer is timed."""
+        screen = display.set_mode((200, 200), pygame.SCALED)
+        display.get_present_stats(reset=True)
+
+        for i in range(10):
+            screen.fill((i * 20, 0, 0))
+            if i % 2:
+                display.update([pygame.Rect(0, 0, 50, 50), (40, 40, 100, 20)])
+            else:
+                display.flip()
+
+        stats = display.get_present_stats(reset=True)
+        self.assertEqual(stats["frames"], 10)
+        self.assertGreaterEqual(stats["max_latency"], stats["latency"])
+        self.assertGreaterEqual(stats["latency"], 0)
+        self.assertEqual(display.get_present_stats()["frames"], 0)
+
+        display.flip()
+        self.assertEqual(display.get_present_stats()["frames"], 1)
+
+
+class RecorderTest(unittest.TestCase):
+    def setUp(self):
+        display.init()
+
+    def tearDown(self):
+        display.quit()
+
+    def test_record_display(self):
+        """Ensure flip() and update() record Y4M frames of the display."""
+        screen = display.set_mode((33, 17))
+        # odd sizes round the chroma planes up
+        frame_size = 33 * 17 + 2 * 17 * 9
+
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, "capture.y4m")
+            with display.Recorder(path, fps=30) as recorder:
+                self.assertIsNone(recorder.size)
+                recorder.start()
+                self.assertTrue(recorder.recording)
+                screen.fill((255, 0, 0))
+                display.flip()
+                screen.fill((255, 255, 255))
+                display.update()
+                display.update((0, 0, 5, 5))
+                display.update(None)
+                recorder.stop()
+                display.flip()
+                self.assertEqual(recorder.frames, 4)
+                self.assertEqual(recorder.size, (33, 17))
+
+            with open(path, "rb") as f:
+                data = f.read()
+
+        header, rest = data.split(b"\n", 1)
+        self.assertEqual(
+            header.split()[:5],
+            [b"YUV4MPEG2", b"W33", b"H17", b"F30:1", b"Ip"],
+        )
+        frames = rest.split(b"FRAME\n")[1:]
+        self.assertEqual(len(frames), 4)
+        for frame in frames:
+            self.assertEqual(len(frame), frame_size)
+
+        # full range BT.601, as used by the camera module
+        red, white = frames[0], frames[1]
+        self.assertEqual(set(red[: 33 * 17]), {77})
+        self.assertEqual(set(red[33 * 17 : 33 * 17 + 153]), {90})
+        self.assertEqual(set(red[33 * 17 + 153 :]), {240})
+        self.assertEqual(set(white[: 33 * 17]), {255})
+        self.assertEqual(set(white[33 * 17 :]), {128})
+
+    def test_capture(self):
+        """Ensure capture() writes bare I420 frames to a file object."""
+
+        class KeptBytesIO(io.BytesIO):
+            def close(self):
+                pass
+
+        out = KeptBytesIO()
+        surf = pygame.Surface((64, 40), depth=16)
+        surf.fill((0, 0, 255))
+        recorder = display.Recorder(out, format="i420", buffers=1, block=False)
+        for _ in range(10):
+            recorder.capture(surf)
+        self.assertRaises(ValueError, recorder.capture, pygame.Surface((8, 8)))
+        recorder.close()
+
+        self.assertEqual(recorder.frames + recorder.dropped, 10)
+        data = out.getvalue()
+        frame_size = 64 * 40 * 3 // 2
+        self.assertEqual(len(data), recorder.frames * frame_size)
+        self.assertEqual(set(data[: 64 * 40]), {29})
+
+        self.assertRaises(ValueError, recorder.capture, surf)
+        self.assertRaises(ValueError, display.Recorder, out, format="mp4")
+        self.assertRaises(ValueError, display.Recorder, out, fps=0)
+        # no display mode is set
+        self.assertRaises(pygame.error, display.Recorder(out).capture)
+
+
 class DisplayInteractiveTest(unittest.TestCase):
     __tags__ = ["interactive"]
 
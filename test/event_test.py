@@ -1,5 +1,6 @@
 import collections
 import os
+import struct
 import time
 import unittest
 
@@ -638,6 +639,152 @@ class EventModuleTest(unittest.TestCase):
         pygame.event.get()  # should clear the queue completely by getting all events
         self.assertEqual(pygame.event.get(), [])
 
+    def test_get_buffer(self):
+        """Ensure get_buffer() drains the queue into compact records."""
+        event_cnt = 10
+        for _ in range(event_cnt):
+            pygame.event.post(pygame.event.Event(pygame.USEREVENT))
+        pygame.event.post(pygame.event.Event(pygame.KEYDOWN))
+
+        buffer = pygame.event.get_buffer(pygame.USEREVENT)
+
+        self.assertIsInstance(buffer, pygame.event.EventBuffer)
+        self.assertEqual(len(buffer), event_cnt)
+        with memoryview(buffer) as view:
+            self.assertTrue(view.readonly)
+            self.assertEqual(view.itemsize, struct.calcsize(buffer.format))
+            self.assertEqual(view.nbytes, view.itemsize * event_cnt)
+            for record in struct.iter_unpack(buffer.format, view.tobytes()):
+                # type, ..., count
+                self.assertEqual(record[0], pygame.USEREVENT)
+                self.assertEqual(record[6], 1)
+
+        # the KEYDOWN event was left on the queue
+        self.assertEqual(len(pygame.event.get_buffer()), 1)
+        self.assertEqual(len(pygame.event.get_buffer()), 0)
+
+    def test_get_buffer_reuse(self):
+        """Ensure get_buffer() can refill an existing EventBuffer."""
+        pygame.event.post(pygame.event.Event(pygame.USEREVENT))
+        buffer = pygame.event.get_buffer()
+        self.assertEqual(len(buffer), 1)
+
+        # posted events are never coalesced, their attributes live in a dict
+        for _ in range(3):
+            pygame.event.post(pygame.event.Event(pygame.MOUSEMOTION))
+        self.assertIs(pygame.event.get_buffer(coalesce=True, buffer=buffer), buffer)
+        self.assertEqual(len(buffer), 3)
+
+        with memoryview(buffer):
+            self.assertRaises(BufferError, pygame.event.get_buffer, buffer=buffer)
+        self.assertRaises(TypeError, pygame.event.get_buffer, buffer=bytearray(8))
+
+    def test_set_coalesce(self):
+        """Ensure set_coalesce() validates its arguments."""
+        self.assertRaises(ValueError, pygame.event.set_coalesce, pygame.KEYDOWN)
+        self.assertRaises(
+            ValueError, pygame.event.set_coalesce, pygame.MOUSEMOTION, "newest"
+        )
+        self.assertRaises(
+            ValueError, pygame.event.set_coalesce, pygame.MOUSEMOTION, "limit", -1
+        )
+        # nothing is changed if one of the types is invalid
+        self.assertRaises(
+            ValueError,
+            pygame.event.set_coalesce,
+            (pygame.MOUSEMOTION, pygame.QUIT),
+            "latest",
+        )
+
+        pygame.event.set_coalesce(
+            (pygame.MOUSEMOTION, pygame.JOYAXISMOTION), "accumulate"
+        )
+        pygame.event.set_coalesce(pygame.FINGERMOTION, "limit", limit=2)
+        pygame.event.set_coalesce(
+            (pygame.MOUSEMOTION, pygame.JOYAXISMOTION, pygame.FINGERMOTION)
+        )
+
+    def test_set_coalesce__posted_events(self):
+        """Ensure posted events are never coalesced or dropped."""
+        pygame.event.get_coalesce_stats(reset=True)
+        pygame.event.set_coalesce(pygame.MOUSEMOTION, "limit", 1)
+        try:
+            for _ in range(5):
+                pygame.event.post(pygame.event.Event(pygame.MOUSEMOTION))
+            self.assertEqual(len(pygame.event.get(pygame.MOUSEMOTION)), 5)
+        finally:
+            pygame.event.set_coalesce(pygame.MOUSEMOTION, None)
+
+        merged, dropped = pygame.event.get_coalesce_stats(reset=True)
+        self.assertEqual(merged, 0)
+        self.assertIsInstance(dropped, int)
+        self.assertEqual(pygame.event.get_coalesce_stats(), (0, 0))
+
+    def _warp_mouse_start(self, pos):
+        """Move the mouse to pos in a new window, so that pygame.mouse.set_pos
+        queues real SDL MOUSEMOTION events from there on."""
+        pygame.display.set_mode((100, 100))
+        pygame.event.get()
+        if not pygame.mouse.get_focused():
+            self.skipTest("set_pos needs the window to have mouse focus")
+        pygame.mouse.set_pos(pos)
+        pygame.event.get()
+        pygame.event.get_coalesce_stats(reset=True)
+
+    def test_set_coalesce__accumulate(self):
+        """Ensure neighbouring SDL motion events are merged by 'accumulate'."""
+        self._warp_mouse_start((10, 10))
+        pygame.event.set_coalesce(pygame.MOUSEMOTION, "accumulate")
+        try:
+            for pos in ((20, 10), (30, 15), (40, 30)):
+                pygame.mouse.set_pos(pos)
+            events = pygame.event.get()
+        finally:
+            pygame.event.set_coalesce(pygame.MOUSEMOTION, None)
+
+        motion = [e for e in events if e.type == pygame.MOUSEMOTION]
+        self.assertEqual(len(motion), 1)
+        self.assertEqual(motion[0].pos, (40, 30))
+        self.assertEqual(motion[0].rel, (30, 20))
+        self.assertEqual(pygame.event.get_coalesce_stats(reset=True), (2, 0))
+
+    def test_set_coalesce__latest(self):
+        """Ensure 'latest' only replaces SDL motion events by the event right
+        after them, in get() as well as in poll()."""
+        self._warp_mouse_start((10, 10))
+        pygame.event.set_coalesce(pygame.MOUSEMOTION, "latest")
+        try:
+            pygame.mouse.set_pos((20, 20))
+            pygame.mouse.set_pos((30, 30))
+            pygame.event.post(pygame.event.Event(pygame.USEREVENT))
+            pygame.mouse.set_pos((40, 40))
+            pygame.mouse.set_pos((50, 50))
+            events = [
+                e
+                for e in pygame.event.get()
+                if e.type in (pygame.MOUSEMOTION, pygame.USEREVENT)
+            ]
+
+            for pos in ((60, 60), (70, 70), (80, 80)):
+                pygame.mouse.set_pos(pos)
+            polled = []
+            event = pygame.event.poll()
+            while event.type != pygame.NOEVENT:
+                if event.type == pygame.MOUSEMOTION:
+                    polled.append(event.pos)
+                event = pygame.event.poll()
+        finally:
+            pygame.event.set_coalesce(pygame.MOUSEMOTION, None)
+
+        self.assertEqual(
+            [e.type for e in events],
+            [pygame.MOUSEMOTION, pygame.USEREVENT, pygame.MOUSEMOTION],
+        )
+        self.assertEqual(events[0].pos, (30, 30))
+        self.assertEqual(events[2].pos, (50, 50))
+        self.assertEqual(polled, [(80, 80)])
+        self.assertEqual(pygame.event.get_coalesce_stats(reset=True), (0, 4))
+
     def test_clear(self):
         """Ensure clear() removes all the events on the queue."""
         for e in EVENT_TYPES:
@@ -935,6 +1082,20 @@ class EventModuleTest(unittest.TestCase):
         self.assertEqual(pygame.event.poll().type, e3.type)
         self.assertEqual(pygame.event.poll().type, pygame.NOEVENT)
 
+    def test_poll__lazy_attributes(self):
+        """Ensure attributes of queued events are built when first accessed"""
+        pygame.event.clear()
+        ev = pygame.event.poll()
+        self.assertEqual(ev.type, pygame.NOEVENT)
+        self.assertEqual(ev.__dict__, {})
+        self.assertIs(ev.dict, ev.__dict__)
+        self.assertEqual(ev, pygame.event.Event(pygame.NOEVENT))
+
+        ev = pygame.event.poll()
+        ev.custom = 42
+        self.assertEqual(ev.custom, 42)
+        self.assertEqual(ev.dict, {"custom": 42})
+
 
 class EventModuleTestsWithTiming(unittest.TestCase):
     __tags__ = ["timing"]
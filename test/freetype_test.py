@@ -833,6 +833,50 @@ class FreeTypeFontTest(unittest.TestCase):
         rendering.blit(u13079_rendered, (0, 0))
         self.assertTrue(surf_same_image(rendering, bitmap))
 
+    def test_freetype_Font_render_many(self):
+        font = self._TEST_FONTS["sans"]
+        color = pygame.Color("black")
+        texts = ["FoobarBaz", "", "\u00e9t\u00e9", b"bytes"] * 8
+
+        for threads in (0, 1, 4):
+            rendered = font.render_many(texts, color, size=24, threads=threads)
+            self.assertIsInstance(rendered, list)
+            self.assertEqual(len(rendered), len(texts))
+            for text, (surf, rect) in zip(texts, rendered):
+                expected_surf, expected_rect = font.render(text, color, size=24)
+                self.assertIsInstance(surf, pygame.Surface)
+                self.assertEqual(rect, expected_rect)
+                self.assertEqual(surf.get_size(), rect.size)
+                self.assertTrue(surf_same_image(surf, expected_surf))
+
+        # mono rendering and background color
+        rendered = font.render_many(
+            texts, color, "white", size=24, style=ft.STYLE_STRONG, threads=4
+        )
+        for text, (surf, rect) in zip(texts, rendered):
+            expected_surf, expected_rect = font.render(
+                text, color, "white", size=24, style=ft.STYLE_STRONG
+            )
+            self.assertEqual(rect, expected_rect)
+            self.assertTrue(surf_same_image(surf, expected_surf))
+
+        self.assertEqual(font.render_many([], color, size=24), [])
+
+        self.assertRaises(TypeError, font.render_many, ["a", None], color, size=24)
+        self.assertRaises(TypeError, font.render_many, 42, color, size=24)
+        self.assertRaises(ValueError, font.render_many, ["a"], color)
+        self.assertRaises(
+            ValueError, font.render_many, ["a"], color, size=24, threads=-1
+        )
+
+    def test_freetype_Font_render_many_file_object(self):
+        with open(self._sans_path, "rb") as f:
+            font = ft.Font(f, 24)
+            texts = ["Foobar", "Baz"]
+            rendered = font.render_many(texts, "black", threads=2)
+            for text, (surf, rect) in zip(texts, rendered):
+                self.assertEqual(rect, font.render(text, "black")[1])
+
     def test_freetype_Font_render_mono(self):
         font = self._TEST_FONTS["sans"]
         color = pygame.Color("black")
@@ -768,6 +768,70 @@ class ImageModuleTest(unittest.TestCase):
             f'tobytes/frombytes functions are not symmetric using pitch with "{fmt}" format',
         )
 
+    def test_tobytes_into(self):
+        """Ensure tobytes_into() writes what tobytes() returns."""
+        fmts = (
+            "RGB",
+            "RGBX",
+            "RGBA",
+            "ARGB",
+            "BGRA",
+            "ABGR",
+            "RGBA_PREMULT",
+            "ARGB_PREMULT",
+        )
+        # an odd width leaves a tail after the SIMD kernels
+        test_surface = pygame.Surface((37, 20), flags=pygame.SRCALPHA, depth=32)
+        for y in range(20):
+            for x in range(37):
+                test_surface.set_at((x, y), (x * 7, y * 12, x + y, x * y % 256))
+
+        for fmt in fmts:
+            for flipped in (False, True):
+                for pitch in (-1, 37 * len(fmt[:4]) + 5):
+                    expected = pygame.image.tobytes(test_surface, fmt, flipped, pitch)
+                    buffer = bytearray(len(expected) + 3)
+
+                    written = pygame.image.tobytes_into(
+                        test_surface, buffer, fmt, flipped, pitch
+                    )
+
+                    self.assertEqual(written, len(expected))
+                    self.assertEqual(bytes(buffer[:written]), expected, fmt)
+                    # bytes past the image are left alone
+                    self.assertEqual(buffer[written:], b"\0\0\0")
+
+        with self.assertRaises(ValueError):
+            pygame.image.tobytes_into(test_surface, bytearray(37 * 20 * 4 - 1), "RGBA")
+        with self.assertRaises(BufferError):
+            pygame.image.tobytes_into(test_surface, bytes(37 * 20 * 4), "RGBA")
+        with self.assertRaises(ValueError):
+            pygame.image.tobytes_into(test_surface, bytearray(37 * 20 * 4), "BAD")
+
+    def test_tobytes__large_frame(self):
+        """Ensure frames large enough to be split between threads convert
+        like small ones."""
+        size = (1920, 1080)
+        test_surface = pygame.Surface(size, flags=pygame.SRCALPHA, depth=32)
+        for x in range(0, size[0], 7):
+            color = (x % 256, (x * 3) % 256, (x * 5) % 256, (x * 11) % 256)
+            pygame.draw.line(test_surface, color, (x, 0), (size[0] - x, size[1]))
+
+        for fmt in ("RGB", "ARGB", "RGBA_PREMULT"):
+            whole = pygame.image.tobytes(test_surface, fmt)
+            bands = b"".join(
+                pygame.image.tobytes(test_surface.subsurface(0, y, size[0], 8), fmt)
+                for y in range(0, size[1], 8)
+            )
+            self.assertEqual(whole, bands, fmt)
+
+        frame = pygame.image.tobytes(test_surface, "RGB", True)
+        restored = pygame.image.frombytes(frame, size, "RGB", True)
+        self.assertEqual(
+            pygame.image.tobytes(restored, "RGB"),
+            pygame.image.tobytes(test_surface, "RGB"),
+        )
+
     def test_from_to_bytes_deprecation(self):
         test_surface = pygame.Surface((64, 256), flags=pygame.SRCALPHA, depth=32)
         with self.assertWarns(DeprecationWarning):
@@ -1457,6 +1521,329 @@ class ImageModuleTest(unittest.TestCase):
     def test_load_gif_threads(self):
         self.threads_load(glob.glob(example_path("data/*.gif")))
 
+    def test_load__format(self):
+        """Ensure load() converts to the pixel format of the format surface."""
+        path = example_path("data/alien1.png")
+        expected = pygame.image.load(path)
+
+        for depth in (16, 24, 32):
+            target = pygame.Surface((1, 1), depth=depth)
+            surf = pygame.image.load(path, format=target)
+
+            self.assertEqual(surf.get_size(), expected.get_size())
+            self.assertEqual(surf.get_bitsize(), depth)
+            self.assertEqual(surf.get_masks(), target.get_masks())
+            self.assertEqual(
+                surf.get_at((0, 0)), expected.convert(target).get_at((0, 0))
+            )
+
+        surf = pygame.image.load(path, format=None)
+        self.assertEqual(surf.get_masks(), expected.get_masks())
+        self.assertRaises(TypeError, pygame.image.load, path, format=32)
+
+    def test_load__premultiply(self):
+        """Ensure load() premultiplies colors by alpha when asked to."""
+        colors = [(255, 255, 255, 0), (200, 100, 50, 128), (10, 20, 30, 255)]
+        orig = pygame.Surface((len(colors), 1), pygame.SRCALPHA)
+        for x, color in enumerate(colors):
+            orig.set_at((x, 0), color)
+
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, "premul.png")
+            pygame.image.save(orig, path)
+
+            expected = pygame.image.load(path).premul_alpha()
+            surf = pygame.image.load(path, premultiply=True)
+            for x in range(len(colors)):
+                self.assertEqual(surf.get_at((x, 0)), expected.get_at((x, 0)))
+
+            # combined with a conversion, premultiplying comes last
+            target = pygame.Surface((1, 1), pygame.SRCALPHA, 32)
+            surf = pygame.image.load(path, format=target, premultiply=True)
+            self.assertEqual(surf.get_masks(), target.get_masks())
+            for x in range(len(colors)):
+                self.assertEqual(surf.get_at((x, 0)), expected.get_at((x, 0)))
+
+        # opaque images are left unchanged
+        path = example_path("data/asprite.bmp")
+        surf = pygame.image.load(path, premultiply=True)
+        self.assertEqual(surf.get_at((0, 0)), pygame.image.load(path).get_at((0, 0)))
+
+    def test_load_many(self):
+        """Ensure load_many() returns surfaces in order, as load() would."""
+        files = sorted(glob.glob(example_path("data/*.png")))
+        files += sorted(glob.glob(example_path("data/*.bmp")))
+        files *= 4
+
+        for threads in (0, 1, 3):
+            surfs = pygame.image.load_many(files, threads=threads)
+
+            self.assertEqual(len(surfs), len(files))
+            for path, surf in zip(files, surfs):
+                expected = pygame.image.load(path)
+                self.assertEqual(surf.get_size(), expected.get_size())
+                self.assertEqual(surf.get_bitsize(), expected.get_bitsize())
+                self.assertEqual(surf.get_at((0, 0)), expected.get_at((0, 0)))
+
+        self.assertEqual(pygame.image.load_many([]), [])
+        self.assertRaises(ValueError, pygame.image.load_many, files, threads=-1)
+
+    def test_load_many__format(self):
+        """Ensure load_many() converts to the format surface's pixel format."""
+        target = pygame.Surface((1, 1), depth=16)
+        path = example_path("data/alien1.png")
+        with open(path, "rb") as f:
+            files = [path, pathlib.Path(path), io.BytesIO(f.read())]
+
+        surfs = pygame.image.load_many(files, format=target)
+
+        for surf in surfs:
+            self.assertEqual(surf.get_bitsize(), 16)
+            self.assertEqual(surf.get_masks(), target.get_masks())
+
+        expected = pygame.image.load(path, premultiply=True)
+        surfs = pygame.image.load_many([path, path], premultiply=True)
+        for surf in surfs:
+            self.assertEqual(surf.get_at((0, 0)), expected.get_at((0, 0)))
+
+    def test_load_many__error(self):
+        """Ensure load_many() raises if any one of the images fails."""
+        files = [example_path("data/alien1.png"), "not_an_image.png"]
+
+        self.assertRaises(FileNotFoundError, pygame.image.load_many, files)
+        self.assertRaises(TypeError, pygame.image.load_many, 1)
+
+        with tempfile.TemporaryDirectory() as tmpdir:
+            bad = os.path.join(tmpdir, "bad.png")
+            with open(bad, "wb") as f:
+                f.write(b"this is not a png")
+            files = [example_path("data/alien1.png")] * 8 + [bad]
+
+            self.assertRaises(pygame.error, pygame.image.load_many, files)
+
+    def test_load_async(self):
+        """Ensure load_async() returns a future for the loaded surface."""
+        path = example_path("data/alien1.png")
+
+        future = pygame.image.load_async(path)
+        surf = future.result(timeout=10)
+
+        self.assertIsInstance(surf, pygame.Surface)
+        self.assertEqual(surf.get_at((0, 0)), pygame.image.load(path).get_at((0, 0)))
+
+        with open(path, "rb") as f:
+            data = f.read()
+        surf = pygame.image.load_async(io.BytesIO(data), namehint="a.png").result()
+        self.assertEqual(surf.get_size(), pygame.image.load(path).get_size())
+
+        future = pygame.image.load_async("not_an_image.png")
+        self.assertRaises(FileNotFoundError, future.result, 10)
+
+    def test_save_async(self):
+        """Ensure save_async() writes a copy of the surface in the background."""
+        surf = pygame.Surface((31, 17), pygame.SRCALPHA)
+        for x in range(surf.get_width()):
+            for y in range(surf.get_height()):
+                surf.set_at((x, y), (x * 8, y * 15, 77, 255 - x))
+
+        extensions = ["tga", "bmp"]
+        if pygame.image.get_extended():
+            extensions.append("png")
+        with tempfile.TemporaryDirectory() as tmpdir:
+            for ext in extensions:
+                path = os.path.join(tmpdir, f"frame.{ext}")
+                future = pygame.image.save_async(surf, pathlib.Path(path))
+                # drawing straight away must not change what is saved
+                surf.fill((0, 0, 0, 0), (0, 0, 4, 4))
+                self.assertIsNone(future.result(timeout=10))
+
+                loaded = pygame.image.load(path)
+                self.assertEqual(loaded.get_size(), surf.get_size())
+                self.assertEqual(loaded.get_at((30, 16))[:3], surf.get_at((30, 16))[:3])
+                self.assertNotEqual(loaded.get_at((1, 1)), surf.get_at((1, 1)))
+                surf.fill((200, 200, 200, 200), (0, 0, 4, 4))
+
+            # with block=False a full queue drops saves instead of waiting
+            futures = []
+            dropped = 0
+            for i in range(20):
+                path = os.path.join(tmpdir, f"{i}.tga")
+                try:
+                    futures.append(pygame.image.save_async(surf, path, False))
+                except pygame.error:
+                    dropped += 1
+            self.assertGreater(len(futures), 0)
+            self.assertEqual(len(futures) + dropped, 20)
+            for future in futures:
+                self.assertIsNone(future.result(timeout=10))
+
+            missing = os.path.join(tmpdir, "no_such_dir", "frame.tga")
+            future = pygame.image.save_async(surf, missing)
+            self.assertRaises(pygame.error, future.result, 10)
+
+        self.assertRaises(TypeError, pygame.image.save_async, surf, io.BytesIO())
+
+    def test_save_load_mapped(self):
+        """Ensure surfaces round trip through a mapped surface file."""
+        surfaces = {
+            "rgba": pygame.Surface((17, 5), pygame.SRCALPHA),
+            "rgb": pygame.Surface((3, 40), depth=24),
+            "16bit": pygame.Surface((8, 8), depth=16),
+            "paletted": pygame.Surface((9, 3), depth=8),
+            "empty": pygame.Surface((0, 0)),
+        }
+        for i, surf in enumerate(surfaces.values()):
+            for x in range(surf.get_width()):
+                for y in range(surf.get_height()):
+                    color = ((x * 13 + i) % 256, (y * 7) % 256, 100, x * y % 256)
+                    surf.set_at((x, y), color)
+        surfaces["rgb"].set_colorkey((0, 0, 100))
+        surfaces["16bit"].set_alpha(99)
+
+        for compress in (False, True):
+            with tempfile.TemporaryDirectory() as tmpdir:
+                path = os.path.join(tmpdir, "surfaces.pgs")
+                pygame.image.save_mapped(surfaces, path, compress=compress)
+                loaded = pygame.image.load_mapped(pathlib.Path(path))
+
+                self.assertEqual(list(loaded), list(surfaces))
+                for name, surf in surfaces.items():
+                    other = loaded[name]
+                    self.assertEqual(other.get_size(), surf.get_size())
+                    self.assertEqual(other.get_bitsize(), surf.get_bitsize())
+                    self.assertEqual(other.get_masks(), surf.get_masks())
+                    # mapped surfaces do not own their pixels
+                    self.assertEqual(
+                        other.get_flags() & ~pygame.PREALLOC, surf.get_flags()
+                    )
+                    self.assertEqual(other.get_colorkey(), surf.get_colorkey())
+                    self.assertEqual(other.get_alpha(), surf.get_alpha())
+                    if surf.get_bitsize() == 8:
+                        self.assertEqual(other.get_palette(), surf.get_palette())
+                    if surf.get_width():
+                        self.assertEqual(
+                            pygame.image.tobytes(other, "RGBA"),
+                            pygame.image.tobytes(surf, "RGBA"),
+                        )
+                del loaded, other
+
+    def test_load_mapped__copy_on_write(self):
+        """Ensure drawing on mapped surfaces leaves the file unchanged."""
+        surf = pygame.Surface((64, 64))
+        surf.fill((10, 20, 30))
+
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, "surfaces.pgs")
+            with open(path, "wb") as f:
+                pygame.image.save_mapped({"a": surf, "b": surf}, f)
+            with open(path, "rb") as f:
+                contents = f.read()
+
+            with open(path, "rb") as f:
+                loaded = pygame.image.load_mapped(f)
+            loaded["a"].fill((255, 0, 0))
+
+            self.assertEqual(loaded["a"].get_at((5, 5)), (255, 0, 0))
+            self.assertEqual(loaded["b"].get_at((5, 5)), (10, 20, 30))
+            with open(path, "rb") as f:
+                self.assertEqual(f.read(), contents)
+            # the pixels of the second surface outlive the first
+            b = loaded["b"]
+            del loaded
+            self.assertEqual(b.get_at((63, 63)), (10, 20, 30))
+            del b
+
+    def test_load_mapped__errors(self):
+        """Ensure bad mapped surface files and arguments raise."""
+        with tempfile.TemporaryDirectory() as tmpdir:
+            path = os.path.join(tmpdir, "bad.pgs")
+            with open(path, "wb") as f:
+                f.write(b"this is not a mapped surface file")
+            self.assertRaises(pygame.error, pygame.image.load_mapped, path)
+
+            surf = pygame.Surface((32, 32))
+            pygame.image.save_mapped({"s": surf}, path)
+            with open(path, "rb") as f:
+                contents = f.read()
+            with open(path, "wb") as f:
+                f.write(contents[:-100])
+            self.assertRaises(pygame.error, pygame.image.load_mapped, path)
+
+            self.assertRaises(TypeError, pygame.image.save_mapped, [surf], path)
+            self.assertRaises(TypeError, pygame.image.save_mapped, {1: surf}, path)
+            self.assertRaises(TypeError, pygame.image.save_mapped, {"s": None}, path)
+
+    def test_pack_atlas(self):
+        """Ensure pack_atlas() copies every surface into one atlas."""
+        sizes = [(5, 7), (30, 2), (1, 1), (12, 12), (8, 20), (3, 9)] * 5
+        surfaces = []
+        for i, size in enumerate(sizes):
+            surf = pygame.Surface(size, pygame.SRCALPHA)
+            surf.fill((i * 8, 255 - i, 50, 128 + i))
+            surf.set_at((0, 0), (1, 2, 3, 4))
+            surfaces.append(surf)
+
+        for padding in (0, 1, 3):
+            atlas, subsurfaces, rects = pygame.image.pack_atlas(
+                surfaces, max_size=(64, 64), padding=padding
+            )
+
+            self.assertLessEqual(atlas.get_width(), 64)
+            self.assertLessEqual(atlas.get_height(), 64)
+            self.assertEqual(atlas.get_masks(), surfaces[0].get_masks())
+            self.assertEqual(len(subsurfaces), len(surfaces))
+            self.assertEqual(len(rects), len(surfaces))
+            for i, (surf, sub, rect) in enumerate(zip(surfaces, subsurfaces, rects)):
+                self.assertEqual(rect.size, surf.get_size())
+                self.assertIs(sub.get_parent(), atlas)
+                self.assertEqual(sub.get_abs_offset(), rect.topleft)
+                self.assertEqual(
+                    pygame.image.tobytes(sub, "RGBA"),
+                    pygame.image.tobytes(surf, "RGBA"),
+                )
+                # padded rects of different surfaces never overlap
+                padded = pygame.Rect(rect.topleft, (rect.w + padding, rect.h + padding))
+                for other in rects[i + 1 :]:
+                    self.assertFalse(
+                        padded.colliderect(other), (padding, rect, other)
+                    )
+
+    def test_pack_atlas__convert(self):
+        """Ensure pack_atlas() converts surfaces to the first one's format."""
+        first = pygame.Surface((4, 4), depth=32)
+        first.set_colorkey((255, 0, 255))
+        other = pygame.Surface((6, 3), depth=16)
+        other.fill((0, 255, 0))
+
+        atlas, subsurfaces, _ = pygame.image.pack_atlas([first, other], padding=2)
+
+        self.assertEqual(atlas.get_bitsize(), 32)
+        self.assertEqual(atlas.get_colorkey(), (255, 0, 255, 255))
+        self.assertEqual(subsurfaces[1].get_at((1, 1)), (0, 255, 0, 255))
+
+    def test_pack_atlas__palettes(self):
+        """Ensure pack_atlas() maps 8 bit surfaces with another palette."""
+        first = pygame.Surface((4, 4), depth=8)
+        first.set_palette([(0, 0, 0), (255, 0, 0), (0, 0, 255)])
+        other = pygame.Surface((4, 4), depth=8)
+        other.set_palette([(0, 0, 0), (0, 0, 255), (255, 0, 0)])
+        other.fill((0, 0, 255))
+
+        _, subsurfaces, _ = pygame.image.pack_atlas([first, other])
+
+        self.assertEqual(subsurfaces[1].get_at((1, 1)), (0, 0, 255, 255))
+
+    def test_pack_atlas__errors(self):
+        """Ensure pack_atlas() raises for bad arguments."""
+        surf = pygame.Surface((40, 40))
+
+        self.assertRaises(ValueError, pygame.image.pack_atlas, [surf] * 5, (64, 64))
+        self.assertRaises(ValueError, pygame.image.pack_atlas, [])
+        self.assertRaises(ValueError, pygame.image.pack_atlas, [surf], (0, 10))
+        self.assertRaises(ValueError, pygame.image.pack_atlas, [surf], padding=-1)
+        self.assertRaises(TypeError, pygame.image.pack_atlas, [surf, None])
+        self.assertRaises(TypeError, pygame.image.pack_atlas, [surf], "size")
+
     def test_from_to_bytes_exists(self):
         getattr(pygame.image, "frombytes")
         getattr(pygame.image, "tobytes")
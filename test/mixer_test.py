@@ -1,7 +1,12 @@
+import array
+import contextlib
+import math
 import os
 import pathlib
 import platform
+import random
 import sys
+import tempfile
 import time
 import unittest
 
@@ -1087,6 +1092,65 @@ class SoundTypeTest(unittest.TestCase):
         """Ensure Sound() creation with an array works."""
         self.fail()
 
+    def test_sound__no_copy(self):
+        """Ensure Sound(copy=False) plays from the buffer it was given."""
+        _, size, channels = mixer.get_init()
+        frame = abs(size) // 8 * channels
+        data = bytearray(range(frame * 16))
+
+        for sound in (
+            mixer.Sound(buffer=data, copy=False),
+            mixer.Sound(data, copy=False),
+        ):
+            data[0] = 200
+            self.assertEqual(sound.get_raw(), bytes(data))
+            with memoryview(sound) as view:
+                self.assertFalse(view.readonly)
+            # the Sound holds the buffer, so it can't be resized under it
+            with self.assertRaises(BufferError):
+                data.append(0)
+
+        sound = mixer.Sound(buffer=bytes(data[:frame]), copy=False)
+        with memoryview(sound) as view:
+            self.assertTrue(view.readonly)
+
+        with self.assertRaises(ValueError):
+            mixer.Sound(buffer=bytes(frame + 1), copy=False)
+        filename = example_path(os.path.join("data", "house_lo.wav"))
+        with self.assertRaises(TypeError):
+            mixer.Sound(file=filename, copy=False)
+        with self.assertRaises(TypeError):
+            mixer.Sound(filename, copy=False)
+
+    def test_sound__no_copy_array(self):
+        """Ensure Sound(array=..., copy=False) shares the array's samples."""
+        try:
+            import numpy
+        except ImportError:
+            self.skipTest("requires numpy")
+
+        _, size, channels = mixer.get_init()
+        dtype = {8: numpy.uint8, -8: numpy.int8, 16: numpy.uint16}.get(
+            size, numpy.int16
+        )
+        samples = numpy.zeros((32, channels) if channels > 1 else 32, dtype)
+        sound = mixer.Sound(array=samples, copy=False)
+        samples[3] = 7
+        self.assertEqual(sound.get_raw(), samples.tobytes())
+
+        with self.assertRaises(ValueError):
+            mixer.Sound(array=samples.astype(numpy.int32), copy=False)
+        with self.assertRaises((BufferError, ValueError)):
+            mixer.Sound(array=samples[::2], copy=False)
+
+    def test_sound__reused_memory(self):
+        """Ensure copied Sounds keep their own samples as memory is reused."""
+        for length in (4, 1000, 1024, 1028, 5000, 70000, 4, 1028):
+            data = bytes(i * length % 251 for i in range(length))
+            sounds = [mixer.Sound(buffer=data) for _ in range(3)]
+            for sound in sounds:
+                self.assertEqual(sound.get_raw(), data)
+
     def test_sound__without_arg(self):
         """Ensure exception raised for Sound() creation with no argument."""
         with self.assertRaises(TypeError):
@@ -1331,6 +1395,340 @@ class SoundTypeTest(unittest.TestCase):
         self.assertRaises(RuntimeError, incorrect.get_volume)
 
 
+EFFECT_CONFIG = {"frequency": 44100, "size": -16, "channels": 2, "allowedchanges": 0}
+
+
+@contextlib.contextmanager
+def _disk_audio(testcase):
+    """Initializes the mixer with the SDL disk audio driver, which writes the
+    mix to a file, and yields the path of that file."""
+    mixer.quit()
+    fd, path = tempfile.mkstemp(suffix=".raw")
+    os.close(fd)
+    saved = {k: os.environ.get(k) for k in ("SDL_AUDIODRIVER", "SDL_DISKAUDIOFILE")}
+    os.environ["SDL_AUDIODRIVER"] = "disk"
+    os.environ["SDL_DISKAUDIOFILE"] = path
+    try:
+        try:
+            mixer.init(**EFFECT_CONFIG)
+        except pygame.error:
+            testcase.skipTest("no disk audio driver")
+        yield path
+    finally:
+        mixer.quit()
+        for key, value in saved.items():
+            if value is None:
+                os.environ.pop(key, None)
+            else:
+                os.environ[key] = value
+        os.remove(path)
+
+
+def _reference_biquad(kind, frequency, q, samples, rate):
+    """The filters of the Audio EQ Cookbook, in double precision."""
+    w0 = 2 * math.pi * frequency / rate
+    cosw = math.cos(w0)
+    alpha = math.sin(w0) / (2 * q)
+    a0 = 1 + alpha
+    if kind == "lowpass":
+        b = ((1 - cosw) / 2, 1 - cosw, (1 - cosw) / 2)
+    elif kind == "highpass":
+        b = ((1 + cosw) / 2, -(1 + cosw), (1 + cosw) / 2)
+    else:
+        b = (alpha, 0, -alpha)
+    b0, b1, b2 = (v / a0 for v in b)
+    a1, a2 = -2 * cosw / a0, (1 - alpha) / a0
+    out = []
+    z1 = z2 = 0.0
+    for x in samples:
+        y = b0 * x + z1
+        z1 = b1 * x - a1 * y + z2
+        z2 = b2 * x - a2 * y
+        out.append(y)
+    return out
+
+
+class EffectTest(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        mixer.init(**EFFECT_CONFIG)
+
+    @classmethod
+    def tearDownClass(cls):
+        mixer.quit()
+
+    def setUp(self):
+        if mixer.get_init() is None:
+            mixer.init(**EFFECT_CONFIG)
+
+    def _samples(self, frames=4000):
+        """A stereo test signal, a sine with noise on top."""
+        rng = random.Random(41)
+        return array.array(
+            "h",
+            [
+                int(12000 * math.sin(i // 2 * 0.05)) + rng.randint(-8000, 8000)
+                for i in range(frames * 2)
+            ],
+        )
+
+    def test_effect(self):
+        """Ensure Effect() takes defaults and checks its parameters."""
+        effect = mixer.Effect("lowpass")
+        self.assertEqual(effect.kind, "lowpass")
+        self.assertEqual(sorted(effect.params), ["frequency", "q"])
+        self.assertEqual(effect.params["frequency"], 1000)
+        self.assertAlmostEqual(effect.params["q"], 0.7071, places=6)
+
+        effect = mixer.Effect("delay", time=100, mix=0.25)
+        self.assertEqual(effect.params, {"time": 100.0, "feedback": 0.5, "mix": 0.25})
+        effect.set(feedback=0)
+        self.assertEqual(effect.params["feedback"], 0.0)
+        self.assertEqual(effect.params["time"], 100.0)
+
+        for kind in ("highpass", "bandpass", "reverb", "gain", "pan", "pitch"):
+            self.assertEqual(mixer.Effect(kind).kind, kind)
+
+        with self.assertRaises(ValueError):
+            mixer.Effect("chorus")
+        with self.assertRaises(TypeError):
+            mixer.Effect("gain", frequency=100)
+        with self.assertRaises(ValueError):
+            mixer.Effect("pan", pan=2)
+        with self.assertRaises(ValueError):
+            effect.set(feedback=1)
+        with self.assertRaises(TypeError):
+            effect.set(0.5)
+        with self.assertRaises(RuntimeError):
+            effect.__init__("gain")
+        self.assertEqual(effect.kind, "delay")
+
+    def test_apply_effects__filters(self):
+        """Ensure the filters match reference biquads to within a sample step."""
+        samples = self._samples()
+        sound = mixer.Sound(buffer=samples)
+
+        for kind, frequency, q in (
+            ("lowpass", 800, 0.7071),
+            ("highpass", 2000, 2),
+            ("bandpass", 1000, 1),
+        ):
+            effect = mixer.Effect(kind, frequency=frequency, q=q)
+            out = array.array("h", sound.apply_effects([effect]).get_raw())
+            self.assertEqual(len(out), len(samples))
+            for channel in (0, 1):
+                reference = _reference_biquad(
+                    kind, frequency, q, [s / 32768 for s in samples[channel::2]], 44100
+                )
+                error = max(
+                    abs(o - max(-32768, min(32767, round(r * 32768))))
+                    for o, r in zip(out[channel::2], reference)
+                )
+                self.assertLessEqual(error, 1, kind)
+
+    def test_apply_effects__gain_pan_delay(self):
+        """Ensure gain, pan and delay give the exact expected samples."""
+        samples = self._samples()
+        sound = mixer.Sound(buffer=samples)
+
+        gain = mixer.Effect("gain", volume=0.5)
+        out = array.array("h", sound.apply_effects([gain]).get_raw())
+        self.assertEqual(list(out), [round(s / 2) for s in samples])
+
+        pan = mixer.Effect("pan", pan=1)
+        out = array.array("h", sound.apply_effects([pan]).get_raw())
+        self.assertEqual(list(out[0::2]), [0] * (len(samples) // 2))
+        self.assertEqual(out[1::2], samples[1::2])
+
+        impulse = array.array("h", [16384, 16384] + [0] * 6000)
+        effect = mixer.Effect("delay", time=10, feedback=0.5, mix=0.5)
+        sound = mixer.Sound(buffer=impulse)
+        out = array.array("h", sound.apply_effects([effect]).get_raw())
+        # an echo every 441 frames, each half the last
+        echoes = {i: v for i, v in enumerate(out[0::2]) if v}
+        self.assertEqual(echoes, {441 * i: 16384 >> i for i in range(7)})
+
+    def test_apply_effects__reverb_pitch(self):
+        """Ensure reverb leaves a tail and pitch moves a tone."""
+        impulse = array.array("h", [16384, 16384] + [0] * 20000)
+        sound = mixer.Sound(buffer=impulse)
+        effects = [mixer.Effect("reverb", room=0.8, mix=1)]
+        out = sound.apply_effects(effects).get_raw()
+        self.assertEqual(out, sound.apply_effects(effects).get_raw())
+        tail = array.array("h", out)[8000:]
+        self.assertTrue(any(tail))
+        # the odd channel's lines are longer, so the sides differ
+        self.assertNotEqual(tail[0::2], tail[1::2])
+
+        tone = array.array(
+            "h",
+            [
+                int(10000 * math.sin(2 * math.pi * 441 * (i // 2) / 44100))
+                for i in range(44100)
+            ],
+        )
+        sound = mixer.Sound(buffer=tone)
+        for ratio in (0.5, 2.0):
+            out = sound.apply_effects([mixer.Effect("pitch", ratio=ratio)]).get_raw()
+            left = array.array("h", out)[0::2][4410:]
+            crossings = sum(1 for a, b in zip(left, left[1:]) if (a < 0) != (b < 0))
+            expected = 2 * 441 * ratio * len(left) / 44100
+            self.assertAlmostEqual(crossings / expected, 1, delta=0.02)
+
+    def test_apply_effects__errors(self):
+        """Ensure apply_effects checks its argument."""
+        sound = mixer.Sound(buffer=self._samples(100))
+        self.assertEqual(sound.apply_effects(()).get_raw(), sound.get_raw())
+        with self.assertRaises(TypeError):
+            sound.apply_effects(None)
+        with self.assertRaises(TypeError):
+            sound.apply_effects(["gain"])
+        with self.assertRaises(ValueError):
+            sound.apply_effects([mixer.Effect("gain")] * 17)
+        with self.assertRaises(RuntimeError):
+            sound.apply_effects([mixer.Effect.__new__(mixer.Effect)])
+
+    def test_set_effects(self):
+        """Ensure effect chains can be set on channels and the mix."""
+        channel = mixer.Channel(0)
+        effects = [mixer.Effect("lowpass"), mixer.Effect("gain", volume=0.5, ramp=20)]
+        self.assertEqual(channel.get_effects(), ())
+        self.assertEqual(mixer.get_effects(), ())
+
+        channel.set_effects(effects)
+        mixer.set_effects([mixer.Effect("reverb")])
+        self.assertEqual(channel.get_effects(), tuple(effects))
+        self.assertEqual(mixer.get_effects()[0].kind, "reverb")
+        with self.assertRaises(TypeError):
+            channel.set_effects([1])
+        self.assertEqual(channel.get_effects(), tuple(effects))
+
+        sound = mixer.Sound(buffer=self._samples(2000))
+        channel.play(sound)
+        effects[1].set(volume=0.25)
+        channel.queue(sound)
+        sound.play()
+        time.sleep(0.1)
+
+        channel.set_effects()
+        mixer.set_effects([])
+        self.assertEqual(channel.get_effects(), ())
+        self.assertEqual(mixer.get_effects(), ())
+
+        channel.set_effects(effects)
+        mixer.quit()
+        mixer.init(**EFFECT_CONFIG)
+        self.assertEqual(mixer.Channel(0).get_effects(), ())
+
+    def test_set_effects__disk_playback(self):
+        """Ensure a channel plays what apply_effects renders.
+
+        Uses the SDL disk audio driver, which writes the mix to a file.
+        """
+        with _disk_audio(self) as path:
+            sound = mixer.Sound(buffer=self._samples(4410))
+            effects = [
+                mixer.Effect("highpass", frequency=300),
+                mixer.Effect("delay", time=20),
+                mixer.Effect("pan", pan=-0.5),
+            ]
+            expected = sound.apply_effects(effects).get_raw()
+
+            channel = mixer.Channel(0)
+            channel.set_effects(effects)
+            channel.play(sound)
+            deadline = time.time() + 5
+            while channel.get_busy() and time.time() < deadline:
+                time.sleep(0.02)
+            time.sleep(0.1)
+            mixer.quit()
+
+            with open(path, "rb") as f:
+                written = f.read()
+            self.assertNotEqual(written.find(expected), -1)
+
+
+class StreamChannelTest(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        mixer.init(**EFFECT_CONFIG)
+
+    @classmethod
+    def tearDownClass(cls):
+        mixer.quit()
+
+    def setUp(self):
+        if mixer.get_init() is None:
+            mixer.init(**EFFECT_CONFIG)
+
+    def test_push(self):
+        """Ensure push() queues whole frames until the queue is full."""
+        stream = mixer.StreamChannel(0, frames=1000)
+        self.assertIsInstance(stream, mixer.Channel)
+        self.assertEqual(stream.id, 0)
+        self.assertEqual(stream.get_queued(), 0)
+        self.assertEqual(stream.get_free(), 1024)
+
+        self.assertEqual(stream.push(bytes(400)), 100)
+        self.assertEqual(stream.push(array.array("h", [0] * 200)), 100)
+        self.assertEqual(stream.get_queued(), 200)
+        self.assertEqual(stream.get_free(), 824)
+        self.assertEqual(stream.push(bytes(4000)), 824)
+        self.assertEqual(stream.push(bytes(4)), 0)
+        self.assertEqual(stream.get_free(), 0)
+        self.assertEqual(stream.get_underruns(), 0)
+
+    def test_errors(self):
+        """Ensure StreamChannel checks its arguments."""
+        with self.assertRaises(ValueError):
+            mixer.StreamChannel(0, frames=0)
+        with self.assertRaises(IndexError):
+            mixer.StreamChannel(mixer.get_num_channels())
+
+        stream = mixer.StreamChannel(0)
+        with self.assertRaises(ValueError):
+            stream.push(bytes(6))
+        with self.assertRaises(TypeError):
+            stream.push(None)
+        with self.assertRaises(RuntimeError):
+            stream.__init__(1)
+
+        stream = mixer.StreamChannel.__new__(mixer.StreamChannel)
+        with self.assertRaises(RuntimeError):
+            stream.push(bytes(4))
+
+    def test_play__disk_playback(self):
+        """Ensure a StreamChannel plays what is pushed, through its effects.
+
+        Uses the SDL disk audio driver, which writes the mix to a file.
+        """
+        with _disk_audio(self) as path:
+            samples = array.array("h", [(i * 37) % 20000 - 10000 for i in range(8820)])
+            effects = [mixer.Effect("gain", volume=0.5)]
+            expected = mixer.Sound(buffer=samples).apply_effects(effects).get_raw()
+
+            stream = mixer.StreamChannel(0, frames=8192)
+            stream.set_effects(effects)
+            self.assertEqual(stream.push(samples), 4410)
+            stream.play()
+            self.assertTrue(stream.get_busy())
+            deadline = time.time() + 5
+            while stream.get_queued() and time.time() < deadline:
+                time.sleep(0.02)
+            time.sleep(0.1)
+            self.assertEqual(stream.get_queued(), 0)
+            self.assertEqual(stream.get_underruns(), 1)
+            self.assertTrue(stream.get_busy())
+
+            stream.stop()
+            self.assertFalse(stream.get_busy())
+            mixer.quit()
+
+            with open(path, "rb") as f:
+                written = f.read()
+            self.assertNotEqual(written.find(expected), -1)
+
+
 ##################################### MAIN #####################################
 
 if __name__ == "__main__":
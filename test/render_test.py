@@ -1,3 +1,5 @@
+import array
+import struct
 import unittest
 
 import pygame
@@ -62,6 +64,90 @@ class RendererTest(unittest.TestCase):
         self.assertEqual(drawable_object.area, area)
         self.assertEqual(drawable_object.dest, dest)
 
+    def test_blit_surface(self):
+        surf = pygame.Surface((20, 20))
+        surf.fill("red")
+        self.renderer.blit(surf, pygame.Rect(10, 10, 20, 20))
+        self.renderer.blit(surf, (50, 50), pygame.Rect(0, 0, 5, 5))
+        result = self.renderer.to_surface()
+        self.assertEqual(result.get_at((15, 15)), pygame.Color("red"))
+        self.assertEqual(result.get_at((54, 54)), pygame.Color("red"))
+        self.assertEqual(result.get_at((56, 56)), pygame.Color("black"))
+
+        # writes to the surface show up in the next blit
+        surf.fill("blue", (0, 0, 10, 10))
+        self.renderer.blit(surf, (10, 10))
+        result = self.renderer.to_surface()
+        self.assertEqual(result.get_at((12, 12)), pygame.Color("blue"))
+        self.assertEqual(result.get_at((25, 25)), pygame.Color("red"))
+
+        with self.assertRaises(TypeError):
+            self.renderer.blit(surf, "not a position")
+
+    def test_blit_surface__colorkey(self):
+        surf = pygame.Surface((20, 20))
+        surf.fill("red")
+        surf.fill("blue", (0, 0, 10, 20))
+        self.renderer.blit(surf, (0, 0))
+
+        # the colorkey doesn't write to the surface, but changes what shows
+        for key in ("blue", "red", None):
+            surf.set_colorkey(key)
+            self.renderer.draw_color = "green"
+            self.renderer.clear()
+            self.renderer.blit(surf, (0, 0))
+            result = self.renderer.to_surface()
+            self.assertEqual(
+                result.get_at((5, 5)),
+                pygame.Color("green" if key == "blue" else "blue"),
+            )
+            self.assertEqual(
+                result.get_at((15, 15)),
+                pygame.Color("green" if key == "red" else "red"),
+            )
+
+    def test_blit_surface__frombuffer(self):
+        pixels = bytearray(b"\xff\x00\x00" * 400)
+        surf = pygame.image.frombuffer(pixels, (20, 20), "RGB")
+        self.renderer.blit(surf, (0, 0))
+        self.assertEqual(
+            self.renderer.to_surface().get_at((5, 5)), pygame.Color("red")
+        )
+
+        # the buffer is written without pygame knowing
+        pixels[:] = b"\x00\x00\xff" * 400
+        self.renderer.blit(surf, (0, 0))
+        self.assertEqual(
+            self.renderer.to_surface().get_at((5, 5)), pygame.Color("blue")
+        )
+
+    def test_get_upload_stats(self):
+        surf = pygame.Surface((20, 20), pygame.SRCALPHA)
+        self.assertEqual(self.renderer.get_upload_stats(), (0, 0))
+
+        self.renderer.blit(surf, (0, 0))
+        self.renderer.present()
+        self.assertEqual(self.renderer.get_upload_stats(), (20 * 20 * 4, 1))
+
+        # nothing is sent for a surface that wasn't written to
+        surf.get_at((3, 3))
+        pygame.mask.from_surface(surf)
+        self.renderer.blit(surf, (0, 0))
+        self.renderer.present()
+        self.assertEqual(self.renderer.get_upload_stats(), (0, 0))
+
+        # a written surface is sent once, however often it is drawn
+        surf.fill("white", (3, 4, 5, 6))
+        self.renderer.blit(surf, (0, 0))
+        self.renderer.blit(surf, (30, 30))
+        self.renderer.present()
+        self.assertEqual(self.renderer.get_upload_stats(), (20 * 20 * 4, 1))
+
+        surf.subsurface((10, 10, 5, 5)).set_at((1, 1), "green")
+        self.renderer.blit(surf, (0, 0))
+        self.renderer.present()
+        self.assertEqual(self.renderer.get_upload_stats(), (20 * 20 * 4, 1))
+
     def test_clear(self):
         self.renderer.draw_color = "YELLOW"
         self.renderer.clear()
@@ -154,6 +240,79 @@ class RendererTest(unittest.TestCase):
             self.assertEqual(surf.get_at((x, 20)), pygame.Color(255, 255, 0, 255))
             self.assertEqual(surf.get_at((x, 59)), pygame.Color(255, 255, 0, 255))
 
+    def test_fill_rects(self):
+        self.renderer.draw_color = "YELLOW"
+        rects = array.array("f", [10, 10, 11, 11, 50, 60, 5, 5])
+        self.renderer.fill_rects(rects)
+        self.renderer.fill_rects(struct.pack("4f", 80, 80, 2, 2))
+        self.renderer.fill_rects(b"")
+        surf = self.renderer.to_surface()
+        for point in ((10, 10), (20, 20), (52, 62), (81, 81)):
+            self.assertEqual(surf.get_at(point), pygame.Color(255, 255, 0, 255))
+        self.assertEqual(surf.get_at((30, 30)), pygame.Color(0, 0, 0, 255))
+
+        with self.assertRaises(ValueError):
+            self.renderer.fill_rects(array.array("f", [1, 2, 3]))
+        with self.assertRaises(TypeError):
+            self.renderer.fill_rects(array.array("d", [1, 2, 3, 4]))
+        with self.assertRaises(TypeError):
+            self.renderer.fill_rects([10, 10, 11, 11])
+
+    def test_draw_lines(self):
+        self.renderer.draw_color = "YELLOW"
+        self.renderer.draw_lines(array.array("f", [10, 10, 40, 10, 40, 40]))
+        self.renderer.draw_lines(array.array("f"))
+        surf = self.renderer.to_surface()
+        for point in ((10, 10), (25, 10), (40, 25), (40, 40)):
+            self.assertEqual(surf.get_at(point), pygame.Color(255, 255, 0, 255))
+        self.assertEqual(surf.get_at((25, 25)), pygame.Color(0, 0, 0, 255))
+
+        with self.assertRaises(ValueError):
+            self.renderer.draw_lines(array.array("f", [1, 2, 3]))
+
+    def test_draw_geometry(self):
+        def vertex(x, y, color, u=0.0, v=0.0):
+            return struct.pack("2f4B2f", x, y, *color, u, v)
+
+        # a quad, drawn as two triangles sharing vertices
+        red = (255, 0, 0, 255)
+        vertices = b"".join(
+            vertex(x, y, red) for x, y in ((10, 10), (40, 10), (40, 40), (10, 40))
+        )
+        self.renderer.draw_geometry(vertices, array.array("i", [0, 1, 2, 2, 3, 0]))
+        surf = self.renderer.to_surface()
+        for point in ((15, 15), (35, 15), (35, 35), (15, 35)):
+            self.assertEqual(surf.get_at(point), pygame.Color("red"))
+        self.assertEqual(surf.get_at((45, 45)), pygame.Color(0, 0, 0, 255))
+
+        # textured from a surface, without indices
+        source = pygame.Surface((4, 4))
+        source.fill("blue")
+        white = (255, 255, 255, 255)
+        vertices = (
+            vertex(50, 50, white, 0, 0)
+            + vertex(90, 50, white, 1, 0)
+            + vertex(50, 90, white, 0, 1)
+        )
+        self.renderer.draw_geometry(vertices, texture=source)
+        surf = self.renderer.to_surface()
+        self.assertEqual(surf.get_at((55, 55)), pygame.Color("blue"))
+
+        # the surface's alpha applies, as it does in blit()
+        source.set_alpha(0)
+        self.renderer.draw_color = "black"
+        self.renderer.clear()
+        self.renderer.draw_geometry(vertices, texture=source)
+        surf = self.renderer.to_surface()
+        self.assertEqual(surf.get_at((55, 55)), pygame.Color(0, 0, 0, 255))
+
+        with self.assertRaises(ValueError):
+            self.renderer.draw_geometry(vertices[:-1])
+        with self.assertRaises(TypeError):
+            self.renderer.draw_geometry(vertices, array.array("d", [0, 1, 2]))
+        with self.assertRaises(TypeError):
+            self.renderer.draw_geometry(vertices, texture="not a texture")
+
     def test_viewport(self):
         self.assertEqual(self.renderer.get_viewport(), pygame.Rect(0, 0, 100, 100))
         self.renderer.set_viewport(pygame.Rect(20, 20, 60, 60))
@@ -2706,6 +2706,74 @@ class GeneralSurfaceTests(unittest.TestCase):
         # kwargs
         surface.scroll(dx=1, dy=1, scroll_flag=0)
 
+    def test_get_generation(self):
+        surf = pygame.Surface((20, 20))
+        sub = surf.subsurface((5, 5, 10, 10))
+
+        def changed(write):
+            gen, sub_gen = surf.get_generation(), sub.get_generation()
+            write()
+            return surf.get_generation() != gen and sub.get_generation() != sub_gen
+
+        self.assertEqual(surf.get_generation(), surf.get_generation())
+        self.assertTrue(changed(lambda: surf.fill("red")))
+        self.assertTrue(changed(lambda: surf.fill("red", special_flags=BLEND_ADD)))
+        self.assertTrue(changed(lambda: surf.set_at((6, 6), "blue")))
+        self.assertTrue(changed(lambda: surf.blit(pygame.Surface((4, 4)), (6, 6))))
+        self.assertTrue(
+            changed(lambda: pygame.draw.line(surf, "green", (0, 0), (9, 9)))
+        )
+        self.assertTrue(changed(lambda: pygame.PixelArray(surf).close()))
+        # writes to the subsurface change its parent too
+        self.assertTrue(changed(lambda: sub.fill("white")))
+
+        gen = surf.get_generation()
+        surf.get_at((0, 0))
+        surf.get_hash()
+        surf.copy()
+        sub.get_at((0, 0))
+        pygame.mask.from_surface(surf)
+        pygame.image.tobytes(surf, "RGBA")
+        self.assertEqual(surf.get_generation(), gen)
+
+        surf.lock()
+        surf.unlock()
+        self.assertNotEqual(surf.get_generation(), gen)
+
+    def test_get_hash(self):
+        for size in ((1, 1), (7, 3), (33, 17), (640, 480)):
+            for depth in (8, 16, 24, 32):
+                surf = pygame.Surface(size, 0, depth)
+                surf.fill((10, 200, 30))
+                pygame.draw.line(surf, (90, 1, 250), (0, 0), size)
+                self.assertEqual(surf.get_hash(), surf.copy().get_hash())
+
+                copy = surf.copy()
+                copy.set_at((size[0] - 1, size[1] - 1), (1, 2, 3))
+                self.assertNotEqual(surf.get_hash(), copy.get_hash())
+
+        # the size and pixel format count, not only the bytes
+        self.assertNotEqual(
+            pygame.Surface((4, 8), 0, 32).get_hash(),
+            pygame.Surface((8, 4), 0, 32).get_hash(),
+        )
+        self.assertNotEqual(
+            pygame.Surface((4, 4), 0, 32).get_hash(),
+            pygame.Surface((4, 4), SRCALPHA, 32).get_hash(),
+        )
+
+    def test_get_hash_subsurface(self):
+        surf = pygame.Surface((100, 50), SRCALPHA)
+        for x in range(100):
+            pygame.draw.line(surf, (x, 255 - x, x * 2 % 256, x), (x, 0), (x, 49))
+        sub = surf.subsurface((3, 7, 61, 20))
+        self.assertEqual(sub.get_hash(), sub.copy().get_hash())
+
+        # pixels outside the subsurface don't change its hash
+        hash_ = sub.get_hash()
+        surf.fill("black", (70, 0, 30, 50))
+        self.assertEqual(sub.get_hash(), hash_)
+
 
 class SurfaceSubtypeTest(unittest.TestCase):
     """pygame-ce issue #295: Methods that return a new Surface preserve subclasses"""
@@ -1,5 +1,6 @@
 import os
 import unittest
+import warnings
 
 import pygame
 
@@ -119,5 +120,163 @@ class SystemModuleTest(unittest.TestCase):
             )
 
 
+class PerfCountersTest(unittest.TestCase):
+    def setUp(self):
+        try:
+            pygame.system.enable_perf_counters()
+        except NotImplementedError:
+            self.skipTest("pygame was built without perf counters")
+        pygame.system.reset_perf_counters()
+
+    def tearDown(self):
+        pygame.system.enable_perf_counters(False)
+        pygame.system.reset_perf_counters()
+
+    def test_counts_kernels(self):
+        surf = pygame.Surface((20, 10), depth=32)
+        other = pygame.Surface((20, 10), depth=32)
+
+        surf.fill((10, 20, 30))
+        surf.fill((1, 1, 1), special_flags=pygame.BLEND_ADD)
+        surf.blit(other, (0, 0))
+        pygame.draw.rect(surf, (255, 0, 0), (0, 0, 5, 4))
+        counters = pygame.system.get_perf_counters()
+
+        for name, counter in counters.items():
+            self.assertIsInstance(name, str)
+            self.assertEqual(set(counter), {"calls", "pixels", "ns"})
+            self.assertGreaterEqual(counter["calls"], 1)
+            self.assertGreaterEqual(counter["ns"], 0)
+
+        self.assertEqual(counters["fill.solid"]["calls"], 1)
+        self.assertEqual(counters["fill.solid"]["pixels"], 200)
+        self.assertEqual(counters["draw.rect"]["pixels"], 20)
+        fill_add = [name for name in counters if name.startswith("fill.add.")]
+        self.assertEqual(len(fill_add), 1)
+        self.assertEqual(counters[fill_add[0]]["pixels"], 200)
+        blits = [name for name in counters if name.startswith("blit.")]
+        self.assertEqual(sum(counters[name]["calls"] for name in blits), 1)
+
+    def test_reset(self):
+        pygame.Surface((4, 4)).fill((1, 2, 3))
+        self.assertIn("fill.solid", pygame.system.get_perf_counters())
+
+        pygame.system.reset_perf_counters()
+        self.assertEqual(pygame.system.get_perf_counters(), {})
+
+    def test_disabled(self):
+        pygame.system.enable_perf_counters(False)
+        pygame.Surface((4, 4)).fill((1, 2, 3))
+
+        self.assertEqual(pygame.system.get_perf_counters(), {})
+
+
+class BlitDiagnosticsTest(unittest.TestCase):
+    def tearDown(self):
+        pygame.system.set_blit_diagnostics()
+
+    def test_invalid_args(self):
+        with self.assertRaises(ValueError):
+            pygame.system.set_blit_diagnostics("fix")
+        with self.assertRaises(ValueError):
+            pygame.system.set_blit_diagnostics("warn", threshold=0)
+
+    def test_warn(self):
+        pygame.system.set_blit_diagnostics("warn", threshold=3)
+        dst = pygame.Surface((8, 8), depth=32)
+        slow = pygame.Surface((8, 8), depth=24)
+        fast = pygame.Surface((8, 8), depth=32)
+
+        with warnings.catch_warnings(record=True) as caught:
+            warnings.simplefilter("always")
+            for _ in range(5):
+                dst.blit(fast, (0, 0))
+            self.assertEqual(caught, [])
+
+            for _ in range(2):
+                dst.blit(slow, (0, 0))
+            self.assertEqual(caught, [])
+
+            for _ in range(3):
+                dst.blit(slow, (0, 0))
+            self.assertEqual(len(caught), 1)
+            self.assertIs(caught[0].category, RuntimeWarning)
+
+    def test_convert(self):
+        pygame.system.set_blit_diagnostics("convert", threshold=1)
+        dst = pygame.Surface((8, 8), depth=32)
+        src = pygame.Surface((8, 8), depth=24)
+
+        src.fill((255, 0, 0))
+        dst.blit(src, (0, 0))
+        self.assertEqual(dst.get_at((4, 4)), (255, 0, 0, 255))
+
+        # each write to the source has to show up in the next blit
+        src.fill((0, 255, 0))
+        dst.blit(src, (0, 0))
+        self.assertEqual(dst.get_at((4, 4)), (0, 255, 0, 255))
+
+        src.set_at((4, 4), (0, 0, 255))
+        dst.blit(src, (0, 0))
+        self.assertEqual(dst.get_at((4, 4)), (0, 0, 255, 255))
+
+        src.fill((10, 10, 10), special_flags=pygame.BLEND_ADD)
+        dst.blit(src, (0, 0))
+        self.assertEqual(dst.get_at((4, 4)), (10, 10, 255, 255))
+
+        other = pygame.Surface((8, 8), depth=24)
+        other.fill((1, 2, 3))
+        src.blit(other, (0, 0))
+        dst.blit(src, (0, 0))
+        self.assertEqual(dst.get_at((4, 4)), (1, 2, 3, 255))
+
+    def test_convert__locked_source(self):
+        pygame.system.set_blit_diagnostics("convert", threshold=1)
+        dst = pygame.Surface((8, 8), depth=32)
+        src = pygame.Surface((8, 8), depth=24)
+
+        src.fill((255, 0, 0))
+        dst.blit(src, (0, 0))
+        self.assertEqual(dst.get_at((4, 4)), (255, 0, 0, 255))
+
+        # a locked source can be written without pygame knowing, so the
+        # converted copy isn't blitted in its place
+        src.lock()
+        with self.assertRaises(pygame.error):
+            dst.blit(src, (0, 0))
+        src.unlock()
+
+    def test_convert__frombuffer(self):
+        pygame.system.set_blit_diagnostics("convert", threshold=1)
+        dst = pygame.Surface((8, 8), depth=32)
+        pixels = bytearray(b"\xff\x00\x00" * 64)
+        src = pygame.image.frombuffer(pixels, (8, 8), "RGB")
+
+        with warnings.catch_warnings():
+            warnings.simplefilter("ignore")
+            dst.blit(src, (0, 0))
+            self.assertEqual(dst.get_at((4, 4)), (255, 0, 0, 255))
+
+            # the buffer is written without pygame knowing
+            pixels[:] = b"\x00\x00\xff" * 64
+            dst.blit(src, (0, 0))
+            self.assertEqual(dst.get_at((4, 4)), (0, 0, 255, 255))
+
+    def test_convert_alpha_source(self):
+        pygame.system.set_blit_diagnostics("convert", threshold=1)
+        dst = pygame.Surface((8, 8), depth=32)
+        dst.fill((0, 0, 100))
+        # RGBA byte order, while dst is the default XRGB
+        masks = (0xFF, 0xFF00, 0xFF0000, 0xFF000000)
+        src = pygame.Surface((8, 8), pygame.SRCALPHA, depth=32, masks=masks)
+        src.fill((200, 0, 0, 0))
+        src.fill((200, 0, 0, 255), (0, 0, 4, 8))
+
+        for _ in range(2):
+            dst.blit(src, (0, 0))
+        self.assertEqual(dst.get_at((1, 1)), (200, 0, 0, 255))
+        self.assertEqual(dst.get_at((6, 6)), (0, 0, 100, 255))
+
+
 if __name__ == "__main__":
     unittest.main()
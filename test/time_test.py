@@ -240,6 +240,63 @@ class ClockTypeTest(unittest.TestCase):
             c.tick_busy_loop(bool_fps), (second_length / bool_fps) - shortfall_tolerance
         )
 
+    def test_tick_precise(self):
+        """Test tick_precise"""
+        c = Clock()
+        sample_fps = 40
+        frame_length = 1000 / sample_fps
+        shortfall_tolerance = 1  # (ms)
+
+        self.assertEqual(c.tick_precise(), c.get_time())
+        for _ in range(5):
+            self.assertGreaterEqual(
+                c.tick_precise(sample_fps), frame_length - shortfall_tolerance
+            )
+        self.assertGreaterEqual(
+            c.tick_precise(sample_fps, spin=0), frame_length - shortfall_tolerance
+        )
+        pygame.time.wait(200)  # a late frame does not wait any more
+        self.assertLess(c.tick_precise(sample_fps), 200 + frame_length)
+
+        self.assertRaises(ValueError, c.tick_precise, sample_fps, -1)
+
+    def test_frame_stats(self):
+        """Test get_frame_percentiles and get_frame_histogram"""
+        c = Clock()
+        self.assertEqual(c.get_frame_percentiles(), (0.0, 0.0, 0.0))
+        self.assertEqual(c.get_frame_histogram(), [0] * 32)
+
+        for _ in range(10):
+            c.tick_busy_loop(100)
+
+        p50, p95, p99 = c.get_frame_percentiles()
+        self.assertGreaterEqual(p50, 9)
+        self.assertLessEqual(p50, p95)
+        self.assertLessEqual(p95, p99)
+        self.assertEqual(len(c.get_frame_percentiles([0, 100])), 2)
+        self.assertRaises(ValueError, c.get_frame_percentiles, [101])
+
+        histogram = c.get_frame_histogram(bin_width=5, bins=4)
+        self.assertEqual(len(histogram), 4)
+        self.assertEqual(sum(histogram), 10)
+        self.assertRaises(ValueError, c.get_frame_histogram, 0)
+        self.assertRaises(ValueError, c.get_frame_histogram, 1, 0)
+
+    def test_frame_percentiles__nearest_rank(self):
+        """Test get_frame_percentiles picks the nearest rank of an even number
+        of frames"""
+        c = Clock()
+        for delay in (10, 50, 90, 130):
+            pygame.time.wait(delay)
+            c.tick()
+
+        p0, p25, p50, p100 = c.get_frame_percentiles([0, 25, 50, 100])
+        # the 1st, 1st, 2nd and 4th of the 4 sorted frame times
+        self.assertEqual(p0, p25)
+        self.assertGreaterEqual(p50, 49)
+        self.assertLess(p50, 90)
+        self.assertGreaterEqual(p100, 129)
+
 
 class TimeModuleTest(unittest.TestCase):
     __tags__ = ["timing"]